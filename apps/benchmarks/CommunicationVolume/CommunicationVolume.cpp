@@ -0,0 +1,269 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file CommunicationVolume.cpp
+//! \brief Reports the number of bytes sent via MPI per MLUP for the PDF synchronization of D3Q19/D3Q27 lattice models
+//
+//======================================================================================================================
+
+#include "blockforest/Initialization.h"
+#include "blockforest/StructuredBlockForest.h"
+#include "blockforest/communication/UniformBufferedScheme.h"
+#include "blockforest/communication/UniformDirectScheme.h"
+#include "core/Abort.h"
+#include "core/DataTypes.h"
+#include "core/Environment.h"
+#include "core/config/Config.h"
+#include "core/logging/Logging.h"
+#include "core/math/Constants.h"
+#include "core/math/Vector3.h"
+#include "core/mpi/MPIManager.h"
+#include "core/mpi/Reduce.h"
+#include "core/timing/TimingPool.h"
+#include "domain_decomposition/SharedSweep.h"
+#include "field/AddToStorage.h"
+#include "field/FlagField.h"
+#include "field/FlagUID.h"
+#include "field/communication/PackInfo.h"
+#include "lbm/BlockForestEvaluation.h"
+#include "lbm/PerformanceEvaluation.h"
+#include "lbm/communication/PdfFieldMPIDatatypeInfo.h"
+#include "lbm/communication/PdfFieldPackInfo.h"
+#include "lbm/field/AddToStorage.h"
+#include "lbm/field/PdfField.h"
+#include "lbm/lattice_model/D3Q19.h"
+#include "lbm/lattice_model/D3Q27.h"
+#include "lbm/sweeps/CellwiseSweep.h"
+#include "stencil/D3Q27.h"
+#include "timeloop/SweepTimeloop.h"
+
+#include <cmath>
+#include <functional>
+#include <string>
+
+
+namespace walberla {
+
+typedef walberla::uint8_t   flag_t;
+typedef FlagField< flag_t > FlagField_T;
+
+const FlagUID Fluid_Flag( "fluid" );
+
+enum Scheme { BUFFERED_FULL_CELLS, BUFFERED, DIRECT };
+
+std::string schemeToString( const Scheme scheme )
+{
+   if( scheme == BUFFERED_FULL_CELLS )
+      return "UniformBufferedScheme (all PDFs of a cell)";
+   if( scheme == BUFFERED )
+      return "UniformBufferedScheme (PdfFieldPackInfo)";
+   return "UniformDirectScheme (PdfFieldMPIDatatypeInfo)";
+}
+
+
+
+/// Initializes a shear wave, so that the benchmark does not operate on a fluid at rest.
+template< typename PdfField_T >
+void initialize( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & pdfFieldId, const real_t velocity )
+{
+   const real_t k = real_t(2) * math::PI / real_c( blocks->getNumberOfYCells() );
+
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      PdfField_T * pdfField = block->getData< PdfField_T >( pdfFieldId );
+      for( auto cell = pdfField->beginXYZ(); cell != pdfField->end(); ++cell )
+      {
+         Cell global( cell.x(), cell.y(), cell.z() );
+         blocks->transformBlockLocalToGlobalCell( global, *block );
+
+         pdfField->setDensityAndVelocity( cell.x(), cell.y(), cell.z(),
+                                          Vector3< real_t >( velocity * std::sin( k * real_c( global.y() ) ), real_t(0), real_t(0) ), real_t(1) );
+      }
+   }
+}
+
+
+
+/// Runs the cell-wise sweep with the given communication scheme and logs the number of bytes sent per MLUP.
+/// All 26 neighbors are part of the communication, the pack infos/data type infos decide what is actually sent.
+template< typename LatticeModel_T >
+void runBenchmark( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & flagFieldId, const real_t omega,
+                   const real_t velocity, const field::Layout & layout, const Scheme scheme,
+                   const uint_t outerTimeSteps, const uint_t innerTimeSteps )
+{
+   typedef lbm::PdfField< LatticeModel_T > PdfField_T;
+
+   const std::string name = std::string( LatticeModel_T::Stencil::NAME ) + ", " + schemeToString( scheme );
+
+   const LatticeModel_T latticeModel = LatticeModel_T( lbm::collision_model::SRT( omega ) );
+   BlockDataID pdfFieldId = lbm::addPdfFieldToStorage( blocks, "pdf field (" + name + ")", latticeModel, layout );
+   initialize< PdfField_T >( blocks, pdfFieldId, velocity );
+
+   blockforest::communication::UniformBufferedScheme< stencil::D3Q27 > bufferedScheme( blocks );
+   blockforest::communication::UniformDirectScheme< stencil::D3Q27 >   directScheme( blocks );
+
+   std::function< void () > communication;
+   std::function< uint64_t () > bytesSent;
+   std::function< void () > resetStatistics;
+
+   if( scheme == DIRECT )
+   {
+      directScheme.addDataToCommunicate( make_shared< lbm::communication::PdfFieldMPIDatatypeInfo< PdfField_T > >( pdfFieldId ) );
+      communication   = std::ref( directScheme );
+      bytesSent       = std::bind( &blockforest::communication::UniformDirectScheme< stencil::D3Q27 >::getBytesSent, &directScheme );
+      resetStatistics = std::bind( &blockforest::communication::UniformDirectScheme< stencil::D3Q27 >::resetStatistics, &directScheme );
+   }
+   else
+   {
+      if( scheme == BUFFERED_FULL_CELLS )
+         bufferedScheme.addPackInfo( make_shared< field::communication::PackInfo< PdfField_T > >( pdfFieldId ) );
+      else
+         bufferedScheme.addPackInfo( make_shared< lbm::PdfFieldPackInfo< LatticeModel_T > >( pdfFieldId ) );
+      communication   = std::ref( bufferedScheme );
+      bytesSent       = std::bind( &blockforest::communication::UniformBufferedScheme< stencil::D3Q27 >::getBytesSent, &bufferedScheme );
+      resetStatistics = std::bind( &blockforest::communication::UniformBufferedScheme< stencil::D3Q27 >::resetStatistics, &bufferedScheme );
+   }
+
+   SweepTimeloop timeloop( blocks->getBlockStorage(), outerTimeSteps * innerTimeSteps );
+
+   timeloop.add() << BeforeFunction( communication, "communication" )
+                  << Sweep( makeSharedSweep( lbm::makeCellwiseSweep< LatticeModel_T >( pdfFieldId ) ), "LB stream & collide (cellwise)" );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "Benchmark parameters:"
+                              "\n- lattice model:        " << LatticeModel_T::Stencil::NAME <<
+                              "\n- communication scheme: " << schemeToString( scheme ) <<
+                              "\n- data layout:          " << ( layout == field::fzyx ? "fzyx (structure of arrays [SoA])" : "zyxf (array of structures [AoS])" ) );
+
+   lbm::PerformanceEvaluation< FlagField_T > performance( blocks, flagFieldId, Fluid_Flag );
+
+   const double mlu = double_c( blocks->getNumberOfXCells() * blocks->getNumberOfYCells() * blocks->getNumberOfZCells() ) *
+                      double_c( innerTimeSteps ) * 1E-6;
+
+   for( uint_t outerRun = 0; outerRun < outerTimeSteps; ++outerRun )
+   {
+      WcTimingPool timeloopTiming;
+      resetStatistics();
+
+      WALBERLA_MPI_WORLD_BARRIER();
+      WcTimer timer;
+      timer.start();
+
+      for( uint_t innerRun = 0; innerRun < innerTimeSteps; ++innerRun )
+         timeloop.singleStep( timeloopTiming );
+
+      timer.end();
+
+      double time = timer.max();
+      mpi::reduceInplace( time, mpi::MAX );
+
+      uint64_t bytes = bytesSent();
+      mpi::reduceInplace( bytes, mpi::SUM );
+
+      const auto reducedTimeloopTiming = timeloopTiming.getReduced();
+      WALBERLA_LOG_RESULT_ON_ROOT( "Time loop timing (" << name << "):\n" << *reducedTimeloopTiming );
+
+      WALBERLA_LOG_RESULT_ON_ROOT( "Communication volume (" << name << "):"
+                                   "\n- bytes sent via MPI (all processes): " << bytes <<
+                                   "\n- bytes sent per MLUP:                " << ( double_c( bytes ) / mlu ) );
+
+      performance.logResultOnRoot( innerTimeSteps, time );
+   }
+
+   // free the memory before the next configuration is benchmarked
+   blocks->clearBlockData( pdfFieldId );
+}
+
+
+
+template< typename LatticeModel_T >
+void runBenchmarks( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & flagFieldId, const real_t omega,
+                    const real_t velocity, const field::Layout & layout, const bool fullCells,
+                    const uint_t outerTimeSteps, const uint_t innerTimeSteps )
+{
+   if( fullCells )
+      runBenchmark< LatticeModel_T >( blocks, flagFieldId, omega, velocity, layout, BUFFERED_FULL_CELLS, outerTimeSteps, innerTimeSteps );
+   runBenchmark< LatticeModel_T >( blocks, flagFieldId, omega, velocity, layout, BUFFERED, outerTimeSteps, innerTimeSteps );
+   runBenchmark< LatticeModel_T >( blocks, flagFieldId, omega, velocity, layout, DIRECT,   outerTimeSteps, innerTimeSteps );
+}
+
+
+
+//////////
+// MAIN //
+//////////
+
+int main( int argc, char ** argv )
+{
+   Environment env( argc, argv );
+
+   if( !env.config() )
+      WALBERLA_ABORT_NO_DEBUG_INFO( "USAGE: " << argv[0] << " INPUT_FILE" );
+
+   auto configBlock = env.config()->getOneBlock( "CommunicationVolume" );
+
+   const Vector3< uint_t > blocksPerDirection = configBlock.getParameter< Vector3< uint_t > >( "blocks", Vector3< uint_t >( uint_t(2) ) );
+   const Vector3< uint_t > cellsPerBlock      = configBlock.getParameter< Vector3< uint_t > >( "cellsPerBlock", Vector3< uint_t >( uint_t(32) ) );
+
+   const real_t omega    = configBlock.getParameter< real_t >( "omega", real_t(1.4) );
+   const real_t velocity = configBlock.getParameter< real_t >( "velocity", real_t(0.01) );
+
+   const bool fzyx = configBlock.getParameter< bool >( "fzyx", true );
+
+   const uint_t outerTimeSteps = configBlock.getParameter< uint_t >( "outerTimeSteps", uint_t(3) );
+   const uint_t innerTimeSteps = configBlock.getParameter< uint_t >( "innerTimeSteps", uint_t(20) );
+
+   const bool d3q19     = configBlock.getParameter< bool >( "D3Q19", true );
+   const bool d3q27     = configBlock.getParameter< bool >( "D3Q27", true );
+   const bool fullCells = configBlock.getParameter< bool >( "fullCells", true );
+
+   auto blocks = blockforest::createUniformBlockGrid( blocksPerDirection[0], blocksPerDirection[1], blocksPerDirection[2],
+                                                      cellsPerBlock[0], cellsPerBlock[1], cellsPerBlock[2],
+                                                      real_t(1), uint_t(0), false, false, // blocks are distributed evenly among all processes
+                                                      true, true, true );                 // periodicity
+
+   // all cells are fluid cells (required for the performance evaluation)
+   BlockDataID flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, "flag field" );
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      FlagField_T * flagField = block->getData< FlagField_T >( flagFieldId );
+      const flag_t fluid = flagField->registerFlag( Fluid_Flag );
+      for( auto cell = flagField->beginXYZ(); cell != flagField->end(); ++cell )
+         addFlag( cell, fluid );
+   }
+
+   lbm::BlockForestEvaluation< FlagField_T >( blocks, flagFieldId, Fluid_Flag ).logInfoOnRoot();
+
+   if( MPIManager::instance()->numProcesses() == 1 )
+      WALBERLA_LOG_WARNING( "Only messages between processes are counted, the buffered schemes will report zero bytes "
+                            "if the benchmark runs on a single process!" );
+
+   const field::Layout layout = fzyx ? field::fzyx : field::zyxf;
+
+   if( d3q19 )
+      runBenchmarks< lbm::D3Q19< lbm::collision_model::SRT, false > >( blocks, flagFieldId, omega, velocity, layout, fullCells,
+                                                                       outerTimeSteps, innerTimeSteps );
+   if( d3q27 )
+      runBenchmarks< lbm::D3Q27< lbm::collision_model::SRT, false > >( blocks, flagFieldId, omega, velocity, layout, fullCells,
+                                                                       outerTimeSteps, innerTimeSteps );
+
+   return EXIT_SUCCESS;
+}
+
+} // namespace walberla
+
+int main( int argc, char ** argv )
+{
+   return walberla::main( argc, argv );
+}
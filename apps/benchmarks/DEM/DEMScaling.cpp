@@ -0,0 +1,160 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file DEMScaling.cpp
+//! \brief Thread/process scaling benchmark of the DEM solver with a settling dense packing of spheres
+//
+//======================================================================================================================
+
+#include "pe/basic.h"
+
+#include <blockforest/Initialization.h>
+#include <core/DataTypes.h>
+#include <core/OpenMP.h>
+#include <core/grid_generator/SCIterator.h>
+#include <core/math/Random.h>
+#include <core/timing/TimingTree.h>
+
+#include <string>
+
+namespace walberla {
+
+int main( int argc, char** argv )
+{
+   using namespace walberla;
+   using namespace walberla::pe;
+
+   typedef boost::tuple<Sphere, Plane> BodyTuple ;
+
+   walberla::MPIManager::instance()->initializeMPI( &argc, &argv );
+
+   uint_t spheres    = uint_c(32);        //!< number of spheres per direction and process
+   uint_t steps      = uint_c(1000);      //!< number of time steps
+   real_t dt         = real_c(0.0001);    //!< integration time
+   real_t radius     = real_c(1);         //!< particle radius
+   real_t density    = real_c(2707);      //!< particle density
+   real_t k          = real_c(8.11e6);    //!< linear spring stiffness
+   real_t gamma      = real_c(6.86e1);    //!< damper
+   real_t verletSkin = real_c(0);         //!< skin distance of the Verlet list CCD, 0 uses hash grids
+
+   for( int i = 1; i < argc; ++i )
+   {
+      if( std::strcmp( argv[i], "-spheres" )            == 0 ) spheres = uint_c( std::stoul( argv[++i] ) );
+      else if( std::strcmp( argv[i], "-steps" )         == 0 ) steps   = uint_c( std::stoul( argv[++i] ) );
+      else if( std::strcmp( argv[i], "-dt" )            == 0 ) dt      = real_c( std::stod( argv[++i] ) );
+      else if( std::strcmp( argv[i], "-verletSkin" )    == 0 ) verletSkin = real_c( std::stod( argv[++i] ) );
+      else if( std::strcmp( argv[i], "-kg" )            == 0 )
+      {
+         k     = real_c( std::stod( argv[++i] ) );
+         gamma = real_c( std::stod( argv[++i] ) );
+      }
+      else WALBERLA_ABORT("Found invalid command line argument: \"" << argv[i] << "\" - aborting...");
+   }
+
+   math::seedRandomGenerator( static_cast<unsigned int>( 1337 * MPIManager::instance()->worldRank() ) );
+
+   shared_ptr<BodyStorage> globalBodyStorage = make_shared<BodyStorage>();
+
+   // one block per process, stacked in x direction
+   const uint_t processes = uint_c( MPIManager::instance()->numProcesses() );
+   const real_t spacing   = real_t(2) * radius;
+   const real_t length    = real_c( spheres ) * spacing;
+   shared_ptr< StructuredBlockForest > forest = blockforest::createUniformBlockGrid(
+                                                   math::AABB( 0, 0, 0, real_c( processes ) * length, length, length ),
+                                                   processes, uint_c( 1), uint_c( 1), // number of blocks in x,y,z direction
+                                                   uint_c( 1), uint_c( 1), uint_c( 1), // how many cells per block (x,y,z)
+                                                   true,                               // max blocks per process
+                                                   false, false, false,                // full periodicity
+                                                   false);
+
+   SetBodyTypeIDs<BodyTuple>::execute();
+
+   WcTimingTree tt;
+
+   auto storageID           = forest->addBlockData(createStorageDataHandling<BodyTuple>(), "Storage");
+   auto ccdID               = ( verletSkin > real_t(0) )
+                              ? forest->addBlockData(ccd::createVerletListCCDDataHandling( globalBodyStorage, storageID, verletSkin ), "VCCD")
+                              : forest->addBlockData(ccd::createHashGridsDataHandling( globalBodyStorage, storageID ), "HCCD");
+   auto fcdID               = forest->addBlockData(fcd::createGenericFCDDataHandling<BodyTuple, fcd::AnalyticCollideFunctor>(), "FCD");
+   cr::DEM cr(globalBodyStorage, forest->getBlockStoragePointer(), storageID, ccdID, fcdID, &tt);
+   cr.setGlobalLinearAcceleration( Vec3( 0, 0, real_t(-9.81) ) );
+
+   const real_t   m           = Sphere::calcMass( radius, density );
+   const real_t   e           = std::exp( -real_t(0.5) * gamma / m * math::PI / std::sqrt( k / m - real_t(0.25) * gamma * gamma / ( m * m ) ) );
+   const real_t   static_cof  ( real_t(0.4) / real_t(2) );
+   const real_t   dynamic_cof ( static_cof );
+   MaterialID material = createMaterial( "granular", density, e, static_cof, dynamic_cof, real_t( 0.5 ), 1, k, gamma, 0 );
+
+   const math::AABB & domain = forest->getDomain();
+   pe::createPlane( *globalBodyStorage, 0, Vec3( 1, 0, 0), domain.minCorner(), material );
+   pe::createPlane( *globalBodyStorage, 0, Vec3(-1, 0, 0), domain.maxCorner(), material );
+   pe::createPlane( *globalBodyStorage, 0, Vec3( 0, 1, 0), domain.minCorner(), material );
+   pe::createPlane( *globalBodyStorage, 0, Vec3( 0,-1, 0), domain.maxCorner(), material );
+   pe::createPlane( *globalBodyStorage, 0, Vec3( 0, 0, 1), domain.minCorner(), material );
+   pe::createPlane( *globalBodyStorage, 0, Vec3( 0, 0,-1), domain.maxCorner(), material );
+
+   // dense packing of slightly overlapping spheres with random velocities -> many contacts from the first step on
+   uint_t numParticles = uint_c(0);
+   for( auto & currentBlock : *forest )
+   {
+      for( auto it = grid_generator::SCIterator( currentBlock.getAABB(), Vec3( radius, radius, radius ), spacing ); it != grid_generator::SCIterator(); ++it )
+      {
+         SphereID sp = pe::createSphere( *globalBodyStorage, forest->getBlockStorage(), storageID, 0, *it, real_c(1.005) * radius, material );
+         if( sp != NULL )
+         {
+            sp->setLinearVel( Vec3( math::realRandom( real_t(-0.1), real_t(0.1) ),
+                                    math::realRandom( real_t(-0.1), real_t(0.1) ),
+                                    math::realRandom( real_t(-0.1), real_t(0.1) ) ) );
+            ++numParticles;
+         }
+      }
+   }
+   mpi::allReduceInplace( numParticles, mpi::SUM );
+
+   syncNextNeighbors<BodyTuple>( forest->getBlockForest(), storageID );
+
+   uint_t contacts = uint_c(0);
+   WALBERLA_MPI_BARRIER();
+   WcTimer timer;
+   for( uint_t i = 0; i < steps; ++i )
+   {
+      cr.timestep( dt );
+      syncNextNeighbors<BodyTuple>( forest->getBlockForest(), storageID, &tt );
+      contacts += cr.getNumberOfContactsTreated();
+   }
+   WALBERLA_MPI_BARRIER();
+   timer.end();
+
+   mpi::reduceInplace( contacts, mpi::SUM );
+
+   auto reducedTT = tt.getReduced();
+
+   WALBERLA_LOG_RESULT_ON_ROOT(std::setw(30) << "processes: "                  << processes);
+   WALBERLA_LOG_RESULT_ON_ROOT(std::setw(30) << "threads per process: "        << omp_get_max_threads());
+   WALBERLA_LOG_RESULT_ON_ROOT(std::setw(30) << "particles: "                  << numParticles);
+   WALBERLA_LOG_RESULT_ON_ROOT(std::setw(30) << "steps: "                      << steps);
+   WALBERLA_LOG_RESULT_ON_ROOT(std::setw(30) << "contacts per step: "          << real_c( contacts ) / real_c( steps ));
+   WALBERLA_LOG_RESULT_ON_ROOT(std::setw(30) << "runtime: "                    << timer.total());
+   WALBERLA_LOG_RESULT_ON_ROOT(std::setw(30) << "particle updates per second: "<< real_c( numParticles * steps ) / timer.total());
+   WALBERLA_LOG_RESULT_ON_ROOT( "Timing tree:\n" << reducedTT );
+
+   return EXIT_SUCCESS;
+}
+}
+
+int main( int argc, char** argv )
+{
+   return walberla::main(argc, argv);
+}
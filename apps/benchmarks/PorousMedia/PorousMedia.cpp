@@ -0,0 +1,268 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file PorousMedia.cpp
+//! \brief Compares the cell-wise LBM sweep with the list-based SparseSweep in a low-porosity voxel geometry
+//
+//======================================================================================================================
+
+#include "blockforest/Initialization.h"
+#include "blockforest/StructuredBlockForest.h"
+#include "blockforest/communication/UniformBufferedScheme.h"
+#include "core/Abort.h"
+#include "core/DataTypes.h"
+#include "core/Environment.h"
+#include "core/cell/CellInterval.h"
+#include "core/config/Config.h"
+#include "core/logging/Logging.h"
+#include "core/math/Vector3.h"
+#include "core/mpi/MPIManager.h"
+#include "core/mpi/Reduce.h"
+#include "core/timing/TimingPool.h"
+#include "domain_decomposition/SharedSweep.h"
+#include "field/AddToStorage.h"
+#include "field/FlagField.h"
+#include "field/FlagUID.h"
+#include "lbm/BlockForestEvaluation.h"
+#include "lbm/PerformanceEvaluation.h"
+#include "lbm/boundary/factories/DefaultBoundaryHandling.h"
+#include "lbm/communication/PdfFieldPackInfo.h"
+#include "lbm/communication/SparsePdfFieldPackInfo.h"
+#include "lbm/field/AddToStorage.h"
+#include "lbm/field/PdfField.h"
+#include "lbm/lattice_model/D3Q19.h"
+#include "lbm/sweeps/CellwiseSweep.h"
+#include "lbm/sweeps/SparseSweep.h"
+#include "timeloop/SweepTimeloop.h"
+
+#include <string>
+
+
+namespace walberla {
+
+typedef lbm::D3Q19< lbm::collision_model::SRT, false > LatticeModel_T;
+typedef LatticeModel_T::CommunicationStencil           CommunicationStencil_T;
+
+typedef walberla::uint8_t   flag_t;
+typedef FlagField< flag_t > FlagField_T;
+
+typedef lbm::DefaultBoundaryHandlingFactory< LatticeModel_T, FlagField_T > BHFactory_T;
+typedef BHFactory_T::BoundaryHandling                                     BoundaryHandling_T;
+
+const FlagUID Fluid_Flag( "fluid" );
+
+
+
+//////////////
+// GEOMETRY //
+//////////////
+
+/// Random voxel geometry: every cell of the (periodic) domain is solid with probability 1 - porosity.
+/// The decision only depends on the global cell coordinates and the seed, so it is independent of the number of
+/// processes and of the block size.
+class VoxelGeometry
+{
+public:
+
+   VoxelGeometry( const shared_ptr< StructuredBlockForest > & blocks, const real_t porosity, const uint32_t seed ) :
+      blocks_( blocks ), threshold_( uint32_c( porosity * real_t(1000000) ) ), seed_( seed ) {}
+
+   bool isSolid( const IBlock & block, const Cell & localCell ) const
+   {
+      Cell cell( localCell );
+      blocks_->transformBlockLocalToGlobalCell( cell, block );
+      blocks_->mapToPeriodicDomain( cell );
+
+      uint32_t hash = seed_;
+      hash = ( hash ^ uint32_c( cell.x() ) ) * uint32_t(0x01000193);
+      hash = ( hash ^ uint32_c( cell.y() ) ) * uint32_t(0x01000193);
+      hash = ( hash ^ uint32_c( cell.z() ) ) * uint32_t(0x01000193);
+      hash ^= hash >> 16;
+      hash *= uint32_t(0x85ebca6b);
+      hash ^= hash >> 13;
+
+      return ( hash % uint32_t(1000000) ) >= threshold_;
+   }
+
+   void operator()( const BlockDataID & boundaryHandlingId ) const
+   {
+      for( auto block = blocks_->begin(); block != blocks_->end(); ++block )
+      {
+         BoundaryHandling_T * handling = block->getData< BoundaryHandling_T >( boundaryHandlingId );
+
+         CellInterval cells = blocks_->getBlockCellBB( *block );
+         blocks_->transformGlobalToBlockLocalCellInterval( cells, *block );
+         cells.expand( cell_idx_t(1) );
+
+         for( auto cell = cells.begin(); cell != cells.end(); ++cell )
+         {
+            if( isSolid( *block, *cell ) )
+               handling->forceBoundary( BHFactory_T::getNoSlip(), cell->x(), cell->y(), cell->z() );
+         }
+         handling->fillWithDomain( uint_t(1) );
+      }
+   }
+
+private:
+
+   shared_ptr< StructuredBlockForest > blocks_;
+
+   const uint32_t threshold_;
+   const uint32_t seed_;
+};
+
+
+
+///////////////
+// BENCHMARK //
+///////////////
+
+void runBenchmark( const shared_ptr< StructuredBlockForest > & blocks, const VoxelGeometry & geometry, const LatticeModel_T & latticeModel,
+                   const Vector3< real_t > & velocity, const bool sparse, const uint_t outerTimeSteps, const uint_t innerTimeSteps )
+{
+   const std::string kernel = sparse ? "sparse" : "cellwise";
+
+   BlockDataID pdfFieldId = lbm::addPdfFieldToStorage( blocks, "pdf field (" + kernel + ")", latticeModel, velocity, real_t(1),
+                                                       uint_t(1), field::fzyx );
+   BlockDataID flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, "flag field (" + kernel + ")" );
+   BlockDataID boundaryHandlingId = BHFactory_T::addBoundaryHandlingToStorage( blocks, "boundary handling (" + kernel + ")", flagFieldId, pdfFieldId,
+                                                                               Fluid_Flag, Vector3< real_t >(), Vector3< real_t >(), real_t(1), real_t(1) );
+   geometry( boundaryHandlingId );
+
+   SweepTimeloop timeloop( blocks->getBlockStorage(), outerTimeSteps * innerTimeSteps );
+
+   blockforest::communication::UniformBufferedScheme< CommunicationStencil_T > communication( blocks );
+
+   if( sparse )
+   {
+      // only PDFs of fluid cells are communicated, NoSlip is treated by the sweep itself
+      communication.addPackInfo( make_shared< lbm::SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T > >( pdfFieldId, flagFieldId, Fluid_Flag, true ) );
+
+      timeloop.add() << BeforeFunction( communication, "communication" )
+                     << Sweep( makeSharedSweep( lbm::makeSparseSweep< LatticeModel_T, FlagField_T >( pdfFieldId, flagFieldId, Fluid_Flag,
+                                                                                                    BHFactory_T::getNoSlip() ) ), "LB stream & collide (sparse)" );
+   }
+   else
+   {
+      communication.addPackInfo( make_shared< lbm::PdfFieldPackInfo< LatticeModel_T > >( pdfFieldId ) );
+
+      timeloop.add() << BeforeFunction( communication, "communication" )
+                     << Sweep( BoundaryHandling_T::getBlockSweep( boundaryHandlingId ), "boundary handling" );
+      timeloop.add() << Sweep( makeSharedSweep( lbm::makeCellwiseSweep< LatticeModel_T, FlagField_T >( pdfFieldId, flagFieldId, Fluid_Flag ) ),
+                               "LB stream & collide (cellwise)" );
+   }
+
+   lbm::BlockForestEvaluation< FlagField_T > blockForest( blocks, flagFieldId, Fluid_Flag );
+   blockForest.logInfoOnRoot();
+
+   WALBERLA_LOG_INFO_ON_ROOT( "Benchmark parameters:"
+                              "\n- kernel:        " << kernel <<
+                              "\n- communication: " << ( sparse ? "fluid cells only (SparsePdfFieldPackInfo)" : "all cells (PdfFieldPackInfo)" ) );
+
+   lbm::PerformanceEvaluation< FlagField_T > performance( blocks, flagFieldId, Fluid_Flag );
+
+   for( uint_t outerRun = 0; outerRun < outerTimeSteps; ++outerRun )
+   {
+      WcTimingPool timeloopTiming;
+
+      WALBERLA_MPI_WORLD_BARRIER();
+      WcTimer timer;
+      timer.start();
+
+      for( uint_t innerRun = 0; innerRun < innerTimeSteps; ++innerRun )
+         timeloop.singleStep( timeloopTiming );
+
+      timer.end();
+
+      double time = timer.max();
+      mpi::reduceInplace( time, mpi::MAX );
+
+      const auto reducedTimeloopTiming = timeloopTiming.getReduced();
+      WALBERLA_LOG_RESULT_ON_ROOT( "Time loop timing (" << kernel << "):\n" << *reducedTimeloopTiming );
+
+      performance.logResultOnRoot( innerTimeSteps, time );
+   }
+
+   // free the memory before the next kernel is benchmarked
+   blocks->clearBlockData( boundaryHandlingId );
+   blocks->clearBlockData( flagFieldId );
+   blocks->clearBlockData( pdfFieldId );
+}
+
+
+
+//////////
+// MAIN //
+//////////
+
+int main( int argc, char ** argv )
+{
+   Environment env( argc, argv );
+
+   if( !env.config() )
+      WALBERLA_ABORT_NO_DEBUG_INFO( "USAGE: " << argv[0] << " INPUT_FILE" );
+
+   auto configBlock = env.config()->getOneBlock( "PorousMedia" );
+
+   const Vector3< uint_t > blocksPerDirection = configBlock.getParameter< Vector3< uint_t > >( "blocks", Vector3< uint_t >( uint_t(1) ) );
+   const Vector3< uint_t > cellsPerBlock      = configBlock.getParameter< Vector3< uint_t > >( "cellsPerBlock", Vector3< uint_t >( uint_t(64) ) );
+
+   const real_t   porosity = configBlock.getParameter< real_t >( "porosity", real_t(0.2) );
+   const uint_t   seed     = configBlock.getParameter< uint_t >( "seed", uint_t(42) );
+
+   const real_t            omega = configBlock.getParameter< real_t >( "omega", real_t(1.4) );
+   const Vector3< real_t > velocity = configBlock.getParameter< Vector3< real_t > >( "velocity", Vector3< real_t >( real_t(0.01), real_t(0), real_t(0) ) );
+
+   const uint_t outerTimeSteps = configBlock.getParameter< uint_t >( "outerTimeSteps", uint_t(3) );
+   const uint_t innerTimeSteps = configBlock.getParameter< uint_t >( "innerTimeSteps", uint_t(20) );
+
+   const bool cellwise = configBlock.getParameter< bool >( "cellwise", true );
+   const bool sparse   = configBlock.getParameter< bool >( "sparse", true );
+
+   if( porosity <= real_t(0) || porosity > real_t(1) )
+      WALBERLA_ABORT( "The porosity must be in (0,1]!" );
+
+   const uint_t processes = uint_c( MPIManager::instance()->numProcesses() );
+   if( processes > blocksPerDirection[0] * blocksPerDirection[1] * blocksPerDirection[2] )
+      WALBERLA_ABORT( "There must be at least one block per process!" );
+
+   auto blocks = blockforest::createUniformBlockGrid( blocksPerDirection[0], blocksPerDirection[1], blocksPerDirection[2],
+                                                      cellsPerBlock[0], cellsPerBlock[1], cellsPerBlock[2],
+                                                      real_t(1), uint_t(0), false, false, // blocks are distributed evenly among all processes
+                                                      true, true, true );                 // periodicity
+
+   const VoxelGeometry geometry( blocks, porosity, uint32_c( seed ) );
+   const LatticeModel_T latticeModel = LatticeModel_T( lbm::collision_model::SRT( omega ) );
+
+   WALBERLA_LOG_INFO_ON_ROOT( "Porous media benchmark:"
+                              "\n- porosity:       " << porosity <<
+                              "\n- omega:          " << omega <<
+                              "\n- velocity:       " << velocity <<
+                              "\n- time steps:     " << outerTimeSteps << " x " << innerTimeSteps );
+
+   if( cellwise )
+      runBenchmark( blocks, geometry, latticeModel, velocity, false, outerTimeSteps, innerTimeSteps );
+   if( sparse )
+      runBenchmark( blocks, geometry, latticeModel, velocity, true, outerTimeSteps, innerTimeSteps );
+
+   return EXIT_SUCCESS;
+}
+
+} // namespace walberla
+
+int main( int argc, char ** argv )
+{
+   return walberla::main( argc, argv );
+}
@@ -0,0 +1,226 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file TemporalBlocking.cpp
+//! \brief Compares the cell-wise LBM sweep with the temporally blocked WavefrontSweep in a periodic domain
+//
+//======================================================================================================================
+
+#include "blockforest/Initialization.h"
+#include "blockforest/StructuredBlockForest.h"
+#include "blockforest/communication/UniformBufferedScheme.h"
+#include "core/Abort.h"
+#include "core/DataTypes.h"
+#include "core/Environment.h"
+#include "core/config/Config.h"
+#include "core/logging/Logging.h"
+#include "core/math/Constants.h"
+#include "core/math/Vector3.h"
+#include "core/mpi/MPIManager.h"
+#include "core/mpi/Reduce.h"
+#include "core/timing/TimingPool.h"
+#include "domain_decomposition/SharedSweep.h"
+#include "field/AddToStorage.h"
+#include "field/FlagField.h"
+#include "field/FlagUID.h"
+#include "lbm/BlockForestEvaluation.h"
+#include "lbm/PerformanceEvaluation.h"
+#include "lbm/communication/PdfFieldPackInfo.h"
+#include "lbm/communication/WavefrontPdfFieldPackInfo.h"
+#include "lbm/field/AddToStorage.h"
+#include "lbm/field/PdfField.h"
+#include "lbm/lattice_model/D3Q19.h"
+#include "lbm/sweeps/CellwiseSweep.h"
+#include "lbm/sweeps/WavefrontSweep.h"
+#include "stencil/D3Q27.h"
+#include "timeloop/SweepTimeloop.h"
+
+#include <cmath>
+#include <string>
+
+
+namespace walberla {
+
+typedef lbm::D3Q19< lbm::collision_model::SRT, false > LatticeModel_T;
+typedef LatticeModel_T::CommunicationStencil           CommunicationStencil_T;
+typedef lbm::PdfField< LatticeModel_T >                PdfField_T;
+
+typedef walberla::uint8_t   flag_t;
+typedef FlagField< flag_t > FlagField_T;
+
+const FlagUID Fluid_Flag( "fluid" );
+
+
+
+/// Initializes a shear wave, so that the benchmark does not operate on a fluid at rest.
+void initialize( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & pdfFieldId, const real_t velocity )
+{
+   const real_t k = real_t(2) * math::PI / real_c( blocks->getNumberOfYCells() );
+
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      PdfField_T * pdfField = block->getData< PdfField_T >( pdfFieldId );
+      for( auto cell = pdfField->beginXYZ(); cell != pdfField->end(); ++cell )
+      {
+         Cell global( cell.x(), cell.y(), cell.z() );
+         blocks->transformBlockLocalToGlobalCell( global, *block );
+
+         pdfField->setDensityAndVelocity( cell.x(), cell.y(), cell.z(),
+                                          Vector3< real_t >( velocity * std::sin( k * real_c( global.y() ) ), real_t(0), real_t(0) ), real_t(1) );
+      }
+   }
+}
+
+
+
+/// Runs the cell-wise sweep (wavefrontTimeSteps == 0) or the wavefront sweep and logs the performance.
+/// Either way, one time loop iteration corresponds to 'timeStepsPerIteration' LB time steps.
+void runBenchmark( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & flagFieldId, const LatticeModel_T & latticeModel,
+                   const real_t velocity, const field::Layout & layout, const uint_t wavefrontTimeSteps,
+                   const uint_t outerTimeSteps, const uint_t innerTimeSteps )
+{
+   const bool wavefront = ( wavefrontTimeSteps > uint_t(0) );
+   const uint_t timeStepsPerIteration = wavefront ? wavefrontTimeSteps : uint_t(1);
+   const std::string kernel = wavefront ? ( "wavefront (" + std::to_string( wavefrontTimeSteps ) + " time steps)" ) : std::string( "cellwise" );
+
+   if( innerTimeSteps % timeStepsPerIteration != uint_t(0) )
+      WALBERLA_ABORT( "The number of inner time steps (" << innerTimeSteps << ") must be a multiple of the number of time steps "
+                      "performed by one wavefront sweep (" << timeStepsPerIteration << ")!" );
+
+   BlockDataID pdfFieldId = lbm::addPdfFieldToStorage( blocks, "pdf field (" + kernel + ")", latticeModel, timeStepsPerIteration, layout );
+   initialize( blocks, pdfFieldId, velocity );
+
+   SweepTimeloop timeloop( blocks->getBlockStorage(), outerTimeSteps * innerTimeSteps / timeStepsPerIteration );
+
+   // the wavefront sweep updates all of its ghost layers and therefore requires a full D3Q27 synchronization
+   blockforest::communication::UniformBufferedScheme< CommunicationStencil_T > communication( blocks );
+   blockforest::communication::UniformBufferedScheme< stencil::D3Q27 >        wavefrontCommunication( blocks );
+
+   if( wavefront )
+   {
+      wavefrontCommunication.addPackInfo( make_shared< lbm::WavefrontPdfFieldPackInfo< LatticeModel_T > >( pdfFieldId, wavefrontTimeSteps ) );
+
+      timeloop.add() << BeforeFunction( wavefrontCommunication, "communication (" + std::to_string( wavefrontTimeSteps ) + " ghost layers)" )
+                     << Sweep( makeSharedSweep( lbm::makeWavefrontSweep< LatticeModel_T >( pdfFieldId, wavefrontTimeSteps ) ),
+                               "LB stream & collide (wavefront)" );
+   }
+   else
+   {
+      communication.addPackInfo( make_shared< lbm::PdfFieldPackInfo< LatticeModel_T > >( pdfFieldId ) );
+
+      timeloop.add() << BeforeFunction( communication, "communication" )
+                     << Sweep( makeSharedSweep( lbm::makeCellwiseSweep< LatticeModel_T >( pdfFieldId ) ), "LB stream & collide (cellwise)" );
+   }
+
+   WALBERLA_LOG_INFO_ON_ROOT( "Benchmark parameters:"
+                              "\n- kernel:                    " << kernel <<
+                              "\n- data layout:               " << ( layout == field::fzyx ? "fzyx (structure of arrays [SoA])" : "zyxf (array of structures [AoS])" ) <<
+                              "\n- time steps per sweep:      " << timeStepsPerIteration <<
+                              "\n- ghost layers communicated: " << timeStepsPerIteration );
+
+   lbm::PerformanceEvaluation< FlagField_T > performance( blocks, flagFieldId, Fluid_Flag );
+
+   for( uint_t outerRun = 0; outerRun < outerTimeSteps; ++outerRun )
+   {
+      WcTimingPool timeloopTiming;
+
+      WALBERLA_MPI_WORLD_BARRIER();
+      WcTimer timer;
+      timer.start();
+
+      for( uint_t innerRun = 0; innerRun < innerTimeSteps / timeStepsPerIteration; ++innerRun )
+         timeloop.singleStep( timeloopTiming );
+
+      timer.end();
+
+      double time = timer.max();
+      mpi::reduceInplace( time, mpi::MAX );
+
+      const auto reducedTimeloopTiming = timeloopTiming.getReduced();
+      WALBERLA_LOG_RESULT_ON_ROOT( "Time loop timing (" << kernel << "):\n" << *reducedTimeloopTiming );
+
+      performance.logResultOnRoot( innerTimeSteps, time );
+   }
+
+   // free the memory before the next kernel is benchmarked
+   blocks->clearBlockData( pdfFieldId );
+}
+
+
+
+//////////
+// MAIN //
+//////////
+
+int main( int argc, char ** argv )
+{
+   Environment env( argc, argv );
+
+   if( !env.config() )
+      WALBERLA_ABORT_NO_DEBUG_INFO( "USAGE: " << argv[0] << " INPUT_FILE" );
+
+   auto configBlock = env.config()->getOneBlock( "TemporalBlocking" );
+
+   const Vector3< uint_t > blocksPerDirection = configBlock.getParameter< Vector3< uint_t > >( "blocks", Vector3< uint_t >( uint_t(1) ) );
+   const Vector3< uint_t > cellsPerBlock      = configBlock.getParameter< Vector3< uint_t > >( "cellsPerBlock", Vector3< uint_t >( uint_t(64) ) );
+
+   const real_t omega    = configBlock.getParameter< real_t >( "omega", real_t(1.4) );
+   const real_t velocity = configBlock.getParameter< real_t >( "velocity", real_t(0.01) );
+
+   const bool fzyx = configBlock.getParameter< bool >( "fzyx", true );
+
+   const uint_t outerTimeSteps = configBlock.getParameter< uint_t >( "outerTimeSteps", uint_t(3) );
+   const uint_t innerTimeSteps = configBlock.getParameter< uint_t >( "innerTimeSteps", uint_t(24) );
+
+   const bool   cellwise           = configBlock.getParameter< bool >( "cellwise", true );
+   const uint_t wavefrontTimeSteps = configBlock.getParameter< uint_t >( "wavefrontTimeSteps", uint_t(4) );
+
+   if( wavefrontTimeSteps > std::min( cellsPerBlock[0], std::min( cellsPerBlock[1], cellsPerBlock[2] ) ) )
+      WALBERLA_ABORT( "The number of time steps performed by one wavefront sweep must not exceed the number of cells per block!" );
+
+   auto blocks = blockforest::createUniformBlockGrid( blocksPerDirection[0], blocksPerDirection[1], blocksPerDirection[2],
+                                                      cellsPerBlock[0], cellsPerBlock[1], cellsPerBlock[2],
+                                                      real_t(1), uint_t(0), false, false, // blocks are distributed evenly among all processes
+                                                      true, true, true );                 // periodicity
+
+   // all cells are fluid cells (required for the performance evaluation)
+   BlockDataID flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, "flag field" );
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      FlagField_T * flagField = block->getData< FlagField_T >( flagFieldId );
+      const flag_t fluid = flagField->registerFlag( Fluid_Flag );
+      for( auto cell = flagField->beginXYZ(); cell != flagField->end(); ++cell )
+         addFlag( cell, fluid );
+   }
+
+   lbm::BlockForestEvaluation< FlagField_T >( blocks, flagFieldId, Fluid_Flag ).logInfoOnRoot();
+
+   const LatticeModel_T latticeModel = LatticeModel_T( lbm::collision_model::SRT( omega ) );
+   const field::Layout layout = fzyx ? field::fzyx : field::zyxf;
+
+   if( cellwise )
+      runBenchmark( blocks, flagFieldId, latticeModel, velocity, layout, uint_t(0), outerTimeSteps, innerTimeSteps );
+   if( wavefrontTimeSteps > uint_t(0) )
+      runBenchmark( blocks, flagFieldId, latticeModel, velocity, layout, wavefrontTimeSteps, outerTimeSteps, innerTimeSteps );
+
+   return EXIT_SUCCESS;
+}
+
+} // namespace walberla
+
+int main( int argc, char ** argv )
+{
+   return walberla::main( argc, argv );
+}
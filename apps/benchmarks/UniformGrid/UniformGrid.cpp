@@ -593,12 +593,8 @@ struct AddLB
 };
 
 template< typename LatticeModel_T  >
-struct AddLB< LatticeModel_T, typename boost::enable_if_c< boost::mpl::or_<
-                                                                           boost::is_same< typename LatticeModel_T::CollisionModel::tag,
-                                                                                           lbm::collision_model::MRT_tag >,
-                                                                           boost::is_same< typename LatticeModel_T::CollisionModel::tag,
-                                                                                           lbm::collision_model::Cumulant_tag >
-                                                                          >::value >::type >
+struct AddLB< LatticeModel_T, typename boost::enable_if_c< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                           lbm::collision_model::MRT_tag >::value >::type >
 {
    using PdfField = typename Types< LatticeModel_T >::PdfField_T;
    using CommunicationStencil = typename Types< LatticeModel_T >::CommunicationStencil_T;
@@ -662,6 +658,90 @@ struct AddLB< LatticeModel_T, typename boost::enable_if_c< boost::mpl::or_<
    }
 };
 
+template< typename LatticeModel_T  >
+struct AddLB< LatticeModel_T, typename boost::enable_if_c< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                           lbm::collision_model::Cumulant_tag >::value >::type >
+{
+   using PdfField = typename Types< LatticeModel_T >::PdfField_T;
+   using CommunicationStencil = typename Types< LatticeModel_T >::CommunicationStencil_T;
+
+   static void add( shared_ptr< blockforest::StructuredBlockForest > & blocks, SweepTimeloop & timeloop,
+                    const BlockDataID & pdfFieldId, const BlockDataID & flagFieldId, const BlockDataID & boundaryHandlingId,
+                    const bool split, const bool pure, const bool fullComm, const bool fused, const bool directComm )
+   {
+      // setup of the LB communication for synchronizing the pdf field between neighboring blocks
+
+      std::function< void () > commFunction;
+      if( directComm )
+      {
+         if( fullComm )
+         {
+            blockforest::communication::UniformDirectScheme< stencil::D3Q27 > comm( blocks );
+            auto mpiDatatypeInfo = make_shared<field::communication::UniformMPIDatatypeInfo< PdfField > >( pdfFieldId );
+            comm.addDataToCommunicate( mpiDatatypeInfo );
+            commFunction = comm;
+         }
+         else
+         {
+            blockforest::communication::UniformDirectScheme< CommunicationStencil > comm( blocks );
+            auto mpiDatatypeInfo = make_shared<lbm::communication::PdfFieldMPIDatatypeInfo< PdfField > >( pdfFieldId );
+            comm.addDataToCommunicate( mpiDatatypeInfo );
+            commFunction = comm;
+         }
+      }
+      else
+      {
+         if( fullComm )
+         {
+            blockforest::communication::UniformBufferedScheme< stencil::D3Q27 > scheme( blocks );
+            scheme.addPackInfo( make_shared< field::communication::PackInfo< PdfField > >( pdfFieldId ) );
+            commFunction = scheme;
+         }
+         else
+         {
+            blockforest::communication::UniformBufferedScheme< CommunicationStencil > scheme( blocks );
+            scheme.addPackInfo( make_shared< lbm::PdfFieldPackInfo< LatticeModel_T > >( pdfFieldId ) );
+            commFunction = scheme;
+         }
+      }
+
+      // for the cumulant collision model, only a split kernel that is also "pure" is available
+
+      if( fused )
+      {
+         timeloop.add() << BeforeFunction( commFunction, "LB communication" )
+                        << Sweep( MyBoundaryHandling<LatticeModel_T>::BoundaryHandling_T::getBlockSweep( boundaryHandlingId ), "LB boundary sweep" );
+
+         if( split && pure )
+            timeloop.add() << Sweep( lbm::SplitPureSweep< LatticeModel_T >( pdfFieldId ), "split pure LB sweep (stream & collide)" );
+         else
+            timeloop.add() << Sweep( makeSharedSweep( lbm::makeCellwiseSweep< LatticeModel_T, FlagField_T >( pdfFieldId, flagFieldId, Fluid_Flag ) ), "cell-wise LB sweep (stream & collide)" );
+      }
+      else
+      {
+         if( split && pure )
+         {
+            using Sweep_T = lbm::SplitPureSweep< LatticeModel_T >;
+            auto sweep = make_shared< Sweep_T >( pdfFieldId );
+
+            timeloop.add() << Sweep( lbm::CollideSweep< Sweep_T >( sweep ), "split pure LB sweep (collide)" );
+            timeloop.add() << BeforeFunction( commFunction, "LB communication" )
+                           << Sweep( MyBoundaryHandling<LatticeModel_T>::BoundaryHandling_T::getBlockSweep( boundaryHandlingId ), "LB boundary sweep" );
+            timeloop.add() << Sweep( lbm::StreamSweep< Sweep_T >( sweep ), "split pure LB sweep (stream)" );
+         }
+         else
+         {
+            auto sweep = lbm::makeCellwiseSweep< LatticeModel_T, FlagField_T >( pdfFieldId, flagFieldId, Fluid_Flag );
+
+            timeloop.add() << Sweep( lbm::makeCollideSweep( sweep ), "cell-wise LB sweep (collide)" );
+            timeloop.add() << BeforeFunction( commFunction, "LB communication" )
+                           << Sweep( MyBoundaryHandling<LatticeModel_T>::BoundaryHandling_T::getBlockSweep( boundaryHandlingId ), "LB boundary sweep" );
+            timeloop.add() << Sweep( lbm::makeStreamSweep( sweep ), "cell-wise LB sweep (stream)" );
+         }
+      }
+   }
+};
+
 
 
 template< typename LatticeModel_T >
@@ -834,7 +914,8 @@ int main( int argc, char **argv )
                       "Optional arguments:\n"
                       " --trt:         collision model = TRT\n"
                       " --mrt:         collision model = MRT\n"
-                      " --cumulant     collision model = cumulant\n"
+                      " --cumulant:    collision model = cumulant (always compressible, D3Q27)\n"
+                      "                Compare the split (vectorized) kernel against the cell-wise kernel with \"--not-split --not-pure\".\n"
                       " --comp:        LB kernel is switched from incompressible to compressible\n"
                       " --not-split:   LB kernel NOT split by PDF direction but executed cell by cell\n"
                       " --not-pure:    LB kernel is only executed in fluid cells, not in obstacle/boundary cells.\n"
@@ -940,13 +1021,17 @@ int main( int argc, char **argv )
       split        = false;
       pure         = false;
    }
-   if( collisionModel == CMCUM && ( compressible || split || pure ) )
+   if( collisionModel == CMCUM && !compressible )
    {
-      WALBERLA_LOG_WARNING_ON_ROOT( "Option \"--comp\" has to be set for Cumulant! Also, Cumulant requires options \"--not-split\" and \"--not-pure\"!\n"
-                                            "Setting \"compressible\", to true, \"split\", and \"pure\" to false ..." );
+      WALBERLA_LOG_WARNING_ON_ROOT( "Option \"--comp\" has to be set for Cumulant! Setting \"compressible\" to true ..." );
       compressible = true;
-      split        = false;
-      pure         = false;
+   }
+   if( collisionModel == CMCUM && split && !pure )
+   {
+      WALBERLA_LOG_WARNING_ON_ROOT( "For Cumulant, split kernels are only available as \"pure\" kernels! Use either no option at all\n"
+                                    "(= split, pure kernel) or \"--not-split --not-pure\" (= cell-wise kernel).\n"
+                                    "Setting \"split\" to false ..." );
+      split = false;
    }
 
    WALBERLA_NON_MPI_SECTION()
@@ -696,6 +696,8 @@ int main( int argc, char **argv ) {
 
    real_t lubricationCutOffDistance = diameterAvg; //0 switches it off
 
+   real_t verletSkin = real_t(0); // skin distance of the Verlet list coarse collision detection, 0 uses hash grids
+
    for (int i = 1; i < argc; ++i) {
       if (std::strcmp(argv[i], "--funcTest") == 0) funcTest = true;
       else if (std::strcmp(argv[i], "--vtkIOFreq") == 0) vtkWriteFrequency = uint_c(std::atof(argv[++i]));
@@ -719,6 +721,7 @@ int main( int argc, char **argv ) {
       else if (std::strcmp(argv[i], "--effectiveViscosity") == 0) effVisc = to_effvisc(argv[++i]);
       else if (std::strcmp(argv[i], "--disableTurbulenceModel") == 0) useTurbulenceModel = false;
       else if (std::strcmp(argv[i], "--lubricationCutOff") == 0) lubricationCutOffDistance = real_c(std::atof(argv[++i]));
+      else if (std::strcmp(argv[i], "--verletSkin") == 0) verletSkin = real_c(std::atof(argv[++i]));
       else if (std::strcmp(argv[i], "--vtkBaseFolder") == 0) vtkBaseFolder = argv[++i];
       else WALBERLA_ABORT("Found invalid command line argument \"" << argv[i] << "\" - aborting...");
    }
@@ -841,7 +844,9 @@ int main( int argc, char **argv ) {
    shared_ptr<pe::BodyStorage> globalBodyStorage = make_shared<pe::BodyStorage>();
    pe::SetBodyTypeIDs<BodyTypeTuple>::execute();
    auto bodyStorageID = blocks->addBlockData(pe::createStorageDataHandling<BodyTypeTuple>(), "pe Body Storage");
-   auto ccdID = blocks->addBlockData(pe::ccd::createHashGridsDataHandling(globalBodyStorage, bodyStorageID), "CCD");
+   auto ccdID = ( verletSkin > real_t(0) )
+                ? blocks->addBlockData(pe::ccd::createVerletListCCDDataHandling(globalBodyStorage, bodyStorageID, verletSkin), "CCD")
+                : blocks->addBlockData(pe::ccd::createHashGridsDataHandling(globalBodyStorage, bodyStorageID), "CCD");
    auto fcdID = blocks->addBlockData(
          pe::fcd::createGenericFCDDataHandling<BodyTypeTuple, pe::fcd::AnalyticCollideFunctor>(), "FCD");
 
@@ -54,6 +54,7 @@ public:
 
           BlockID() : usedBits_( 0 ) {}
    inline BlockID( const BlockID& id ) : usedBits_( id.usedBits_ ), blocks_( id.blocks_ ) {}
+   BlockID& operator=( const BlockID& id ) = default;
    inline BlockID( const uint_t treeIndex, const uint_t treeIdMarker );
    inline BlockID( const BlockID& id, const uint_t branchId );
           BlockID( const std::vector< uint8_t >& array, const uint_t offset, const uint_t bytes );
@@ -262,6 +263,7 @@ public:
 
    inline BlockID() : id_( uint_c(0) ) {}
    inline BlockID( const BlockID& id ) : id_( id.id_ ) {}
+   BlockID& operator=( const BlockID& id ) = default;
    inline BlockID( const uint_t id ) : id_( id ) {}
    inline BlockID( const uint_t treeIndex, const uint_t treeIdMarker );
    inline BlockID( const BlockID& id, const uint_t branchId );
@@ -31,12 +31,15 @@
 #include "core/Set.h"
 #include "core/debug/CheckFunctions.h"
 #include "core/debug/Debug.h"
+#include "core/mpi/Datatype.h"
 #include "core/mpi/MPIManager.h"
+#include "core/mpi/MPIWrapper.h"
 #include "core/mpi/OpenMPBufferSystem.h"
 #include "core/selectable/IsSetSelected.h"
 #include "core/uid/SUID.h"
 
 
+#include <algorithm>
 #include <map>
 #include <functional>
 #include <set>
@@ -143,6 +146,9 @@ protected:
 
    void resetBufferSystem( shared_ptr< mpi::OpenMPBufferSystem > & bufferSystem );
 
+   void startDatatypeCommunication( const uint_t index );
+   void  waitDatatypeCommunication( const uint_t index );
+
    void start( const INDEX i, const uint_t j );
    void  wait( const INDEX i, const uint_t j );
 
@@ -161,6 +167,29 @@ protected:
 
 
 
+   /// equal level communication with MPI datatypes, see NonUniformPackInfo::equalLevelDatatypeCommunication
+   struct DatatypeCommInfo
+   {
+      uint_t             packInfoIdx;   ///< index into packInfos_
+      Block *            localBlock;
+      BlockID            remoteBlockId;
+      uint_t             remoteProcess;
+      stencil::Direction dir;           ///< direction from local to remote block
+      shared_ptr< mpi::Datatype > datatype;
+
+      static bool sortByLocal ( const DatatypeCommInfo & lhs, const DatatypeCommInfo & rhs );
+      static bool sortByRemote( const DatatypeCommInfo & lhs, const DatatypeCommInfo & rhs );
+   };
+
+   struct DatatypeCommunication
+   {
+      std::vector< DatatypeCommInfo > sends;
+      std::vector< DatatypeCommInfo > recvs;
+      std::vector< MPI_Request >      requests;
+   };
+
+
+
    weak_ptr<StructuredBlockForest> blockForest_;
    uint_t forestModificationStamp_;
 
@@ -179,6 +208,8 @@ protected:
 
    std::vector< std::vector< std::vector< SendBuffer > > > localBuffers_;
 
+   std::vector< DatatypeCommunication > equalLevelDatatypeCommunication_; // one entry per level (+ one for all levels)
+
    std::vector< std::vector< char > > setupBeforeNextCommunication_; // cannot be a vector of 'bool' since access by non-const reference is required
    std::vector< std::vector< bool > > communicationInProgress_;
 
@@ -273,6 +304,9 @@ void NonUniformBufferedScheme<Stencil>::refresh()
       (*p)->clearBufferSizeCheckMap();
 #endif
    
+   equalLevelDatatypeCommunication_.clear();
+   equalLevelDatatypeCommunication_.resize( levels + uint_t(1) );
+
    forestModificationStamp_ = forest->getBlockForest().getModificationStamp();
 }
 
@@ -616,6 +650,11 @@ void NonUniformBufferedScheme<Stencil>::startCommunicationEqualLevel( const uint
 
       localBuffers.clear();
 
+      DatatypeCommunication & datatypeCommunication = equalLevelDatatypeCommunication_[ index ];
+      datatypeCommunication.sends.clear();
+      datatypeCommunication.recvs.clear();
+      datatypeCommunication.requests.clear();
+
       std::map< uint_t, std::vector< SendBufferFunction > > sendFunctions;
 
       auto forest = blockForest_.lock();
@@ -686,15 +725,40 @@ void NonUniformBufferedScheme<Stencil>::startCommunicationEqualLevel( const uint
             {
                auto nProcess = block->getNeighborProcess( neighborIdx, uint_t(0) );
 
-               if( !packInfos_.empty() )
-                  sendFunctions[ nProcess ].push_back( std::bind( NonUniformBufferedScheme<Stencil>::writeHeader, std::placeholders::_1, block->getId(), receiverId, *dir ) );
+               bool headerWritten = false;
+               for( uint_t p = uint_t(0); p != packInfos_.size(); ++p )
+               {
+                  const PackInfo & packInfo = packInfos_[p];
 
-               for( auto packInfo = packInfos_.begin(); packInfo != packInfos_.end(); ++packInfo )
-                  sendFunctions[ nProcess ].push_back( std::bind( &blockforest::communication::NonUniformPackInfo::packDataEqualLevel, *packInfo, block, *dir, std::placeholders::_1 ) );
+                  if( packInfo->equalLevelDatatypeCommunication( block, *dir ) )
+                  {
+                     // send to and receive from the neighbor (the neighbor does the same from its point of view)
+                     DatatypeCommInfo sendInfo = { p, block, receiverId, nProcess, *dir, packInfo->getEqualLevelSendDatatype( block, *dir ) };
+                     DatatypeCommInfo recvInfo = { p, block, receiverId, nProcess, *dir, packInfo->getEqualLevelRecvDatatype( block, *dir ) };
+                     if( sendInfo.datatype )
+                        datatypeCommunication.sends.push_back( sendInfo );
+                     if( recvInfo.datatype )
+                        datatypeCommunication.recvs.push_back( recvInfo );
+                     continue;
+                  }
+
+                  if( !headerWritten )
+                  {
+                     sendFunctions[ nProcess ].push_back( std::bind( NonUniformBufferedScheme<Stencil>::writeHeader, std::placeholders::_1, block->getId(), receiverId, *dir ) );
+                     headerWritten = true;
+                  }
+
+                  sendFunctions[ nProcess ].push_back( std::bind( &blockforest::communication::NonUniformPackInfo::packDataEqualLevel, packInfo, block, *dir, std::placeholders::_1 ) );
+               }
             }
          }
       }
 
+      // all messages between two processes use the same tag -> sends and receives must be posted in matching order
+      std::sort( datatypeCommunication.sends.begin(), datatypeCommunication.sends.end(), DatatypeCommInfo::sortByLocal );
+      std::sort( datatypeCommunication.recvs.begin(), datatypeCommunication.recvs.end(), DatatypeCommInfo::sortByRemote );
+      datatypeCommunication.requests.resize( datatypeCommunication.sends.size() + datatypeCommunication.recvs.size(), MPI_REQUEST_NULL );
+
       resetBufferSystem( bufferSystem );
 
       for( auto sender = sendFunctions.begin(); sender != sendFunctions.end(); ++sender )
@@ -706,6 +770,7 @@ void NonUniformBufferedScheme<Stencil>::startCommunicationEqualLevel( const uint
       setupBeforeNextCommunication = char(0);
    }
 
+   startDatatypeCommunication( index );
    start( EQUAL_LEVEL, index );
 }
 
@@ -1018,6 +1083,7 @@ void NonUniformBufferedScheme<Stencil>::resetBufferSystem( shared_ptr< mpi::Open
    bufferSystem->setReceiverInfo( !constantSizes );
    bufferSystem->enforceSerialSends( false );
    bufferSystem->enforceSerialRecvs( !threadsafeReceive );
+   bufferSystem->usePersistentRequests( constantSizes );
 }
 
 
@@ -1106,11 +1172,83 @@ void NonUniformBufferedScheme<Stencil>::wait( const INDEX i, const uint_t j )
 
    bufferSystem->wait();
 
+   if( i == EQUAL_LEVEL )
+      waitDatatypeCommunication( j );
+
    communicationInProgress_[i][j] = false;
 }
 
 
 
+template< typename Stencil >
+void NonUniformBufferedScheme<Stencil>::startDatatypeCommunication( const uint_t index )
+{
+   DatatypeCommunication & datatypeCommunication = equalLevelDatatypeCommunication_[ index ];
+
+   if( datatypeCommunication.requests.empty() )
+      return;
+
+   const MPI_Comm comm = mpi::MPIManager::instance()->comm();
+   const int tag = baseTag_ + int_c( uint_t(3) * equalLevelDatatypeCommunication_.size() + index );
+
+   auto request = datatypeCommunication.requests.begin();
+
+   for( auto it = datatypeCommunication.recvs.begin(); it != datatypeCommunication.recvs.end(); ++it, ++request )
+   {
+      WALBERLA_ASSERT_EQUAL( *request, MPI_REQUEST_NULL );
+      MPI_Irecv( packInfos_[ it->packInfoIdx ]->getEqualLevelRecvPointer( it->localBlock, it->dir ), 1, *(it->datatype),
+                 int_c( it->remoteProcess ), tag, comm, &( *request ) );
+   }
+
+   for( auto it = datatypeCommunication.sends.begin(); it != datatypeCommunication.sends.end(); ++it, ++request )
+   {
+      WALBERLA_ASSERT_EQUAL( *request, MPI_REQUEST_NULL );
+      MPI_Isend( const_cast< void * >( packInfos_[ it->packInfoIdx ]->getEqualLevelSendPointer( it->localBlock, it->dir ) ), 1, *(it->datatype),
+                 int_c( it->remoteProcess ), tag, comm, &( *request ) );
+   }
+
+   WALBERLA_ASSERT( request == datatypeCommunication.requests.end() );
+}
+
+
+
+template< typename Stencil >
+void NonUniformBufferedScheme<Stencil>::waitDatatypeCommunication( const uint_t index )
+{
+   WALBERLA_ASSERT_LESS( index, equalLevelDatatypeCommunication_.size() );
+
+   std::vector< MPI_Request > & requests = equalLevelDatatypeCommunication_[ index ].requests;
+
+   if( !requests.empty() )
+      MPI_Waitall( int_c( requests.size() ), &( requests.front() ), MPI_STATUSES_IGNORE );
+}
+
+
+
+template< typename Stencil >
+bool NonUniformBufferedScheme<Stencil>::DatatypeCommInfo::sortByLocal( const DatatypeCommInfo & lhs, const DatatypeCommInfo & rhs )
+{
+   // lexicographical compare in order: localBlockId, remoteBlockId, dir, packInfoIdx
+   if( lhs.localBlock->getId() != rhs.localBlock->getId() ) return lhs.localBlock->getId() < rhs.localBlock->getId();
+   if( lhs.remoteBlockId != rhs.remoteBlockId ) return lhs.remoteBlockId < rhs.remoteBlockId;
+   if( lhs.dir != rhs.dir ) return lhs.dir < rhs.dir;
+   return lhs.packInfoIdx < rhs.packInfoIdx;
+}
+
+
+
+template< typename Stencil >
+bool NonUniformBufferedScheme<Stencil>::DatatypeCommInfo::sortByRemote( const DatatypeCommInfo & lhs, const DatatypeCommInfo & rhs )
+{
+   // same order as 'sortByLocal' on the remote process: remoteBlockId, localBlockId, direction from remote to local, packInfoIdx
+   if( lhs.remoteBlockId != rhs.remoteBlockId ) return lhs.remoteBlockId < rhs.remoteBlockId;
+   if( lhs.localBlock->getId() != rhs.localBlock->getId() ) return lhs.localBlock->getId() < rhs.localBlock->getId();
+   if( lhs.dir != rhs.dir ) return stencil::inverseDir[lhs.dir] < stencil::inverseDir[rhs.dir];
+   return lhs.packInfoIdx < rhs.packInfoIdx;
+}
+
+
+
 template< typename Stencil >
 void NonUniformBufferedScheme<Stencil>::writeHeader( SendBuffer & buffer, const BlockID & sender, const BlockID & receiver, const stencil::Direction & dir )
 {
@@ -1162,7 +1300,8 @@ void NonUniformBufferedScheme<Stencil>::receive( RecvBuffer & buffer )
       if( senderLevel == receiverLevel )
       {
          for( auto packInfo = packInfos_.begin(); packInfo != packInfos_.end(); ++packInfo )
-            (*packInfo)->unpackDataEqualLevel( block, stencil::inverseDir[dir], buffer );
+            if( !(*packInfo)->equalLevelDatatypeCommunication( block, stencil::inverseDir[dir] ) )
+               (*packInfo)->unpackDataEqualLevel( block, stencil::inverseDir[dir], buffer );
       }
       else if( senderLevel < receiverLevel ) // coarse to fine
       {
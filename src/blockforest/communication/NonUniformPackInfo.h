@@ -25,7 +25,9 @@
 #include "blockforest/Block.h"
 #include "blockforest/BlockID.h"
 
+#include "core/DataTypes.h"
 #include "core/debug/Debug.h"
+#include "core/mpi/Datatype.h"
 #include "core/mpi/RecvBuffer.h"
 #include "core/mpi/SendBuffer.h"
 
@@ -76,6 +78,26 @@ public:
    /// If NOT thread-safe, threadsafeReceiving must return false!
    virtual void communicateLocalEqualLevel( const Block * sender, Block * receiver, stencil::Direction dir ) = 0;
 
+   /**
+    * Equal level communication between blocks on different processes using MPI datatypes (no intermediate buffers)
+    *
+    * If this function returns true, packDataEqualLevel and unpackDataEqualLevel are not called for the given block and
+    * direction if the neighbor block is located on another process. Instead, the data described by the datatypes
+    * returned by getEqualLevelSendDatatype/getEqualLevelRecvDatatype (relative to the corresponding pointers) is sent
+    * directly from the field of the sender to the field of the receiver.
+    * The sender calls this function with the direction from sender to receiver, the receiver with the direction from
+    * receiver to sender. Both calls must return the same result!
+    */
+   virtual bool equalLevelDatatypeCommunication( const Block * /*block*/, stencil::Direction /*dir*/ ) const { return false; }
+
+   /// Only called if equalLevelDatatypeCommunication returns true. Returning a null pointer means that nothing is sent.
+   virtual shared_ptr< mpi::Datatype > getEqualLevelSendDatatype( const Block * /*sender*/,   stencil::Direction /*dir*/ ) const { return shared_ptr< mpi::Datatype >(); }
+   /// Only called if equalLevelDatatypeCommunication returns true. Must return a null pointer iff the sender does.
+   virtual shared_ptr< mpi::Datatype > getEqualLevelRecvDatatype( const Block * /*receiver*/, stencil::Direction /*dir*/ ) const { return shared_ptr< mpi::Datatype >(); }
+
+   virtual const void * getEqualLevelSendPointer( const Block * /*sender*/,   stencil::Direction /*dir*/ ) const { return nullptr; }
+   virtual       void * getEqualLevelRecvPointer(       Block * /*receiver*/, stencil::Direction /*dir*/ ) const { return nullptr; }
+
    inline  void packDataCoarseToFine        ( const Block * coarseSender, const BlockID & fineReceiver, stencil::Direction dir, mpi::SendBuffer & buffer ) const;
    virtual void unpackDataCoarseToFine      (       Block * fineReceiver, const BlockID & coarseSender, stencil::Direction dir, mpi::RecvBuffer & buffer ) = 0;
    virtual void communicateLocalCoarseToFine( const Block * coarseSender, Block * fineReceiver, stencil::Direction dir ) = 0;
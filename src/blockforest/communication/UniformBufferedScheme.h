@@ -40,6 +40,7 @@
 
 #include <functional>
 #include <map>
+#include <set>
 #include <vector>
 
 
@@ -75,6 +76,14 @@ namespace communication {
 *
 * When running multiple Schemes concurrently different MPI tags have to be used
 * for the schemes: the tag can be passed in the constructor.
+*
+* Optionally, the messages can be exchanged with MPI neighborhood collectives (see useNeighborCollectives()): a
+* distributed graph communicator is created from the neighbor processes, and all messages of a communication step
+* are exchanged with a single MPI_Ineighbor_alltoallw call.
+*
+* Messages to processes on the same node can be exchanged via an MPI-3 shared memory window instead (see
+* useSharedMemory()): the ghost layer data is packed into a segment of the window that is shared by all processes of
+* the node and unpacked directly from there by the receiver, only messages to other nodes are sent via MPI.
 */
 //*******************************************************************************************************************
 template< typename Stencil >
@@ -103,6 +112,8 @@ public:
         bufferSystem_( mpi::MPIManager::instance()->comm(), tag ),
         setupBeforeNextCommunication_( true ),
         communicationInProgress_( false ),
+        neighborCollectives_( false ),
+        sharedMemory_( false ),
         requiredBlockSelectors_( Set<SUID>::emptySet() ),
         incompatibleBlockSelectors_( Set<SUID>::emptySet() )
    {
@@ -120,6 +131,8 @@ public:
         bufferSystem_( mpi::MPIManager::instance()->comm(), tag ),
         setupBeforeNextCommunication_( true ),
         communicationInProgress_( false ),
+        neighborCollectives_( false ),
+        sharedMemory_( false ),
         requiredBlockSelectors_( requiredBlockSelectors ),
         incompatibleBlockSelectors_( incompatibleBlockSelectors )
    {
@@ -152,6 +165,18 @@ public:
    LocalCommunicationMode localMode() const { return localMode_; }
    inline void setLocalMode( const LocalCommunicationMode & mode );
 
+   bool neighborCollectivesUsed() const { return neighborCollectives_; }
+   inline void useNeighborCollectives( const bool val );
+
+   bool sharedMemoryUsed() const { return sharedMemory_; }
+   inline void useSharedMemory( const bool val );
+
+   /// Number of bytes sent to/received from other processes (local communication is not included)
+   /// since construction or the last resetStatistics() call
+   uint64_t getBytesSent()     const { return bufferSystem_.getBytesSent();     }
+   uint64_t getBytesReceived() const { return bufferSystem_.getBytesReceived(); }
+   void     resetStatistics()        { bufferSystem_.resetStatistics();         }
+
 
    //** Asynchronous Communication *************************************************************************************
    /*! \name Asynchronous Communication */
@@ -196,6 +221,8 @@ protected:
 
    bool setupBeforeNextCommunication_;
    bool communicationInProgress_;
+   bool neighborCollectives_;
+   bool sharedMemory_;
 
    Set<SUID> requiredBlockSelectors_;
    Set<SUID> incompatibleBlockSelectors_;
@@ -239,6 +266,45 @@ inline void UniformBufferedScheme<Stencil>::setLocalMode( const LocalCommunicati
 
 
 
+//**********************************************************************************************************************
+/*! Enables/disables the exchange of all messages with MPI neighborhood collectives
+*
+* The graph communicator is created collectively whenever the communication is set up (first communication,
+* changes of the block structure, the pack infos or the local mode). Hence, this function as well as all changes
+* of the scheme have to be applied on all processes.
+*/
+//**********************************************************************************************************************
+template< typename Stencil >
+inline void UniformBufferedScheme<Stencil>::useNeighborCollectives( const bool val )
+{
+   if( val != neighborCollectives_ )
+   {
+      neighborCollectives_ = val;
+      setupBeforeNextCommunication_ = true;
+   }
+}
+
+
+
+//**********************************************************************************************************************
+/*! Enables/disables the exchange of messages within a node via MPI-3 shared memory
+*
+* The shared memory window is created collectively in the first communication step and is shared by all processes of
+* a node. Hence, this function has to be called on all processes. See mpi::BufferSystem::useSharedMemory().
+*/
+//**********************************************************************************************************************
+template< typename Stencil >
+inline void UniformBufferedScheme<Stencil>::useSharedMemory( const bool val )
+{
+   if( val != sharedMemory_ )
+   {
+      sharedMemory_ = val;
+      setupBeforeNextCommunication_ = true;
+   }
+}
+
+
+
 template< typename Stencil >
 void UniformBufferedScheme<Stencil>::startCommunication()
 {
@@ -282,6 +348,7 @@ void UniformBufferedScheme<Stencil>::startCommunication()
       localBuffers_.clear();
 
       std::map< uint_t, std::vector< SendBufferFunction > > sendFunctions;
+      std::set< uint_t > recvProcesses;
 
       for( auto it = forest->begin(); it != forest->end(); ++it )
       {
@@ -313,6 +380,9 @@ void UniformBufferedScheme<Stencil>::startCommunication()
 
                for( auto packInfo = packInfos_.begin(); packInfo != packInfos_.end(); ++packInfo )
                {
+                  if( !(*packInfo)->sendsDataInDirection( *dir ) )
+                     continue;
+
                   if( localMode_ == BUFFER )
                   {
                      SendBuffer buffer;
@@ -347,12 +417,28 @@ void UniformBufferedScheme<Stencil>::startCommunication()
             {
                auto nProcess = block->getNeighborProcess( neighborIdx, uint_t(0) );
 
-               if( !packInfos_.empty() )
-                  sendFunctions[ nProcess ].push_back( std::bind( UniformBufferedScheme<Stencil>::writeHeader, std::placeholders::_1, nBlockId, *dir ) );
+               // empty messages are not sent -> the neighbor process only is a sender/receiver if data is
+               // packed in this direction/in the inverse direction (the neighbor sends in the inverse direction)
+               bool sendData = false;
+               bool recvData = false;
+               for( auto packInfo = packInfos_.begin(); packInfo != packInfos_.end(); ++packInfo )
+               {
+                  sendData = sendData || (*packInfo)->sendsDataInDirection( *dir );
+                  recvData = recvData || (*packInfo)->sendsDataInDirection( stencil::inverseDir[*dir] );
+               }
+
+               if( recvData )
+                  recvProcesses.insert( nProcess );
+
+               if( !sendData )
+                  continue;
+
+               sendFunctions[ nProcess ].push_back( std::bind( UniformBufferedScheme<Stencil>::writeHeader, std::placeholders::_1, nBlockId, *dir ) );
 
                for( auto packInfo = packInfos_.begin(); packInfo != packInfos_.end(); ++packInfo )
-                  sendFunctions[ nProcess ].push_back( std::bind( &walberla::communication::UniformPackInfo::packData,
-                                                                     *packInfo, block, *dir,  std::placeholders::_1 ) );
+                  if( (*packInfo)->sendsDataInDirection( *dir ) )
+                     sendFunctions[ nProcess ].push_back( std::bind( &walberla::communication::UniformPackInfo::packData,
+                                                                        *packInfo, block, *dir,  std::placeholders::_1 ) );
             }
          }
       }
@@ -363,12 +449,15 @@ void UniformBufferedScheme<Stencil>::startCommunication()
       bufferSystem_.setReceiverInfo( !constantSizes );
       bufferSystem_.enforceSerialSends( false );
       bufferSystem_.enforceSerialRecvs( !threadsafeReceive );
+      bufferSystem_.usePersistentRequests( constantSizes ); // same messages in every step -> reuse MPI requests
+      bufferSystem_.useNeighborCollectives( neighborCollectives_ );
+      bufferSystem_.useSharedMemory( sharedMemory_ );
 
       for( auto sender = sendFunctions.begin(); sender != sendFunctions.end(); ++sender )
-      {
          bufferSystem_.addSendingFunction  ( int_c(sender->first), std::bind(  UniformBufferedScheme<Stencil>::send, std::placeholders::_1, sender->second ) );
-         bufferSystem_.addReceivingFunction( int_c(sender->first), std::bind( &UniformBufferedScheme<Stencil>::receive, this, std::placeholders::_1 ) );
-      }
+
+      for( auto receiver = recvProcesses.begin(); receiver != recvProcesses.end(); ++receiver )
+         bufferSystem_.addReceivingFunction( int_c(*receiver), std::bind( &UniformBufferedScheme<Stencil>::receive, this, std::placeholders::_1 ) );
 
       setupBeforeNextCommunication_ = false;
       forestModificationStamp_ = forest->getBlockForest().getModificationStamp();
@@ -501,7 +590,8 @@ void UniformBufferedScheme<Stencil>::receive( RecvBuffer & buffer )
          auto block = dynamic_cast< Block * >( forest->getBlock(blockID) );
 
          for( auto packInfo = packInfos_.begin(); packInfo != packInfos_.end(); ++packInfo )
-            (*packInfo)->unpackData( block, stencil::inverseDir[dir], buffer );
+            if( (*packInfo)->sendsDataInDirection( dir ) )
+               (*packInfo)->unpackData( block, stencil::inverseDir[dir], buffer );
       }
    }
 }
@@ -64,7 +64,8 @@ public:
         communicationRunning_( false ),
         requiredBlockSelectors_( Set<SUID>::emptySet() ),
         incompatibleBlockSelectors_( Set<SUID>::emptySet() ),
-        tag_( tag )
+        tag_( tag ),
+        bytesSent_( 0 )
    {
       if ( dataInfo )
          dataInfos_.push_back( dataInfo );
@@ -80,7 +81,8 @@ public:
         communicationRunning_( false ),
         requiredBlockSelectors_( requiredBlockSelectors ),
         incompatibleBlockSelectors_( incompatibleBlockSelectors ),
-        tag_( tag )
+        tag_( tag ),
+        bytesSent_( 0 )
    {
       if ( dataInfo )
          dataInfos_.push_back( dataInfo );
@@ -119,6 +121,17 @@ public:
    //@}
    //*******************************************************************************************************************
 
+
+   //** Statistics *****************************************************************************************************
+   /*! \name Statistics */
+   //@{
+   /// Number of bytes sent to other processes (also blocks on the same process are exchanged via MPI)
+   /// since construction or the last resetStatistics() call
+   uint64_t getBytesSent() const { return bytesSent_; }
+   void     resetStatistics()    { bytesSent_ = 0;    }
+   //@}
+   //*******************************************************************************************************************
+
 protected:
    void setup();
 
@@ -158,6 +171,8 @@ protected:
 
    int tag_;
 
+   uint64_t bytesSent_;
+
 }; // class UniformDirectScheme
 
 
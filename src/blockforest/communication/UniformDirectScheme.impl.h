@@ -139,9 +139,12 @@ void UniformDirectScheme<Stencil>::setup()
             // These two infos do not belong to the same data exchange
             // here we just say for example: "recv from west", "send to west"
             // the sorting according to communication partners is done in a second step
+            // directions with empty data types are skipped, the neighbor sends towards us in the inverse direction
             CommInfo info = { dataIdx, block->getId(), nBlockId, nProcess, *dir };
-            sendInfos_.push_back( info );
-            recvInfos_.push_back( info );
+            if( dataInfos_[ dataIdx ]->sendsDataInDirection( *dir ) )
+               sendInfos_.push_back( info );
+            if( dataInfos_[ dataIdx ]->sendsDataInDirection( stencil::inverseDir[ *dir ] ) )
+               recvInfos_.push_back( info );
          }
       }
    }
@@ -204,8 +207,14 @@ void UniformDirectScheme<Stencil>::startCommunication()
       WALBERLA_ASSERT_UNEQUAL( **datatypeIt, MPI_DATATYPE_NULL );
 
       const shared_ptr<UniformMPIDatatypeInfo> & dataInfo = dataInfos_ [ it->dataIdx ];
+      const int items = dataInfo->getNumberOfItemsToCommunicate( block, it->dir );
+
+      int typeSize = 0;
+      MPI_Type_size( **datatypeIt, &typeSize );
+      bytesSent_ += uint64_c( typeSize ) * uint64_c( items );
+
       MPI_Isend( dataInfo->getSendPointer( block, it->dir ),
-                 dataInfo->getNumberOfItemsToCommunicate( block, it->dir ),
+                 items,
                  **datatypeIt,
                  int_c( it->remoteProcess ),
                  tag_,
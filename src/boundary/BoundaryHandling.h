@@ -40,6 +40,7 @@
 #include "stencil/Directions.h"
 
 #include <boost/tuple/tuple.hpp>
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -337,6 +338,12 @@ public:
 
    inline void beforeBoundaryTreatment() { beforeBoundaryTreatment( boundaryConditions_ ); }
    inline void  afterBoundaryTreatment() {  afterBoundaryTreatment( boundaryConditions_ ); }
+
+   // Fused boundary treatment: boundary links are treated row by row (x-lines of the interior of the block) from
+   // within a sweep, right before the sweep processes the row (see lbm::FusedBoundaryHandling).
+   inline void beforeRowWiseTreatment();
+   inline void treatRow( const cell_idx_t y, const cell_idx_t z );
+   inline void  afterRowWiseTreatment() { afterBoundaryTreatment(); }
    //@}
    //*******************************************************************************************************************
 
@@ -561,6 +568,13 @@ private:
    inline void treatDirection( const boost::tuples::null_type &, const uint_t,
                                const std::vector< std::vector< std::pair< Cell, stencil::Direction > > > & ) const {}
 
+   template< typename Head, typename Tail >
+   inline void treatDirection( boost::tuples::cons<Head, Tail> & boundaryConditions, const uint_t index,
+                               const std::vector< std::vector< std::pair< Cell, stencil::Direction > > > & cellDirectionPairs,
+                               const CellInterval & cells );
+   inline void treatDirection( const boost::tuples::null_type &, const uint_t,
+                               const std::vector< std::vector< std::pair< Cell, stencil::Direction > > > &, const CellInterval & ) const {}
+
    template< typename Head, typename Tail >
    inline void treatDirection(       boost::tuples::cons<Head, Tail> & boundaryConditions, const cell_idx_t x, const cell_idx_t y, const cell_idx_t z,
                                                                                            const stencil::Direction dir,
@@ -568,6 +582,27 @@ private:
    inline void treatDirection( const boost::tuples::null_type & , const cell_idx_t, const cell_idx_t, const cell_idx_t, const stencil::Direction,
                                                                   const cell_idx_t, const cell_idx_t, const cell_idx_t ) const { WALBERLA_CHECK( false ); }
 
+   template< typename Head, typename Tail >
+   inline void treatDirection(       boost::tuples::cons<Head, Tail> & boundaryConditions, const uint_t index,
+                                                                                           const cell_idx_t x, const cell_idx_t y, const cell_idx_t z,
+                                                                                           const stencil::Direction dir,
+                                                                                           const cell_idx_t nx, const cell_idx_t ny, const cell_idx_t nz );
+   inline void treatDirection( const boost::tuples::null_type & , const uint_t, const cell_idx_t, const cell_idx_t, const cell_idx_t, const stencil::Direction,
+                                                                                const cell_idx_t, const cell_idx_t, const cell_idx_t ) const { WALBERLA_CHECK( false ); }
+
+   inline void treatRowLinks( const uint_t row, const cell_idx_t y, const cell_idx_t z );
+
+   inline void checkDirtyFlag();
+   inline void rebuildCellDirectionPairs( const uint_t numberOfGhostLayersToInclude );
+
+   /// orders the links of cellDirectionPairs_ by their cell in (z,y,x) order
+   static bool linkCellLess( const std::pair< Cell, stencil::Direction > & link, const Cell & cell )
+   {
+      if( link.first.z() != cell.z() ) return link.first.z() < cell.z();
+      if( link.first.y() != cell.y() ) return link.first.y() < cell.y();
+      return link.first.x() < cell.x();
+   }
+
    template< typename Head, typename Tail >
    inline void beforeBoundaryTreatment(       boost::tuples::cons<Head, Tail> & boundaryConditions );
    inline void beforeBoundaryTreatment( const boost::tuples::null_type & ) const {}
@@ -640,7 +675,8 @@ private:
    const Mode mode_;
 
    bool dirty_; //!< Every time "near boundary" flags are set or removed, dirty_ is set to true.
-                /*!< Triggers a rebuild of vector cellDirectionPairs_ in "OPTIMIZED_SPARSE_TRAVERSAL" mode. */
+                /*!< Triggers a rebuild of vector cellDirectionPairs_ in "OPTIMIZED_SPARSE_TRAVERSAL" mode and a rebuild
+                     of the row-wise link list (rowLinks_) used by the fused boundary treatment. */
 
    std::vector< flag_t > bcMaskMapping_; // boundary condition index (position in tuple) to associated mask mapping
 
@@ -648,6 +684,17 @@ private:
    std::vector< std::vector< std::vector< std::pair< Cell, stencil::Direction > > > > cellDirectionPairs_; // 1st vector: numberOfGhostLayersToInclude
                                                                                                            // 2nd vector: boundary condition index
                                                                                                            // 3rd vector: vector of cell<->direction pairs
+   struct RowLink
+   {
+      cell_idx_t         x;
+      stencil::Direction direction;
+      uint_t             index; // boundary condition index (position in tuple)
+   };
+
+   bool rebuildRowLinks_;
+   std::vector< RowLink > rowLinks_;      // boundary links of all interior cells, sorted by rows (x-lines) ...
+   std::vector< uint_t >  rowLinksBegin_; // ... the links of row (y,z) are [ rowLinksBegin_[ z * ySize + y ], rowLinksBegin_[ z * ySize + y + 1 ] )
+
    Tuple boundaryConditions_;
    bool  threadSafeBCs_;
 
@@ -672,6 +719,7 @@ BoundaryHandling< FlagField_T, Stencil, Tuple >::BoundaryHandling( const std::st
    domain_( domain ),
    mode_( mode ),
    dirty_( false ),
+   rebuildRowLinks_( true ),
    boundaryConditions_( boundaryConditions ),
    threadSafeBCs_( true )
 {
@@ -2135,39 +2183,15 @@ inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::operator()( const u
    {
       WALBERLA_ASSERT( innerBB_.contains( cells ) );
 
-      if( dirty_ )
-      {
-         for( uint_t i = 0; i != rebuildCellDirectionPairs_.size(); ++i )
-            rebuildCellDirectionPairs_[i] = true;
-         dirty_ = false;
-      }
-
-      auto & cellDirectionPairs = cellDirectionPairs_[numberOfGhostLayersToInclude];
+      checkDirtyFlag();
 
       if( rebuildCellDirectionPairs_[numberOfGhostLayersToInclude] )
-      {
-         cellDirectionPairs.clear();
-         cellDirectionPairs.resize( bcMaskMapping_.size() );
-
-         for( auto cell = flagField_->beginSliceXYZ( cells ); cell != flagField_->end(); ++cell )
-            if( isFlagSet( cell, nearBoundary_ ) )
-               for( auto d = Stencil::begin(); d != Stencil::end(); ++d )
-                  if( field::isPartOfMaskSet( cell.neighbor( *d ), boundary_ ) )
-                  {
-                     uint_t index( uint_t(0) );
-                     for( auto mask = bcMaskMapping_.begin(); mask != bcMaskMapping_.end(); ++mask, ++index )
-                        if( field::isPartOfMaskSet( cell.neighbor( *d ), *mask ) )
-                        {
-                           cellDirectionPairs[ index ].push_back( std::make_pair( cell.cell(), *d) );
-                           break;
-                        }
-                  }
-
-         rebuildCellDirectionPairs_[numberOfGhostLayersToInclude] = false;
-      }
+         rebuildCellDirectionPairs( numberOfGhostLayersToInclude );
 
       WALBERLA_ASSERT( checkFlagField( numberOfGhostLayersToInclude ) );
 
+      const auto & cellDirectionPairs = cellDirectionPairs_[numberOfGhostLayersToInclude];
+
       if( !cellDirectionPairs.empty() )
          treatDirection( boundaryConditions_, uint_t(0), cellDirectionPairs );
    }
@@ -2213,6 +2237,32 @@ inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::operator()( const C
 
    WALBERLA_ASSERT( checkConsistency( localCells ) );
 
+   if( mode_ == OPTIMIZED_SPARSE_TRAVERSAL )
+   {
+      // use the cached links of the smallest ghost layer region that contains all cells -> cost scales with the
+      // number of boundary links of this region instead of with the number of cells in 'localCells'
+
+      uint_t numberOfGhostLayersToInclude( uint_t(0) );
+      while( !getGhostLayerCellInterval( numberOfGhostLayersToInclude ).contains( localCells ) )
+         ++numberOfGhostLayersToInclude;
+
+      WALBERLA_ASSERT_LESS( numberOfGhostLayersToInclude, flagField_->nrOfGhostLayers() );
+
+      checkDirtyFlag();
+
+      if( rebuildCellDirectionPairs_[numberOfGhostLayersToInclude] )
+         rebuildCellDirectionPairs( numberOfGhostLayersToInclude );
+
+      WALBERLA_ASSERT( checkFlagField( numberOfGhostLayersToInclude ) );
+
+      const auto & cellDirectionPairs = cellDirectionPairs_[numberOfGhostLayersToInclude];
+
+      if( !cellDirectionPairs.empty() )
+         treatDirection( boundaryConditions_, uint_t(0), cellDirectionPairs, localCells );
+
+      return;
+   }
+
    #ifdef _OPENMP
    const int zMin = int_c( localCells.zMin() );
    const int zMax = int_c( localCells.zMax() );
@@ -2250,6 +2300,98 @@ inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::operator()( const C
 
 
 
+template< typename FlagField_T, typename Stencil, typename Tuple >
+inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::beforeRowWiseTreatment()
+{
+   beforeBoundaryTreatment();
+
+   checkDirtyFlag();
+
+   if( !rebuildRowLinks_ )
+      return;
+
+   const cell_idx_t xSize = cell_idx_c( flagField_->xSize() );
+   const cell_idx_t ySize = cell_idx_c( flagField_->ySize() );
+   const cell_idx_t zSize = cell_idx_c( flagField_->zSize() );
+
+   rowLinks_.clear();
+   rowLinksBegin_.clear();
+   rowLinksBegin_.reserve( flagField_->ySize() * flagField_->zSize() + uint_t(1) );
+
+   for( cell_idx_t z = 0; z < zSize; ++z ) {
+      for( cell_idx_t y = 0; y < ySize; ++y )
+      {
+         rowLinksBegin_.push_back( rowLinks_.size() );
+
+         for( cell_idx_t x = 0; x < xSize; ++x )
+         {
+            if( !isNearBoundary(x,y,z) )
+               continue;
+
+            for( auto d = Stencil::begin(); d != Stencil::end(); ++d )
+            {
+               const flag_t neighbor = flagField_->get( x + cell_idx_c( d.cx() ), y + cell_idx_c( d.cy() ), z + cell_idx_c( d.cz() ) );
+               if( !field::isPartOfMaskSet( neighbor, boundary_ ) )
+                  continue;
+
+               uint_t index( uint_t(0) );
+               for( auto mask = bcMaskMapping_.begin(); mask != bcMaskMapping_.end(); ++mask, ++index )
+                  if( field::isPartOfMaskSet( neighbor, *mask ) )
+                  {
+                     RowLink link;
+                     link.x         = x;
+                     link.direction = *d;
+                     link.index     = index;
+                     rowLinks_.push_back( link );
+                     break;
+                  }
+            }
+         }
+      }
+   }
+   rowLinksBegin_.push_back( rowLinks_.size() );
+
+   rebuildRowLinks_ = false;
+}
+
+
+
+/// Treats all boundary links of the cells of row (y,z) of the interior of the block. Must be enclosed by calls to
+/// beforeRowWiseTreatment() and afterRowWiseTreatment(). The boundary links of a row are only read during the streaming
+/// step of the cells of the very same row, hence different rows can be treated in any order (and concurrently).
+template< typename FlagField_T, typename Stencil, typename Tuple >
+inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::treatRow( const cell_idx_t y, const cell_idx_t z )
+{
+   WALBERLA_ASSERT( !rebuildRowLinks_ );
+   WALBERLA_ASSERT( !dirty_ );
+   WALBERLA_ASSERT_GREATER_EQUAL( y, cell_idx_t(0) );
+   WALBERLA_ASSERT_GREATER_EQUAL( z, cell_idx_t(0) );
+   WALBERLA_ASSERT_LESS( y, cell_idx_c( flagField_->ySize() ) );
+   WALBERLA_ASSERT_LESS( z, cell_idx_c( flagField_->zSize() ) );
+
+   const uint_t row = uint_c( z ) * flagField_->ySize() + uint_c( y );
+
+   WALBERLA_ASSERT_LESS( row + uint_t(1), rowLinksBegin_.size() );
+
+   if( rowLinksBegin_[ row ] == rowLinksBegin_[ row + uint_t(1) ] )
+      return;
+
+#ifdef _OPENMP
+   if( !threadSafeBCs_ )
+   {
+      #pragma omp critical (BoundaryHandling_treatRow)
+      {
+         treatRowLinks( row, y, z );
+      }
+      return;
+   }
+#endif
+
+   treatRowLinks( row, y, z );
+}
+
+
+
 template< typename FlagField_T, typename Stencil, typename Tuple >
 template< typename Buffer_T >
 void BoundaryHandling< FlagField_T, Stencil, Tuple >::pack( Buffer_T & buffer, const CellInterval & interval, const bool assumeIdenticalFlagMapping ) const
@@ -2896,6 +3038,56 @@ inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::treatDirection( boo
 
 
 
+template< typename FlagField_T, typename Stencil, typename Tuple >
+template< typename Head, typename Tail >
+inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::treatDirection( boost::tuples::cons<Head, Tail> & boundaryConditions, const uint_t index,
+                                                                             const std::vector< std::vector< std::pair< Cell, stencil::Direction > > > & cellDirectionPairs,
+                                                                             const CellInterval & cells )
+{
+   Head & boundaryCondition = boundaryConditions.get_head();
+
+   WALBERLA_ASSERT_LESS( index, cellDirectionPairs.size() );
+
+   // The links are sorted by cell in (z,y,x) order (see rebuildCellDirectionPairs), hence the links of every row of
+   // 'cells' form a contiguous range that is found by binary search -> cost scales with the number of rows of 'cells'
+   // and the number of links within 'cells', not with the number of links of the whole block.
+
+   const auto & links = cellDirectionPairs[index];
+   if( links.empty() || cells.empty() )
+   {
+      treatDirection( boundaryConditions.get_tail(), index + uint_t(1), cellDirectionPairs, cells );
+      return;
+   }
+
+   const cell_idx_t ySize = cell_idx_c( cells.ySize() );
+   const int rows = int_c( cells.ySize() * cells.zSize() );
+   #ifdef _OPENMP
+   #pragma omp parallel for schedule(static) if(threadSafeBCs_)
+   #endif
+   for( int row = 0; row < rows; ++row )
+   {
+      const cell_idx_t y = cells.yMin() + cell_idx_c( row ) % ySize;
+      const cell_idx_t z = cells.zMin() + cell_idx_c( row ) / ySize;
+
+      auto link = std::lower_bound( links.begin(), links.end(), Cell( cells.xMin(), y, z ), linkCellLess );
+
+      for( ; link != links.end() && link->first.z() == z && link->first.y() == y && link->first.x() <= cells.xMax(); ++link )
+      {
+         const cell_idx_t x = link->first.x();
+         const stencil::Direction direction = link->second;
+         const cell_idx_t nx = x + cell_idx_c( stencil::cx[ direction ] );
+         const cell_idx_t ny = y + cell_idx_c( stencil::cy[ direction ] );
+         const cell_idx_t nz = z + cell_idx_c( stencil::cz[ direction ] );
+
+         boundaryCondition.treatDirection( x, y, z, direction, nx, ny, nz, flagField_->get(nx,ny,nz) );
+      }
+   }
+
+   treatDirection( boundaryConditions.get_tail(), index + uint_t(1), cellDirectionPairs, cells );
+}
+
+
+
 template< typename FlagField_T, typename Stencil, typename Tuple >
 template< typename Head, typename Tail >
 inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::treatDirection( boost::tuples::cons<Head, Tail> & boundaryConditions,
@@ -2917,6 +3109,96 @@ inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::treatDirection( boo
 
 
 
+template< typename FlagField_T, typename Stencil, typename Tuple >
+template< typename Head, typename Tail >
+inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::treatDirection( boost::tuples::cons<Head, Tail> & boundaryConditions, const uint_t index,
+                                                                             const cell_idx_t x, const cell_idx_t y, const cell_idx_t z,
+                                                                             const stencil::Direction dir,
+                                                                             const cell_idx_t nx, const cell_idx_t ny, const cell_idx_t nz )
+{
+   if( index == uint_t(0) )
+   {
+      Head & boundaryCondition = boundaryConditions.get_head();
+
+      WALBERLA_ASSERT( flagField_->isPartOfMaskSet( nx, ny, nz, boundaryCondition.getMask() ) );
+
+      boundaryCondition.treatDirection( x, y, z, dir, nx, ny, nz, flagField_->get(nx,ny,nz) );
+   }
+   else
+   {
+      treatDirection( boundaryConditions.get_tail(), index - uint_t(1), x, y, z, dir, nx, ny, nz );
+   }
+}
+
+
+
+template< typename FlagField_T, typename Stencil, typename Tuple >
+inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::treatRowLinks( const uint_t row, const cell_idx_t y, const cell_idx_t z )
+{
+   for( uint_t i = rowLinksBegin_[ row ]; i != rowLinksBegin_[ row + uint_t(1) ]; ++i )
+   {
+      const RowLink & link = rowLinks_[i];
+
+      treatDirection( boundaryConditions_, link.index, link.x, y, z, link.direction, link.x + cell_idx_c( stencil::cx[ link.direction ] ),
+                      y + cell_idx_c( stencil::cy[ link.direction ] ), z + cell_idx_c( stencil::cz[ link.direction ] ) );
+   }
+}
+
+
+
+template< typename FlagField_T, typename Stencil, typename Tuple >
+inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::checkDirtyFlag()
+{
+   if( dirty_ )
+   {
+      for( uint_t i = 0; i != rebuildCellDirectionPairs_.size(); ++i )
+         rebuildCellDirectionPairs_[i] = true;
+      rebuildRowLinks_ = true;
+      dirty_ = false;
+   }
+}
+
+
+
+template< typename FlagField_T, typename Stencil, typename Tuple >
+inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::rebuildCellDirectionPairs( const uint_t numberOfGhostLayersToInclude )
+{
+   WALBERLA_ASSERT_LESS( numberOfGhostLayersToInclude, flagField_->nrOfGhostLayers() );
+
+   CellInterval cells = getGhostLayerCellInterval( numberOfGhostLayersToInclude );
+
+   WALBERLA_ASSERT( innerBB_.contains( cells ) );
+
+   auto & cellDirectionPairs = cellDirectionPairs_[numberOfGhostLayersToInclude];
+
+   cellDirectionPairs.clear();
+   cellDirectionPairs.resize( bcMaskMapping_.size() );
+
+   for( auto cell = flagField_->beginSliceXYZ( cells ); cell != flagField_->end(); ++cell )
+      if( isFlagSet( cell, nearBoundary_ ) )
+         for( auto d = Stencil::begin(); d != Stencil::end(); ++d )
+            if( field::isPartOfMaskSet( cell.neighbor( *d ), boundary_ ) )
+            {
+               uint_t index( uint_t(0) );
+               for( auto mask = bcMaskMapping_.begin(); mask != bcMaskMapping_.end(); ++mask, ++index )
+                  if( field::isPartOfMaskSet( cell.neighbor( *d ), *mask ) )
+                  {
+                     cellDirectionPairs[ index ].push_back( std::make_pair( cell.cell(), *d) );
+                     break;
+                  }
+            }
+
+   // the slice iterator traverses the cells in (z,y,x) order, operator()( CellInterval ) relies on this order
+   for( auto links = cellDirectionPairs.begin(); links != cellDirectionPairs.end(); ++links )
+      WALBERLA_ASSERT( std::is_sorted( links->begin(), links->end(),
+                                       []( const std::pair< Cell, stencil::Direction > & lhs, const std::pair< Cell, stencil::Direction > & rhs )
+                                       { return linkCellLess( lhs, rhs.first ); } ) );
+
+   rebuildCellDirectionPairs_[numberOfGhostLayersToInclude] = false;
+}
+
+
+
 template< typename FlagField_T, typename Stencil, typename Tuple >
 template< typename Head, typename Tail >
 inline void BoundaryHandling< FlagField_T, Stencil, Tuple >::beforeBoundaryTreatment( boost::tuples::cons<Head, Tail> & boundaryConditions )
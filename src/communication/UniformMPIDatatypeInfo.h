@@ -77,6 +77,13 @@ namespace communication {
       * Due to custom aggregated MPI datatypes this is usually 1
       *****************************************************************************************************************/
       virtual int getNumberOfItemsToCommunicate( IBlock * , const stencil::Direction ) { return 1; }
+
+      /*************************************************************************************************************//**
+      * Return false if the send data type for the specified direction is empty for all blocks.
+      * No message is sent in this direction then (and no message is expected from the neighbor in the inverse
+      * direction). Returning true is always safe.
+      *****************************************************************************************************************/
+      virtual bool sendsDataInDirection( const stencil::Direction ) const { return true; }
    };
 
 
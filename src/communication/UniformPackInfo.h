@@ -80,6 +80,15 @@ public:
     */
    virtual bool threadsafeReceiving() const = 0;
 
+   /**
+    * Must return true if, for any block, data may be packed in direction "dir". Should return false
+    * if packData never writes anything into the buffer for this direction (e.g., PDFs of lattice
+    * models that do not stream into "dir", see stencil::d_per_d_mask). For such directions, the
+    * communication schemes neither call packData/unpackData/communicateLocal nor send any message.
+    * Returning true is always safe.
+    */
+   virtual bool sendsDataInDirection( stencil::Direction /*dir*/ ) const { return true; }
+
    /**
     * Packs data from a block into a send buffer. Must be thread-safe! Calls packDataImpl.
     *
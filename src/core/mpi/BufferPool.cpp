@@ -0,0 +1,340 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file BufferPool.cpp
+//! \ingroup core
+//
+//======================================================================================================================
+
+#include "BufferPool.h"
+
+#include "core/debug/Debug.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+
+namespace walberla {
+namespace mpi {
+
+
+
+BufferPool & BufferPool::instance()
+{
+   // intentionally never destroyed: buffers of static objects may be released after the end of main()
+   static BufferPool * pool = new BufferPool();
+   return *pool;
+}
+
+
+
+BufferPool::BufferPool()
+   : pooling_( true ), hugePages_( false ), cacheLimit_( size_t(256) << 20 ),
+     numAllocations_( 0 ), numReuses_( 0 ), numReallocations_( 0 ), bytesCopied_( 0 ),
+     bytesInUse_( 0 ), peakBytesInUse_( 0 ), bytesCached_( 0 )
+{
+}
+
+
+
+size_t BufferPool::sizeClass( size_t bytes )
+{
+   size_t c = 0;
+   while( classSize( c ) < bytes )
+      ++c;
+   WALBERLA_ASSERT_LESS( c, NUM_CLASSES );
+   return c;
+}
+
+
+
+void * BufferPool::allocateFromSystem( size_t bytes )
+{
+   void * base = nullptr;
+   const bool huge = hugePages_ && bytes >= HUGE_PAGE_SIZE;
+
+   if( huge )
+   {
+      // the header is placed in front of the buffer -> the buffer itself is not huge page aligned, but its pages are
+      if( posix_memalign( &base, HUGE_PAGE_SIZE, HEADER_SIZE + bytes ) != 0 )
+         base = nullptr;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+      if( base != nullptr )
+         madvise( base, HEADER_SIZE + bytes, MADV_HUGEPAGE );
+#endif
+   }
+   else
+   {
+      if( posix_memalign( &base, HEADER_SIZE, HEADER_SIZE + bytes ) != 0 )
+         base = nullptr;
+   }
+
+   if( base == nullptr )
+      throw std::bad_alloc();
+
+   Header * header = static_cast< Header * >( base );
+   header->bytes     = bytes;
+   header->hugePages = huge;
+
+   return static_cast< char * >( base ) + HEADER_SIZE;
+}
+
+
+
+void BufferPool::freeToSystem( void * ptr )
+{
+   std::free( static_cast< char * >( ptr ) - HEADER_SIZE );
+}
+
+
+
+//**********************************************************************************************************************
+/*! Allocates memory for at least \a bytes bytes
+*
+* \param bytes     requested number of bytes
+* \param capacity  [out] usable number of bytes of the allocation (>= bytes)
+* \return          pointer to the memory, nullptr if bytes == 0
+*/
+//**********************************************************************************************************************
+void * BufferPool::allocate( size_t bytes, size_t & capacity )
+{
+   if( bytes == 0 )
+   {
+      capacity = 0;
+      return nullptr;
+   }
+
+   std::lock_guard< std::mutex > lock( mutex_ );
+
+   void * ptr = nullptr;
+
+   if( pooling_ )
+   {
+      const size_t c = sizeClass( bytes );
+      bytes = classSize( c );
+      if( !freeLists_[c].empty() )
+      {
+         ptr = freeLists_[c].back();
+         freeLists_[c].pop_back();
+         bytesCached_ -= bytes;
+         ++numReuses_;
+      }
+   }
+
+   if( ptr == nullptr )
+      ptr = allocateFromSystem( bytes );
+
+   ++numAllocations_;
+   bytesInUse_ += bytes;
+   peakBytesInUse_ = std::max( peakBytesInUse_, bytesInUse_ );
+
+   capacity = bytes;
+   return ptr;
+}
+
+
+
+//**********************************************************************************************************************
+/*! Replaces an allocation by a larger one, the first \a bytesToKeep bytes are copied
+*
+* \param ptr          memory returned by allocate()/reallocate() (may be nullptr)
+* \param bytesToKeep  number of bytes (from the beginning) that have to be preserved
+* \param bytes        requested number of bytes
+* \param capacity     [out] usable number of bytes of the new allocation (>= bytes)
+*/
+//**********************************************************************************************************************
+void * BufferPool::reallocate( void * ptr, size_t bytesToKeep, size_t bytes, size_t & capacity )
+{
+   WALBERLA_ASSERT_LESS_EQUAL( bytesToKeep, bytes );
+
+   void * newPtr = allocate( bytes, capacity );
+
+   if( bytesToKeep > 0 )
+   {
+      std::memcpy( newPtr, ptr, bytesToKeep );
+
+      std::lock_guard< std::mutex > lock( mutex_ );
+      ++numReallocations_;
+      bytesCopied_ += bytesToKeep;
+   }
+
+   deallocate( ptr );
+   return newPtr;
+}
+
+
+
+void BufferPool::deallocate( void * ptr )
+{
+   if( ptr == nullptr )
+      return;
+
+   const Header * header = reinterpret_cast< const Header * >( static_cast< char * >( ptr ) - HEADER_SIZE );
+   const size_t bytes = header->bytes;
+
+   std::lock_guard< std::mutex > lock( mutex_ );
+
+   WALBERLA_ASSERT_GREATER_EQUAL( bytesInUse_, bytes );
+   bytesInUse_ -= bytes;
+
+   // only allocations of a size class with the current huge page setting are kept
+   const size_t c = sizeClass( bytes );
+   if( pooling_ && classSize( c ) == bytes && header->hugePages == ( hugePages_ && bytes >= HUGE_PAGE_SIZE ) &&
+       bytesCached_ + bytes <= cacheLimit_ )
+   {
+      freeLists_[c].push_back( ptr );
+      bytesCached_ += bytes;
+   }
+   else
+   {
+      freeToSystem( ptr );
+   }
+}
+
+
+
+void BufferPool::enablePooling( bool val )
+{
+   {
+      std::lock_guard< std::mutex > lock( mutex_ );
+      pooling_ = val;
+   }
+   if( !val )
+      releaseCachedMemory();
+}
+
+bool BufferPool::poolingEnabled() const
+{
+   std::lock_guard< std::mutex > lock( mutex_ );
+   return pooling_;
+}
+
+//**********************************************************************************************************************
+/*! Enables/disables 2 MiB aligned allocations marked for transparent huge pages (only for allocations >= 2 MiB)
+*/
+//**********************************************************************************************************************
+void BufferPool::useHugePages( bool val )
+{
+   {
+      std::lock_guard< std::mutex > lock( mutex_ );
+      hugePages_ = val;
+   }
+   releaseCachedMemory();
+}
+
+bool BufferPool::hugePagesUsed() const
+{
+   std::lock_guard< std::mutex > lock( mutex_ );
+   return hugePages_;
+}
+
+//**********************************************************************************************************************
+/*! Sets the maximum number of bytes kept in the pool (default: 256 MiB)
+*/
+//**********************************************************************************************************************
+void BufferPool::setCacheLimit( size_t bytes )
+{
+   {
+      std::lock_guard< std::mutex > lock( mutex_ );
+      cacheLimit_ = bytes;
+   }
+   releaseCachedMemory();
+}
+
+size_t BufferPool::cacheLimit() const
+{
+   std::lock_guard< std::mutex > lock( mutex_ );
+   return cacheLimit_;
+}
+
+/// Returns all memory kept in the pool to the system
+void BufferPool::releaseCachedMemory()
+{
+   std::lock_guard< std::mutex > lock( mutex_ );
+
+   for( auto list = freeLists_.begin(); list != freeLists_.end(); ++list )
+   {
+      for( auto ptr = list->begin(); ptr != list->end(); ++ptr )
+         freeToSystem( *ptr );
+      list->clear();
+   }
+   bytesCached_ = 0;
+}
+
+
+
+uint64_t BufferPool::numAllocations() const
+{
+   std::lock_guard< std::mutex > lock( mutex_ );
+   return numAllocations_;
+}
+
+uint64_t BufferPool::numReuses() const
+{
+   std::lock_guard< std::mutex > lock( mutex_ );
+   return numReuses_;
+}
+
+uint64_t BufferPool::numReallocations() const
+{
+   std::lock_guard< std::mutex > lock( mutex_ );
+   return numReallocations_;
+}
+
+uint64_t BufferPool::bytesCopied() const
+{
+   std::lock_guard< std::mutex > lock( mutex_ );
+   return bytesCopied_;
+}
+
+size_t BufferPool::bytesInUse() const
+{
+   std::lock_guard< std::mutex > lock( mutex_ );
+   return bytesInUse_;
+}
+
+size_t BufferPool::peakBytesInUse() const
+{
+   std::lock_guard< std::mutex > lock( mutex_ );
+   return peakBytesInUse_;
+}
+
+size_t BufferPool::bytesCached() const
+{
+   std::lock_guard< std::mutex > lock( mutex_ );
+   return bytesCached_;
+}
+
+/// Resets the counters, the peak number of bytes is set to the current number of bytes in use
+void BufferPool::resetStatistics()
+{
+   std::lock_guard< std::mutex > lock( mutex_ );
+   numAllocations_   = 0;
+   numReuses_        = 0;
+   numReallocations_ = 0;
+   bytesCopied_      = 0;
+   peakBytesInUse_   = bytesInUse_;
+}
+
+
+
+} // namespace mpi
+} // namespace walberla
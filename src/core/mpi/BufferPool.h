@@ -0,0 +1,139 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file BufferPool.h
+//! \ingroup core
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "core/DataTypes.h"
+#include "core/NonCopyable.h"
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+
+namespace walberla {
+namespace mpi {
+
+
+
+//**********************************************************************************************************************
+/*! Process-wide pool for the memory of SendBuffers and RecvBuffers
+*
+* All Send- and RecvBuffers allocate their memory from this pool. If pooling is enabled (default), the sizes of
+* the allocations are rounded up to powers of two ("size classes", at least 64 bytes), and the memory of destroyed
+* or reallocated buffers is kept in a free list per size class and handed out again. Hence, buffers that are
+* recreated in every communication step (e.g., the BufferSystems of the pe synchronization) do not hit the system
+* allocator in a steady state. The total amount of cached memory is limited (see setCacheLimit()), memory that
+* exceeds the limit is returned to the system.
+*
+* Optionally, allocations of at least 2 MiB are aligned to 2 MiB and marked as eligible for transparent huge pages
+* (Linux only, see useHugePages()).
+*
+* The statistics (number of allocations, of reallocations of buffers whose content had to be copied, and the
+* current/peak number of bytes held by buffers) are collected in any case. They are process-local and include
+* the buffers of all threads.
+*
+* The pool is thread-safe. It is never destroyed, so buffers may safely be released during static destruction.
+*/
+//**********************************************************************************************************************
+class BufferPool : private NonCopyable
+{
+public:
+
+   static BufferPool & instance();
+
+   //** Allocation *****************************************************************************************************
+   /*! \name Allocation */
+   //@{
+   void * allocate  ( size_t bytes, size_t & capacity );
+   void * reallocate( void * ptr, size_t bytesToKeep, size_t bytes, size_t & capacity );
+   void   deallocate( void * ptr );
+   //@}
+   //*******************************************************************************************************************
+
+   //** Configuration **************************************************************************************************
+   /*! \name Configuration */
+   //@{
+   void   enablePooling( bool val );
+   bool   poolingEnabled() const;
+   void   useHugePages( bool val );
+   bool   hugePagesUsed() const;
+   void   setCacheLimit( size_t bytes );
+   size_t cacheLimit() const;
+   void   releaseCachedMemory();
+   //@}
+   //*******************************************************************************************************************
+
+   //** Statistics *****************************************************************************************************
+   /*! \name Statistics */
+   //@{
+   uint64_t numAllocations()   const; ///< allocations (including reallocations) since the last resetStatistics()
+   uint64_t numReuses()        const; ///< allocations served from the pool since the last resetStatistics()
+   uint64_t numReallocations() const; ///< reallocations that had to copy data since the last resetStatistics()
+   uint64_t bytesCopied()      const; ///< bytes copied by these reallocations
+   size_t   bytesInUse()       const; ///< bytes currently held by buffers
+   size_t   peakBytesInUse()   const; ///< maximum of bytesInUse() since the last resetStatistics()
+   size_t   bytesCached()      const; ///< bytes currently kept in the pool
+   void     resetStatistics();
+   //@}
+   //*******************************************************************************************************************
+
+private:
+
+   BufferPool();
+
+   struct Header
+   {
+      size_t bytes;     //< usable bytes of the allocation
+      bool   hugePages; //< allocated with 2 MiB alignment
+   };
+
+   static const size_t HEADER_SIZE    = 64;       //< keeps the buffer memory cache line aligned
+   static const size_t MIN_CLASS_SIZE = 64;
+   static const size_t NUM_CLASSES    = 42;       //< 64 bytes, ..., 2^47 bytes
+   static const size_t HUGE_PAGE_SIZE = 2 << 20;
+
+   static size_t sizeClass( size_t bytes );
+   static size_t classSize( size_t sizeClass ) { return MIN_CLASS_SIZE << sizeClass; }
+
+   void * allocateFromSystem( size_t bytes );
+   static void freeToSystem( void * ptr );
+
+   mutable std::mutex mutex_;
+
+   bool   pooling_;
+   bool   hugePages_;
+   size_t cacheLimit_;
+
+   std::array< std::vector< void * >, NUM_CLASSES > freeLists_;
+
+   uint64_t numAllocations_;
+   uint64_t numReuses_;
+   uint64_t numReallocations_;
+   uint64_t bytesCopied_;
+   size_t   bytesInUse_;
+   size_t   peakBytesInUse_;
+   size_t   bytesCached_;
+};
+
+
+
+} // namespace mpi
+} // namespace walberla
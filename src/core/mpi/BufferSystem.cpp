@@ -84,34 +84,69 @@ bool BufferSystem::iterator::operator!=( const BufferSystem::iterator & other )
 
 BufferSystem::BufferSystem( const MPI_Comm & communicator, int tag )
    : knownSizeComm_  ( communicator, tag ),
+     persistentKnownSizeComm_( communicator, tag ),
      unknownSizeComm_( communicator, tag ),
      noMPIComm_( communicator, tag ),
+     unknownSendersComm_( communicator, tag ),
+     neighborCollectiveComm_( communicator, tag ),
+     sharedMemoryComm_( communicator, tag ),
      currentComm_    ( nullptr ),
+     unknownSenders_( false ),
+     persistentRequests_( false ),
+     neighborCollectives_( false ),
+     sharedMemory_( false ),
      sizeChangesEverytime_( true ),
-     communicationRunning_( false )
+     communicationRunning_( false ),
+     bytesSent_( 0 ),
+     bytesReceived_( 0 )
 {
 }
 
 
 BufferSystem::BufferSystem( const BufferSystem &other )
    : knownSizeComm_  ( other.knownSizeComm_.getCommunicator(), other.knownSizeComm_.getTag() ),
+     persistentKnownSizeComm_( other.knownSizeComm_.getCommunicator(), other.knownSizeComm_.getTag() ),
      unknownSizeComm_( other.knownSizeComm_.getCommunicator(), other.knownSizeComm_.getTag() ),
      noMPIComm_      ( other.knownSizeComm_.getCommunicator(), other.knownSizeComm_.getTag() ),
+     unknownSendersComm_( other.knownSizeComm_.getCommunicator(), other.knownSizeComm_.getTag() ),
+     neighborCollectiveComm_( other.knownSizeComm_.getCommunicator(), other.knownSizeComm_.getTag() ),
+     sharedMemoryComm_( other.knownSizeComm_.getCommunicator(), other.knownSizeComm_.getTag() ),
      currentComm_ ( nullptr ),
+     unknownSenders_( other.unknownSenders_ ),
+     persistentRequests_( other.persistentRequests_ ),
+     neighborCollectives_( other.neighborCollectives_ ),
+     sharedMemory_( other.sharedMemory_ ),
      sizeChangesEverytime_( other.sizeChangesEverytime_ ),
      communicationRunning_( other.communicationRunning_ ),
+     bytesSent_( other.bytesSent_ ),
+     bytesReceived_( other.bytesReceived_ ),
      recvInfos_( other.recvInfos_ ),
      sendInfos_( other.sendInfos_ )
 {
    WALBERLA_ASSERT( !communicationRunning_, "Can't copy BufferSystem while communication is running" );
    if( other.currentComm_ == &other.knownSizeComm_ )
       currentComm_ = &knownSizeComm_;
+   else if ( other.currentComm_ == &other.persistentKnownSizeComm_ )
+      currentComm_ = &persistentKnownSizeComm_;
    else if ( other.currentComm_ == &other.unknownSizeComm_ )
       currentComm_ = &unknownSizeComm_;
    else if ( other.currentComm_ == &other.noMPIComm_ )
       currentComm_ = &noMPIComm_;
+   else if ( other.currentComm_ == &other.unknownSendersComm_ )
+      currentComm_ = &unknownSendersComm_;
+   else if ( other.currentComm_ == &other.neighborCollectiveComm_ )
+      currentComm_ = &neighborCollectiveComm_;
+   else if ( other.currentComm_ == &other.sharedMemoryComm_ )
+      currentComm_ = &sharedMemoryComm_;
    else
       currentComm_ = nullptr; // receiver information not yet set
+
+   // the graph communicator is not copied, it is recreated in the next communication step
+   neighborCollectiveComm_.setKnownSize( other.neighborCollectiveComm_.isSizeKnown() );
+   neighborCollectiveComm_.resetNeighborhood();
+
+   // the shared memory window is not copied, it is created in the next communication step
+   sharedMemoryComm_.setKnownSize( other.sharedMemoryComm_.isSizeKnown() );
 }
 
 
@@ -119,20 +154,41 @@ BufferSystem & BufferSystem::operator=( const BufferSystem & other )
 {
    WALBERLA_ASSERT( !communicationRunning_, "Can't copy BufferSystem while communication is running" );
 
+   unknownSenders_ = other.unknownSenders_;
+   persistentRequests_ = other.persistentRequests_;
+   neighborCollectives_ = other.neighborCollectives_;
+   sharedMemory_ = other.sharedMemory_;
    sizeChangesEverytime_ = other.sizeChangesEverytime_;
    communicationRunning_ = other.communicationRunning_;
+   bytesSent_ = other.bytesSent_;
+   bytesReceived_ = other.bytesReceived_;
    recvInfos_ = other.recvInfos_;
    sendInfos_ = other.sendInfos_;
 
    if( other.currentComm_ == &other.knownSizeComm_ )
       currentComm_ = &knownSizeComm_;
+   else if ( other.currentComm_ == &other.persistentKnownSizeComm_ )
+      currentComm_ = &persistentKnownSizeComm_;
    else if ( other.currentComm_ == &other.unknownSizeComm_ )
       currentComm_ = &unknownSizeComm_;
    else if ( other.currentComm_ == &other.noMPIComm_ )
       currentComm_ = &noMPIComm_;
+   else if ( other.currentComm_ == &other.unknownSendersComm_ )
+      currentComm_ = &unknownSendersComm_;
+   else if ( other.currentComm_ == &other.neighborCollectiveComm_ )
+      currentComm_ = &neighborCollectiveComm_;
+   else if ( other.currentComm_ == &other.sharedMemoryComm_ )
+      currentComm_ = &sharedMemoryComm_;
    else
       currentComm_ = nullptr; // receiver information not yet set
 
+   // the graph communicator is not copied, it is recreated in the next communication step
+   neighborCollectiveComm_.setKnownSize( other.neighborCollectiveComm_.isSizeKnown() );
+   neighborCollectiveComm_.resetNeighborhood();
+
+   // the shared memory window is not copied, it is created in the next communication step
+   sharedMemoryComm_.setKnownSize( other.sharedMemoryComm_.isSizeKnown() );
+
    return *this;
 }
 
@@ -165,6 +221,8 @@ void BufferSystem::setReceiverInfo( const std::set<MPIRank> & ranksToRecvFrom, b
    }
 
    sizeChangesEverytime_ = changingSize;
+   unknownSenders_ = false;
+   neighborCollectiveComm_.resetNeighborhood();
    setCommunicationType( false ); // no size information on first run -> UnknownSizeCommunication
 }
 
@@ -193,6 +251,8 @@ void BufferSystem::setReceiverInfo( const std::map<MPIRank,MPISize> & ranksToRec
    }
 
    sizeChangesEverytime_ = false;
+   unknownSenders_ = false;
+   neighborCollectiveComm_.resetNeighborhood();
    setCommunicationType( true );
 }
 
@@ -233,12 +293,44 @@ void BufferSystem::setReceiverInfoFromSendBufferState( bool useSizeFromSendBuffe
    }
 
    sizeChangesEverytime_ = changingSize;
+   unknownSenders_ = false;
+   neighborCollectiveComm_.resetNeighborhood();
 
    setCommunicationType( useSizeFromSendBuffers );
 }
 
 
 
+//**********************************************************************************************************************
+/*! Sets receiver information, when the processes that send messages to this process are unknown
+*
+* In every communication step, messages are detected using MPI_Iprobe and received as soon as they arrive.
+* The end of the communication step is determined with a non-blocking barrier that every process enters after all
+* of its own messages have been received by their destinations ("NBX" algorithm, see Hoefler et al., "Scalable
+* communication protocols for dynamic sparse data exchange", PPoPP 2010). Hence, no process needs to know its
+* senders, and no all-to-all communication is required to set up the communication partners.
+*
+* Restrictions:
+*  - every process of the communicator has to take part in every communication step (the barrier is collective)
+*  - all SendBuffers have to be sent (sendAll()) before the iteration over the received messages starts
+*
+* The setting remains active until one of the other setReceiverInfo*() functions is called.
+*/
+//**********************************************************************************************************************
+void BufferSystem::setReceiverInfoUnknownSenders()
+{
+   WALBERLA_ASSERT( ! communicationRunning_ );
+
+   recvInfos_.clear();
+
+   sizeChangesEverytime_ = true;
+   unknownSenders_ = true;
+
+   setCommunicationType( false );
+}
+
+
+
 //**********************************************************************************************************************
 /*! Notifies that BufferSystem that message sizes have changed ( and optionally are changing in all following steps)
 *
@@ -259,6 +351,96 @@ void BufferSystem::sizeHasChanged( bool alwaysChangingSize )
 
 
 
+//**********************************************************************************************************************
+/*! Enables/disables the use of persistent MPI requests
+*
+* If enabled, persistent requests (MPI_Send_init / MPI_Recv_init) are used for all communication steps where the
+* message sizes are known. The requests are created in the first of these steps and then restarted in all following
+* steps, as long as the communication partners and the message sizes do not change. This is most beneficial for
+* small messages that are exchanged many times, where the MPI latency dominates.
+* Can only be called if no communication is currently running.
+*/
+//**********************************************************************************************************************
+void BufferSystem::usePersistentRequests( bool val )
+{
+   WALBERLA_ASSERT( ! communicationRunning_ );
+
+   persistentRequests_ = val;
+
+   if( currentComm_ == &knownSizeComm_ || currentComm_ == &persistentKnownSizeComm_ )
+      setCommunicationType( true );
+}
+
+
+
+//**********************************************************************************************************************
+/*! Enables/disables the use of MPI neighborhood collectives
+*
+* If enabled, a distributed graph communicator is created from the ranks where messages are received from, and all
+* messages of a communication step are exchanged with a single MPI_Ineighbor_alltoallw call (if the message sizes are
+* unknown, they are exchanged with MPI_Neighbor_alltoall before). This allows the MPI library to optimize the
+* communication for the process topology and reduces the per-message overhead for many small messages.
+*
+* Restrictions:
+*  - the communication has to be symmetric: messages can only be sent to ranks where messages are received from
+*  - every process of the communicator has to take part in every communication step (the exchange is collective)
+*  - the graph communicator is created collectively in the first communication step after the receiver information
+*    was set. Hence, all processes have to set their receiver information (and have to call sizeHasChanged()) in
+*    the same communication steps.
+*  - all SendBuffers have to be sent (sendAll()) before the iteration over the received messages starts
+*
+* Neighborhood collectives are not used if the senders are unknown (see setReceiverInfoUnknownSenders()).
+* Can only be called if no communication is currently running.
+*/
+//**********************************************************************************************************************
+void BufferSystem::useNeighborCollectives( bool val )
+{
+   WALBERLA_ASSERT( ! communicationRunning_ );
+
+   if( val && ! neighborCollectives_ )
+      neighborCollectiveComm_.resetNeighborhood();
+
+   neighborCollectives_ = val;
+
+   if( currentComm_ != nullptr && currentComm_ != &unknownSendersComm_ && currentComm_ != &noMPIComm_ )
+      setCommunicationType( ! isSizeCommunicatedInNextStep() );
+}
+
+
+
+//**********************************************************************************************************************
+/*! Enables/disables the exchange of messages within a node via MPI-3 shared memory
+*
+* If enabled, the processes of the communicator that share memory (MPI_Comm_split_type with MPI_COMM_TYPE_SHARED)
+* exchange their messages via a shared memory window: the sender copies the message into its segment of the window,
+* and after a barrier of the node the receiver copies it directly out of this segment. The MPI message matching and
+* progress engine is only used for the messages between different nodes (with known or unknown message sizes as
+* usual). This reduces the overhead of intra-node messages for runs with one process per core.
+*
+* Restrictions:
+*  - every process of the communicator has to take part in every communication step (the exchange within a node is
+*    collective), and all processes have to enable/disable the shared memory exchange in the same steps
+*  - the node communicator and the window are created collectively in the first communication step, the window is
+*    freed collectively when the BufferSystem is destroyed
+*  - all SendBuffers have to be sent (sendAll()) before the iteration over the received messages starts
+*
+* The shared memory exchange takes precedence over neighborhood collectives (see useNeighborCollectives()) and is not
+* used if the senders are unknown (see setReceiverInfoUnknownSenders()).
+* Can only be called if no communication is currently running.
+*/
+//**********************************************************************************************************************
+void BufferSystem::useSharedMemory( bool val )
+{
+   WALBERLA_ASSERT( ! communicationRunning_ );
+
+   sharedMemory_ = val;
+
+   if( currentComm_ != nullptr && currentComm_ != &unknownSendersComm_ && currentComm_ != &noMPIComm_ )
+      setCommunicationType( ! isSizeCommunicatedInNextStep() );
+}
+
+
+
 //======================================================================================================================
 //
 //  Step 1: Schedule Receives and ISends
@@ -303,11 +485,18 @@ void BufferSystem::sendAll()
       if ( ! iter->second.alreadySent )
       {
          if ( iter->second.buffer.size() > 0 )
+         {
+            if( unknownSenders_ && currentComm_ == &noMPIComm_ )
+               recvInfos_[ iter->first ].size = INVALID_SIZE; // without MPI, this process is the only receiver
             currentComm_->send( iter->first, iter->second.buffer );
+            bytesSent_ += iter->second.buffer.size();
+         }
 
          iter->second.alreadySent = true;
       }
    }
+
+   currentComm_->sendsCompleted();
 }
 
 
@@ -331,7 +520,12 @@ void BufferSystem::send( MPIRank rank )
    WALBERLA_ASSERT( ! iter->second.alreadySent ); // this buffer has already been sent
 
    if ( iter->second.buffer.size() > 0 )
+   {
+      if( unknownSenders_ && currentComm_ == &noMPIComm_ )
+         recvInfos_[ rank ].size = INVALID_SIZE; // without MPI, this process is the only receiver
       currentComm_->send( rank, iter->second.buffer );
+      bytesSent_ += iter->second.buffer.size();
+   }
 
    iter->second.alreadySent = true;
 }
@@ -360,6 +554,9 @@ void BufferSystem::startCommunication()
 
    WALBERLA_CHECK( ! communicationRunning_ );
 
+   if( unknownSenders_ )
+      recvInfos_.clear();
+
    currentComm_->scheduleReceives( recvInfos_ );
    communicationRunning_ = true;
 }
@@ -415,7 +612,11 @@ RecvBuffer * BufferSystem::waitForNext( MPIRank & fromRank )
    fromRank = currentComm_->waitForNextReceive( recvInfos_ );
 
    if( fromRank >= 0 )
-      return & ( recvInfos_[fromRank].buffer );
+   {
+      RecvBuffer & buffer = recvInfos_[fromRank].buffer;
+      bytesReceived_ += buffer.size();
+      return & buffer;
+   }
    else
    {
       endCommunication();
@@ -439,7 +640,21 @@ void BufferSystem::setCommunicationType( const bool knownSize )
 
    WALBERLA_MPI_SECTION()
    {
-      if( knownSize )
+      if( unknownSenders_ )
+         currentComm_ = &unknownSendersComm_;
+      else if( sharedMemory_ )
+      {
+         sharedMemoryComm_.setKnownSize( knownSize );
+         currentComm_ = &sharedMemoryComm_;
+      }
+      else if( neighborCollectives_ )
+      {
+         neighborCollectiveComm_.setKnownSize( knownSize );
+         currentComm_ = &neighborCollectiveComm_;
+      }
+      else if( knownSize && persistentRequests_ )
+         currentComm_ = &persistentKnownSizeComm_;
+      else if( knownSize )
          currentComm_ = &knownSizeComm_;
       else
          currentComm_ = &unknownSizeComm_;
@@ -43,6 +43,7 @@ class OpenMPBufferSystem;
 *   Features / Restrictions:
 *    - usable in every case where normal MPI_Send, MPI_Recv is needed
 *    - communication partners have to be known, message size not necessarily
+*      ( exception: with setReceiverInfoUnknownSenders() the senders are discovered during communication )
 *    - unknown message sizes possible ( -> automatic extra message to exchange sizes )
 *    - Implemented with non-blocking MPI calls, and MPI_Waitany to process a message as soon
 *      as it was received while still waiting for other messages
@@ -84,7 +85,21 @@ class OpenMPBufferSystem;
 *          of the received messages. If the message sizes are unknown, they have to be communicated first.
 *          One also defines if the sizes stay constant or if they change in each communication step
 *           (size message is then sent before every content message)
+*        - If a process does not know which processes send to it, use setReceiverInfoUnknownSenders() instead.
+*          Messages are then detected with MPI_Iprobe, and a non-blocking barrier determines the end of the
+*          communication step ("NBX" algorithm). This avoids an all-to-all exchange of the communication partners.
+*          All processes of the communicator have to take part in every communication step, and all
+*          SendBuffers have to be sent before the iteration over the received messages starts.
 *        - The receiver and send information can be changed, if no communication is currently running.
+*        - If the same messages (same communication partners, same sizes) are exchanged in many communication steps,
+*          usePersistentRequests() can be enabled: while the message sizes are known, persistent MPI requests are
+*          created once and restarted in every step instead of calling MPI_Isend/MPI_Irecv again.
+*        - For symmetric communication patterns (we receive from the same processes that we send to), the messages can
+*          be exchanged with MPI neighborhood collectives on a distributed graph topology (useNeighborCollectives()).
+*          All processes have to take part in every communication step and have to change their receiver information
+*          in the same steps.
+*        - Messages between processes of the same node can be exchanged via an MPI-3 shared memory window instead of
+*          MPI messages (useSharedMemory()). All processes have to take part in every communication step.
 *
 *    2. Communication Step:
 *        - Optionally call scheduleReceives() -> starts communication step and causes MPI_IRecv's to be called.
@@ -131,8 +146,13 @@ public:
 
    void setReceiverInfo( const std::map<MPIRank,MPISize> & ranksToRecvFrom );
    void setReceiverInfoFromSendBufferState( bool useSizeFromSendBuffers, bool changingSize );
+   void setReceiverInfoUnknownSenders();
 
    void sizeHasChanged( bool alwaysChangingSize = false );
+
+   void usePersistentRequests( bool val );
+   void useNeighborCollectives( bool val );
+   void useSharedMemory( bool val );
    //@}
    //*******************************************************************************************************************
 
@@ -187,9 +207,26 @@ public:
    //** Status Queries        ******************************************************************************************
    /*! \name Status Queries  */
    //@{
-   bool isSizeCommunicatedInNextStep() const { return (currentComm_ == &unknownSizeComm_); }
+   bool isSizeCommunicatedInNextStep() const { return (currentComm_ == &unknownSizeComm_) ||
+                                                      (currentComm_ == &neighborCollectiveComm_ && !neighborCollectiveComm_.isSizeKnown()) ||
+                                                      (currentComm_ == &sharedMemoryComm_ && !sharedMemoryComm_.isSizeKnown()); }
    bool isCommunciationRunning() const       { return communicationRunning_;               }
    bool isReceiverInformationSet() const     { return currentComm_ != NULL;                }
+   bool areSendersUnknown() const            { return unknownSenders_;                     }
+   bool persistentRequestsUsed() const       { return persistentRequests_;                 }
+   bool neighborCollectivesUsed() const      { return neighborCollectives_;                }
+   bool sharedMemoryUsed() const             { return sharedMemory_;                       }
+   //@}
+   //*******************************************************************************************************************
+
+
+   //** Statistics        **********************************************************************************************
+   /*! \name Statistics  */
+   //@{
+   /// Number of bytes sent/received (message payload) since construction or the last resetStatistics() call
+   uint64_t getBytesSent()     const { return bytesSent_;     }
+   uint64_t getBytesReceived() const { return bytesReceived_; }
+   void     resetStatistics()        { bytesSent_ = 0; bytesReceived_ = 0; }
    //@}
    //*******************************************************************************************************************
 
@@ -217,13 +254,25 @@ protected:
    void setCommunicationType( const bool knownSize );
 
    internal::KnownSizeCommunication   knownSizeComm_;
+   internal::PersistentKnownSizeCommunication persistentKnownSizeComm_;
    internal::UnknownSizeCommunication unknownSizeComm_;
    internal::NoMPICommunication       noMPIComm_;
+   internal::NonblockingConsensusCommunication unknownSendersComm_;
+   internal::NeighborCollectiveCommunication neighborCollectiveComm_;
+   internal::SharedMemoryCommunication sharedMemoryComm_;
    internal::AbstractCommunication *  currentComm_;  //< after receiver setup, this points to unknown- or knownSizeComm_
 
+   bool unknownSenders_;       //< if set to true, senders are discovered during communication ( -> unknownSendersComm_ )
+   bool persistentRequests_;   //< if set to true, persistentKnownSizeComm_ is used instead of knownSizeComm_
+   bool neighborCollectives_;  //< if set to true, neighborCollectiveComm_ is used (unless senders are unknown)
+   bool sharedMemory_;         //< if set to true, sharedMemoryComm_ is used (unless senders are unknown)
+
    bool sizeChangesEverytime_; //< if set to true, the receiveSizeUnknown_ is set to true before communicating
    bool communicationRunning_; //< indicates if a communication step is currently running
 
+   uint64_t bytesSent_;
+   uint64_t bytesReceived_;
+
 
    /// Info about the message to be received from a certain rank:
    /// information holds the buffer and, if known, the message size
@@ -275,6 +324,8 @@ void BufferSystem::setReceiverInfo( RankIter rankBegin, RankIter rankEnd, bool c
    }
 
    sizeChangesEverytime_ = changingSize;
+   unknownSenders_ = false;
+   neighborCollectiveComm_.resetNeighborhood();
    setCommunicationType( false );
 }
 
@@ -23,9 +23,13 @@
 #include "MPIManager.h"
 
 #include "core/Abort.h"
+#include "core/debug/CheckFunctions.h"
 #include "core/debug/Debug.h"
 #include "core/logging/Logging.h"
 
+#include <algorithm>
+#include <cstring>
+
 
 namespace walberla {
 namespace mpi {
@@ -164,6 +168,194 @@ MPIRank KnownSizeCommunication::waitForNextReceive( std::map<MPIRank, ReceiveInf
 
 
 
+//======================================================================================================================
+//
+//  Persistent Known Size Communication
+//
+//======================================================================================================================
+
+
+PersistentKnownSizeCommunication::~PersistentKnownSizeCommunication()
+{
+   WALBERLA_MPI_SECTION()
+   {
+      if( ! MPIManager::instance()->isMPIInitialized() )
+         return;
+
+      for( auto it = sendRequests_.begin(); it != sendRequests_.end(); ++it )
+         freeRequest( *it );
+      for( auto it = recvRequests_.begin(); it != recvRequests_.end(); ++it )
+         freeRequest( *it );
+   }
+}
+
+
+
+void PersistentKnownSizeCommunication::freeRequest( MPI_Request & request )
+{
+   if( request != MPI_REQUEST_NULL )
+      MPI_Request_free( &request );
+}
+
+
+
+void PersistentKnownSizeCommunication::send( MPIRank receiver, const SendBuffer & sendBuffer )
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   if ( ! sending_ )
+      sending_ = true;
+
+   auto indexIt = sendRequestIndex_.find( receiver );
+   if( indexIt == sendRequestIndex_.end() )
+   {
+      indexIt = sendRequestIndex_.insert( std::make_pair( receiver, sendRequests_.size() ) ).first;
+      sendRequests_.push_back( MPI_REQUEST_NULL );
+      sendRequestInfos_.push_back( PersistentRequest{ receiver, nullptr, 0 } );
+   }
+
+   MPI_Request & request = sendRequests_[ indexIt->second ];
+   PersistentRequest & info = sendRequestInfos_[ indexIt->second ];
+
+   if( request == MPI_REQUEST_NULL || info.ptr != sendBuffer.ptr() || info.size != int_c( sendBuffer.size() ) )
+   {
+      freeRequest( request );
+
+      info.ptr  = sendBuffer.ptr();
+      info.size = int_c( sendBuffer.size() );
+
+      MPI_Send_init( sendBuffer.ptr(),           // pointer to send buffer
+                     int_c( sendBuffer.size() ), // size of message
+                     MPI_BYTE,                   // type
+                     receiver,                   // receiver rank
+                     tag_,                       // message tag
+                     communicator_,              // communicator
+                     &request                    // persistent request
+                     );
+   }
+
+   MPI_Start( &request );
+}
+
+
+
+void PersistentKnownSizeCommunication::waitForSends()
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   sending_ = false;
+
+   if ( sendRequests_.empty() )
+      return;
+
+   // requests of receivers that were not sent to in this step are inactive and complete immediately
+   MPI_Waitall( int_c( sendRequests_.size() ),
+                &sendRequests_[0],
+                MPI_STATUSES_IGNORE );
+}
+
+
+
+void PersistentKnownSizeCommunication::scheduleReceives( std::map<MPIRank, ReceiveInfo> & recvInfos )
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   WALBERLA_ASSERT( ! receiving_ );
+
+   for( uint_t i = recvInfos.size(); i < recvRequests_.size(); ++i )
+      freeRequest( recvRequests_[i] );
+
+   recvRequests_.resize( recvInfos.size(), MPI_REQUEST_NULL );
+   recvRequestInfos_.resize( recvInfos.size(), PersistentRequest{ INVALID_RANK, nullptr, 0 } );
+   size_t recvCount = 0;
+
+   for( auto it = recvInfos.begin(); it != recvInfos.end(); ++it, ++recvCount )
+   {
+      const MPIRank senderRank = it->first;
+      ReceiveInfo & recvInfo   = it->second;
+
+      // This is the known-size communication -> here valid sizes are needed
+      WALBERLA_ASSERT_GREATER( recvInfo.size, 0 );
+
+      recvInfo.buffer.resize( uint_c( recvInfo.size ) );
+
+      MPI_Request & request = recvRequests_[ recvCount ];
+      PersistentRequest & info = recvRequestInfos_[ recvCount ];
+
+      if( request != MPI_REQUEST_NULL && info.rank == senderRank && info.ptr == recvInfo.buffer.ptr() && info.size == recvInfo.size )
+         continue;
+
+      freeRequest( request );
+
+      info.rank = senderRank;
+      info.ptr  = recvInfo.buffer.ptr();
+      info.size = recvInfo.size;
+
+      MPI_Recv_init( recvInfo.buffer.ptr(), // pointer to receive buffer
+                     recvInfo.size,         // size of expected message
+                     MPI_BYTE,              // type
+                     senderRank,            // rank of sender process
+                     tag_,                  // message tag
+                     communicator_,         // communicator
+                     &request               // persistent request
+                     );
+   }
+
+   WALBERLA_ASSERT_EQUAL( recvCount, recvRequests_.size() );
+
+   if( ! recvRequests_.empty() )
+      MPI_Startall( int_c( recvRequests_.size() ), &recvRequests_[0] );
+
+   receiving_ = true;
+}
+
+
+
+MPIRank PersistentKnownSizeCommunication::waitForNextReceive( std::map<MPIRank, ReceiveInfo> & recvInfos )
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   WALBERLA_ASSERT( receiving_ );
+
+   if( recvRequests_.empty() ) {
+      receiving_ = false;
+      return INVALID_RANK;
+   }
+
+   // completed persistent requests become inactive (but are not freed) and are ignored by subsequent MPI_Waitany calls
+   MPI_Status status;
+   int requestIndex = -1; // output parameter initialized with invalid value
+   MPI_Waitany( int_c( recvRequests_.size() ),
+                & recvRequests_[0],
+                & requestIndex,
+                & status );
+
+   if ( requestIndex == MPI_UNDEFINED )
+   {
+      receiving_ = false;
+      return INVALID_RANK;
+   }
+
+   WALBERLA_ASSERT_GREATER_EQUAL( requestIndex, 0 );
+   WALBERLA_ASSERT_LESS( requestIndex, int_c( recvRequests_.size() ) );
+
+   MPIRank senderRank = status.MPI_SOURCE;
+   WALBERLA_ASSERT_EQUAL( senderRank, recvRequestInfos_[ uint_c( requestIndex ) ].rank );
+
+#ifndef NDEBUG
+   int receivedBytes;
+   MPI_Get_count( &status, MPI_BYTE, &receivedBytes );
+   WALBERLA_ASSERT_EQUAL ( recvInfos[senderRank].size, receivedBytes );
+#else
+   WALBERLA_UNUSED( recvInfos );
+#endif
+
+   return senderRank;
+}
+
+
+
+
 //======================================================================================================================
 //
 //  Unknown Size Communication
@@ -345,6 +537,613 @@ MPIRank UnknownSizeCommunication::waitForNextReceive( std::map<MPIRank, ReceiveI
 
 
 
+//======================================================================================================================
+//
+//  Nonblocking Consensus Communication
+//
+//======================================================================================================================
+
+
+NonblockingConsensusCommunication::~NonblockingConsensusCommunication()
+{
+   WALBERLA_MPI_SECTION()
+   {
+      if( duplicateCommunicator_ != MPI_COMM_NULL && MPIManager::instance()->isMPIInitialized() )
+         MPI_Comm_free( &duplicateCommunicator_ );
+   }
+}
+
+
+
+void NonblockingConsensusCommunication::send( MPIRank receiver, const SendBuffer & sendBuffer )
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   if ( ! sending_ )
+      sending_ = true;
+
+   // synchronous send: completes only if the receiver has matched the message
+   sendRequests_.push_back( MPI_REQUEST_NULL );
+   MPI_Request & request = sendRequests_.back();
+   MPI_Issend( sendBuffer.ptr(),           // pointer to size buffer
+               int_c( sendBuffer.size() ), // send one size
+               MPI_BYTE,                   // type
+               receiver,                   // receiver rank
+               tag_,                       // message tag
+               stepCommunicator_,          // communicator
+               &request                    // request needed for test/wait
+               );
+}
+
+
+
+void NonblockingConsensusCommunication::waitForSends()
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   sending_ = false;
+
+   // all sends have already completed when waitForNextReceive() returned INVALID_RANK
+   if ( sendRequests_.empty() )
+      return;
+
+   MPI_Waitall( int_c( sendRequests_.size() ),
+                &sendRequests_[0],
+                MPI_STATUSES_IGNORE );
+
+   sendRequests_.clear();
+}
+
+
+
+void NonblockingConsensusCommunication::scheduleReceives( std::map<MPIRank, ReceiveInfo> & recvInfos )
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   WALBERLA_ASSERT( ! receiving_ );
+
+   // senders are unknown - they are discovered in waitForNextReceive()
+   recvInfos.clear();
+
+   if( duplicateCommunicator_ == MPI_COMM_NULL )
+      MPI_Comm_dup( communicator_, &duplicateCommunicator_ );
+
+   stepCommunicator_ = oddStep_ ? duplicateCommunicator_ : communicator_;
+   oddStep_ = !oddStep_;
+
+   barrierActive_  = false;
+   barrierRequest_ = MPI_REQUEST_NULL;
+   receiving_ = true;
+}
+
+
+
+MPIRank NonblockingConsensusCommunication::waitForNextReceive( std::map<MPIRank, ReceiveInfo> & recvInfos )
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   if( ! receiving_ )
+      return INVALID_RANK;
+
+   while( true )
+   {
+      int        probeFlag = 0;
+      MPI_Status status;
+      MPI_Iprobe( MPI_ANY_SOURCE, tag_, stepCommunicator_, &probeFlag, &status );
+
+      if( probeFlag )
+      {
+         const MPIRank senderRank = status.MPI_SOURCE;
+         WALBERLA_ASSERT_GREATER_EQUAL( senderRank, 0 );
+
+         int receivedBytes;
+         MPI_Get_count( &status, MPI_BYTE, &receivedBytes );
+
+         ReceiveInfo & recvInfo = recvInfos[ senderRank ];
+         WALBERLA_ASSERT( recvInfo.buffer.isEmpty(), "Received two messages from rank " << senderRank << " in one communication step" );
+
+         recvInfo.size = receivedBytes;
+         recvInfo.buffer.resize( uint_c( receivedBytes ) );
+
+         MPI_Recv( recvInfo.buffer.ptr(),   // where to store the message
+                   receivedBytes,           // size of the message
+                   MPI_BYTE,                // type
+                   senderRank,              // rank of sender process
+                   tag_,                    // message tag
+                   stepCommunicator_,       // communicator
+                   MPI_STATUS_IGNORE        // status
+                   );
+
+         return senderRank;
+      }
+
+      if( barrierActive_ )
+      {
+         // the barrier completes after all processes have entered it, i.e., after all messages have been received
+         int barrierFlag = 0;
+         MPI_Test( &barrierRequest_, &barrierFlag, MPI_STATUS_IGNORE );
+         if( barrierFlag )
+         {
+            barrierActive_ = false;
+            receiving_ = false;
+            return INVALID_RANK;
+         }
+      }
+      else
+      {
+         // enter the barrier as soon as all messages sent by this process have been matched by their receivers
+         int sendsFlag = 1;
+         if( ! sendRequests_.empty() )
+            MPI_Testall( int_c( sendRequests_.size() ), &sendRequests_[0], &sendsFlag, MPI_STATUSES_IGNORE );
+
+         if( sendsFlag )
+         {
+            sendRequests_.clear();
+            MPI_Ibarrier( stepCommunicator_, &barrierRequest_ );
+            barrierActive_ = true;
+         }
+      }
+   }
+
+   WALBERLA_ASSERT( false );
+   return INVALID_RANK; //cannot happen - only to prevent compiler warnings
+}
+
+
+
+
+//======================================================================================================================
+//
+//  Neighbor Collective Communication
+//
+//======================================================================================================================
+
+
+NeighborCollectiveCommunication::~NeighborCollectiveCommunication()
+{
+   WALBERLA_MPI_SECTION()
+   {
+      if( graphCommunicator_ != MPI_COMM_NULL && MPIManager::instance()->isMPIInitialized() )
+         MPI_Comm_free( &graphCommunicator_ );
+   }
+}
+
+
+
+void NeighborCollectiveCommunication::createGraphCommunicator( const std::map<MPIRank, ReceiveInfo> & recvInfos )
+{
+   if( graphCommunicator_ != MPI_COMM_NULL )
+      MPI_Comm_free( &graphCommunicator_ );
+
+   neighbors_.clear();
+   neighborIndex_.clear();
+   for( auto it = recvInfos.begin(); it != recvInfos.end(); ++it )
+   {
+      neighborIndex_[ it->first ] = int_c( neighbors_.size() );
+      neighbors_.push_back( it->first );
+   }
+
+   // symmetric communication -> sources and destinations are identical
+   const int degree = int_c( neighbors_.size() );
+   MPI_Dist_graph_create_adjacent( communicator_,
+                                   degree, neighbors_.empty() ? nullptr : &neighbors_[0], MPI_UNWEIGHTED, // sources
+                                   degree, neighbors_.empty() ? nullptr : &neighbors_[0], MPI_UNWEIGHTED, // destinations
+                                   MPI_INFO_NULL,
+                                   0,                                                                     // no reordering
+                                   &graphCommunicator_ );
+
+   sendCounts_.assign( neighbors_.size(), 0 );
+   sendDisplacements_.assign( neighbors_.size(), 0 );
+   recvCounts_.assign( neighbors_.size(), 0 );
+   recvDisplacements_.assign( neighbors_.size(), 0 );
+   types_.assign( neighbors_.size(), MPI_BYTE );
+
+   neighborhoodValid_ = true;
+}
+
+
+
+void NeighborCollectiveCommunication::send( MPIRank receiver, const SendBuffer & sendBuffer )
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   WALBERLA_ASSERT( receiving_ );          // scheduleReceives() creates the graph communicator
+   WALBERLA_ASSERT( ! exchangeStarted_ );  // all buffers have to be sent before the exchange starts
+
+   if ( ! sending_ )
+      sending_ = true;
+
+   auto index = neighborIndex_.find( receiver );
+   WALBERLA_CHECK( index != neighborIndex_.end(), "Message to rank " << receiver << " cannot be sent with neighborhood "
+                   "collectives: only messages to ranks where messages are received from are possible." );
+
+   sendCounts_[ uint_c( index->second ) ] = int_c( sendBuffer.size() );
+   MPI_Get_address( sendBuffer.ptr(), &sendDisplacements_[ uint_c( index->second ) ] );
+}
+
+
+
+void NeighborCollectiveCommunication::sendsCompleted()
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   if( receiving_ && ! exchangeStarted_ )
+      startExchange();
+}
+
+
+
+void NeighborCollectiveCommunication::startExchange()
+{
+   WALBERLA_ASSERT_NOT_NULLPTR( recvInfos_ );
+
+   if( ! knownSize_ )
+   {
+      MPI_Neighbor_alltoall( sendCounts_.empty() ? nullptr : &sendCounts_[0], 1, MPITrait<MPISize>::type(),
+                             recvCounts_.empty() ? nullptr : &recvCounts_[0], 1, MPITrait<MPISize>::type(),
+                             graphCommunicator_ );
+   }
+
+   for( uint_t i = 0; i < neighbors_.size(); ++i )
+   {
+      ReceiveInfo & recvInfo = (*recvInfos_)[ neighbors_[i] ];
+      if( knownSize_ )
+         recvCounts_[i] = recvInfo.size;
+      else
+         recvInfo.size = recvCounts_[i];
+
+      WALBERLA_ASSERT_GREATER_EQUAL( recvCounts_[i], 0 );
+      recvInfo.buffer.resize( uint_c( recvCounts_[i] ) );
+      MPI_Get_address( recvInfo.buffer.ptr(), &recvDisplacements_[i] );
+   }
+
+   MPI_Ineighbor_alltoallw( MPI_BOTTOM,
+                            sendCounts_.empty()        ? nullptr : &sendCounts_[0],
+                            sendDisplacements_.empty() ? nullptr : &sendDisplacements_[0],
+                            types_.empty()             ? nullptr : &types_[0],
+                            MPI_BOTTOM,
+                            recvCounts_.empty()        ? nullptr : &recvCounts_[0],
+                            recvDisplacements_.empty() ? nullptr : &recvDisplacements_[0],
+                            types_.empty()             ? nullptr : &types_[0],
+                            graphCommunicator_,
+                            &exchangeRequest_ );
+
+   exchangeStarted_ = true;
+}
+
+
+
+void NeighborCollectiveCommunication::waitForSends()
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   sending_ = false;
+
+   // the exchange has already completed when waitForNextReceive() returned INVALID_RANK
+   if( exchangeRequest_ != MPI_REQUEST_NULL )
+      MPI_Wait( &exchangeRequest_, MPI_STATUS_IGNORE );
+
+   exchangeStarted_ = false;
+}
+
+
+
+void NeighborCollectiveCommunication::scheduleReceives( std::map<MPIRank, ReceiveInfo> & recvInfos )
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   WALBERLA_ASSERT( ! receiving_ );
+
+   if( ! neighborhoodValid_ )
+      createGraphCommunicator( recvInfos );
+
+   WALBERLA_ASSERT_EQUAL( recvInfos.size(), neighbors_.size() ); // call resetNeighborhood() if the ranks have changed
+
+   std::fill( sendCounts_.begin(), sendCounts_.end(), 0 );
+
+   recvInfos_ = &recvInfos;
+   nextReceive_ = 0;
+   exchangeStarted_ = false;
+   receiving_ = true;
+}
+
+
+
+MPIRank NeighborCollectiveCommunication::waitForNextReceive( std::map<MPIRank, ReceiveInfo> & recvInfos )
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   WALBERLA_ASSERT( receiving_ );
+   WALBERLA_ASSERT_EQUAL( &recvInfos, recvInfos_ );
+   WALBERLA_UNUSED( recvInfos );
+
+   if( ! exchangeStarted_ )
+      startExchange();
+
+   if( exchangeRequest_ != MPI_REQUEST_NULL )
+      MPI_Wait( &exchangeRequest_, MPI_STATUS_IGNORE );
+
+   // all messages have arrived, neighbors that did not send anything are skipped
+   while( nextReceive_ < neighbors_.size() )
+   {
+      const uint_t i = nextReceive_++;
+      if( recvCounts_[i] > 0 )
+         return neighbors_[i];
+   }
+
+   receiving_ = false;
+   recvInfos_ = nullptr;
+   return INVALID_RANK;
+}
+
+
+
+
+//======================================================================================================================
+//
+//  Shared Memory Communication
+//
+//======================================================================================================================
+
+
+SharedMemoryCommunication::~SharedMemoryCommunication()
+{
+   WALBERLA_MPI_SECTION()
+   {
+      if( MPIManager::instance()->isMPIInitialized() )
+      {
+         if( window_ != MPI_WIN_NULL )
+         {
+            MPI_Win_unlock_all( window_ );
+            MPI_Win_free( &window_ );
+         }
+         if( nodeCommunicator_ != MPI_COMM_NULL )
+            MPI_Comm_free( &nodeCommunicator_ );
+      }
+   }
+}
+
+
+
+void SharedMemoryCommunication::createNodeCommunicator()
+{
+   int commRank;
+   MPI_Comm_rank( communicator_, &commRank );
+   MPI_Comm_split_type( communicator_, MPI_COMM_TYPE_SHARED, commRank, MPI_INFO_NULL, &nodeCommunicator_ );
+
+   int nodeSize;
+   MPI_Comm_size( nodeCommunicator_, &nodeSize );
+   MPI_Comm_rank( nodeCommunicator_, &nodeRank_ );
+
+   // ranks of the processes of the node in communicator_
+   MPI_Group nodeGroup;
+   MPI_Group group;
+   MPI_Comm_group( nodeCommunicator_, &nodeGroup );
+   MPI_Comm_group( communicator_, &group );
+
+   std::vector<int> nodeRanks( uint_c( nodeSize ) );
+   std::vector<int> ranks( uint_c( nodeSize ) );
+   for( int i = 0; i < nodeSize; ++i )
+      nodeRanks[ uint_c(i) ] = i;
+   MPI_Group_translate_ranks( nodeGroup, nodeSize, &nodeRanks[0], group, &ranks[0] );
+
+   MPI_Group_free( &nodeGroup );
+   MPI_Group_free( &group );
+
+   nodeRanks_.clear();
+   for( int i = 0; i < nodeSize; ++i )
+      nodeRanks_[ ranks[ uint_c(i) ] ] = i;
+
+   segments_.assign( uint_c( nodeSize ), nullptr );
+}
+
+
+
+void SharedMemoryCommunication::allocateWindow( size_t segmentSize )
+{
+   if( window_ != MPI_WIN_NULL )
+   {
+      MPI_Win_unlock_all( window_ );
+      MPI_Win_free( &window_ );
+   }
+
+   // multiple of 64 bytes -> all segments (and the message tables at their beginning) are well aligned
+   segmentSize_ = 64 * ( ( segmentSize + 63 ) / 64 );
+
+   char * segment;
+   MPI_Win_allocate_shared( static_cast<MPI_Aint>( segmentSize_ ), 1, MPI_INFO_NULL, nodeCommunicator_, &segment, &window_ );
+   MPI_Win_lock_all( MPI_MODE_NOCHECK, window_ );
+
+   for( uint_t i = 0; i < segments_.size(); ++i )
+   {
+      MPI_Aint size;
+      int displacementUnit;
+      MPI_Win_shared_query( window_, int_c(i), &size, &displacementUnit, &segments_[i] );
+   }
+   WALBERLA_ASSERT_EQUAL( segments_[ uint_c( nodeRank_ ) ], segment );
+}
+
+
+
+void SharedMemoryCommunication::send( MPIRank receiver, const SendBuffer & sendBuffer )
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   WALBERLA_ASSERT( receiving_ );   // scheduleReceives() creates the node communicator
+   WALBERLA_ASSERT( ! exchanged_ ); // all buffers have to be sent before the node-local messages are exchanged
+
+   if ( ! sending_ )
+      sending_ = true;
+
+   auto nodeRank = nodeRanks_.find( receiver );
+   if( nodeRank != nodeRanks_.end() )
+      nodeSends_.push_back( std::make_pair( nodeRank->second, &sendBuffer ) );
+   else
+      remoteComm_->send( receiver, sendBuffer );
+}
+
+
+
+void SharedMemoryCommunication::sendsCompleted()
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   if( receiving_ && ! exchanged_ )
+      exchangeNodeMessages();
+}
+
+
+
+void SharedMemoryCommunication::exchangeNodeMessages()
+{
+   const size_t tableSize = segments_.size() * sizeof(MessageInfo);
+
+   uint64_t requiredSize = tableSize;
+   for( auto it = nodeSends_.begin(); it != nodeSends_.end(); ++it )
+      requiredSize += 8 * ( ( it->second->size() + 7 ) / 8 );
+
+   // all processes of the node have finished reading the messages of the previous step after this reduction
+   uint64_t maxRequiredSize;
+   MPI_Allreduce( &requiredSize, &maxRequiredSize, 1, MPITrait<uint64_t>::type(), MPI_MAX, nodeCommunicator_ );
+
+   if( maxRequiredSize > segmentSize_ )
+      allocateWindow( std::max( uint_c( maxRequiredSize ), 2 * segmentSize_ ) ); // same decision on all processes
+   else
+      MPI_Win_sync( window_ );
+
+   char * segment = segments_[ uint_c( nodeRank_ ) ];
+   MessageInfo * table = reinterpret_cast< MessageInfo * >( segment );
+   std::fill( table, table + segments_.size(), MessageInfo() );
+
+   uint64_t offset = tableSize;
+   for( auto it = nodeSends_.begin(); it != nodeSends_.end(); ++it )
+   {
+      const SendBuffer & sendBuffer = *(it->second);
+      MessageInfo & info = table[ it->first ];
+      WALBERLA_ASSERT_EQUAL( info.size, 0 ); // only one message per receiver and step
+
+      info.offset = offset;
+      info.size   = sendBuffer.size();
+      std::memcpy( segment + offset, sendBuffer.ptr(), sendBuffer.size() );
+      offset += 8 * ( ( sendBuffer.size() + 7 ) / 8 );
+   }
+
+   MPI_Win_sync( window_ );
+   MPI_Barrier( nodeCommunicator_ );
+   MPI_Win_sync( window_ );
+
+   nodeSends_.clear();
+   exchanged_ = true;
+}
+
+
+
+void SharedMemoryCommunication::waitForSends()
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   WALBERLA_ASSERT( exchanged_ || ! sending_ );
+
+   sending_ = false;
+   if( remoteComm_ != nullptr )
+      remoteComm_->waitForSends();
+
+   exchanged_ = false;
+}
+
+
+
+void SharedMemoryCommunication::scheduleReceives( std::map<MPIRank, ReceiveInfo> & recvInfos )
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   WALBERLA_ASSERT( ! receiving_ );
+
+   if( nodeCommunicator_ == MPI_COMM_NULL )
+      createNodeCommunicator();
+
+   remoteComm_ = knownSize_ ? static_cast< AbstractCommunication * >( &knownSizeComm_ ) : &unknownSizeComm_;
+
+   // the memory of the receive buffers of remote processes is handed over to the remote communication
+   nodeSenders_.clear();
+   remoteRecvInfos_.clear();
+   for( auto it = recvInfos.begin(); it != recvInfos.end(); ++it )
+   {
+      if( nodeRanks_.find( it->first ) != nodeRanks_.end() )
+      {
+         nodeSenders_.push_back( it->first );
+      }
+      else
+      {
+         ReceiveInfo & remoteInfo = remoteRecvInfos_[ it->first ];
+         remoteInfo.size = it->second.size;
+         remoteInfo.buffer.swap( it->second.buffer );
+      }
+   }
+
+   remoteComm_->scheduleReceives( remoteRecvInfos_ );
+
+   recvInfos_ = &recvInfos;
+   nextNodeReceive_ = 0;
+   exchanged_ = false;
+   receiving_ = true;
+}
+
+
+
+MPIRank SharedMemoryCommunication::waitForNextReceive( std::map<MPIRank, ReceiveInfo> & recvInfos )
+{
+   WALBERLA_NON_MPI_SECTION() { WALBERLA_ASSERT( false ); }
+
+   WALBERLA_ASSERT( receiving_ );
+   WALBERLA_ASSERT_EQUAL( &recvInfos, recvInfos_ );
+
+   if( ! exchanged_ )
+      exchangeNodeMessages();
+
+   // node-local messages are copied directly out of the segments of the senders,
+   // senders that did not send anything are skipped
+   while( nextNodeReceive_ < nodeSenders_.size() )
+   {
+      const MPIRank sender = nodeSenders_[ nextNodeReceive_++ ];
+      const char * segment = segments_[ uint_c( nodeRanks_[ sender ] ) ];
+      const MessageInfo & info = reinterpret_cast< const MessageInfo * >( segment )[ nodeRank_ ];
+
+      if( info.size > 0 )
+      {
+         ReceiveInfo & recvInfo = recvInfos[ sender ];
+         recvInfo.size = int_c( info.size );
+         recvInfo.buffer.resize( uint_c( info.size ) );
+         std::memcpy( recvInfo.buffer.ptr(), segment + info.offset, uint_c( info.size ) );
+         return sender;
+      }
+   }
+
+   const MPIRank sender = remoteComm_->waitForNextReceive( remoteRecvInfos_ );
+   if( sender != INVALID_RANK )
+   {
+      ReceiveInfo & remoteInfo = remoteRecvInfos_[ sender ];
+      ReceiveInfo & recvInfo = recvInfos[ sender ];
+      recvInfo.size = remoteInfo.size;
+      recvInfo.buffer.swap( remoteInfo.buffer );
+      return sender;
+   }
+
+   // receive buffers of remote processes that did not send anything are handed back
+   for( auto it = remoteRecvInfos_.begin(); it != remoteRecvInfos_.end(); ++it )
+   {
+      if( it->second.buffer.capacity() > 0 )
+         recvInfos[ it->first ].buffer.swap( it->second.buffer );
+   }
+
+   receiving_ = false;
+   recvInfos_ = nullptr;
+   return INVALID_RANK;
+}
+
+
+
+
 //======================================================================================================================
 //
 //  NoMPI Communication
@@ -90,6 +90,12 @@ namespace internal {
       virtual MPIRank waitForNextReceive( std::map<MPIRank, ReceiveInfo> & recvInfos ) = 0;
 
 
+      /*************************************************************************************************************//**
+      * Called after all SendBuffers of the current communication step have been passed to send().
+      *****************************************************************************************************************/
+      virtual void sendsCompleted() {}
+
+
       virtual int getTag() const { return tag_; }
 
       virtual MPI_Comm getCommunicator() const { return communicator_; }
@@ -127,6 +133,53 @@ namespace internal {
 
 
 
+   /*****************************************************************************************************************//**
+   * Known size communication using persistent requests (MPI_Send_init / MPI_Recv_init)
+   *
+   * For every communication partner, a persistent request is created once and then started in every communication
+   * step. A request is only recreated if the memory location or the size of the corresponding buffer has changed.
+   * Since Send- and RecvBuffers keep their memory when they are cleared, this is only the case if the message size
+   * changes or if the set of communication partners changes. This reduces the per-step MPI overhead for
+   * communication patterns that are repeated many times (e.g., ghost layer exchange).
+   *********************************************************************************************************************/
+   class PersistentKnownSizeCommunication : public AbstractCommunication
+   {
+   public:
+      PersistentKnownSizeCommunication( const MPI_Comm & communicator, int tag = 0 )
+           : AbstractCommunication( communicator, tag ), sending_(false), receiving_(false) {}
+
+      virtual ~PersistentKnownSizeCommunication();
+
+      virtual void send( MPIRank receiver, const SendBuffer & sendBuffer );
+      virtual void waitForSends();
+
+      virtual void    scheduleReceives  ( std::map<MPIRank, ReceiveInfo> & recvInfos );
+
+      /// size field of recvInfos is expected to be valid
+      virtual MPIRank waitForNextReceive( std::map<MPIRank, ReceiveInfo> & recvInfos );
+
+   private:
+      struct PersistentRequest {
+         MPIRank     rank;
+         const void* ptr;
+         int         size;
+      };
+
+      static void freeRequest( MPI_Request & request );
+
+      bool sending_;
+      bool receiving_;
+
+      std::map<MPIRank, uint_t>      sendRequestIndex_; //< index into sendRequests_ / sendRequestInfos_
+      std::vector<MPI_Request>       sendRequests_;     //< inactive requests are ignored by MPI_Waitall
+      std::vector<PersistentRequest> sendRequestInfos_;
+
+      std::vector<MPI_Request>       recvRequests_;     //< one request per entry of recvInfos (same order)
+      std::vector<PersistentRequest> recvRequestInfos_;
+   };
+
+
+
    class UnknownSizeCommunication : public AbstractCommunication
    {
    public:
@@ -157,6 +210,200 @@ namespace internal {
 
 
 
+   /*****************************************************************************************************************//**
+   * Sparse dynamic data exchange where the receivers do not know which processes send to them ("NBX" algorithm)
+   *
+   * Messages are sent with synchronous non-blocking sends (MPI_Issend). The receivers detect incoming messages (and
+   * their sizes) with MPI_Iprobe. As soon as all sends of a process have been matched, the process enters a
+   * non-blocking barrier (MPI_Ibarrier). Once the barrier has completed, all messages of all processes have been
+   * received. Neither the senders nor the message sizes need to be known in advance, and no all-to-all handshake is
+   * required.
+   *
+   * The recvInfos passed to scheduleReceives() are cleared, entries are created for every rank a message is received
+   * from during the communication step.
+   *
+   * A process that observed the completion of the barrier may already send the messages of the next communication
+   * step while other processes still probe for messages of the current step. Hence, consecutive steps alternate
+   * between the given communicator and a duplicate of it (created collectively during the first step).
+   *********************************************************************************************************************/
+   class NonblockingConsensusCommunication : public AbstractCommunication
+   {
+   public:
+      NonblockingConsensusCommunication( const MPI_Comm & communicator, int tag = 0 )
+           :  AbstractCommunication( communicator, tag ), sending_(false), receiving_(false), barrierActive_(false),
+              barrierRequest_( MPI_REQUEST_NULL ), duplicateCommunicator_( MPI_COMM_NULL ), oddStep_( false ),
+              stepCommunicator_( communicator ) {}
+
+      virtual ~NonblockingConsensusCommunication();
+
+      virtual void send( MPIRank receiver, const SendBuffer & sendBuffer );
+      virtual void waitForSends();
+
+      virtual void scheduleReceives( std::map<MPIRank, ReceiveInfo> & recvInfos );
+
+      /// recvInfos are filled in with the ranks of the senders and the actual message sizes
+      virtual MPIRank waitForNextReceive( std::map<MPIRank, ReceiveInfo> & recvInfos );
+
+   private:
+      bool sending_;
+      bool receiving_;
+      bool barrierActive_;
+
+      std::vector<MPI_Request> sendRequests_;
+      MPI_Request              barrierRequest_;
+
+      MPI_Comm duplicateCommunicator_; //< used in every other communication step
+      bool     oddStep_;
+      MPI_Comm stepCommunicator_;      //< communicator_ or duplicateCommunicator_, depending on the current step
+   };
+
+
+
+   /*****************************************************************************************************************//**
+   * Communication using MPI neighborhood collectives on a distributed graph topology
+   *
+   * A distributed graph communicator (MPI_Dist_graph_create_adjacent) is created from the ranks where messages are
+   * received from. The communication has to be symmetric: messages are only sent to these ranks. All messages of a
+   * communication step are exchanged with a single MPI_Ineighbor_alltoallw call, which is started as soon as all
+   * SendBuffers have been sent (or in the first call of waitForNextReceive()). If the message sizes are unknown, they
+   * are exchanged with MPI_Neighbor_alltoall before. The buffers are addressed relative to MPI_BOTTOM, so the data is
+   * not copied into a contiguous buffer.
+   *
+   * The graph communicator is created collectively in the first communication step after resetNeighborhood() was
+   * called. Hence, all processes of the communicator have to take part in every communication step, and they have to
+   * reset their neighborhood in the same steps. In the same way, setKnownSize() has to be called consistently.
+   *********************************************************************************************************************/
+   class NeighborCollectiveCommunication : public AbstractCommunication
+   {
+   public:
+      NeighborCollectiveCommunication( const MPI_Comm & communicator, int tag = 0 )
+           :  AbstractCommunication( communicator, tag ), knownSize_( false ), neighborhoodValid_( false ),
+              sending_( false ), receiving_( false ), exchangeStarted_( false ), exchangeRequest_( MPI_REQUEST_NULL ),
+              graphCommunicator_( MPI_COMM_NULL ), recvInfos_( nullptr ), nextReceive_( 0 ) {}
+
+      virtual ~NeighborCollectiveCommunication();
+
+      void setKnownSize( bool knownSize ) { knownSize_ = knownSize; }
+      bool isSizeKnown() const            { return knownSize_; }
+
+      /// the graph communicator is recreated from the recvInfos in the next communication step
+      void resetNeighborhood() { neighborhoodValid_ = false; }
+
+      virtual void send( MPIRank receiver, const SendBuffer & sendBuffer );
+      virtual void waitForSends();
+
+      virtual void scheduleReceives( std::map<MPIRank, ReceiveInfo> & recvInfos );
+
+      /// size field of recvInfos is expected to be valid if isSizeKnown(), otherwise it is filled in
+      virtual MPIRank waitForNextReceive( std::map<MPIRank, ReceiveInfo> & recvInfos );
+
+      virtual void sendsCompleted();
+
+   private:
+      void createGraphCommunicator( const std::map<MPIRank, ReceiveInfo> & recvInfos );
+      void startExchange();
+
+      bool knownSize_;
+      bool neighborhoodValid_;
+
+      bool sending_;
+      bool receiving_;
+      bool exchangeStarted_;
+
+      MPI_Request exchangeRequest_;
+      MPI_Comm    graphCommunicator_;
+
+      std::vector<MPIRank>   neighbors_;      //< sources and destinations of the graph communicator (same order)
+      std::map<MPIRank, int> neighborIndex_;  //< index into neighbors_
+
+      std::vector<int>          sendCounts_;
+      std::vector<MPI_Aint>     sendDisplacements_; //< absolute addresses of the send buffers
+      std::vector<int>          recvCounts_;
+      std::vector<MPI_Aint>     recvDisplacements_; //< absolute addresses of the receive buffers
+      std::vector<MPI_Datatype> types_;             //< MPI_BYTE for every neighbor
+
+      std::map<MPIRank, ReceiveInfo> * recvInfos_; //< recvInfos of the running communication step
+      uint_t nextReceive_;                         //< index into neighbors_ of the next message returned
+   };
+
+
+
+   /*****************************************************************************************************************//**
+   * Hierarchical communication: messages between processes that share memory are exchanged via an MPI-3 shared memory
+   * window, all other messages are exchanged with MPI_Isend/MPI_Irecv (known or unknown size).
+   *
+   * Every process of a node owns a segment of the shared window. In each communication step, the messages to the
+   * processes of the same node are copied into the own segment (preceded by a table with offset and size of the
+   * message for every process of the node). After a barrier of the node, every process copies its messages directly
+   * out of the segments of the senders. Hence, node-local messages bypass the MPI message matching and progress
+   * engine completely.
+   *
+   * The exchange within a node is collective: all processes of the communicator have to take part in every
+   * communication step, and all SendBuffers have to be sent before the iteration over the received messages starts.
+   * The node communicator is created collectively in the first communication step.
+   *****************************************************************************************************************/
+   class SharedMemoryCommunication : public AbstractCommunication
+   {
+   public:
+      SharedMemoryCommunication( const MPI_Comm & communicator, int tag = 0 )
+           :  AbstractCommunication( communicator, tag ), knownSize_( false ),
+              sending_( false ), receiving_( false ), exchanged_( false ),
+              knownSizeComm_( communicator, tag ), unknownSizeComm_( communicator, tag ), remoteComm_( nullptr ),
+              nodeCommunicator_( MPI_COMM_NULL ), window_( MPI_WIN_NULL ), nodeRank_( 0 ), segmentSize_( 0 ),
+              recvInfos_( nullptr ), nextNodeReceive_( 0 ) {}
+
+      virtual ~SharedMemoryCommunication();
+
+      void setKnownSize( bool knownSize ) { knownSize_ = knownSize; }
+      bool isSizeKnown() const            { return knownSize_; }
+
+      virtual void send( MPIRank receiver, const SendBuffer & sendBuffer );
+      virtual void waitForSends();
+
+      virtual void scheduleReceives( std::map<MPIRank, ReceiveInfo> & recvInfos );
+
+      /// size field of recvInfos is expected to be valid for remote processes if isSizeKnown()
+      virtual MPIRank waitForNextReceive( std::map<MPIRank, ReceiveInfo> & recvInfos );
+
+      virtual void sendsCompleted();
+
+   private:
+      struct MessageInfo {
+         uint64_t offset; //< offset of the message in the segment of the sender
+         uint64_t size;   //< message size in bytes
+      };
+
+      void createNodeCommunicator();
+      void allocateWindow( size_t segmentSize );
+      void exchangeNodeMessages();
+
+      bool knownSize_;
+
+      bool sending_;
+      bool receiving_;
+      bool exchanged_; //< node-local messages of the current step have been exchanged
+
+      KnownSizeCommunication   knownSizeComm_;
+      UnknownSizeCommunication unknownSizeComm_;
+      AbstractCommunication *  remoteComm_;       //< communication of the current step for remote processes
+
+      MPI_Comm nodeCommunicator_;
+      MPI_Win  window_;
+      int      nodeRank_;                         //< rank of this process in nodeCommunicator_
+      size_t   segmentSize_;                      //< size of the segment of every process of the node
+      std::vector<char*>     segments_;           //< segments of all processes of the node
+      std::map<MPIRank, int> nodeRanks_;          //< rank in communicator_ -> rank in nodeCommunicator_
+
+      std::vector< std::pair<int, const SendBuffer *> > nodeSends_; //< node-local messages of the current step
+
+      std::map<MPIRank, ReceiveInfo>   remoteRecvInfos_; //< receive infos of the remote processes
+      std::map<MPIRank, ReceiveInfo> * recvInfos_;       //< recvInfos of the running communication step
+      std::vector<MPIRank> nodeSenders_;                 //< node-local processes where messages are received from
+      uint_t nextNodeReceive_;                           //< index into nodeSenders_ of the next message returned
+   };
+
+
+
    class NoMPICommunication : public AbstractCommunication
    {
    public:
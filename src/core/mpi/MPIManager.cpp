@@ -102,10 +102,16 @@ void MPIManager::initializeMPI( int* argc, char*** argv, bool abortOnException )
       int mpiAlreadyInitialized=0;
       MPI_Initialized( &mpiAlreadyInitialized );
       if ( ! mpiAlreadyInitialized ) {
+#ifdef _OPENMP
+         // OpenMPBufferSystem calls MPI from within parallel regions (one thread at a time)
+         MPI_Init_thread( argc, argv, MPI_THREAD_SERIALIZED, &threadSupport_ );
+#else
          MPI_Init( argc, argv );
+#endif
       }
 
       isMPIInitialized_ = true;
+      MPI_Query_thread( &threadSupport_ );
       MPI_Comm_size( MPI_COMM_WORLD, &numProcesses_ );
       MPI_Comm_rank( MPI_COMM_WORLD, &worldRank_ );
 
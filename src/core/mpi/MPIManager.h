@@ -119,6 +119,8 @@ public:
    uint_t      bitsNeededToRepresentRank() const { return math::uintMSBPosition( uint_c(numProcesses()) ); }
 
    bool isMPIInitialized()  const { return isMPIInitialized_; }
+   /// Level of thread support provided by the MPI library (MPI_THREAD_SINGLE, ..., MPI_THREAD_MULTIPLE)
+   int  threadSupport()     const { return threadSupport_; }
    bool hasCartesianSetup() const { return cartesianSetup_;  }
    /// Rank is valid after calling createCartesianComm() or useWorldComm()
    bool rankValid()         const { return rank_ >= 0;       }
@@ -151,6 +153,9 @@ private:
    /// Indicates whether initializeMPI has been called. If true, MPI_Finalize is called upon destruction
    bool isMPIInitialized_;
 
+   /// Thread support level as returned by MPI_Query_thread
+   int threadSupport_;
+
    /// Indicates whether a Cartesian communicator has been created
    bool cartesianSetup_;
 
@@ -158,7 +163,7 @@ private:
 
    // Singleton
    MPIManager() : worldRank_(0), rank_(-1), numProcesses_(1), comm_(MPI_COMM_NULL),
-                  isMPIInitialized_(false), cartesianSetup_(false), currentlyAborting_(false)
+                  isMPIInitialized_(false), threadSupport_(MPI_THREAD_SINGLE), cartesianSetup_(false), currentlyAborting_(false)
    { WALBERLA_NON_MPI_SECTION() { rank_ = 0; } }
 
 }; // class MPIManager
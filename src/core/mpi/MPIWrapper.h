@@ -91,6 +91,7 @@ typedef int MPI_File;
 typedef int MPI_Offset;
 typedef int MPI_Info;
 typedef int MPI_Aint;
+typedef int MPI_Win;
 typedef void (MPI_User_function) (void* a, void* b, int* len, MPI_Datatype*);
 
 struct MPI_Status
@@ -168,8 +169,23 @@ const int MPI_INFO_NULL = 0;
 
 const int MPI_REQUEST_NULL = 0;
 
+const int MPI_THREAD_SINGLE     = 0;
+const int MPI_THREAD_FUNNELED   = 1;
+const int MPI_THREAD_SERIALIZED = 2;
+const int MPI_THREAD_MULTIPLE   = 3;
+
 const int MPI_FILE_NULL = 0;
 
+const int MPI_WIN_NULL          = 0;
+const int MPI_COMM_TYPE_SHARED  = 0;
+const int MPI_MODE_NOCHECK      = 0;
+
+const int MPI_UNWEIGHTED = 0;
+
+#ifndef MPI_BOTTOM
+#define MPI_BOTTOM ((void*)0)
+#endif
+
 static MPI_Status* MPI_STATUS_IGNORE   = NULL;
 static MPI_Status* MPI_STATUSES_IGNORE = NULL;
 
@@ -181,6 +197,8 @@ const int MPI_MAX_ERROR_STRING = 255;
 #define WALBERLA_MPI_FUNCTION_ERROR WALBERLA_ABORT( "Invalid MPI function call! In case of compiling without MPI, MPI functions are not available and shouldn't be called!" );
 
 inline int MPI_Init( int*, char*** )  { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Init_thread( int*, char***, int, int* ) { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Query_thread( int* )   { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Initialized( int *)    { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Finalize()             { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Abort( MPI_Comm, int ) { WALBERLA_MPI_FUNCTION_ERROR }
@@ -200,6 +218,7 @@ inline int MPI_Comm_create( MPI_Comm, MPI_Group, MPI_Comm* ) { WALBERLA_MPI_FUNC
 inline int MPI_Comm_free  ( MPI_Comm* )                      { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Comm_dup   ( MPI_Comm, MPI_Comm *)            { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Comm_split ( MPI_Comm, int, int, MPI_Comm *)  { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Comm_split_type( MPI_Comm, int, int, MPI_Info, MPI_Comm * ) { WALBERLA_MPI_FUNCTION_ERROR }
 
 
 inline int MPI_Cart_create( MPI_Comm, int, int*, int*, int, MPI_Comm* ) { WALBERLA_MPI_FUNCTION_ERROR }
@@ -208,8 +227,15 @@ inline int MPI_Cart_coords( MPI_Comm, int, int, int* )                  { WALBER
 inline int MPI_Cart_rank  ( MPI_Comm, int*, int* )                      { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Cart_shift ( MPI_Comm, int, int, int*, int*)             { WALBERLA_MPI_FUNCTION_ERROR }
 
+inline int MPI_Dist_graph_create_adjacent( MPI_Comm, int, const int*, int, int, const int*, int, MPI_Info, int, MPI_Comm* ) { WALBERLA_MPI_FUNCTION_ERROR }
+
 inline int MPI_Irecv( void*, int, MPI_Datatype, int, int, MPI_Comm, MPI_Request* ) { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Isend( void*, int, MPI_Datatype, int, int, MPI_Comm, MPI_Request* ) { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Issend( void*, int, MPI_Datatype, int, int, MPI_Comm, MPI_Request* ) { WALBERLA_MPI_FUNCTION_ERROR }
+
+inline int MPI_Recv_init( void*, int, MPI_Datatype, int, int, MPI_Comm, MPI_Request* ) { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Send_init( void*, int, MPI_Datatype, int, int, MPI_Comm, MPI_Request* ) { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Request_free( MPI_Request* )                                            { WALBERLA_MPI_FUNCTION_ERROR }
 
 inline int MPI_Recv( void*, int, MPI_Datatype, int, int, MPI_Comm, MPI_Status* ) { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Send( void*, int, MPI_Datatype, int, int, MPI_Comm )              { WALBERLA_MPI_FUNCTION_ERROR }
@@ -226,8 +252,12 @@ inline int MPI_Wait   ( MPI_Request*, MPI_Status* )            { WALBERLA_MPI_FU
 inline int MPI_Waitall( int, MPI_Request*, MPI_Status* )       { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Waitany( int, MPI_Request*, int*, MPI_Status* ) { WALBERLA_MPI_FUNCTION_ERROR }
 
+inline int MPI_Test   ( MPI_Request*, int*, MPI_Status* )      { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Testall( int, MPI_Request*, int*, MPI_Status* ) { WALBERLA_MPI_FUNCTION_ERROR }
+
 inline int MPI_Reduce   ( void*, void*, int, MPI_Datatype, MPI_Op, int, MPI_Comm ) { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Allreduce( void*, void*, int, MPI_Datatype, MPI_Op, MPI_Comm )      { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Iallreduce( void*, void*, int, MPI_Datatype, MPI_Op, MPI_Comm, MPI_Request* ) { WALBERLA_MPI_FUNCTION_ERROR }
 
 inline int MPI_Scan  ( void*, void*, int, MPI_Datatype, MPI_Op, MPI_Comm ) { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Exscan( void*, void*, int, MPI_Datatype, MPI_Op, MPI_Comm ) { WALBERLA_MPI_FUNCTION_ERROR }
@@ -239,6 +269,10 @@ inline int MPI_Allgatherv( void*, int, MPI_Datatype, void*, int*, int*, MPI_Data
 inline int MPI_Gatherv   ( void*, int, MPI_Datatype, void*, int*, int*, MPI_Datatype, int, MPI_Comm ) { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Alltoall  ( void*, int, MPI_Datatype, void*, int, MPI_Datatype, MPI_Comm ) { WALBERLA_MPI_FUNCTION_ERROR }
 
+inline int MPI_Neighbor_alltoall  ( const void*, int, MPI_Datatype, void*, int, MPI_Datatype, MPI_Comm ) { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Ineighbor_alltoallw( const void*, const int*, const MPI_Aint*, const MPI_Datatype*,
+                                    void*, const int*, const MPI_Aint*, const MPI_Datatype*, MPI_Comm, MPI_Request* ) { WALBERLA_MPI_FUNCTION_ERROR }
+
 inline int MPI_Type_contiguous( int, MPI_Datatype, MPI_Datatype* ) { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Type_create_subarray( int, const int*, const int*, const int*, int, MPI_Datatype, MPI_Datatype* ) { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Type_create_indexed_block( int, int, const int*, MPI_Datatype, MPI_Datatype* ) { WALBERLA_MPI_FUNCTION_ERROR }
@@ -248,12 +282,21 @@ inline int MPI_Type_create_resized( MPI_Datatype, MPI_Aint, MPI_Aint, MPI_Dataty
 inline int MPI_Type_size( MPI_Datatype, int * ) { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Type_get_extent(MPI_Datatype, MPI_Aint*, MPI_Aint*) { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_Type_create_struct(int, const int[], const MPI_Aint[], const MPI_Datatype[], MPI_Datatype*) { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Get_address( const void*, MPI_Aint* ) { WALBERLA_MPI_FUNCTION_ERROR }
 
 inline int MPI_Op_create(MPI_User_function*, int, MPI_Op*) { WALBERLA_MPI_FUNCTION_ERROR }
 
 inline int MPI_Get_processor_name( char*, int* ) { WALBERLA_MPI_FUNCTION_ERROR }
 
+inline int MPI_Win_allocate_shared( MPI_Aint, int, MPI_Info, MPI_Comm, void*, MPI_Win* ) { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Win_shared_query   ( MPI_Win, int, MPI_Aint*, int*, void* )              { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Win_lock_all       ( int, MPI_Win )                                      { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Win_unlock_all     ( MPI_Win )                                           { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Win_sync           ( MPI_Win )                                           { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Win_free           ( MPI_Win* )                                          { WALBERLA_MPI_FUNCTION_ERROR }
+
 inline int MPI_Barrier( MPI_Comm ) { WALBERLA_MPI_FUNCTION_ERROR }
+inline int MPI_Ibarrier( MPI_Comm, MPI_Request* ) { WALBERLA_MPI_FUNCTION_ERROR }
 
 inline int MPI_File_open        ( MPI_Comm, char*, int, int, MPI_File* )            { WALBERLA_MPI_FUNCTION_ERROR }
 inline int MPI_File_write_shared( MPI_File, void*, int, MPI_Datatype, MPI_Status* ) { WALBERLA_MPI_FUNCTION_ERROR }
@@ -20,6 +20,8 @@
 //======================================================================================================================
 
 #include "OpenMPBufferSystem.h"
+#include "MPIManager.h"
+#include "core/OpenMP.h"
 
 #include <boost/range/adaptor/map.hpp>
 
@@ -42,11 +44,34 @@ OpenMPBufferSystem::OpenMPBufferSystem( const MPI_Comm & communicator, int tag,
      dirty_( true ),
      serialSends_( _serialSends ),
      serialRecvs_( _serialRecvs ),
+     funneledMPI_( false ),
      sizeChangesEverytime_( true )
 {
 }
 
 
+/// True if only the master thread is allowed to call MPI functions
+bool OpenMPBufferSystem::funneledMPI() const
+{
+   WALBERLA_MPI_SECTION()
+   {
+      if( MPIManager::instance()->threadSupport() < MPI_THREAD_SERIALIZED )
+         return true;
+   }
+   return funneledMPI_;
+}
+
+
+static bool isMasterThread()
+{
+#ifdef _OPENMP
+   return omp_get_thread_num() == 0;
+#else
+   return true;
+#endif
+}
+
+
 void OpenMPBufferSystem::addReceivingFunction( MPIRank rank, const std::function<void ( RecvBuffer & buf ) >& recvFunction )
 {
    dirty_ = true;
@@ -90,6 +115,8 @@ void OpenMPBufferSystem::startCommunication()
    setupBufferSystem();
    if( serialSends_ )
       startCommunicationSerial();
+   else if( funneledMPI() )
+      startCommunicationFunneled();
    else
       startCommunicationOpenMP();
 }
@@ -141,6 +168,57 @@ void OpenMPBufferSystem::startCommunicationOpenMP()
    bs_.sendAll(); // for the case where sendFunctions_ is empty
 }
 
+void OpenMPBufferSystem::startCommunicationFunneled()
+{
+   bs_.scheduleReceives();
+
+   WALBERLA_ASSERT_EQUAL( sendRanks_.size(), sendFunctions_.size() );
+
+   const int nrOfSendFunctions = int_c( sendFunctions_.size() );
+
+   std::vector< MPIRank > completedRanks; // packed but not yet sent
+   completedRanks.reserve( sendRanks_.size() );
+
+   #ifdef _OPENMP
+   #pragma omp parallel
+   #endif
+   {
+      std::vector< MPIRank > ranksToSend; // only used by the master thread
+
+      #ifdef _OPENMP
+      #pragma omp for schedule(dynamic)
+      #endif
+      for( int i=0; i < nrOfSendFunctions; ++i )
+      {
+         const MPIRank rank = sendRanks_[ uint_c(i) ];
+         SendBuffer & sendBuffer = bs_.sendBuffer( rank ); // This call is thread-safe since all send buffers
+                                                           // are already allocated in setupBufferSystem().
+         sendFunctions_[ uint_c(i) ]( sendBuffer );
+
+         #ifdef _OPENMP
+         #pragma omp critical (OpenMPBufferSystem_completedRanks)
+         #endif
+         completedRanks.push_back( rank );
+
+         // Only the master thread calls MPI. Every time it has packed one of its own buffers,
+         // it sends all buffers that have been completed so far.
+         if( isMasterThread() )
+         {
+            #ifdef _OPENMP
+            #pragma omp critical (OpenMPBufferSystem_completedRanks)
+            #endif
+            ranksToSend.swap( completedRanks );
+
+            for( auto rankToSend = ranksToSend.begin(); rankToSend != ranksToSend.end(); ++rankToSend )
+               bs_.send( *rankToSend );
+            ranksToSend.clear();
+         }
+      }
+   }
+
+   bs_.sendAll(); // all buffers completed after the last send of the master thread (and the case where sendFunctions_ is empty)
+}
+
 
 
 
@@ -155,6 +233,8 @@ void OpenMPBufferSystem::wait()
 {
    if ( serialRecvs_ )
       waitSerial();
+   else if( funneledMPI() )
+      waitFunneled();
    else
       waitOpenMP();
 }
@@ -208,6 +288,43 @@ void OpenMPBufferSystem::waitOpenMP()
 }
 
 
+void OpenMPBufferSystem::waitFunneled()
+{
+   const int numReceives = int_c( bs_.recvInfos_.size() );
+
+   #ifdef _OPENMP
+   #pragma omp parallel
+   #pragma omp master
+   #endif
+   {
+      for( int i = 0; i < numReceives; ++i )
+      {
+         MPIRank recvRank = INVALID_RANK;
+         RecvBuffer * recvBuffer = bs_.waitForNext( recvRank );
+
+         WALBERLA_ASSERT_GREATER_EQUAL( recvRank, 0 );
+         WALBERLA_ASSERT_NOT_NULLPTR( recvBuffer );
+
+         auto recvFunction = recvFunctions_.find( recvRank );
+         WALBERLA_ASSERT( recvFunction != recvFunctions_.end() );
+
+         // unpacking is done by the other threads while the master thread waits for the next message
+         #ifdef _OPENMP
+         #pragma omp task firstprivate( recvBuffer, recvFunction )
+         #endif
+         recvFunction->second( *recvBuffer );
+      }
+   } // all tasks are completed at the end of the parallel region
+
+   MPIRank rank;
+   RecvBuffer * ret = bs_.waitForNext( rank );
+   WALBERLA_ASSERT_NULLPTR( ret ); // call last time to finish communication
+   WALBERLA_UNUSED( ret );
+
+   WALBERLA_ASSERT( ! bs_.isCommunciationRunning() );
+}
+
+
 
 } // namespace mpi
 } // namespace walberla
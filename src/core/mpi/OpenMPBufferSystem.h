@@ -42,6 +42,12 @@ namespace mpi {
 *
 * When running multiple BufferSystems concurrently different MPI tags have to be used
 * for the systems: the tag can be passed in the constructor.
+*
+* If the MPI library provides at least MPI_THREAD_SERIALIZED, every thread sends its buffer as soon as it is packed
+* and receives the next message as soon as it is ready to unpack (MPI calls are protected by a critical section).
+* Otherwise (or if enforceFunneledMPI() is set), only the master thread calls MPI functions: it sends all buffers
+* that have been completed by the other threads in between packing its own buffers, and, when receiving, it waits
+* for the messages and hands the unpacking to the other threads (as OpenMP tasks).
 */
 //**********************************************************************************************************************
 class OpenMPBufferSystem
@@ -54,6 +60,11 @@ public:
 
    void enforceSerialSends( bool val ) { serialSends_ = val; }
    void enforceSerialRecvs( bool val ) { serialRecvs_ = val; }
+   void enforceFunneledMPI( bool val ) { funneledMPI_ = val; }
+
+   void usePersistentRequests( bool val ) { bs_.usePersistentRequests( val ); }
+   void useNeighborCollectives( bool val ) { bs_.useNeighborCollectives( val ); }
+   void useSharedMemory( bool val ) { bs_.useSharedMemory( val ); }
 
 
    void setReceiverInfo( bool _sizeChangesEverytime ) { dirty_ = true; sizeChangesEverytime_ = _sizeChangesEverytime; }
@@ -72,6 +83,14 @@ public:
    bool sizeChangesEverytime() const { return sizeChangesEverytime_; }
    bool serialSends() const          { return serialSends_; }
    bool serialRecvs() const          { return serialRecvs_; }
+   bool funneledMPI() const;
+   bool persistentRequestsUsed() const { return bs_.persistentRequestsUsed(); }
+   bool neighborCollectivesUsed() const { return bs_.neighborCollectivesUsed(); }
+   bool sharedMemoryUsed() const { return bs_.sharedMemoryUsed(); }
+
+   uint64_t getBytesSent()     const { return bs_.getBytesSent();     }
+   uint64_t getBytesReceived() const { return bs_.getBytesReceived(); }
+   void     resetStatistics()        { bs_.resetStatistics();         }
 
 
 private:
@@ -83,6 +102,7 @@ private:
 
    bool serialSends_;
    bool serialRecvs_;
+   bool funneledMPI_;
 
    bool sizeChangesEverytime_;
 
@@ -94,9 +114,11 @@ private:
 
    void startCommunicationOpenMP();
    void startCommunicationSerial();
+   void startCommunicationFunneled();
 
    void waitOpenMP();
    void waitSerial();
+   void waitFunneled();
 };
 
 
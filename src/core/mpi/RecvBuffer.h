@@ -144,6 +144,7 @@ public:
                           inline T *  skip   ( size_t elements    );
                           inline void clear  ();
                           inline void reset  ();
+                          inline void swap   ( GenericRecvBuffer & other );
                           inline void readDebugMarker( const char * marker );
    //@}
    //*******************************************************************************************************************
@@ -166,6 +167,8 @@ private:
    typename boost::enable_if< boost::mpl::or_< boost::is_arithmetic<V>, boost::is_enum<V> >,
                               GenericRecvBuffer& >::type
    get( V& value );
+
+   inline void replaceMemory( size_t newCapacity );
    //@}
    //*******************************************************************************************************************
 
@@ -207,13 +210,13 @@ inline GenericRecvBuffer<T>::GenericRecvBuffer()
 */
 template< typename T >  // Element type
 inline GenericRecvBuffer<T>::GenericRecvBuffer( const GenericRecvBuffer& rb )
-   : capacity_( rb.size()        )  // Capacity of the receive buffer
-   , begin_   ( new T[capacity_] )  // Pointer to the first element
-   , cur_     ( begin_           )  // Pointer to the current element
-   , end_     ( begin_+capacity_ )  // Pointer to the last element
+   : capacity_( 0    )  // Capacity of the receive buffer
+   , begin_   ( NULL )  // Pointer to the first element
+   , cur_     ( NULL )  // Pointer to the current element
+   , end_     ( NULL )  // Pointer to the last element
 {
-   for( size_t i=0; i<capacity_; ++i )
-      cur_[i] = rb.cur_[i];
+   replaceMemory( rb.size() );
+   end_ = std::copy( rb.cur_, rb.end_, begin_ );
 }
 //**********************************************************************************************************************
 
@@ -231,9 +234,9 @@ inline GenericRecvBuffer<T>::GenericRecvBuffer( GenericSendBuffer<T,G> & sb )
    , cur_( sb.begin_ )
    , end_( sb.end_ )
 {
-   sb.begin_ = new T[0];
-   sb.cur_   = sb.begin_;
-   sb.end_   = sb.begin_;
+   sb.begin_ = NULL;
+   sb.cur_   = NULL;
+   sb.end_   = NULL;
 }
 //**********************************************************************************************************************
 
@@ -251,7 +254,7 @@ inline GenericRecvBuffer<T>::GenericRecvBuffer( GenericSendBuffer<T,G> & sb )
 template< typename T >  // Element type
 inline GenericRecvBuffer<T>::~GenericRecvBuffer()
 {
-   delete [] begin_;
+   BufferPool::instance().deallocate( begin_ );
 }
 //**********************************************************************************************************************
 
@@ -275,19 +278,11 @@ GenericRecvBuffer<T>& GenericRecvBuffer<T>::operator=( const GenericRecvBuffer&
 {
    if( &rb == this ) return *this;
 
-   if( rb.size() > capacity_ ) {
-      T* newBegin( new T[rb.size()] );
-      end_ = std::copy( rb.cur_, rb.end_, newBegin );
-      std::swap( begin_, newBegin );
-      delete [] newBegin;
+   if( rb.size() > capacity_ )
+      replaceMemory( rb.size() );
 
-      capacity_ = rb.size();
-      cur_ = begin_;
-   }
-   else {
-      end_ = std::copy( rb.cur_, rb.end_, begin_ );
-      cur_ = begin_;
-   }
+   end_ = std::copy( rb.cur_, rb.end_, begin_ );
+   cur_ = begin_;
 
    return *this;
 }
@@ -296,19 +291,11 @@ template< typename T >  // Element type
 template< typename G >
 GenericRecvBuffer<T>& GenericRecvBuffer<T>::operator=( const GenericSendBuffer<T,G> & sb )
 {
-   if( sb.size() > capacity_ ) {
-      T* newBegin( new T[sb.size()] );
-      end_ = std::copy( sb.begin_, sb.cur_, newBegin );
-      std::swap( begin_, newBegin );
-      delete [] newBegin;
-
-      capacity_ = sb.size();
-      cur_ = begin_;
-   }
-   else {
-      end_ = std::copy( sb.begin_, sb.cur_, begin_ );
-      cur_ = begin_;
-   }
+   if( sb.size() > capacity_ )
+      replaceMemory( sb.size() );
+
+   end_ = std::copy( sb.begin_, sb.cur_, begin_ );
+   cur_ = begin_;
 
    return *this;
 }
@@ -493,17 +480,7 @@ template< typename T >  // Element type
 void GenericRecvBuffer<T>::reserve( size_t newCapacity )
 {
    if( newCapacity > capacity_ )
-   {
-      // Allocating a new array
-      T* tmp = new T[newCapacity];
-
-      // Replacing the old array
-      std::swap( tmp, begin_ );
-      delete [] tmp;
-
-      // Adjusting the members
-      capacity_ = newCapacity;
-   }
+      replaceMemory( newCapacity );
 
    // Clearing the receive buffer
    clear();
@@ -524,17 +501,7 @@ template< typename T >  // Element type
 void GenericRecvBuffer<T>::resize( size_t newSize )
 {
    if( newSize > capacity_ )
-   {
-      // Allocating a new array
-      T* tmp = new T[newSize];
-
-      // Replacing the old array
-      std::swap( tmp, begin_ );
-      delete [] tmp;
-
-      // Adjusting the capacity
-      capacity_ = newSize;
-   }
+      replaceMemory( newSize );
 
    cur_ = begin_;
    end_ = begin_+newSize;
@@ -607,6 +574,46 @@ inline void GenericRecvBuffer<T>::clear()
 //**********************************************************************************************************************
 
 
+//**********************************************************************************************************************
+/*!\brief Exchanges the contents (including the allocated memory) of two receive buffers.
+//
+// \param other The receive buffer to be exchanged with this receive buffer.
+// \return void
+*/
+template< typename T >  // Element type
+inline void GenericRecvBuffer<T>::swap( GenericRecvBuffer & other )
+{
+   std::swap( capacity_, other.capacity_ );
+   std::swap( begin_,    other.begin_    );
+   std::swap( cur_,      other.cur_      );
+   std::swap( end_,      other.end_      );
+}
+//**********************************************************************************************************************
+
+
+//**********************************************************************************************************************
+/*!\brief Replaces the memory of the receive buffer by (at least) \a newCapacity elements from the buffer pool.
+//
+// \param newCapacity The new minimum capacity of the receive buffer.
+// \return void
+//
+// The current contents of the receive buffer are not preserved.
+*/
+template< typename T >  // Element type
+inline void GenericRecvBuffer<T>::replaceMemory( size_t newCapacity )
+{
+   BufferPool & pool = BufferPool::instance();
+   pool.deallocate( begin_ );
+
+   size_t bytes( 0 );
+   begin_    = static_cast<T*>( pool.allocate( newCapacity * sizeof(T), bytes ) );
+   capacity_ = bytes / sizeof(T);
+   cur_      = begin_;
+   end_      = begin_;
+}
+//**********************************************************************************************************************
+
+
 //**********************************************************************************************************************
 /*!\brief Clearing the receive buffer.
 //
@@ -617,7 +624,7 @@ inline void GenericRecvBuffer<T>::clear()
 template< typename T >  // Element type
 inline void GenericRecvBuffer<T>::reset()
 {
-   delete [] begin_;
+   BufferPool::instance().deallocate( begin_ );
    capacity_ = 0;
    begin_    = NULL;
    cur_      = NULL;
@@ -30,6 +30,7 @@
 #include "core/mpi/MPIWrapper.h"
 
 #include <boost/type_traits/is_arithmetic.hpp>
+#include <memory>
 #include <vector>
 
 
@@ -459,5 +460,148 @@ inline void allReduceInplace( std::vector<bool> & bools, Operation operation, MP
 
 
 
+namespace internal {
+
+template< typename T >
+struct AllReduceBuffer
+{
+   static_assert( boost::is_arithmetic<T>::value, "allReduceAsync(...) may only by called with integer or floating point types!" );
+   static_assert( (!boost::is_same<T, bool>::value), "allReduceAsync(...) may not be called with bool, use int instead!" );
+
+   typedef T value_type;
+   static void * data( T & value ) { return &value; }
+   static int    size( const T & ) { return 1; }
+};
+
+template< typename T >
+struct AllReduceBuffer< std::vector<T> >
+{
+   static_assert( boost::is_arithmetic<T>::value, "allReduceAsync(...) may only by called with integer or floating point types!" );
+   static_assert( (!boost::is_same<T, bool>::value), "allReduceAsync(...) may not be called with std::vector<bool>!" );
+
+   typedef T value_type;
+   static void * data( std::vector<T> & values ) { return values.empty() ? nullptr : &values[0]; }
+   static int    size( const std::vector<T> & values ) { return int_c( values.size() ); }
+};
+
+} // namespace internal
+
+
+
+//======================================================================================================================
+/*!
+ *  \brief Handle of a non-blocking reduction over all processes (see allReduceAsync)
+ *
+ *  T has to be an integer or floating point value, or a std::vector of such values. The reduction is started on
+ *  construction (MPI_Iallreduce) and progresses while the process performs other work. get() waits for the
+ *  reduction to complete and returns the reduced value(s). Every process of the communicator must start the same
+ *  reductions in the same order.
+ *
+ *  The reduced value is stored on the heap, hence the future can be moved while the reduction is in flight.
+ *  A future that is destroyed or overwritten before get()/wait() was called waits for its reduction to complete.
+ */
+//======================================================================================================================
+template< typename T >
+class AllReduceFuture
+{
+public:
+
+   AllReduceFuture() {}
+
+   AllReduceFuture( const T & value, Operation operation, MPI_Comm comm = MPI_COMM_WORLD ) : state_( new State( value ) )
+   {
+      WALBERLA_NON_MPI_SECTION() { return; }
+
+      MPI_Iallreduce( MPI_IN_PLACE, internal::AllReduceBuffer<T>::data( state_->value ), internal::AllReduceBuffer<T>::size( state_->value ),
+                      MPITrait< typename internal::AllReduceBuffer<T>::value_type >::type(), toMPI_Op(operation), comm, &state_->request );
+   }
+
+   AllReduceFuture( AllReduceFuture && other ) : state_( std::move( other.state_ ) ) {}
+
+   AllReduceFuture & operator=( AllReduceFuture && other )
+   {
+      if( this != &other )
+      {
+         wait();
+         state_ = std::move( other.state_ );
+      }
+      return *this;
+   }
+
+   ~AllReduceFuture() { wait(); }
+
+   /// Returns true if a reduction was started, i.e., if get() can be called
+   bool valid() const { return static_cast< bool >( state_ ); }
+
+   /// Returns true if the reduction is completed (does not block)
+   bool ready()
+   {
+      if( !state_ || state_->request == MPI_REQUEST_NULL )
+         return true;
+
+      int flag = 0;
+      MPI_Test( &state_->request, &flag, MPI_STATUS_IGNORE );
+      return flag != 0;
+   }
+
+   void wait()
+   {
+      if( state_ && state_->request != MPI_REQUEST_NULL )
+         MPI_Wait( &state_->request, MPI_STATUS_IGNORE );
+   }
+
+   /// Waits for the reduction to complete and returns the reduced value(s)
+   const T & get()
+   {
+      WALBERLA_ASSERT( valid(), "get() called for an AllReduceFuture without reduction" );
+      wait();
+      return state_->value;
+   }
+
+private:
+
+   AllReduceFuture( const AllReduceFuture & );
+   AllReduceFuture & operator=( const AllReduceFuture & );
+
+   struct State
+   {
+      State( const T & _value ) : value( _value ), request( MPI_REQUEST_NULL ) {}
+      T           value;
+      MPI_Request request;
+   };
+
+   std::unique_ptr< State > state_;
+};
+
+
+
+//======================================================================================================================
+/*!
+ *  \brief Starts a non-blocking reduction of a value over all processes
+ *
+ *  T has to be an integer or floating point value, or a std::vector of such values. For logical operations use int.
+ *  The reduction overlaps with the work the process performs until get() is called on the returned future:
+ *
+ *  \code
+ *  auto future = mpi::allReduceAsync( localResidual, mpi::SUM );
+ *  sweep(); // communication and computation that does not depend on the reduced value
+ *  const real_t residual = future.get();
+ *  \endcode
+ *
+ *  \param value      The value(s) to be reduced
+ *  \param operation  The operation to be performed
+ *  \param comm       The MPI communicator used for communication
+ *
+ *  \returns          A future that provides the reduced value(s) on all processes
+ */
+//======================================================================================================================
+template< typename T >
+AllReduceFuture<T> allReduceAsync( const T & value, Operation operation, MPI_Comm comm = MPI_COMM_WORLD )
+{
+   return AllReduceFuture<T>( value, operation, comm );
+}
+
+
+
 } // namespace mpi
 } // namespace walberla
@@ -26,6 +26,7 @@
 #pragma once
 
 #include "waLBerlaDefinitions.h"
+#include "BufferPool.h"
 #include "BufferSizeTrait.h"
 #include "growPolicies/ConstantGrowth.h"
 #include "growPolicies/LinearGrowth.h"
@@ -280,10 +281,13 @@ VT& GenericSendBuffer<T,G>::Ptr<VT>::operator[](const size_t& rhs)
 template< typename T    // Element type
           , typename G >  // Growth policy
 inline GenericSendBuffer<T,G>::GenericSendBuffer( size_t initCapacity )
-   : begin_( new T[initCapacity] )  // Pointer to the first element
-   , cur_  ( begin_ )               // Pointer to the current/last element
-   , end_  ( begin_ )               // Pointer to the end of the storage
-{}
+   : begin_( NULL )  // Pointer to the first element
+   , cur_  ( NULL )  // Pointer to the current/last element
+   , end_  ( NULL )  // Pointer to the end of the storage
+{
+   if( initCapacity > 0 )
+      extendMemory( initCapacity );
+}
 //**********************************************************************************************************************
 
 
@@ -295,12 +299,13 @@ inline GenericSendBuffer<T,G>::GenericSendBuffer( size_t initCapacity )
 template< typename T    // Element type
           , typename G >  // Growth policy
 inline GenericSendBuffer<T,G>::GenericSendBuffer( const GenericSendBuffer& sb )
-   : begin_( new T[sb.size()] )  // Pointer to the first element
-   , cur_  ( begin_+sb.size() )  // Pointer to the current/last element
-   , end_  ( cur_ )              // Pointer to the end of the storage
+   : begin_( NULL )  // Pointer to the first element
+   , cur_  ( NULL )  // Pointer to the current/last element
+   , end_  ( NULL )  // Pointer to the end of the storage
 {
-   for( size_t i=0; i<sb.size(); ++i )
-      begin_[i] = sb.begin_[i];
+   if( sb.size() > 0 )
+      extendMemory( sb.size() );
+   cur_ = std::copy( sb.begin_, sb.cur_, begin_ );
 }
 //**********************************************************************************************************************
 
@@ -320,7 +325,7 @@ template< typename T    // Element type
           , typename G >  // Growth policy
 inline GenericSendBuffer<T,G>::~GenericSendBuffer()
 {
-   delete [] begin_;
+   BufferPool::instance().deallocate( begin_ );
 }
 //**********************************************************************************************************************
 
@@ -345,17 +350,10 @@ GenericSendBuffer<T,G>& GenericSendBuffer<T,G>::operator=( const GenericSendBuff
 {
    if( &sb == this ) return *this;
 
-   if( sb.size() > capacity() ) {
-      T* newBegin( new T[sb.size()] );
-      end_ = std::copy( sb.begin_, sb.cur_, newBegin );
-      std::swap( begin_, newBegin );
-      delete [] newBegin;
-
-      cur_ = end_;
-   }
-   else {
-      cur_ = std::copy( sb.begin_, sb.end_, begin_ );
-   }
+   clear();
+   if( sb.size() > capacity() )
+      extendMemory( sb.size() );
+   cur_ = std::copy( sb.begin_, sb.cur_, begin_ );
 
    return *this;
 }
@@ -662,14 +660,13 @@ void GenericSendBuffer<T,G>::extendMemory( size_t newCapacity )
    newCapacity = G()( capacity(), newCapacity );
    WALBERLA_ASSERT_GREATER( newCapacity, capacity() );
 
-   // Allocating a new array
-   T* tmp = new T[newCapacity];
-
-   // Replacing the old array
-   cur_ = std::copy( begin_, cur_, tmp );
-   std::swap( tmp, begin_ );
-   end_ = begin_ + newCapacity;
-   delete [] tmp;
+   // Replacing the old array, the buffer pool may provide more memory than requested
+   const size_t used = size();
+   size_t bytes( 0 );
+   begin_ = static_cast<T*>( BufferPool::instance().reallocate( begin_, used * sizeof(T),
+                                                                newCapacity * sizeof(T), bytes ) );
+   cur_ = begin_ + used;
+   end_ = begin_ + bytes / sizeof(T);
 }
 //**********************************************************************************************************************
 
@@ -701,10 +698,10 @@ template< typename T    // Element type
           , typename G >  // Growth policy
 inline void GenericSendBuffer<T,G>::reset()
 {
-   delete [] begin_;
-   begin_ = new T[0];
-   cur_ = begin_;
-   end_ = begin_;
+   BufferPool::instance().deallocate( begin_ );
+   begin_ = NULL;
+   cur_ = NULL;
+   end_ = NULL;
 }
 //**********************************************************************************************************************
 
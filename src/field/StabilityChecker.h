@@ -56,6 +56,8 @@ const bool stabilityCheckerVTKLittleEndian( true );
 const bool stabilityCheckerVTKMPIIO( true );
 const bool stabilityCheckerVTKForcePVTU( false );
 
+const bool stabilityCheckerAsynchronousReduction( false );
+
 const std::string stabilityCheckerConfigBlock("StabilityChecker");
 
 template< typename T >
@@ -112,6 +114,7 @@ inline bool stabilityCheckerIsFinite( const Vector3<real_t> & value ) { return m
 *      vtkLittleEndian    [boolean]; // VTK binary file format [default: true (= little endian)]
 *      vtkMPIIO           [boolean]; // use MPI IO for creating VTK output? [default: true]
 *      vtkForcePVTU       [boolean]; // force VTK to generate a PVTU file? [default: false]
+*      asynchronousReduction [boolean]; // evaluate the global result of a check one call later? [default: false]
 *   }
 *   \endcode
 *
@@ -129,6 +132,13 @@ inline bool stabilityCheckerIsFinite( const Vector3<real_t> & value ) { return m
 *
 *   For documentation of the VTK parameters see \ref docVTKConfigurationFile.
 *
+*   By default, the results of all processes are combined by a blocking reduction every time the check is performed,
+*   i.e., every check is a global synchronization point. If 'asynchronousReduction' is enabled, the reduction is only
+*   started during the check and evaluated at the beginning of the next call of operator()(), so that it overlaps with
+*   everything that is executed in between (typically, the next time step). The simulation is then aborted one call
+*   later than in the blocking mode. If no further call follows the last check (end of the simulation), the result of
+*   this check is not evaluated.
+*
 *   Note that the shared pointer returned by all 'makeStabilityChecker' functions can be captured by a SharedFunctor
 *   for immediate registration at a time loop (see field::makeSharedFunctor).
 */
@@ -262,6 +272,7 @@ public:
       vtkLittleEndian_( internal::stabilityCheckerVTKLittleEndian ),
       vtkMPIIO_( internal::stabilityCheckerVTKMPIIO ),
       vtkForcePVTU_( internal::stabilityCheckerVTKForcePVTU ),
+      asynchronousReduction_( internal::stabilityCheckerAsynchronousReduction ),
       requiredSelectors_(requiredSelectors), incompatibleSelectors_( incompatibleSelectors ) {}
 
    StabilityChecker( const weak_ptr< StructuredBlockStorage > & blocks, const ConstBlockDataID & fieldId,
@@ -278,6 +289,7 @@ public:
       vtkLittleEndian_( internal::stabilityCheckerVTKLittleEndian ),
       vtkMPIIO_( internal::stabilityCheckerVTKMPIIO ),
       vtkForcePVTU_( internal::stabilityCheckerVTKForcePVTU ),
+      asynchronousReduction_( internal::stabilityCheckerAsynchronousReduction ),
       requiredSelectors_(requiredSelectors), incompatibleSelectors_( incompatibleSelectors )
    {
       static_assert( (boost::is_same< Filter_T, DefaultEvaluationFilter >::value),
@@ -292,6 +304,8 @@ public:
    void setVTKLittleEndian( const bool vtkLittleEndian ) { vtkLittleEndian_ = vtkLittleEndian; }
    void setVTKMPIIO       ( const bool vtkMPIIO        ) { vtkMPIIO_        = vtkMPIIO; }
    void setVTKForcePVTU   ( const bool vtkForcePVTU    ) { vtkForcePVTU_    = vtkForcePVTU; }
+
+   void setAsynchronousReduction( const bool asynchronousReduction ) { asynchronousReduction_ = asynchronousReduction; }
    
    void operator()();
 
@@ -299,6 +313,8 @@ private:
 
    void checkBlock( const IBlock * const block );
 
+   void abortSimulation( const shared_ptr< StructuredBlockStorage > & blocks );
+
 
 
    weak_ptr< StructuredBlockStorage > blocks_;
@@ -324,6 +340,9 @@ private:
    bool vtkMPIIO_;
    bool vtkForcePVTU_;
 
+   bool asynchronousReduction_;
+   shared_ptr< mpi::AllReduceFuture<int> > pendingReduction_; ///< reduction of the last check (asynchronous mode only)
+
    Set<SUID> requiredSelectors_;
    Set<SUID> incompatibleSelectors_;
 
@@ -335,6 +354,20 @@ template< typename Field_T, typename Filter_T >
 void StabilityChecker< Field_T, Filter_T >::operator()()
 {
    ++executionCounter_;
+
+   if( pendingReduction_ )
+   {
+      const bool abort = pendingReduction_->get() != 0;
+      pendingReduction_.reset();
+
+      if( abort )
+      {
+         auto blocks = blocks_.lock();
+         WALBERLA_CHECK_NOT_NULLPTR( blocks, "Trying to access 'StabilityChecker' for a block storage object that doesn't exist anymore" );
+         abortSimulation( blocks );
+      }
+   }
+
    if( checkFrequency_ == uint_t(0) || ( executionCounter_ - uint_c(1) ) % checkFrequency_ != 0 )
       return;
 
@@ -380,32 +413,44 @@ void StabilityChecker< Field_T, Filter_T >::operator()()
          WALBERLA_LOG_WARNING( oss.str() );
    }
 
+   if( asynchronousReduction_ )
+   {
+      pendingReduction_ = make_shared< mpi::AllReduceFuture<int> >( failedCells_.empty() ? 0 : 1, mpi::LOGICAL_OR );
+      return;
+   }
+
    bool abort = !failedCells_.empty();
    mpi::allReduceInplace( abort, mpi::LOGICAL_OR );
 
    if( abort )
-   {
-      if( outputVTK_ )
-      {
-         auto vtkWriter = vtk::createVTKOutput_BlockData( blocks, vtkIdentifier_, uint_t(1), uint_t(0), vtkForcePVTU_,
-                                                          vtkBaseFolder_, vtkExecutionFolder_, false, vtkBinary_, vtkLittleEndian_, vtkMPIIO_ );                                                         
+      abortSimulation( blocks );
+}
 
-         vtkWriter->addCellInclusionFilter( VTKCellFilter( failedCells_ ) );
 
-         vtkWriter->addCellDataWriter( walberla::make_shared< vtk::DumpBlockStructureProcess >( "process" ) );
-         vtkWriter->addCellDataWriter( walberla::make_shared< vtk::DumpBlockStructureLevel >( "level" ) );
-         vtkWriter->addCellDataWriter( walberla::make_shared< FValueVTKWriter >( std::ref( failedCells_ ), "F" ) );
-         vtkWriter->addCellDataWriter( walberla::make_shared< LocalCoordVTKWriter >( "blockLocalCoordinate" ) );
-         vtkWriter->addCellDataWriter( walberla::make_shared< GlobalCoordVTKWriter >( "globalCoordinate" ) );
 
-         vtkWriter->write();
-      }
+template< typename Field_T, typename Filter_T >
+void StabilityChecker< Field_T, Filter_T >::abortSimulation( const shared_ptr< StructuredBlockStorage > & blocks )
+{
+   if( outputVTK_ )
+   {
+      auto vtkWriter = vtk::createVTKOutput_BlockData( blocks, vtkIdentifier_, uint_t(1), uint_t(0), vtkForcePVTU_,
+                                                       vtkBaseFolder_, vtkExecutionFolder_, false, vtkBinary_, vtkLittleEndian_, vtkMPIIO_ );                                                         
 
-      WALBERLA_LOG_WARNING_ON_ROOT( "Field stability check failed - aborting program ..." );
-      WALBERLA_MPI_WORLD_BARRIER();
+      vtkWriter->addCellInclusionFilter( VTKCellFilter( failedCells_ ) );
 
-      WALBERLA_ABORT_NO_DEBUG_INFO("");
+      vtkWriter->addCellDataWriter( walberla::make_shared< vtk::DumpBlockStructureProcess >( "process" ) );
+      vtkWriter->addCellDataWriter( walberla::make_shared< vtk::DumpBlockStructureLevel >( "level" ) );
+      vtkWriter->addCellDataWriter( walberla::make_shared< FValueVTKWriter >( std::ref( failedCells_ ), "F" ) );
+      vtkWriter->addCellDataWriter( walberla::make_shared< LocalCoordVTKWriter >( "blockLocalCoordinate" ) );
+      vtkWriter->addCellDataWriter( walberla::make_shared< GlobalCoordVTKWriter >( "globalCoordinate" ) );
+
+      vtkWriter->write();
    }
+
+   WALBERLA_LOG_WARNING_ON_ROOT( "Field stability check failed - aborting program ..." );
+   WALBERLA_MPI_WORLD_BARRIER();
+
+   WALBERLA_ABORT_NO_DEBUG_INFO("");
 }
 
 
@@ -551,7 +596,8 @@ namespace internal {
 inline void stabilityCheckerConfigParser( const Config::BlockHandle & parentBlockHandle, const std::string & configBlockName,
                                           uint_t & defaultCheckFrequency, bool & defaultOutputToStream, bool & defaultOutputVTK,
                                           std::string & defaultVTKBaseFolder, std::string & defaultVTKExecutionFolder, std::string & defaultVTKIdentifier,
-                                          bool & defaultVTKBinary, bool & defaultVTKLittleEndian, bool & defaultVTKMPIIO, bool & defaultVTKForcePVTU )
+                                          bool & defaultVTKBinary, bool & defaultVTKLittleEndian, bool & defaultVTKMPIIO, bool & defaultVTKForcePVTU,
+                                          bool & defaultAsynchronousReduction )
 {
    if( parentBlockHandle )
    {
@@ -568,6 +614,7 @@ inline void stabilityCheckerConfigParser( const Config::BlockHandle & parentBloc
          defaultVTKLittleEndian = block.getParameter< bool >( "vtkLittleEndian", defaultVTKLittleEndian );
          defaultVTKMPIIO = block.getParameter< bool >( "vtkMPIIO", defaultVTKMPIIO );
          defaultVTKForcePVTU = block.getParameter< bool >( "vtkForcePVTU", defaultVTKForcePVTU );
+         defaultAsynchronousReduction = block.getParameter< bool >( "asynchronousReduction", defaultAsynchronousReduction );
       }
    }
 }
@@ -575,12 +622,14 @@ inline void stabilityCheckerConfigParser( const Config::BlockHandle & parentBloc
 inline void stabilityCheckerConfigParser( const shared_ptr< Config > & config, const std::string & configBlockName,
                                           uint_t & defaultCheckFrequency, bool & defaultOutputToStream, bool & defaultOutputVTK,
                                           std::string & defaultVTKBaseFolder, std::string & defaultVTKExecutionFolder, std::string & defaultVTKIdentifier,
-                                          bool & defaultVTKBinary, bool & defaultVTKLittleEndian, bool & defaultVTKMPIIO, bool & defaultVTKForcePVTU )
+                                          bool & defaultVTKBinary, bool & defaultVTKLittleEndian, bool & defaultVTKMPIIO, bool & defaultVTKForcePVTU,
+                                          bool & defaultAsynchronousReduction )
 {
    if( !!config )
       stabilityCheckerConfigParser( config->getGlobalBlock(), configBlockName, defaultCheckFrequency, defaultOutputToStream, defaultOutputVTK,
                                     defaultVTKBaseFolder, defaultVTKExecutionFolder, defaultVTKIdentifier,
-                                    defaultVTKBinary, defaultVTKLittleEndian, defaultVTKMPIIO, defaultVTKForcePVTU );
+                                    defaultVTKBinary, defaultVTKLittleEndian, defaultVTKMPIIO, defaultVTKForcePVTU,
+                                    defaultAsynchronousReduction );
 }
 
 } // namespace internal
@@ -596,9 +645,11 @@ inline void stabilityCheckerConfigParser( const shared_ptr< Config > & config, c
    bool defaultVTKLittleEndian = internal::stabilityCheckerVTKLittleEndian; \
    bool defaultVTKMPIIO = internal::stabilityCheckerVTKMPIIO; \
    bool defaultVTKForcePVTU = internal::stabilityCheckerVTKForcePVTU; \
+   bool defaultAsynchronousReduction = internal::stabilityCheckerAsynchronousReduction; \
    internal::stabilityCheckerConfigParser( config, configBlockName, defaultCheckFrequency, defaultOutputToStream, defaultOutputVTK, \
                                            defaultVTKBaseFolder, defaultVTKExecutionFolder, defaultVTKIdentifier, \
-                                           defaultVTKBinary, defaultVTKLittleEndian, defaultVTKMPIIO, defaultVTKForcePVTU );
+                                           defaultVTKBinary, defaultVTKLittleEndian, defaultVTKMPIIO, defaultVTKForcePVTU, \
+                                           defaultAsynchronousReduction );
 
 #define WALBERLA_FIELD_MAKE_STABILITY_CHECKER_SET_AND_RETURN() \
    checker->setVTKBaseFolder( defaultVTKBaseFolder ); \
@@ -608,6 +659,7 @@ inline void stabilityCheckerConfigParser( const shared_ptr< Config > & config, c
    checker->setVTKLittleEndian( defaultVTKLittleEndian ); \
    checker->setVTKMPIIO( defaultVTKMPIIO ); \
    checker->setVTKForcePVTU( defaultVTKForcePVTU ); \
+   checker->setAsynchronousReduction( defaultAsynchronousReduction ); \
    return checker;
 
 template< typename Field_T, typename Config_T > // Config_T may be 'shared_ptr< Config >' or 'Config::BlockHandle'
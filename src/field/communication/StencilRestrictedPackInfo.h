@@ -38,6 +38,9 @@ namespace communication {
  *
  * see also documentation for FieldPackInfo
  *
+ * Directions that are not part of the stencil are still communicated if stencil components point into them
+ * (e.g. the edge directions for D3Q15, which are crossed by the corner components).
+ *
  * \warning For fields with nrOfGhostLayers > 1:  only the components pointing towards
  *          the boundary are communicated, which may not be the desired behavior
  *          for the 'inner' ghost layers
@@ -52,6 +55,8 @@ public:
    bool constantDataExchange() const { return true; }
    bool threadsafeReceiving()  const { return true; }
 
+   bool sendsDataInDirection( stencil::Direction dir ) const { return Stencil_T::d_per_d_mask[dir] != uint_t(0); }
+
    void unpackData( IBlock * receiver, stencil::Direction dir, mpi::RecvBuffer & buffer );
 
    void communicateLocal( const IBlock * sender, IBlock * receiver, stencil::Direction dir );
@@ -69,7 +74,7 @@ protected:
 template< typename GhostLayerField_T, typename Stencil >
 void StencilRestrictedPackInfo<GhostLayerField_T, Stencil>::unpackData( IBlock * receiver, stencil::Direction dir, mpi::RecvBuffer & buffer )
 {
-   if( Stencil::idx[ stencil::inverseDir[dir] ] >= Stencil::Size )
+   if( !sendsDataInDirection( stencil::inverseDir[dir] ) )
       return;
 
    GhostLayerField_T * pdfField = receiver->getData< GhostLayerField_T >( fieldId_ );
@@ -88,7 +93,7 @@ void StencilRestrictedPackInfo<GhostLayerField_T, Stencil>::unpackData( IBlock *
 template< typename GhostLayerField_T, typename Stencil >
 void StencilRestrictedPackInfo<GhostLayerField_T, Stencil>::communicateLocal( const IBlock * sender, IBlock * receiver, stencil::Direction dir )
 {
-   if( Stencil::idx[dir] >= Stencil::Size )
+   if( !sendsDataInDirection( dir ) )
       return;
 
    const GhostLayerField_T * sf = sender  ->getData< GhostLayerField_T >( fieldId_ );
@@ -116,7 +121,7 @@ void StencilRestrictedPackInfo<GhostLayerField_T, Stencil>::communicateLocal( co
 template< typename GhostLayerField_T, typename Stencil >
 void StencilRestrictedPackInfo<GhostLayerField_T, Stencil>::packDataImpl( const IBlock * sender, stencil::Direction dir, mpi::SendBuffer & outBuffer ) const
 {
-   if( Stencil::idx[dir] >= Stencil::Size )
+   if( !sendsDataInDirection( dir ) )
       return;
 
    const GhostLayerField_T * pdfField = sender->getData< GhostLayerField_T >( fieldId_ );
@@ -92,3 +92,17 @@
 
 
 #endif
+
+
+// X-loop for kernels that access a lot of PDF rows at once (e.g. D3Q27 kernels that are not split by direction):
+// GCC does not take into account the 'restrict' qualifier of the row pointers declared inside the sweeps and would
+// require too many run-time alias checks in order to vectorize these loops.
+#if defined(__GNUC__) && !defined(__INTEL_COMPILER) && !defined(__clang__)
+
+#define X_LOOP_IVDEP(loopBody) _Pragma("GCC ivdep") for( cell_idx_t x = 0; x != xSize; ++x ) { loopBody }
+
+#else
+
+#define X_LOOP_IVDEP(loopBody) X_LOOP(loopBody)
+
+#endif
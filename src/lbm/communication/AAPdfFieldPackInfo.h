@@ -0,0 +1,226 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file AAPdfFieldPackInfo.h
+//! \ingroup lbm
+//! \brief PackInfo for PDF fields that are updated in-place by the AASweep.
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "lbm/field/PdfField.h"
+#include "lbm/sweeps/AATimeStepTracker.h"
+#include "communication/UniformPackInfo.h"
+#include "core/cell/CellInterval.h"
+#include "core/debug/Debug.h"
+#include "stencil/Directions.h"
+
+
+namespace walberla {
+namespace lbm {
+
+
+
+/**
+ * \brief PackInfo for PDF fields that are updated in-place by the AASweep (AA pattern)
+ *
+ * Must be executed after the AASweep and before the AATimeStepTracker is advanced.
+ *
+ * - After an even time step, the post-collision PDFs are still located in the cells they belong to (in the slots of
+ *   the inverse directions). Just like for the PdfFieldPackInfo, the slice before the ghost layer is sent and stored
+ *   in the ghost layer of the neighbor - but the slots of the inverse directions are communicated.
+ * - After an odd time step, the PDFs leaving the block have been written to the ghost layer. The ghost layer is sent
+ *   and stored in the slice before the ghost layer of the neighbor (reverse communication). Only PDF values that were
+ *   actually written by the sweep are communicated.
+ *
+ * Only components pointing to the neighbor are communicated. The message sizes of even and odd time steps differ.
+ *
+ * \ingroup lbm
+ */
+template< typename LatticeModel_T >
+class AAPdfFieldPackInfo : public walberla::communication::UniformPackInfo
+{
+public:
+
+   typedef PdfField< LatticeModel_T >        PdfField_T;
+   typedef typename LatticeModel_T::Stencil  Stencil;
+
+   AAPdfFieldPackInfo( const BlockDataID & pdfFieldId, const shared_ptr< AATimeStepTracker > & tracker ) :
+      pdfFieldId_( pdfFieldId ), tracker_( tracker )
+   {
+      WALBERLA_ASSERT_NOT_NULLPTR( tracker_ );
+   }
+
+   virtual ~AAPdfFieldPackInfo() {}
+
+   bool constantDataExchange() const { return false; }
+   bool threadsafeReceiving()  const { return true; }
+
+   bool sendsDataInDirection( stencil::Direction dir ) const { return Stencil::d_per_d_mask[dir] != uint_t(0); }
+
+   void unpackData( IBlock * receiver, stencil::Direction dir, mpi::RecvBuffer & buffer );
+
+   void communicateLocal( const IBlock * sender, IBlock * receiver, stencil::Direction dir );
+
+protected:
+
+   void packDataImpl( const IBlock * sender, stencil::Direction dir, mpi::SendBuffer & outBuffer ) const;
+
+   // cells of 'field' that hold PDF component 'd' which must be sent to the neighbor in direction 'dir'
+   static CellInterval sendInterval( const PdfField_T & field, const stencil::Direction dir, const stencil::Direction d, const bool even );
+   // cells of 'field' that receive PDF component 'd' from the neighbor in direction 'dir'
+   static CellInterval recvInterval( const PdfField_T & field, const stencil::Direction dir, const stencil::Direction d, const bool even );
+
+   static uint_t slot( const stencil::Direction d, const bool even ) { return even ? Stencil::invDirIdx(d) : Stencil::idx[d]; }
+
+
+
+   const BlockDataID pdfFieldId_;
+   shared_ptr< AATimeStepTracker > tracker_;
+};
+
+
+
+template< typename LatticeModel_T >
+CellInterval AAPdfFieldPackInfo< LatticeModel_T >::sendInterval( const PdfField_T & field, const stencil::Direction dir,
+                                                                 const stencil::Direction d, const bool even )
+{
+   CellInterval ci;
+   if( even )
+   {
+      field.getSliceBeforeGhostLayer( dir, ci );
+   }
+   else
+   {
+      // only ghost layer cells into which PDFs were streamed from the inner part of the field
+      field.getGhostRegion( dir, ci, cell_idx_t(1) );
+      CellInterval source = field.xyzSize();
+      source.shift( cell_idx_c( stencil::cx[d] ), cell_idx_c( stencil::cy[d] ), cell_idx_c( stencil::cz[d] ) );
+      ci.intersect( source );
+   }
+   return ci;
+}
+
+
+
+template< typename LatticeModel_T >
+CellInterval AAPdfFieldPackInfo< LatticeModel_T >::recvInterval( const PdfField_T & field, const stencil::Direction dir,
+                                                                 const stencil::Direction d, const bool even )
+{
+   CellInterval ci;
+   if( even )
+   {
+      field.getGhostRegion( dir, ci, cell_idx_t(1) );
+   }
+   else
+   {
+      // only cells that get their PDFs streamed from the ghost layer
+      field.getSliceBeforeGhostLayer( dir, ci );
+      CellInterval source;
+      field.getGhostRegion( dir, source, cell_idx_t(1) );
+      source.shift( cell_idx_c( stencil::cx[d] ), cell_idx_c( stencil::cy[d] ), cell_idx_c( stencil::cz[d] ) );
+      ci.intersect( source );
+   }
+   return ci;
+}
+
+
+
+template< typename LatticeModel_T >
+void AAPdfFieldPackInfo< LatticeModel_T >::unpackData( IBlock * receiver, stencil::Direction dir, mpi::RecvBuffer & buffer )
+{
+   const stencil::Direction packerDirection = stencil::inverseDir[dir];
+
+   if( !sendsDataInDirection( packerDirection ) )
+      return;
+
+   PdfField_T * pdfField = receiver->getData< PdfField_T >( pdfFieldId_ );
+   WALBERLA_ASSERT_NOT_NULLPTR( pdfField );
+   WALBERLA_ASSERT_EQUAL( pdfField->nrOfGhostLayers(), 1 );
+
+   const bool even = tracker_->isEvenTimeStep();
+
+   for( uint_t i = 0; i < Stencil::d_per_d_length[ packerDirection ]; ++i )
+   {
+      const stencil::Direction d = Stencil::d_per_d[ packerDirection ][i];
+      const uint_t f = slot( d, even );
+
+      const CellInterval ci = recvInterval( *pdfField, dir, d, even );
+      for( auto cell = ci.begin(); cell != ci.end(); ++cell )
+         buffer >> pdfField->get( *cell, f );
+   }
+}
+
+
+
+template< typename LatticeModel_T >
+void AAPdfFieldPackInfo< LatticeModel_T >::communicateLocal( const IBlock * sender, IBlock * receiver, stencil::Direction dir )
+{
+   if( !sendsDataInDirection( dir ) )
+      return;
+
+   const PdfField_T * sf = sender  ->getData< PdfField_T >( pdfFieldId_ );
+         PdfField_T * rf = receiver->getData< PdfField_T >( pdfFieldId_ );
+
+   WALBERLA_ASSERT_EQUAL( sf->xyzSize(), rf->xyzSize() );
+
+   const bool even = tracker_->isEvenTimeStep();
+
+   for( uint_t i = 0; i < Stencil::d_per_d_length[dir]; ++i )
+   {
+      const stencil::Direction d = Stencil::d_per_d[dir][i];
+      const uint_t f = slot( d, even );
+
+      const CellInterval sci = sendInterval( *sf, dir, d, even );
+      const CellInterval rci = recvInterval( *rf, stencil::inverseDir[dir], d, even );
+
+      WALBERLA_ASSERT_EQUAL( sci.empty() ? uint_t(0) : sci.numCells(), rci.empty() ? uint_t(0) : rci.numCells() );
+
+      auto dstCell = rci.begin();
+      for( auto srcCell = sci.begin(); srcCell != sci.end(); ++srcCell, ++dstCell )
+         rf->get( *dstCell, f ) = sf->get( *srcCell, f );
+   }
+}
+
+
+
+template< typename LatticeModel_T >
+void AAPdfFieldPackInfo< LatticeModel_T >::packDataImpl( const IBlock * sender, stencil::Direction dir, mpi::SendBuffer & outBuffer ) const
+{
+   if( !sendsDataInDirection( dir ) )
+      return;
+
+   const PdfField_T * pdfField = sender->getData< PdfField_T >( pdfFieldId_ );
+   WALBERLA_ASSERT_NOT_NULLPTR( pdfField );
+   WALBERLA_ASSERT_EQUAL( pdfField->nrOfGhostLayers(), 1 );
+
+   const bool even = tracker_->isEvenTimeStep();
+
+   for( uint_t i = 0; i < Stencil::d_per_d_length[dir]; ++i )
+   {
+      const stencil::Direction d = Stencil::d_per_d[dir][i];
+      const uint_t f = slot( d, even );
+
+      const CellInterval ci = sendInterval( *pdfField, dir, d, even );
+      for( auto cell = ci.begin(); cell != ci.end(); ++cell )
+         outBuffer << pdfField->get( *cell, f );
+   }
+}
+
+
+
+} // namespace lbm
+} // namespace walberla
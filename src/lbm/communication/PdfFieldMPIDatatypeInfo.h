@@ -61,6 +61,11 @@ public:
       return getField(block)->data();
    }
 
+   virtual bool sendsDataInDirection( const stencil::Direction dir ) const
+   {
+      return PdfField_T::Stencil::d_per_d_mask[dir] != uint_t(0);
+   }
+
 private:
 
    inline static std::set< cell_idx_t > getOptimizedCommunicationIndices( const stencil::Direction dir )
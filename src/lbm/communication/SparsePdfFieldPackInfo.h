@@ -73,6 +73,8 @@ public:
    bool constantDataExchange() const { return flagFieldConstant_; }
    bool threadsafeReceiving()  const { return true; }
 
+   bool sendsDataInDirection( stencil::Direction dir ) const { return Stencil::d_per_d_mask[dir] != uint_t(0); }
+
    void unpackData( IBlock * receiver, stencil::Direction dir, mpi::RecvBuffer & buffer );
 
    void communicateLocal( const IBlock * sender, IBlock * receiver, stencil::Direction dir );
@@ -93,7 +95,7 @@ protected:
 template< typename LatticeModel_T, typename FlagField_T >
 void SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T >::unpackData( IBlock * receiver, stencil::Direction dir, mpi::RecvBuffer & buffer )
 {
-   if( Stencil::idx[ stencil::inverseDir[dir] ] >= Stencil::Size )
+   if( !sendsDataInDirection( stencil::inverseDir[dir] ) )
       return;
 
    PdfField_T * pdfField = receiver->getData< PdfField_T >( pdfFieldId_ );
@@ -108,10 +110,7 @@ void SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T >::unpackData( IBlock *
 
    const flag_t mask = flagField->getFlag( flag_ );
 
-   stencil::Direction packerDirection = stencil::inverseDir[dir];
-   const auto packerIndex = Stencil::idx[ packerDirection ];
-
-   WALBERLA_ASSERT( packerIndex < Stencil::Size );
+   const stencil::Direction packerDirection = stencil::inverseDir[dir];
 
    WALBERLA_DEBUG_SECTION()
    {
@@ -119,7 +118,7 @@ void SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T >::unpackData( IBlock *
       for( auto flagIt = flagField->beginGhostLayerOnlyXYZ(dir); flagIt != flagField->end(); ++flagIt )
       {
          if( *flagIt & mask )
-            ctr += Stencil::d_per_d_length[packerIndex];
+            ctr += Stencil::d_per_d_length[packerDirection];
       }
       uint_t recvCtr = 0;
       buffer >> recvCtr;
@@ -135,8 +134,8 @@ void SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T >::unpackData( IBlock *
       WALBERLA_ASSERT_UNEQUAL( flagIt, flagField->end() );
 
       if( *flagIt & mask )
-         for(uint_t f = 0; f < Stencil::d_per_d_length[packerIndex]; ++f)
-            buffer >> pdfIt.getF( Stencil::idx[ Stencil::d_per_d[packerIndex][f] ] );
+         for(uint_t f = 0; f < Stencil::d_per_d_length[packerDirection]; ++f)
+            buffer >> pdfIt.getF( Stencil::idx[ Stencil::d_per_d[packerDirection][f] ] );
 
       ++pdfIt;
       ++flagIt;
@@ -150,7 +149,7 @@ void SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T >::unpackData( IBlock *
 template< typename LatticeModel_T, typename FlagField_T >
 void SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T >::communicateLocal( const IBlock * sender, IBlock * receiver, stencil::Direction dir )
 {
-   if( Stencil::idx[dir] >= Stencil::Size )
+   if( !sendsDataInDirection( dir ) )
       return;
 
    const PdfField_T * senderPdf   = sender  ->getData< PdfField_T >( pdfFieldId_ );
@@ -174,18 +173,14 @@ void SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T >::communicateLocal( co
 
    typename FlagField_T::const_iterator sendFlagIter = senderFlagField->beginSliceBeforeGhostLayerXYZ(dir);
 
-   const auto dirIndex = Stencil::idx[ dir ];
-
-   WALBERLA_ASSERT( dirIndex < Stencil::Size );
-
    while( sendPdfIter != senderPdf->end() )
    {
       WALBERLA_ASSERT_UNEQUAL( recvPdfIter, receiverPdf->end() );
       WALBERLA_ASSERT_UNEQUAL( sendFlagIter, senderFlagField->end() );
 
       if( *sendFlagIter & mask )
-         for( uint_t f = 0; f < Stencil::d_per_d_length[dirIndex]; ++f )
-            recvPdfIter.getF( Stencil::idx[ Stencil::d_per_d[dirIndex][f] ] ) = sendPdfIter.getF( Stencil::idx[ Stencil::d_per_d[dirIndex][f] ] );
+         for( uint_t f = 0; f < Stencil::d_per_d_length[dir]; ++f )
+            recvPdfIter.getF( Stencil::idx[ Stencil::d_per_d[dir][f] ] ) = sendPdfIter.getF( Stencil::idx[ Stencil::d_per_d[dir][f] ] );
 
       ++sendPdfIter;
       ++recvPdfIter;
@@ -202,7 +197,7 @@ void SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T >::communicateLocal( co
 template< typename LatticeModel_T, typename FlagField_T >
 void SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T >::packDataImpl( const IBlock * sender, stencil::Direction dir, mpi::SendBuffer & outBuffer ) const
 {
-   if( Stencil::idx[dir] >= Stencil::Size )
+   if( !sendsDataInDirection( dir ) )
       return;
 
    const PdfField_T * pdfField = sender->getData< PdfField_T >( pdfFieldId_ );
@@ -217,17 +212,13 @@ void SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T >::packDataImpl( const
 
    const flag_t mask = flagField->getFlag( flag_ );
 
-   const auto dirIndex = Stencil::idx[ dir ];
-
-   WALBERLA_ASSERT( dirIndex < Stencil::Size );
-
    WALBERLA_DEBUG_SECTION()
    {
       uint_t ctr = 0;
       for( auto flagIt = flagField->beginSliceBeforeGhostLayerXYZ(dir); flagIt != flagField->end(); ++flagIt )
       {
          if( *flagIt & mask )
-            ctr += Stencil::d_per_d_length[dirIndex];
+            ctr += Stencil::d_per_d_length[dir];
       }
       outBuffer << ctr;
    }
@@ -239,8 +230,8 @@ void SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T >::packDataImpl( const
       WALBERLA_ASSERT_UNEQUAL( flagIt, flagField->end() );
 
       if( *flagIt & mask )
-         for(uint_t f = 0; f < Stencil::d_per_d_length[dirIndex]; ++f)
-            outBuffer << pdfIt.getF( Stencil::idx[ Stencil::d_per_d[dirIndex][f] ] );
+         for(uint_t f = 0; f < Stencil::d_per_d_length[dir]; ++f)
+            outBuffer << pdfIt.getF( Stencil::idx[ Stencil::d_per_d[dir][f] ] );
 
       ++pdfIt;
       ++flagIt;
@@ -0,0 +1,174 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file WavefrontPdfFieldPackInfo.h
+//! \ingroup lbm
+//! \brief PackInfo for PDF fields with multiple ghost layers that are updated by the WavefrontSweep.
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "lbm/field/PdfField.h"
+#include "communication/UniformPackInfo.h"
+#include "core/cell/CellInterval.h"
+#include "core/debug/Debug.h"
+#include "stencil/Directions.h"
+
+
+namespace walberla {
+namespace lbm {
+
+
+
+/**
+ * \brief PackInfo for PDF fields that are updated by the WavefrontSweep (temporal blocking)
+ *
+ * Communicates 'numberOfGhostLayers' ghost layers at once, which allows the WavefrontSweep to perform the same number
+ * of time steps without any further communication. Since the ghost layers are also updated by the sweep, they must be
+ * complete: the communication scheme must use a D3Q27 stencil, regardless of the stencil of the lattice model.
+ *
+ * All inner ghost layers are communicated entirely. Cells in the outermost ghost layer are never updated, they are
+ * only read during the first time step - and only the PDF components pointing into the domain are required. All
+ * other components of the outermost ghost layer are not communicated.
+ *
+ * \ingroup lbm
+ */
+template< typename LatticeModel_T >
+class WavefrontPdfFieldPackInfo : public walberla::communication::UniformPackInfo
+{
+public:
+
+   typedef PdfField< LatticeModel_T >        PdfField_T;
+   typedef typename LatticeModel_T::Stencil  Stencil;
+
+   WavefrontPdfFieldPackInfo( const BlockDataID & pdfFieldId, const uint_t numberOfGhostLayers ) :
+      pdfFieldId_( pdfFieldId ), numberOfGhostLayers_( numberOfGhostLayers )
+   {
+      WALBERLA_ASSERT_GREATER( numberOfGhostLayers_, uint_t(0) );
+   }
+
+   virtual ~WavefrontPdfFieldPackInfo() {}
+
+   bool constantDataExchange() const { return true; }
+   bool threadsafeReceiving()  const { return true; }
+
+   void unpackData( IBlock * receiver, stencil::Direction dir, mpi::RecvBuffer & buffer );
+
+   void communicateLocal( const IBlock * sender, IBlock * receiver, stencil::Direction dir );
+
+protected:
+
+   void packDataImpl( const IBlock * sender, stencil::Direction dir, mpi::SendBuffer & outBuffer ) const;
+
+   /// Returns whether PDF component 'f' of ghost layer cell (x,y,z) is required by the receiving block
+   bool isRequired( const PdfField_T & receiver, const cell_idx_t x, const cell_idx_t y, const cell_idx_t z, const uint_t f ) const;
+
+
+
+   const BlockDataID pdfFieldId_;
+   const uint_t numberOfGhostLayers_;
+};
+
+
+
+template< typename LatticeModel_T >
+bool WavefrontPdfFieldPackInfo< LatticeModel_T >::isRequired( const PdfField_T & receiver, const cell_idx_t x, const cell_idx_t y,
+                                                              const cell_idx_t z, const uint_t f ) const
+{
+   const cell_idx_t gl = cell_idx_c( numberOfGhostLayers_ );
+   const stencil::Direction d = Stencil::dir[f];
+
+   // in the outermost ghost layer, only components pointing into the domain are read
+   if( ( x == -gl && stencil::cx[d] != 1 ) || ( x == cell_idx_c( receiver.xSize() ) - cell_idx_t(1) + gl && stencil::cx[d] != -1 ) )
+      return false;
+   if( ( y == -gl && stencil::cy[d] != 1 ) || ( y == cell_idx_c( receiver.ySize() ) - cell_idx_t(1) + gl && stencil::cy[d] != -1 ) )
+      return false;
+   if( ( z == -gl && stencil::cz[d] != 1 ) || ( z == cell_idx_c( receiver.zSize() ) - cell_idx_t(1) + gl && stencil::cz[d] != -1 ) )
+      return false;
+   return true;
+}
+
+
+
+template< typename LatticeModel_T >
+void WavefrontPdfFieldPackInfo< LatticeModel_T >::unpackData( IBlock * receiver, stencil::Direction dir, mpi::RecvBuffer & buffer )
+{
+   PdfField_T * pdfField = receiver->getData< PdfField_T >( pdfFieldId_ );
+   WALBERLA_ASSERT_NOT_NULLPTR( pdfField );
+   WALBERLA_ASSERT_GREATER_EQUAL( pdfField->nrOfGhostLayers(), numberOfGhostLayers_ );
+
+   CellInterval ci;
+   pdfField->getGhostRegion( dir, ci, cell_idx_c( numberOfGhostLayers_ ) );
+
+   for( auto cell = ci.begin(); cell != ci.end(); ++cell )
+      for( uint_t f = 0; f < Stencil::Size; ++f )
+         if( isRequired( *pdfField, cell->x(), cell->y(), cell->z(), f ) )
+            buffer >> pdfField->get( *cell, f );
+}
+
+
+
+template< typename LatticeModel_T >
+void WavefrontPdfFieldPackInfo< LatticeModel_T >::communicateLocal( const IBlock * sender, IBlock * receiver, stencil::Direction dir )
+{
+   const PdfField_T * sf = sender  ->getData< PdfField_T >( pdfFieldId_ );
+         PdfField_T * rf = receiver->getData< PdfField_T >( pdfFieldId_ );
+
+   WALBERLA_ASSERT_EQUAL( sf->xyzSize(), rf->xyzSize() );
+   WALBERLA_ASSERT_GREATER_EQUAL( sf->nrOfGhostLayers(), numberOfGhostLayers_ );
+   WALBERLA_ASSERT_GREATER_EQUAL( rf->nrOfGhostLayers(), numberOfGhostLayers_ );
+
+   CellInterval sci;
+   CellInterval rci;
+   sf->getSliceBeforeGhostLayer( dir, sci, cell_idx_c( numberOfGhostLayers_ ) );
+   rf->getGhostRegion( stencil::inverseDir[dir], rci, cell_idx_c( numberOfGhostLayers_ ) );
+
+   WALBERLA_ASSERT_EQUAL( sci.numCells(), rci.numCells() );
+
+   auto srcCell = sci.begin();
+   for( auto dstCell = rci.begin(); dstCell != rci.end(); ++srcCell, ++dstCell )
+      for( uint_t f = 0; f < Stencil::Size; ++f )
+         if( isRequired( *rf, dstCell->x(), dstCell->y(), dstCell->z(), f ) )
+            rf->get( *dstCell, f ) = sf->get( *srcCell, f );
+}
+
+
+
+template< typename LatticeModel_T >
+void WavefrontPdfFieldPackInfo< LatticeModel_T >::packDataImpl( const IBlock * sender, stencil::Direction dir, mpi::SendBuffer & outBuffer ) const
+{
+   const PdfField_T * pdfField = sender->getData< PdfField_T >( pdfFieldId_ );
+   WALBERLA_ASSERT_NOT_NULLPTR( pdfField );
+   WALBERLA_ASSERT_GREATER_EQUAL( pdfField->nrOfGhostLayers(), numberOfGhostLayers_ );
+
+   CellInterval ci;
+   pdfField->getSliceBeforeGhostLayer( dir, ci, cell_idx_c( numberOfGhostLayers_ ) );
+
+   // position of the sender cells in the ghost layers of the receiver (all blocks have the same size)
+   const cell_idx_t ox = cell_idx_c( stencil::cx[dir] ) * cell_idx_c( pdfField->xSize() );
+   const cell_idx_t oy = cell_idx_c( stencil::cy[dir] ) * cell_idx_c( pdfField->ySize() );
+   const cell_idx_t oz = cell_idx_c( stencil::cz[dir] ) * cell_idx_c( pdfField->zSize() );
+
+   for( auto cell = ci.begin(); cell != ci.end(); ++cell )
+      for( uint_t f = 0; f < Stencil::Size; ++f )
+         if( isRequired( *pdfField, cell->x() - ox, cell->y() - oy, cell->z() - oz, f ) )
+            outBuffer << pdfField->get( *cell, f );
+}
+
+
+
+} // namespace lbm
+} // namespace walberla
@@ -22,7 +22,9 @@
 
 #pragma once
 
+#include "AAPdfFieldPackInfo.h"
 #include "PdfFieldMPIDatatypeInfo.h"
 #include "PdfFieldPackInfo.h"
+#include "WavefrontPdfFieldPackInfo.h"
 
 
@@ -67,7 +67,7 @@ struct Density< LatticeModel_T, typename boost::enable_if_c< LatticeModel_T::com
    static inline real_t get( const LatticeModel_T & /*latticeModel*/,
                              const PdfField_T & pdf, const cell_idx_t x, const cell_idx_t y, const cell_idx_t z )
    {
-      const real_t & xyz0 = pdf(x,y,z,0);
+      const typename PdfField_T::value_type & xyz0 = pdf(x,y,z,0);
       real_t rho = xyz0;
       for( uint_t i = 1; i != LatticeModel_T::Stencil::Size; ++i )
          rho += pdf.getF( &xyz0, i );
@@ -102,7 +102,7 @@ struct Density< LatticeModel_T, typename boost::enable_if< boost::mpl::not_< boo
    static inline real_t get( const LatticeModel_T & /*latticeModel*/,
                              const PdfField_T & pdf, const cell_idx_t x, const cell_idx_t y, const cell_idx_t z )
    {
-      const real_t & xyz0 = pdf(x,y,z,0);
+      const typename PdfField_T::value_type & xyz0 = pdf(x,y,z,0);
       real_t rho = xyz0 + real_t(1.0);
       for( uint_t i = 1; i != LatticeModel_T::Stencil::Size; ++i )
          rho += pdf.getF( &xyz0, i );
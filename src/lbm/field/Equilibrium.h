@@ -69,11 +69,13 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
    static void set( FieldPtrOrIterator & it,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
+      typedef typename FieldPtrOrIterator::value_type value_type;
+
       const real_t dir_independent = (rho - real_t(1.0)) - real_t(1.5) * velocity.sqrLength();
       for( auto d = LatticeModel_T::Stencil::begin(); d != LatticeModel_T::Stencil::end(); ++d )
       {
          const real_t vel = real_c(d.cx()) * velocity[0] + real_c(d.cy()) * velocity[1] + real_c(d.cz()) * velocity[2];
-         it[ d.toIdx() ] = real_c(LatticeModel_T::w[ d.toIdx() ]) * ( dir_independent + real_t(3.0)*vel + real_t(4.5)*vel*vel );
+         it[ d.toIdx() ] = value_type( real_c(LatticeModel_T::w[ d.toIdx() ]) * ( dir_independent + real_t(3.0)*vel + real_t(4.5)*vel*vel ) );
       }
    }
 
@@ -81,12 +83,14 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
    static void set( PdfField_T & pdf, const cell_idx_t x, const cell_idx_t y, const cell_idx_t z,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
-      real_t & xyz0 = pdf(x,y,z,0);
+      typedef typename PdfField_T::value_type value_type;
+
+      value_type & xyz0 = pdf(x,y,z,0);
       const real_t dir_independent = (rho - real_t(1.0)) - real_t(1.5) * velocity.sqrLength();
       for( auto d = LatticeModel_T::Stencil::begin(); d != LatticeModel_T::Stencil::end(); ++d )
       {
          const real_t vel = real_c(d.cx()) * velocity[0] + real_c(d.cy()) * velocity[1] + real_c(d.cz()) * velocity[2];
-         pdf.getF( &xyz0, d.toIdx() ) = real_c(LatticeModel_T::w[ d.toIdx() ]) * ( dir_independent + real_t(3.0)*vel + real_t(4.5)*vel*vel );
+         pdf.getF( &xyz0, d.toIdx() ) = value_type( real_c(LatticeModel_T::w[ d.toIdx() ]) * ( dir_independent + real_t(3.0)*vel + real_t(4.5)*vel*vel ) );
       }
    }
 };
@@ -106,11 +110,13 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
    static void set( FieldPtrOrIterator & it,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
+      typedef typename FieldPtrOrIterator::value_type value_type;
+
       const real_t dir_independent = rho - real_t(1.0);
       for( auto d = LatticeModel_T::Stencil::begin(); d != LatticeModel_T::Stencil::end(); ++d )
       {
          const real_t vel = real_c(d.cx()) * velocity[0] + real_c(d.cy()) * velocity[1] + real_c(d.cz()) * velocity[2];
-         it[ d.toIdx() ] = real_c(LatticeModel_T::w[ d.toIdx() ]) * ( dir_independent + real_t(3.0)*vel );
+         it[ d.toIdx() ] = value_type( real_c(LatticeModel_T::w[ d.toIdx() ]) * ( dir_independent + real_t(3.0)*vel ) );
       }
    }
 
@@ -118,12 +124,14 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
    static void set( PdfField_T & pdf, const cell_idx_t x, const cell_idx_t y, const cell_idx_t z,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
-      real_t & xyz0 = pdf(x,y,z,0);
+      typedef typename PdfField_T::value_type value_type;
+
+      value_type & xyz0 = pdf(x,y,z,0);
       const real_t dir_independent = rho - real_t(1.0);
       for( auto d = LatticeModel_T::Stencil::begin(); d != LatticeModel_T::Stencil::end(); ++d )
       {
          const real_t vel = real_c(d.cx()) * velocity[0] + real_c(d.cy()) * velocity[1] + real_c(d.cz()) * velocity[2];
-         pdf.getF( &xyz0, d.toIdx() ) = real_c(LatticeModel_T::w[ d.toIdx() ]) * ( dir_independent + real_t(3.0)*vel );
+         pdf.getF( &xyz0, d.toIdx() ) = value_type( real_c(LatticeModel_T::w[ d.toIdx() ]) * ( dir_independent + real_t(3.0)*vel ) );
       }
    }
 };
@@ -144,11 +152,13 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
    static void set( FieldPtrOrIterator & it,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
+      typedef typename FieldPtrOrIterator::value_type value_type;
+
       const real_t dir_independent = real_t(1.0) - real_t(1.5) * velocity.sqrLength();
       for( auto d = LatticeModel_T::Stencil::begin(); d != LatticeModel_T::Stencil::end(); ++d )
       {
          const real_t vel = real_c(d.cx()) * velocity[0] + real_c(d.cy()) * velocity[1] + real_c(d.cz()) * velocity[2];
-         it[ d.toIdx() ] = real_c(LatticeModel_T::w[ d.toIdx() ]) * rho * ( dir_independent + real_t(3.0)*vel + real_t(4.5)*vel*vel );
+         it[ d.toIdx() ] = value_type( real_c(LatticeModel_T::w[ d.toIdx() ]) * rho * ( dir_independent + real_t(3.0)*vel + real_t(4.5)*vel*vel ) );
       }
    }
 
@@ -156,12 +166,14 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
    static void set( PdfField_T & pdf, const cell_idx_t x, const cell_idx_t y, const cell_idx_t z,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
-      real_t & xyz0 = pdf(x,y,z,0);
+      typedef typename PdfField_T::value_type value_type;
+
+      value_type & xyz0 = pdf(x,y,z,0);
       const real_t dir_independent = real_t(1.0) - real_t(1.5) * velocity.sqrLength();
       for( auto d = LatticeModel_T::Stencil::begin(); d != LatticeModel_T::Stencil::end(); ++d )
       {
          const real_t vel = real_c(d.cx()) * velocity[0] + real_c(d.cy()) * velocity[1] + real_c(d.cz()) * velocity[2];
-         pdf.getF( &xyz0, d.toIdx() ) = real_c(LatticeModel_T::w[ d.toIdx() ]) * rho * ( dir_independent + real_t(3.0)*vel + real_t(4.5)*vel*vel );
+         pdf.getF( &xyz0, d.toIdx() ) = value_type( real_c(LatticeModel_T::w[ d.toIdx() ]) * rho * ( dir_independent + real_t(3.0)*vel + real_t(4.5)*vel*vel ) );
       }
    }
 };
@@ -181,10 +193,12 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
    static void set( FieldPtrOrIterator & it,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
+      typedef typename FieldPtrOrIterator::value_type value_type;
+
       for( auto d = LatticeModel_T::Stencil::begin(); d != LatticeModel_T::Stencil::end(); ++d )
       {
          const real_t vel = real_c(d.cx()) * velocity[0] + real_c(d.cy()) * velocity[1] + real_c(d.cz()) * velocity[2];
-         it[ d.toIdx() ] = real_c(LatticeModel_T::w[ d.toIdx() ]) * rho * ( real_t(1.0) + real_t(3.0)*vel );
+         it[ d.toIdx() ] = value_type( real_c(LatticeModel_T::w[ d.toIdx() ]) * rho * ( real_t(1.0) + real_t(3.0)*vel ) );
       }
    }
 
@@ -192,11 +206,13 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
    static void set( PdfField_T & pdf, const cell_idx_t x, const cell_idx_t y, const cell_idx_t z,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
-      real_t & xyz0 = pdf(x,y,z,0);
+      typedef typename PdfField_T::value_type value_type;
+
+      value_type & xyz0 = pdf(x,y,z,0);
       for( auto d = LatticeModel_T::Stencil::begin(); d != LatticeModel_T::Stencil::end(); ++d )
       {
          const real_t vel = real_c(d.cx()) * velocity[0] + real_c(d.cy()) * velocity[1] + real_c(d.cz()) * velocity[2];
-         pdf.getF( &xyz0, d.toIdx() ) = real_c(LatticeModel_T::w[ d.toIdx() ]) * rho * ( real_t(1.0) + real_t(3.0)*vel );
+         pdf.getF( &xyz0, d.toIdx() ) = value_type( real_c(LatticeModel_T::w[ d.toIdx() ]) * rho * ( real_t(1.0) + real_t(3.0)*vel ) );
       }
    }
 };
@@ -219,6 +235,8 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
    static void set( FieldPtrOrIterator & it,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
+      typedef typename FieldPtrOrIterator::value_type value_type;
+
       using namespace stencil;
 
       const real_t velXX = velocity[0] * velocity[0];
@@ -227,7 +245,7 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
 
       const real_t dir_indep_trm = ( real_t(1) / real_t(3) ) * (rho - real_t(1.0)) - real_t(0.5) * ( velXX + velYY + velZZ );
 
-      it[ Stencil::idx[C] ] = dir_indep_trm;
+      it[ Stencil::idx[C] ] = value_type( dir_indep_trm );
 
       const real_t vel_trm_E_W = dir_indep_trm + real_t(1.5) * velXX;
       const real_t vel_trm_N_S = dir_indep_trm + real_t(1.5) * velYY;
@@ -235,59 +253,61 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
 
       const real_t w1 = real_t(3.0) / real_t(18.0);
 
-      it[ Stencil::idx[E] ] = w1 * ( vel_trm_E_W + velocity[0] );
-      it[ Stencil::idx[W] ] = w1 * ( vel_trm_E_W - velocity[0] );
-      it[ Stencil::idx[N] ] = w1 * ( vel_trm_N_S + velocity[1] );
-      it[ Stencil::idx[S] ] = w1 * ( vel_trm_N_S - velocity[1] );
-      it[ Stencil::idx[T] ] = w1 * ( vel_trm_T_B + velocity[2] );
-      it[ Stencil::idx[B] ] = w1 * ( vel_trm_T_B - velocity[2] );
+      it[ Stencil::idx[E] ] = value_type( w1 * ( vel_trm_E_W + velocity[0] ) );
+      it[ Stencil::idx[W] ] = value_type( w1 * ( vel_trm_E_W - velocity[0] ) );
+      it[ Stencil::idx[N] ] = value_type( w1 * ( vel_trm_N_S + velocity[1] ) );
+      it[ Stencil::idx[S] ] = value_type( w1 * ( vel_trm_N_S - velocity[1] ) );
+      it[ Stencil::idx[T] ] = value_type( w1 * ( vel_trm_T_B + velocity[2] ) );
+      it[ Stencil::idx[B] ] = value_type( w1 * ( vel_trm_T_B - velocity[2] ) );
 
       const real_t velXmY = velocity[0] - velocity[1];
       const real_t vel_trm_NW_SE = dir_indep_trm + real_t(1.5) * velXmY * velXmY;
 
       const real_t w2 = real_t(3.0) / real_t(36.0);
 
-      it[ Stencil::idx[NW] ] = w2 * ( vel_trm_NW_SE - velXmY );
-      it[ Stencil::idx[SE] ] = w2 * ( vel_trm_NW_SE + velXmY );
+      it[ Stencil::idx[NW] ] = value_type( w2 * ( vel_trm_NW_SE - velXmY ) );
+      it[ Stencil::idx[SE] ] = value_type( w2 * ( vel_trm_NW_SE + velXmY ) );
 
       const real_t velXpY = velocity[0] + velocity[1];
       const real_t vel_trm_NE_SW = dir_indep_trm + real_t(1.5) * velXpY * velXpY;
 
-      it[ Stencil::idx[NE] ] = w2 * ( vel_trm_NE_SW + velXpY );
-      it[ Stencil::idx[SW] ] = w2 * ( vel_trm_NE_SW - velXpY );
+      it[ Stencil::idx[NE] ] = value_type( w2 * ( vel_trm_NE_SW + velXpY ) );
+      it[ Stencil::idx[SW] ] = value_type( w2 * ( vel_trm_NE_SW - velXpY ) );
 
       const real_t velXmZ = velocity[0] - velocity[2];
       const real_t vel_trm_TW_BE = dir_indep_trm + real_t(1.5) * velXmZ * velXmZ;
 
-      it[ Stencil::idx[TW] ] = w2 * ( vel_trm_TW_BE - velXmZ );
-      it[ Stencil::idx[BE] ] = w2 * ( vel_trm_TW_BE + velXmZ );
+      it[ Stencil::idx[TW] ] = value_type( w2 * ( vel_trm_TW_BE - velXmZ ) );
+      it[ Stencil::idx[BE] ] = value_type( w2 * ( vel_trm_TW_BE + velXmZ ) );
 
       const real_t velXpZ = velocity[0] + velocity[2];
       const real_t vel_trm_TE_BW = dir_indep_trm + real_t(1.5) * velXpZ * velXpZ;
 
-      it[ Stencil::idx[TE] ] = w2 * ( vel_trm_TE_BW + velXpZ );
-      it[ Stencil::idx[BW] ] = w2 * ( vel_trm_TE_BW - velXpZ );
+      it[ Stencil::idx[TE] ] = value_type( w2 * ( vel_trm_TE_BW + velXpZ ) );
+      it[ Stencil::idx[BW] ] = value_type( w2 * ( vel_trm_TE_BW - velXpZ ) );
 
       const real_t velYmZ = velocity[1] - velocity[2];
       const real_t vel_trm_TS_BN = dir_indep_trm + real_t(1.5) * velYmZ * velYmZ;
 
-      it[ Stencil::idx[TS] ] = w2 * ( vel_trm_TS_BN - velYmZ );
-      it[ Stencil::idx[BN] ] = w2 * ( vel_trm_TS_BN + velYmZ );
+      it[ Stencil::idx[TS] ] = value_type( w2 * ( vel_trm_TS_BN - velYmZ ) );
+      it[ Stencil::idx[BN] ] = value_type( w2 * ( vel_trm_TS_BN + velYmZ ) );
 
       const real_t velYpZ = velocity[1] + velocity[2];
       const real_t vel_trm_TN_BS = dir_indep_trm + real_t(1.5) * velYpZ * velYpZ;
 
-      it[ Stencil::idx[TN] ] = w2 * ( vel_trm_TN_BS + velYpZ );
-      it[ Stencil::idx[BS] ] = w2 * ( vel_trm_TN_BS - velYpZ );
+      it[ Stencil::idx[TN] ] = value_type( w2 * ( vel_trm_TN_BS + velYpZ ) );
+      it[ Stencil::idx[BS] ] = value_type( w2 * ( vel_trm_TN_BS - velYpZ ) );
    }
 
    template< typename PdfField_T >
    static void set( PdfField_T & pdf, const cell_idx_t x, const cell_idx_t y, const cell_idx_t z,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
+      typedef typename PdfField_T::value_type value_type;
+
       using namespace stencil;
 
-      real_t & xyz0 = pdf(x,y,z,0);
+      value_type & xyz0 = pdf(x,y,z,0);
 
       const real_t velXX = velocity[0] * velocity[0];
       const real_t velYY = velocity[1] * velocity[1];
@@ -295,7 +315,7 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
 
       const real_t dir_indep_trm = ( real_t(1) / real_t(3) ) * (rho - real_t(1.0)) - real_t(0.5) * ( velXX + velYY + velZZ );
 
-      pdf.getF( &xyz0, Stencil::idx[C] ) = dir_indep_trm;
+      pdf.getF( &xyz0, Stencil::idx[C] ) = value_type( dir_indep_trm );
 
       const real_t vel_trm_E_W = dir_indep_trm + real_t(1.5) * velXX;
       const real_t vel_trm_N_S = dir_indep_trm + real_t(1.5) * velYY;
@@ -303,50 +323,50 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
 
       const real_t w1 = real_t(3.0) / real_t(18.0);
 
-      pdf.getF( &xyz0, Stencil::idx[E] ) = w1 * ( vel_trm_E_W + velocity[0] );
-      pdf.getF( &xyz0, Stencil::idx[W] ) = w1 * ( vel_trm_E_W - velocity[0] );
-      pdf.getF( &xyz0, Stencil::idx[N] ) = w1 * ( vel_trm_N_S + velocity[1] );
-      pdf.getF( &xyz0, Stencil::idx[S] ) = w1 * ( vel_trm_N_S - velocity[1] );
-      pdf.getF( &xyz0, Stencil::idx[T] ) = w1 * ( vel_trm_T_B + velocity[2] );
-      pdf.getF( &xyz0, Stencil::idx[B] ) = w1 * ( vel_trm_T_B - velocity[2] );
+      pdf.getF( &xyz0, Stencil::idx[E] ) = value_type( w1 * ( vel_trm_E_W + velocity[0] ) );
+      pdf.getF( &xyz0, Stencil::idx[W] ) = value_type( w1 * ( vel_trm_E_W - velocity[0] ) );
+      pdf.getF( &xyz0, Stencil::idx[N] ) = value_type( w1 * ( vel_trm_N_S + velocity[1] ) );
+      pdf.getF( &xyz0, Stencil::idx[S] ) = value_type( w1 * ( vel_trm_N_S - velocity[1] ) );
+      pdf.getF( &xyz0, Stencil::idx[T] ) = value_type( w1 * ( vel_trm_T_B + velocity[2] ) );
+      pdf.getF( &xyz0, Stencil::idx[B] ) = value_type( w1 * ( vel_trm_T_B - velocity[2] ) );
 
       const real_t velXmY = velocity[0] - velocity[1];
       const real_t vel_trm_NW_SE = dir_indep_trm + real_t(1.5) * velXmY * velXmY;
 
       const real_t w2 = real_t(3.0) / real_t(36.0);
 
-      pdf.getF( &xyz0, Stencil::idx[NW] ) = w2 * ( vel_trm_NW_SE - velXmY );
-      pdf.getF( &xyz0, Stencil::idx[SE] ) = w2 * ( vel_trm_NW_SE + velXmY );
+      pdf.getF( &xyz0, Stencil::idx[NW] ) = value_type( w2 * ( vel_trm_NW_SE - velXmY ) );
+      pdf.getF( &xyz0, Stencil::idx[SE] ) = value_type( w2 * ( vel_trm_NW_SE + velXmY ) );
 
       const real_t velXpY = velocity[0] + velocity[1];
       const real_t vel_trm_NE_SW = dir_indep_trm + real_t(1.5) * velXpY * velXpY;
 
-      pdf.getF( &xyz0, Stencil::idx[NE] ) = w2 * ( vel_trm_NE_SW + velXpY );
-      pdf.getF( &xyz0, Stencil::idx[SW] ) = w2 * ( vel_trm_NE_SW - velXpY );
+      pdf.getF( &xyz0, Stencil::idx[NE] ) = value_type( w2 * ( vel_trm_NE_SW + velXpY ) );
+      pdf.getF( &xyz0, Stencil::idx[SW] ) = value_type( w2 * ( vel_trm_NE_SW - velXpY ) );
 
       const real_t velXmZ = velocity[0] - velocity[2];
       const real_t vel_trm_TW_BE = dir_indep_trm + real_t(1.5) * velXmZ * velXmZ;
 
-      pdf.getF( &xyz0, Stencil::idx[TW] ) = w2 * ( vel_trm_TW_BE - velXmZ );
-      pdf.getF( &xyz0, Stencil::idx[BE] ) = w2 * ( vel_trm_TW_BE + velXmZ );
+      pdf.getF( &xyz0, Stencil::idx[TW] ) = value_type( w2 * ( vel_trm_TW_BE - velXmZ ) );
+      pdf.getF( &xyz0, Stencil::idx[BE] ) = value_type( w2 * ( vel_trm_TW_BE + velXmZ ) );
 
       const real_t velXpZ = velocity[0] + velocity[2];
       const real_t vel_trm_TE_BW = dir_indep_trm + real_t(1.5) * velXpZ * velXpZ;
 
-      pdf.getF( &xyz0, Stencil::idx[TE] ) = w2 * ( vel_trm_TE_BW + velXpZ );
-      pdf.getF( &xyz0, Stencil::idx[BW] ) = w2 * ( vel_trm_TE_BW - velXpZ );
+      pdf.getF( &xyz0, Stencil::idx[TE] ) = value_type( w2 * ( vel_trm_TE_BW + velXpZ ) );
+      pdf.getF( &xyz0, Stencil::idx[BW] ) = value_type( w2 * ( vel_trm_TE_BW - velXpZ ) );
 
       const real_t velYmZ = velocity[1] - velocity[2];
       const real_t vel_trm_TS_BN = dir_indep_trm + real_t(1.5) * velYmZ * velYmZ;
 
-      pdf.getF( &xyz0, Stencil::idx[TS] ) = w2 * ( vel_trm_TS_BN - velYmZ );
-      pdf.getF( &xyz0, Stencil::idx[BN] ) = w2 * ( vel_trm_TS_BN + velYmZ );
+      pdf.getF( &xyz0, Stencil::idx[TS] ) = value_type( w2 * ( vel_trm_TS_BN - velYmZ ) );
+      pdf.getF( &xyz0, Stencil::idx[BN] ) = value_type( w2 * ( vel_trm_TS_BN + velYmZ ) );
 
       const real_t velYpZ = velocity[1] + velocity[2];
       const real_t vel_trm_TN_BS = dir_indep_trm + real_t(1.5) * velYpZ * velYpZ;
 
-      pdf.getF( &xyz0, Stencil::idx[TN] ) = w2 * ( vel_trm_TN_BS + velYpZ );
-      pdf.getF( &xyz0, Stencil::idx[BS] ) = w2 * ( vel_trm_TN_BS - velYpZ );
+      pdf.getF( &xyz0, Stencil::idx[TN] ) = value_type( w2 * ( vel_trm_TN_BS + velYpZ ) );
+      pdf.getF( &xyz0, Stencil::idx[BS] ) = value_type( w2 * ( vel_trm_TN_BS - velYpZ ) );
    }
 };
 
@@ -368,6 +388,8 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
    static void set( FieldPtrOrIterator & it,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
+      typedef typename FieldPtrOrIterator::value_type value_type;
+
       using namespace stencil;
 
       const real_t velXX = velocity[0] * velocity[0];
@@ -376,7 +398,7 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
 
       const real_t dir_indep_trm = ( real_t(1) / real_t(3) ) - real_t(0.5) * ( velXX + velYY + velZZ );
 
-      it[ Stencil::idx[C] ] = rho * dir_indep_trm;
+      it[ Stencil::idx[C] ] = value_type( rho * dir_indep_trm );
 
       const real_t vel_trm_E_W = dir_indep_trm + real_t(1.5) * velXX;
       const real_t vel_trm_N_S = dir_indep_trm + real_t(1.5) * velYY;
@@ -384,59 +406,61 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
 
       const real_t w1_rho = rho * real_t(3.0) / real_t(18.0);
 
-      it[ Stencil::idx[E] ] = w1_rho * ( vel_trm_E_W + velocity[0] );
-      it[ Stencil::idx[W] ] = w1_rho * ( vel_trm_E_W - velocity[0] );
-      it[ Stencil::idx[N] ] = w1_rho * ( vel_trm_N_S + velocity[1] );
-      it[ Stencil::idx[S] ] = w1_rho * ( vel_trm_N_S - velocity[1] );
-      it[ Stencil::idx[T] ] = w1_rho * ( vel_trm_T_B + velocity[2] );
-      it[ Stencil::idx[B] ] = w1_rho * ( vel_trm_T_B - velocity[2] );
+      it[ Stencil::idx[E] ] = value_type( w1_rho * ( vel_trm_E_W + velocity[0] ) );
+      it[ Stencil::idx[W] ] = value_type( w1_rho * ( vel_trm_E_W - velocity[0] ) );
+      it[ Stencil::idx[N] ] = value_type( w1_rho * ( vel_trm_N_S + velocity[1] ) );
+      it[ Stencil::idx[S] ] = value_type( w1_rho * ( vel_trm_N_S - velocity[1] ) );
+      it[ Stencil::idx[T] ] = value_type( w1_rho * ( vel_trm_T_B + velocity[2] ) );
+      it[ Stencil::idx[B] ] = value_type( w1_rho * ( vel_trm_T_B - velocity[2] ) );
 
       const real_t velXmY = velocity[0] - velocity[1];
       const real_t vel_trm_NW_SE = dir_indep_trm + real_t(1.5) * velXmY * velXmY;
 
       const real_t w2_rho = rho * real_t(3.0) / real_t(36.0);
 
-      it[ Stencil::idx[NW] ] = w2_rho * ( vel_trm_NW_SE - velXmY );
-      it[ Stencil::idx[SE] ] = w2_rho * ( vel_trm_NW_SE + velXmY );
+      it[ Stencil::idx[NW] ] = value_type( w2_rho * ( vel_trm_NW_SE - velXmY ) );
+      it[ Stencil::idx[SE] ] = value_type( w2_rho * ( vel_trm_NW_SE + velXmY ) );
 
       const real_t velXpY = velocity[0] + velocity[1];
       const real_t vel_trm_NE_SW = dir_indep_trm + real_t(1.5) * velXpY * velXpY;
 
-      it[ Stencil::idx[NE] ] = w2_rho * ( vel_trm_NE_SW + velXpY );
-      it[ Stencil::idx[SW] ] = w2_rho * ( vel_trm_NE_SW - velXpY );
+      it[ Stencil::idx[NE] ] = value_type( w2_rho * ( vel_trm_NE_SW + velXpY ) );
+      it[ Stencil::idx[SW] ] = value_type( w2_rho * ( vel_trm_NE_SW - velXpY ) );
 
       const real_t velXmZ = velocity[0] - velocity[2];
       const real_t vel_trm_TW_BE = dir_indep_trm + real_t(1.5) * velXmZ * velXmZ;
 
-      it[ Stencil::idx[TW] ] = w2_rho * ( vel_trm_TW_BE - velXmZ );
-      it[ Stencil::idx[BE] ] = w2_rho * ( vel_trm_TW_BE + velXmZ );
+      it[ Stencil::idx[TW] ] = value_type( w2_rho * ( vel_trm_TW_BE - velXmZ ) );
+      it[ Stencil::idx[BE] ] = value_type( w2_rho * ( vel_trm_TW_BE + velXmZ ) );
 
       const real_t velXpZ = velocity[0] + velocity[2];
       const real_t vel_trm_TE_BW = dir_indep_trm + real_t(1.5) * velXpZ * velXpZ;
 
-      it[ Stencil::idx[TE] ] = w2_rho * ( vel_trm_TE_BW + velXpZ );
-      it[ Stencil::idx[BW] ] = w2_rho * ( vel_trm_TE_BW - velXpZ );
+      it[ Stencil::idx[TE] ] = value_type( w2_rho * ( vel_trm_TE_BW + velXpZ ) );
+      it[ Stencil::idx[BW] ] = value_type( w2_rho * ( vel_trm_TE_BW - velXpZ ) );
 
       const real_t velYmZ = velocity[1] - velocity[2];
       const real_t vel_trm_TS_BN = dir_indep_trm + real_t(1.5) * velYmZ * velYmZ;
 
-      it[ Stencil::idx[TS] ] = w2_rho * ( vel_trm_TS_BN - velYmZ );
-      it[ Stencil::idx[BN] ] = w2_rho * ( vel_trm_TS_BN + velYmZ );
+      it[ Stencil::idx[TS] ] = value_type( w2_rho * ( vel_trm_TS_BN - velYmZ ) );
+      it[ Stencil::idx[BN] ] = value_type( w2_rho * ( vel_trm_TS_BN + velYmZ ) );
 
       const real_t velYpZ = velocity[1] + velocity[2];
       const real_t vel_trm_TN_BS = dir_indep_trm + real_t(1.5) * velYpZ * velYpZ;
 
-      it[ Stencil::idx[TN] ] = w2_rho * ( vel_trm_TN_BS + velYpZ );
-      it[ Stencil::idx[BS] ] = w2_rho * ( vel_trm_TN_BS - velYpZ );
+      it[ Stencil::idx[TN] ] = value_type( w2_rho * ( vel_trm_TN_BS + velYpZ ) );
+      it[ Stencil::idx[BS] ] = value_type( w2_rho * ( vel_trm_TN_BS - velYpZ ) );
    }
 
    template< typename PdfField_T >
    static void set( PdfField_T & pdf, const cell_idx_t x, const cell_idx_t y, const cell_idx_t z,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
+      typedef typename PdfField_T::value_type value_type;
+
       using namespace stencil;
 
-      real_t & xyz0 = pdf(x,y,z,0);
+      value_type & xyz0 = pdf(x,y,z,0);
 
       const real_t velXX = velocity[0] * velocity[0];
       const real_t velYY = velocity[1] * velocity[1];
@@ -444,7 +468,7 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
 
       const real_t dir_indep_trm = ( real_t(1) / real_t(3) ) - real_t(0.5) * ( velXX + velYY + velZZ );
 
-      pdf.getF( &xyz0, Stencil::idx[C] ) = rho * dir_indep_trm;
+      pdf.getF( &xyz0, Stencil::idx[C] ) = value_type( rho * dir_indep_trm );
 
       const real_t vel_trm_E_W = dir_indep_trm + real_t(1.5) * velXX;
       const real_t vel_trm_N_S = dir_indep_trm + real_t(1.5) * velYY;
@@ -452,50 +476,50 @@ struct Equilibrium< LatticeModel_T, typename boost::enable_if< boost::mpl::and_<
 
       const real_t w1_rho = rho * real_t(3.0) / real_t(18.0);
 
-      pdf.getF( &xyz0, Stencil::idx[E] ) = w1_rho * ( vel_trm_E_W + velocity[0] );
-      pdf.getF( &xyz0, Stencil::idx[W] ) = w1_rho * ( vel_trm_E_W - velocity[0] );
-      pdf.getF( &xyz0, Stencil::idx[N] ) = w1_rho * ( vel_trm_N_S + velocity[1] );
-      pdf.getF( &xyz0, Stencil::idx[S] ) = w1_rho * ( vel_trm_N_S - velocity[1] );
-      pdf.getF( &xyz0, Stencil::idx[T] ) = w1_rho * ( vel_trm_T_B + velocity[2] );
-      pdf.getF( &xyz0, Stencil::idx[B] ) = w1_rho * ( vel_trm_T_B - velocity[2] );
+      pdf.getF( &xyz0, Stencil::idx[E] ) = value_type( w1_rho * ( vel_trm_E_W + velocity[0] ) );
+      pdf.getF( &xyz0, Stencil::idx[W] ) = value_type( w1_rho * ( vel_trm_E_W - velocity[0] ) );
+      pdf.getF( &xyz0, Stencil::idx[N] ) = value_type( w1_rho * ( vel_trm_N_S + velocity[1] ) );
+      pdf.getF( &xyz0, Stencil::idx[S] ) = value_type( w1_rho * ( vel_trm_N_S - velocity[1] ) );
+      pdf.getF( &xyz0, Stencil::idx[T] ) = value_type( w1_rho * ( vel_trm_T_B + velocity[2] ) );
+      pdf.getF( &xyz0, Stencil::idx[B] ) = value_type( w1_rho * ( vel_trm_T_B - velocity[2] ) );
 
       const real_t velXmY = velocity[0] - velocity[1];
       const real_t vel_trm_NW_SE = dir_indep_trm + real_t(1.5) * velXmY * velXmY;
 
       const real_t w2_rho = rho * real_t(3.0) / real_t(36.0);
 
-      pdf.getF( &xyz0, Stencil::idx[NW] ) = w2_rho * ( vel_trm_NW_SE - velXmY );
-      pdf.getF( &xyz0, Stencil::idx[SE] ) = w2_rho * ( vel_trm_NW_SE + velXmY );
+      pdf.getF( &xyz0, Stencil::idx[NW] ) = value_type( w2_rho * ( vel_trm_NW_SE - velXmY ) );
+      pdf.getF( &xyz0, Stencil::idx[SE] ) = value_type( w2_rho * ( vel_trm_NW_SE + velXmY ) );
 
       const real_t velXpY = velocity[0] + velocity[1];
       const real_t vel_trm_NE_SW = dir_indep_trm + real_t(1.5) * velXpY * velXpY;
 
-      pdf.getF( &xyz0, Stencil::idx[NE] ) = w2_rho * ( vel_trm_NE_SW + velXpY );
-      pdf.getF( &xyz0, Stencil::idx[SW] ) = w2_rho * ( vel_trm_NE_SW - velXpY );
+      pdf.getF( &xyz0, Stencil::idx[NE] ) = value_type( w2_rho * ( vel_trm_NE_SW + velXpY ) );
+      pdf.getF( &xyz0, Stencil::idx[SW] ) = value_type( w2_rho * ( vel_trm_NE_SW - velXpY ) );
 
       const real_t velXmZ = velocity[0] - velocity[2];
       const real_t vel_trm_TW_BE = dir_indep_trm + real_t(1.5) * velXmZ * velXmZ;
 
-      pdf.getF( &xyz0, Stencil::idx[TW] ) = w2_rho * ( vel_trm_TW_BE - velXmZ );
-      pdf.getF( &xyz0, Stencil::idx[BE] ) = w2_rho * ( vel_trm_TW_BE + velXmZ );
+      pdf.getF( &xyz0, Stencil::idx[TW] ) = value_type( w2_rho * ( vel_trm_TW_BE - velXmZ ) );
+      pdf.getF( &xyz0, Stencil::idx[BE] ) = value_type( w2_rho * ( vel_trm_TW_BE + velXmZ ) );
 
       const real_t velXpZ = velocity[0] + velocity[2];
       const real_t vel_trm_TE_BW = dir_indep_trm + real_t(1.5) * velXpZ * velXpZ;
 
-      pdf.getF( &xyz0, Stencil::idx[TE] ) = w2_rho * ( vel_trm_TE_BW + velXpZ );
-      pdf.getF( &xyz0, Stencil::idx[BW] ) = w2_rho * ( vel_trm_TE_BW - velXpZ );
+      pdf.getF( &xyz0, Stencil::idx[TE] ) = value_type( w2_rho * ( vel_trm_TE_BW + velXpZ ) );
+      pdf.getF( &xyz0, Stencil::idx[BW] ) = value_type( w2_rho * ( vel_trm_TE_BW - velXpZ ) );
 
       const real_t velYmZ = velocity[1] - velocity[2];
       const real_t vel_trm_TS_BN = dir_indep_trm + real_t(1.5) * velYmZ * velYmZ;
 
-      pdf.getF( &xyz0, Stencil::idx[TS] ) = w2_rho * ( vel_trm_TS_BN - velYmZ );
-      pdf.getF( &xyz0, Stencil::idx[BN] ) = w2_rho * ( vel_trm_TS_BN + velYmZ );
+      pdf.getF( &xyz0, Stencil::idx[TS] ) = value_type( w2_rho * ( vel_trm_TS_BN - velYmZ ) );
+      pdf.getF( &xyz0, Stencil::idx[BN] ) = value_type( w2_rho * ( vel_trm_TS_BN + velYmZ ) );
 
       const real_t velYpZ = velocity[1] + velocity[2];
       const real_t vel_trm_TN_BS = dir_indep_trm + real_t(1.5) * velYpZ * velYpZ;
 
-      pdf.getF( &xyz0, Stencil::idx[TN] ) = w2_rho * ( vel_trm_TN_BS + velYpZ );
-      pdf.getF( &xyz0, Stencil::idx[BS] ) = w2_rho * ( vel_trm_TN_BS - velYpZ );
+      pdf.getF( &xyz0, Stencil::idx[TN] ) = value_type( w2_rho * ( vel_trm_TN_BS + velYpZ ) );
+      pdf.getF( &xyz0, Stencil::idx[BS] ) = value_type( w2_rho * ( vel_trm_TN_BS - velYpZ ) );
    }
 };
 
@@ -520,13 +544,15 @@ struct EquilibriumRange< LatticeModel_T, FieldIteratorXYZ, typename boost::enabl
    static void set( FieldIteratorXYZ & begin, const FieldIteratorXYZ & end,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
-      std::vector< real_t > value( stencil::NR_OF_DIRECTIONS );
+      typedef typename FieldIteratorXYZ::value_type value_type;
+
+      std::vector< value_type > value( stencil::NR_OF_DIRECTIONS );
 
       const real_t dir_independent = (rho - real_t(1.0)) - real_t(1.5) * velocity.sqrLength();
       for( auto d = LatticeModel_T::Stencil::begin(); d != LatticeModel_T::Stencil::end(); ++d )
       {
          const real_t vel =  real_c(d.cx()) * velocity[0] +  real_c(d.cy()) * velocity[1] +  real_c(d.cz()) * velocity[2];
-         value[ d.toIdx() ] = real_c(LatticeModel_T::w[ d.toIdx() ]) * ( dir_independent + real_t(3.0)*vel + real_t(4.5)*vel*vel );
+         value[ d.toIdx() ] = value_type( real_c(LatticeModel_T::w[ d.toIdx() ]) * ( dir_independent + real_t(3.0)*vel + real_t(4.5)*vel*vel ) );
       }
 
       for( auto cell = begin; cell != end; ++cell )
@@ -542,13 +568,15 @@ struct EquilibriumRange< LatticeModel_T, FieldIteratorXYZ, typename boost::enabl
    static void set( FieldIteratorXYZ & begin, const FieldIteratorXYZ & end,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
-      std::vector< real_t > value( stencil::NR_OF_DIRECTIONS );
+      typedef typename FieldIteratorXYZ::value_type value_type;
+
+      std::vector< value_type > value( stencil::NR_OF_DIRECTIONS );
 
       const real_t dir_independent = rho - real_t(1.0);
       for( auto d = LatticeModel_T::Stencil::begin(); d != LatticeModel_T::Stencil::end(); ++d )
       {
          const real_t vel =  real_c(d.cx()) * velocity[0] +  real_c(d.cy()) * velocity[1] +  real_c(d.cz()) * velocity[2];
-         value[ d.toIdx() ] = real_c(LatticeModel_T::w[ d.toIdx() ]) * ( dir_independent + real_t(3.0)*vel );
+         value[ d.toIdx() ] = value_type( real_c(LatticeModel_T::w[ d.toIdx() ]) * ( dir_independent + real_t(3.0)*vel ) );
       }
 
       for( auto cell = begin; cell != end; ++cell )
@@ -564,13 +592,15 @@ struct EquilibriumRange< LatticeModel_T, FieldIteratorXYZ, typename boost::enabl
    static void set( FieldIteratorXYZ & begin, const FieldIteratorXYZ & end,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
-      std::vector< real_t > value( stencil::NR_OF_DIRECTIONS );
+      typedef typename FieldIteratorXYZ::value_type value_type;
+
+      std::vector< value_type > value( stencil::NR_OF_DIRECTIONS );
 
       const real_t dir_independent = real_t(1.0) - real_t(1.5) * velocity.sqrLength();
       for( auto d = LatticeModel_T::Stencil::begin(); d != LatticeModel_T::Stencil::end(); ++d )
       {
          const real_t vel = real_c(d.cx()) * velocity[0] + real_c(d.cy()) * velocity[1] + real_c(d.cz()) * velocity[2];
-         value[ d.toIdx() ] = real_c(LatticeModel_T::w[ d.toIdx() ]) * rho * ( dir_independent + real_t(3.0)*vel + real_t(4.5)*vel*vel );
+         value[ d.toIdx() ] = value_type( real_c(LatticeModel_T::w[ d.toIdx() ]) * rho * ( dir_independent + real_t(3.0)*vel + real_t(4.5)*vel*vel ) );
       }
 
       for( auto cell = begin; cell != end; ++cell )
@@ -586,13 +616,15 @@ struct EquilibriumRange< LatticeModel_T, FieldIteratorXYZ, typename boost::enabl
    static void set( FieldIteratorXYZ & begin, const FieldIteratorXYZ & end,
                     const Vector3< real_t > & velocity = Vector3< real_t >( real_t(0.0) ), const real_t rho = real_t(1.0) )
    {
-      std::vector< real_t > value( stencil::NR_OF_DIRECTIONS );
+      typedef typename FieldIteratorXYZ::value_type value_type;
+
+      std::vector< value_type > value( stencil::NR_OF_DIRECTIONS );
 
       const real_t dir_independent = real_t(1.0);
       for( auto d = LatticeModel_T::Stencil::begin(); d != LatticeModel_T::Stencil::end(); ++d )
       {
          const real_t vel = real_c(d.cx()) * velocity[0] + real_c(d.cy()) * velocity[1] + real_c(d.cz()) * velocity[2];
-         value[ d.toIdx() ] = real_c(LatticeModel_T::w[ d.toIdx() ]) * rho * ( dir_independent + real_t(3.0)*vel );
+         value[ d.toIdx() ] = value_type( real_c(LatticeModel_T::w[ d.toIdx() ]) * rho * ( dir_independent + real_t(3.0)*vel ) );
       }
 
       for( auto cell = begin; cell != end; ++cell )
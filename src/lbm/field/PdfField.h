@@ -28,6 +28,8 @@
 #include "ShearRate.h"
 #include "PressureTensor.h"
 
+#include "lbm/lattice_model/MixedPrecision.h"
+
 #include "core/math/Vector3.h"
 #include "core/math/Matrix3.h"
 
@@ -52,11 +54,13 @@ namespace lbm {
 *   z-coordinates!
 *   Also, particle distribution functions (i.e., the values stored in the field) can be accessed using stencil
 *   directions, e.g. "pdfField( x, y, z, stencil::NE )".
+*   The PDFs are stored as 'real_t', unless the lattice model is wrapped in lbm::MixedPrecision: then, the value type
+*   of the field is the storage type of the lattice model, whereas all macroscopic values are still returned as 'real_t'.
 */
 //**********************************************************************************************************************
 
 template< typename LatticeModel_T >
-class PdfField : public GhostLayerField< real_t, LatticeModel_T::Stencil::Size >
+class PdfField : public GhostLayerField< typename PdfStorage< LatticeModel_T >::type, LatticeModel_T::Stencil::Size >
 {
 public:
 
@@ -66,19 +70,19 @@ public:
    typedef LatticeModel_T                    LatticeModel;
    typedef typename LatticeModel_T::Stencil  Stencil;
 
-   typedef typename GhostLayerField< real_t, Stencil::Size >::value_type             value_type;
+   typedef typename PdfStorage< LatticeModel_T >::type                                   value_type;
 
-   typedef typename GhostLayerField< real_t, Stencil::Size >::iterator               iterator;
-   typedef typename GhostLayerField< real_t, Stencil::Size >::const_iterator         const_iterator;
+   typedef typename GhostLayerField< value_type, Stencil::Size >::iterator               iterator;
+   typedef typename GhostLayerField< value_type, Stencil::Size >::const_iterator         const_iterator;
 
-   typedef typename GhostLayerField< real_t, Stencil::Size >::reverse_iterator       reverse_iterator;
-   typedef typename GhostLayerField< real_t, Stencil::Size >::const_reverse_iterator const_reverse_iterator;
+   typedef typename GhostLayerField< value_type, Stencil::Size >::reverse_iterator       reverse_iterator;
+   typedef typename GhostLayerField< value_type, Stencil::Size >::const_reverse_iterator const_reverse_iterator;
 
-   typedef typename GhostLayerField< real_t, Stencil::Size >::base_iterator          base_iterator;
-   typedef typename GhostLayerField< real_t, Stencil::Size >::const_base_iterator    const_base_iterator;
+   typedef typename GhostLayerField< value_type, Stencil::Size >::base_iterator          base_iterator;
+   typedef typename GhostLayerField< value_type, Stencil::Size >::const_base_iterator    const_base_iterator;
 
-   typedef typename GhostLayerField< real_t, Stencil::Size >::Ptr                    Ptr;
-   typedef typename GhostLayerField< real_t, Stencil::Size >::ConstPtr               ConstPtr;
+   typedef typename GhostLayerField< value_type, Stencil::Size >::Ptr                    Ptr;
+   typedef typename GhostLayerField< value_type, Stencil::Size >::ConstPtr               ConstPtr;
    //@}
    //*******************************************************************************************************************
 
@@ -87,7 +91,7 @@ public:
              const bool initialize = true, const Vector3< real_t > & initialVelocity = Vector3< real_t >( real_t(0.0) ),
              const real_t initialDensity = real_t(1.0),
              const uint_t ghostLayers = uint_t(1), const field::Layout & _layout = field::zyxf,
-             const shared_ptr< field::FieldAllocator<real_t> > & alloc = shared_ptr< field::FieldAllocator<real_t> >() );
+             const shared_ptr< field::FieldAllocator<value_type> > & alloc = shared_ptr< field::FieldAllocator<value_type> >() );
 
    virtual ~PdfField() {}
 
@@ -109,19 +113,19 @@ public:
    // Access functions (with stencil::Direction!) //
    /////////////////////////////////////////////////
 
-   using GhostLayerField< real_t, Stencil::Size >::get;
+   using GhostLayerField< value_type, Stencil::Size >::get;
 
-         real_t & get( cell_idx_t x, cell_idx_t y, cell_idx_t z, stencil::Direction d )       { return get( x, y, z, Stencil::idx[d] ); }
-   const real_t & get( cell_idx_t x, cell_idx_t y, cell_idx_t z, stencil::Direction d ) const { return get( x, y, z, Stencil::idx[d] ); }
-         real_t & get( const Cell & c, stencil::Direction d )       { return get( c.x(), c.y(), c.z(), Stencil::idx[d] ); }
-   const real_t & get( const Cell & c, stencil::Direction d ) const { return get( c.x(), c.y(), c.z(), Stencil::idx[d] ); }
+         value_type & get( cell_idx_t x, cell_idx_t y, cell_idx_t z, stencil::Direction d )       { return get( x, y, z, Stencil::idx[d] ); }
+   const value_type & get( cell_idx_t x, cell_idx_t y, cell_idx_t z, stencil::Direction d ) const { return get( x, y, z, Stencil::idx[d] ); }
+         value_type & get( const Cell & c, stencil::Direction d )       { return get( c.x(), c.y(), c.z(), Stencil::idx[d] ); }
+   const value_type & get( const Cell & c, stencil::Direction d ) const { return get( c.x(), c.y(), c.z(), Stencil::idx[d] ); }
 
-   using GhostLayerField< real_t, Stencil::Size >::operator();
+   using GhostLayerField< value_type, Stencil::Size >::operator();
 
-         real_t & operator()( cell_idx_t x, cell_idx_t y, cell_idx_t z, stencil::Direction d )       { return get( x, y, z, Stencil::idx[d] ); }
-   const real_t & operator()( cell_idx_t x, cell_idx_t y, cell_idx_t z, stencil::Direction d ) const { return get( x, y, z, Stencil::idx[d] ); }
-         real_t & operator()( const Cell & c, stencil::Direction d )       { return get( c.x(), c.y(), c.z(), Stencil::idx[d] ); }
-   const real_t & operator()( const Cell & c, stencil::Direction d ) const { return get( c.x(), c.y(), c.z(), Stencil::idx[d] ); }
+         value_type & operator()( cell_idx_t x, cell_idx_t y, cell_idx_t z, stencil::Direction d )       { return get( x, y, z, Stencil::idx[d] ); }
+   const value_type & operator()( cell_idx_t x, cell_idx_t y, cell_idx_t z, stencil::Direction d ) const { return get( x, y, z, Stencil::idx[d] ); }
+         value_type & operator()( const Cell & c, stencil::Direction d )       { return get( c.x(), c.y(), c.z(), Stencil::idx[d] ); }
+   const value_type & operator()( const Cell & c, stencil::Direction d ) const { return get( c.x(), c.y(), c.z(), Stencil::idx[d] ); }
 
    //////////////////////////////
    // set density and velocity //
@@ -267,7 +271,7 @@ protected:
    /*! \name Shallow Copy */
    //@{
    inline PdfField( const PdfField< LatticeModel_T > & other );
-   Field< real_t, Stencil::Size > * cloneShallowCopyInternal() const { return new PdfField< LatticeModel_T >( *this ); }
+   Field< value_type, Stencil::Size > * cloneShallowCopyInternal() const { return new PdfField< LatticeModel_T >( *this ); }
    //@}
    //*******************************************************************************************************************
 
@@ -281,14 +285,14 @@ PdfField< LatticeModel_T >::PdfField( const uint_t _xSize, const uint_t _ySize,
                                       const LatticeModel_T & _latticeModel,
                                       const bool initialize, const Vector3< real_t > & initialVelocity, const real_t initialDensity,
                                       const uint_t ghostLayers, const field::Layout & _layout,
-                                      const shared_ptr< field::FieldAllocator<real_t> > & alloc ) :
+                                      const shared_ptr< field::FieldAllocator<value_type> > & alloc ) :
 
-   GhostLayerField< real_t, Stencil::Size >( _xSize, _ySize, _zSize, ghostLayers, _layout, alloc ),
+   GhostLayerField< value_type, Stencil::Size >( _xSize, _ySize, _zSize, ghostLayers, _layout, alloc ),
    latticeModel_( _latticeModel )
 {
 #ifdef _OPENMP
    // take care of proper thread<->memory assignment (first-touch allocation policy !)
-   this->setWithGhostLayer( real_t(0) );
+   this->setWithGhostLayer( value_type(0) );
 #endif
 
    if( initialize )
@@ -300,19 +304,19 @@ PdfField< LatticeModel_T >::PdfField( const uint_t _xSize, const uint_t _ySize,
 template< typename LatticeModel_T >
 inline PdfField< LatticeModel_T > * PdfField< LatticeModel_T >::clone() const
 {
-   return dynamic_cast< PdfField * >( GhostLayerField< real_t, Stencil::Size >::clone() );
+   return dynamic_cast< PdfField * >( GhostLayerField< value_type, Stencil::Size >::clone() );
 }
 
 template< typename LatticeModel_T >
 inline PdfField< LatticeModel_T > * PdfField< LatticeModel_T >::cloneUninitialized() const
 {
-   return dynamic_cast< PdfField * >( GhostLayerField< real_t, Stencil::Size >::cloneUninitialized() );
+   return dynamic_cast< PdfField * >( GhostLayerField< value_type, Stencil::Size >::cloneUninitialized() );
 }
 
 template< typename LatticeModel_T >
 inline PdfField< LatticeModel_T > * PdfField< LatticeModel_T >::cloneShallowCopy() const
 {
-   return dynamic_cast< PdfField * >( GhostLayerField< real_t, Stencil::Size >::cloneShallowCopy() );
+   return dynamic_cast< PdfField * >( GhostLayerField< value_type, Stencil::Size >::cloneShallowCopy() );
 }
 
 
@@ -751,7 +755,7 @@ inline void PdfField< LatticeModel_T >::getPressureTensor( Matrix3< real_t > & p
 
 template< typename LatticeModel_T >
 inline PdfField< LatticeModel_T >::PdfField( const PdfField< LatticeModel_T > & other )
-   : GhostLayerField< real_t, Stencil::Size >::GhostLayerField( other ),
+   : GhostLayerField< value_type, Stencil::Size >::GhostLayerField( other ),
      latticeModel_( other.latticeModel_ )
 {
 }
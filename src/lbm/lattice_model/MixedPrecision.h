@@ -0,0 +1,96 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file MixedPrecision.h
+//! \ingroup lbm
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "core/DataTypes.h"
+
+#include <boost/type_traits/is_floating_point.hpp>
+
+
+namespace walberla {
+namespace lbm {
+
+
+
+//**********************************************************************************************************************
+/*!
+*   \brief Trait that determines the data type in which the PDFs of a lattice model are stored (see lbm::PdfField)
+*
+*   For all lattice models, PDFs are stored as 'real_t' unless the lattice model is wrapped in lbm::MixedPrecision.
+*/
+//**********************************************************************************************************************
+
+template< typename LatticeModel_T >
+struct PdfStorage
+{
+   typedef real_t type;
+};
+
+
+
+//**********************************************************************************************************************
+/*!
+*   \brief Lattice model wrapper that stores PDFs in a different floating point type than 'real_t'
+*
+*   The wrapped lattice model behaves exactly like 'LatticeModel_T', only the PDF field (lbm::PdfField) uses
+*   'Storage_T' as its value type. All computations (collision, density, velocity, equilibrium) are still carried out
+*   in 'real_t', PDFs are only converted when they are loaded from or stored to the field:
+*
+*   \code
+*   typedef lbm::MixedPrecision< lbm::D3Q19< lbm::collision_model::SRT, false >, float > LatticeModel_T;
+*   \endcode
+*
+*   With 'real_t' being double, this halves the memory footprint of the PDF field and the amount of data that must be
+*   transferred by memory bound kernels like the SplitPureSweep (for which the D3Q19, D3Q15, and D3Q27 SRT and TRT
+*   implementations are optimized for both storage types). Since the PDFs of incompressible lattice models are stored
+*   as deviations from the lattice weights (f - w), the values stored in the field are small and single precision
+*   storage retains most of its relative accuracy.
+*
+*   Kernels that access the PDFs via PdfField::get convert every value on access. Kernels that work on raw 'real_t'
+*   pointers into the field (SparseSweep, SplitSweep, cumulant SplitPureSweep) do not support a different storage type
+*   and fail to compile with a static assertion.
+*/
+//**********************************************************************************************************************
+
+template< typename LatticeModel_T, typename Storage_T = float >
+class MixedPrecision : public LatticeModel_T
+{
+public:
+
+   static_assert( boost::is_floating_point< Storage_T >::value, "PDFs can only be stored in floating point types!" );
+
+   using LatticeModel_T::LatticeModel_T;
+
+   MixedPrecision( const LatticeModel_T & latticeModel ) : LatticeModel_T( latticeModel ) {}
+
+   virtual ~MixedPrecision() {}
+};
+
+template< typename LatticeModel_T, typename Storage_T >
+struct PdfStorage< MixedPrecision< LatticeModel_T, Storage_T > >
+{
+   typedef Storage_T type;
+};
+
+
+
+} // namespace lbm
+} // namespace walberla
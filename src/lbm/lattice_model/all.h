@@ -30,4 +30,5 @@
 #include "EquilibriumDistribution.h"
 #include "ForceModel.h"
 #include "LatticeModelBase.h"
+#include "MixedPrecision.h"
 #include "SmagorinskyLES.h"
@@ -26,8 +26,12 @@
 #include "lbm/field/PdfField.h"
 #include "blockforest/BlockNeighborhoodSection.h"
 #include "core/cell/CellInterval.h"
+#include "core/mpi/Datatype.h"
+#include "field/communication/MPIDatatypes.h"
 #include "stencil/Directions.h"
 
+#include <set>
+
 
 namespace walberla {
 namespace lbm {
@@ -51,13 +55,13 @@ public:
    PdfFieldPackInfo( const BlockDataID & pdfFieldId, const bool _optimizedEqualLevelCommunication = true,
                      const bool _optimizedForLinearExplosion = true ) :
       pdfFieldId_( pdfFieldId ), optimizedEqualLevelCommunication_( _optimizedEqualLevelCommunication ),
-      optimizedForLinearExplosion_( _optimizedForLinearExplosion ), equalLevelCells_( equalLevelCells() ) {}
+      optimizedForLinearExplosion_( _optimizedForLinearExplosion ), equalLevelDatatypes_( false ), equalLevelCells_( equalLevelCells() ) {}
 #else
    PdfFieldPackInfo( const BlockDataID & pdfFieldId, const ConstBlockDataID & boundaryHandlingId,
                      const bool _optimizedEqualLevelCommunication = true, const bool _optimizedForLinearExplosion = true ) :
       pdfFieldId_( pdfFieldId ), boundaryHandlingId_( boundaryHandlingId ),
       optimizedEqualLevelCommunication_( _optimizedEqualLevelCommunication ), optimizedForLinearExplosion_( _optimizedForLinearExplosion ),
-      equalLevelCells_( equalLevelCells() ) {}
+      equalLevelDatatypes_( false ), equalLevelCells_( equalLevelCells() ) {}
 #endif
 
    virtual ~PdfFieldPackInfo() {}
@@ -67,10 +71,33 @@ public:
    
    bool optimizedForLinearExplosion() const { return optimizedForLinearExplosion_; }
    void optimizeForLinearExplosion( const bool value = true ) { optimizedForLinearExplosion_ = value; }
+
+   /// If enabled, the optimized equal level communication between blocks on different processes is performed with
+   /// MPI datatypes directly from/to the PDF fields (no packing/unpacking). Must be set before the first communication.
+   bool equalLevelDatatypesUsed() const { return equalLevelDatatypes_; }
+   void useEqualLevelDatatypes( const bool value = true ) { equalLevelDatatypes_ = value; }
    
    bool constantDataExchange() const { return true; }
    bool threadsafeReceiving()  const { return true; }
 
+   bool equalLevelDatatypeCommunication( const Block * block, stencil::Direction dir ) const
+   {
+      // only the optimized communication (one layer, only PDFs that stream into the neighbor) is performed with datatypes
+      return equalLevelDatatypes_ && optimizedEqualLevelCommunication_ && !coarserNeighborExistsInVicinity( block, dir );
+   }
+
+   shared_ptr< mpi::Datatype > getEqualLevelSendDatatype( const Block * sender,   stencil::Direction dir ) const;
+   shared_ptr< mpi::Datatype > getEqualLevelRecvDatatype( const Block * receiver, stencil::Direction dir ) const;
+
+   const void * getEqualLevelSendPointer( const Block * sender, stencil::Direction ) const
+   {
+      return sender->getData< PdfField_T >( pdfFieldId_ )->data();
+   }
+   void * getEqualLevelRecvPointer( Block * receiver, stencil::Direction ) const
+   {
+      return receiver->getData< PdfField_T >( pdfFieldId_ )->data();
+   }
+
    void       unpackDataEqualLevel( Block * receiver, stencil::Direction dir, mpi::RecvBuffer & buffer );
    void communicateLocalEqualLevel( const Block * sender, Block * receiver, stencil::Direction dir );
 
@@ -130,6 +157,8 @@ protected:
    
    bool optimizedEqualLevelCommunication_;
    bool optimizedForLinearExplosion_;
+
+   bool equalLevelDatatypes_;
    
    uint_t equalLevelCells_;
 };
@@ -490,6 +519,64 @@ void PdfFieldPackInfo< LatticeModel_T, BoundaryHandling_T >::communicateLocalEqu
 
 
 
+#ifdef NDEBUG
+template< typename LatticeModel_T >
+shared_ptr< mpi::Datatype > PdfFieldPackInfo< LatticeModel_T >::getEqualLevelSendDatatype( const Block * sender, stencil::Direction dir ) const
+#else
+template< typename LatticeModel_T, typename BoundaryHandling_T >
+shared_ptr< mpi::Datatype > PdfFieldPackInfo< LatticeModel_T, BoundaryHandling_T >::getEqualLevelSendDatatype( const Block * sender,
+                                                                                                             stencil::Direction dir ) const
+#endif
+{
+   WALBERLA_ASSERT( equalLevelDatatypeCommunication( sender, dir ) );
+
+   if( Stencil::d_per_d_length[dir] == uint_t(0) )
+      return shared_ptr< mpi::Datatype >();
+
+   const PdfField_T * field = sender->getData< PdfField_T >( pdfFieldId_ );
+
+   // same cells and PDFs as in the optimized case of packDataEqualLevelImpl
+   CellInterval packingInterval = equalLevelPackInterval( dir, field->xyzSize(), uint_t(1) );
+
+   std::set< cell_idx_t > fs;
+   for( uint_t d = 0; d < Stencil::d_per_d_length[dir]; ++d )
+      fs.insert( cell_idx_c( Stencil::idx[ Stencil::d_per_d[dir][d] ] ) );
+
+   return make_shared< mpi::Datatype >( field::communication::mpiDatatypeSliceXYZ( *field, packingInterval, fs ) );
+}
+
+
+
+#ifdef NDEBUG
+template< typename LatticeModel_T >
+shared_ptr< mpi::Datatype > PdfFieldPackInfo< LatticeModel_T >::getEqualLevelRecvDatatype( const Block * receiver, stencil::Direction dir ) const
+#else
+template< typename LatticeModel_T, typename BoundaryHandling_T >
+shared_ptr< mpi::Datatype > PdfFieldPackInfo< LatticeModel_T, BoundaryHandling_T >::getEqualLevelRecvDatatype( const Block * receiver,
+                                                                                                             stencil::Direction dir ) const
+#endif
+{
+   WALBERLA_ASSERT( equalLevelDatatypeCommunication( receiver, dir ) );
+
+   const auto invDir = stencil::inverseDir[dir];
+
+   if( Stencil::d_per_d_length[invDir] == uint_t(0) )
+      return shared_ptr< mpi::Datatype >();
+
+   const PdfField_T * field = receiver->getData< PdfField_T >( pdfFieldId_ );
+
+   // same cells and PDFs as in the optimized case of unpackDataEqualLevel
+   CellInterval unpackingInterval = equalLevelUnpackInterval( dir, field->xyzSize(), uint_t(1) );
+
+   std::set< cell_idx_t > fs;
+   for( uint_t d = 0; d < Stencil::d_per_d_length[invDir]; ++d )
+      fs.insert( cell_idx_c( Stencil::idx[ Stencil::d_per_d[invDir][d] ] ) );
+
+   return make_shared< mpi::Datatype >( field::communication::mpiDatatypeSliceXYZ( *field, unpackingInterval, fs ) );
+}
+
+
+
 ////////////////////
 // Coarse to fine //
 ////////////////////
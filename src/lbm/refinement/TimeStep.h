@@ -140,6 +140,11 @@ public:
       pdfPackInfo_->optimizeForLinearExplosion( optimizedCommunication_ && performLinearExplosion_ );
    }
 
+   /// Equal level communication between processes without packing/unpacking, see PdfFieldPackInfo::useEqualLevelDatatypes
+   /// (only effective if the communication is optimized). Must be called before the first time step.
+   bool equalLevelDatatypesAreUsed() const { return pdfPackInfo_->equalLevelDatatypesUsed(); }
+   void useEqualLevelDatatypes( const bool value = true ) { pdfPackInfo_->useEqualLevelDatatypes( value ); }
+
    bool equalLevelBorderStreamCorrectionIsPerformed() const { return performEqualLevelBorderStreamCorrection_; }
    void performEqualLevelBorderStreamCorrection( const bool value = true )
    {
@@ -36,6 +36,9 @@ public:
 
    virtual bool optimizedForLinearExplosion() const = 0;
    virtual void optimizeForLinearExplosion( const bool value = true ) = 0;
+
+   virtual bool equalLevelDatatypesUsed() const = 0;
+   virtual void useEqualLevelDatatypes( const bool value = true ) = 0;
 };
 
 
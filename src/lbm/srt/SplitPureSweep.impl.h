@@ -26,7 +26,9 @@
 #pragma once
 
 #include "lbm/lattice_model/LatticeModelBase.h"
+#include "lbm/lattice_model/D3Q15.h"
 #include "lbm/lattice_model/D3Q19.h"
+#include "lbm/lattice_model/D3Q27.h"
 #include "lbm/sweeps/Streaming.h"
 #include "lbm/sweeps/SweepBase.h"
 #include "lbm/IntelCompilerOptimization.h"
@@ -51,6 +53,10 @@ namespace lbm {
 // Optimized D3Q19 implementation:                   //
 //                     incompressible | compressible //
 //          no forces:       x               x       //
+//                                                   //
+// Split D3Q15 & D3Q27 implementation:               //
+//                     incompressible | compressible //
+//          no forces:       x               x       //
 ///////////////////////////////////////////////////////
 
 
@@ -81,6 +87,7 @@ public:
 
    typedef typename SweepBase<LatticeModel_T>::PdfField_T  PdfField_T;
    typedef typename LatticeModel_T::Stencil                Stencil;
+   typedef typename PdfField_T::value_type                 PdfValue_T;
 
    // block has NO dst pdf field
    SplitPureSweep( const BlockDataID & pdfField ) :
@@ -145,35 +152,35 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
          using namespace stencil;
 
-         real_t * WALBERLA_RESTRICT pNE = &src->get(-1, y-1, z  , Stencil::idx[NE]);
-         real_t * WALBERLA_RESTRICT pN  = &src->get(0 , y-1, z  , Stencil::idx[N]);
-         real_t * WALBERLA_RESTRICT pNW = &src->get(+1, y-1, z  , Stencil::idx[NW]);
-         real_t * WALBERLA_RESTRICT pW  = &src->get(+1, y  , z  , Stencil::idx[W]);
-         real_t * WALBERLA_RESTRICT pSW = &src->get(+1, y+1, z  , Stencil::idx[SW]);
-         real_t * WALBERLA_RESTRICT pS  = &src->get(0 , y+1, z  , Stencil::idx[S]);
-         real_t * WALBERLA_RESTRICT pSE = &src->get(-1, y+1, z  , Stencil::idx[SE]);
-         real_t * WALBERLA_RESTRICT pE  = &src->get(-1, y  , z  , Stencil::idx[E]);
-         real_t * WALBERLA_RESTRICT pT  = &src->get(0 , y  , z-1, Stencil::idx[T]);
-         real_t * WALBERLA_RESTRICT pTE = &src->get(-1, y  , z-1, Stencil::idx[TE]);
-         real_t * WALBERLA_RESTRICT pTN = &src->get(0 , y-1, z-1, Stencil::idx[TN]);
-         real_t * WALBERLA_RESTRICT pTW = &src->get(+1, y  , z-1, Stencil::idx[TW]);
-         real_t * WALBERLA_RESTRICT pTS = &src->get(0 , y+1, z-1, Stencil::idx[TS]);
-         real_t * WALBERLA_RESTRICT pB  = &src->get(0 , y  , z+1, Stencil::idx[B]);
-         real_t * WALBERLA_RESTRICT pBE = &src->get(-1, y  , z+1, Stencil::idx[BE]);
-         real_t * WALBERLA_RESTRICT pBN = &src->get(0 , y-1, z+1, Stencil::idx[BN]);
-         real_t * WALBERLA_RESTRICT pBW = &src->get(+1, y  , z+1, Stencil::idx[BW]);
-         real_t * WALBERLA_RESTRICT pBS = &src->get(0 , y+1, z+1, Stencil::idx[BS]);
-         real_t * WALBERLA_RESTRICT pC  = &src->get(0 , y  , z  , Stencil::idx[C]);
-
-         real_t * WALBERLA_RESTRICT dC = &dst->get(0,y,z,Stencil::idx[C]);
+         PdfValue_T * WALBERLA_RESTRICT pNE = &src->get(-1, y-1, z  , Stencil::idx[NE]);
+         PdfValue_T * WALBERLA_RESTRICT pN  = &src->get(0 , y-1, z  , Stencil::idx[N]);
+         PdfValue_T * WALBERLA_RESTRICT pNW = &src->get(+1, y-1, z  , Stencil::idx[NW]);
+         PdfValue_T * WALBERLA_RESTRICT pW  = &src->get(+1, y  , z  , Stencil::idx[W]);
+         PdfValue_T * WALBERLA_RESTRICT pSW = &src->get(+1, y+1, z  , Stencil::idx[SW]);
+         PdfValue_T * WALBERLA_RESTRICT pS  = &src->get(0 , y+1, z  , Stencil::idx[S]);
+         PdfValue_T * WALBERLA_RESTRICT pSE = &src->get(-1, y+1, z  , Stencil::idx[SE]);
+         PdfValue_T * WALBERLA_RESTRICT pE  = &src->get(-1, y  , z  , Stencil::idx[E]);
+         PdfValue_T * WALBERLA_RESTRICT pT  = &src->get(0 , y  , z-1, Stencil::idx[T]);
+         PdfValue_T * WALBERLA_RESTRICT pTE = &src->get(-1, y  , z-1, Stencil::idx[TE]);
+         PdfValue_T * WALBERLA_RESTRICT pTN = &src->get(0 , y-1, z-1, Stencil::idx[TN]);
+         PdfValue_T * WALBERLA_RESTRICT pTW = &src->get(+1, y  , z-1, Stencil::idx[TW]);
+         PdfValue_T * WALBERLA_RESTRICT pTS = &src->get(0 , y+1, z-1, Stencil::idx[TS]);
+         PdfValue_T * WALBERLA_RESTRICT pB  = &src->get(0 , y  , z+1, Stencil::idx[B]);
+         PdfValue_T * WALBERLA_RESTRICT pBE = &src->get(-1, y  , z+1, Stencil::idx[BE]);
+         PdfValue_T * WALBERLA_RESTRICT pBN = &src->get(0 , y-1, z+1, Stencil::idx[BN]);
+         PdfValue_T * WALBERLA_RESTRICT pBW = &src->get(+1, y  , z+1, Stencil::idx[BW]);
+         PdfValue_T * WALBERLA_RESTRICT pBS = &src->get(0 , y+1, z+1, Stencil::idx[BS]);
+         PdfValue_T * WALBERLA_RESTRICT pC  = &src->get(0 , y  , z  , Stencil::idx[C]);
+
+         PdfValue_T * WALBERLA_RESTRICT dC = &dst->get(0,y,z,Stencil::idx[C]);
 
          X_LOOP
          (
-            const real_t velX_trm = pE[x] + pNE[x] + pSE[x] + pTE[x] + pBE[x];
-            const real_t velY_trm = pN[x] + pNW[x] + pTN[x] + pBN[x];
-            const real_t velZ_trm = pT[x] + pTS[x] + pTW[x];
+            const real_t velX_trm = real_t( pE[x] ) + pNE[x] + pSE[x] + pTE[x] + pBE[x];
+            const real_t velY_trm = real_t( pN[x] ) + pNW[x] + pTN[x] + pBN[x];
+            const real_t velZ_trm = real_t( pT[x] ) + pTS[x] + pTW[x];
 
-            const real_t rho = pC[x] + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
+            const real_t rho = real_t( pC[x] ) + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
 
             velX[x] = velX_trm - pW[x]  - pNW[x] - pSW[x] - pTW[x] - pBW[x];
             velY[x] = velY_trm + pNE[x] - pS[x]  - pSW[x] - pSE[x] - pTS[x] - pBS[x];
@@ -181,112 +188,112 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             dir_indep_trm[x] = one_third * rho - real_c(0.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            dC[x] = omega_trm * pC[x] + omega_w0 * dir_indep_trm[x];
+            dC[x] = PdfValue_T( omega_trm * pC[x] + omega_w0 * dir_indep_trm[x] );
          )
 
-         real_t * WALBERLA_RESTRICT dNW = &dst->get(0,y,z,Stencil::idx[NW]);
-         real_t * WALBERLA_RESTRICT dSE = &dst->get(0,y,z,Stencil::idx[SE]);
+         PdfValue_T * WALBERLA_RESTRICT dNW = &dst->get(0,y,z,Stencil::idx[NW]);
+         PdfValue_T * WALBERLA_RESTRICT dSE = &dst->get(0,y,z,Stencil::idx[SE]);
 
          X_LOOP
          (
             const real_t vel = velX[x] - velY[x];
             const real_t vel_trm_NW_SE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dNW[x] = omega_trm * pNW[x] + omega_w2 * ( vel_trm_NW_SE - vel );
-            dSE[x] = omega_trm * pSE[x] + omega_w2 * ( vel_trm_NW_SE + vel );
+            dNW[x] = PdfValue_T( omega_trm * pNW[x] + omega_w2 * ( vel_trm_NW_SE - vel ) );
+            dSE[x] = PdfValue_T( omega_trm * pSE[x] + omega_w2 * ( vel_trm_NW_SE + vel ) );
          )
 
-         real_t * WALBERLA_RESTRICT dNE = &dst->get(0,y,z,Stencil::idx[NE]);
-         real_t * WALBERLA_RESTRICT dSW = &dst->get(0,y,z,Stencil::idx[SW]);
+         PdfValue_T * WALBERLA_RESTRICT dNE = &dst->get(0,y,z,Stencil::idx[NE]);
+         PdfValue_T * WALBERLA_RESTRICT dSW = &dst->get(0,y,z,Stencil::idx[SW]);
 
          X_LOOP
          (
             const real_t vel = velX[x] + velY[x];
             const real_t vel_trm_NE_SW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dNE[x] = omega_trm * pNE[x] + omega_w2 * ( vel_trm_NE_SW + vel );
-            dSW[x] = omega_trm * pSW[x] + omega_w2 * ( vel_trm_NE_SW - vel );
+            dNE[x] = PdfValue_T( omega_trm * pNE[x] + omega_w2 * ( vel_trm_NE_SW + vel ) );
+            dSW[x] = PdfValue_T( omega_trm * pSW[x] + omega_w2 * ( vel_trm_NE_SW - vel ) );
          )
 
-         real_t * WALBERLA_RESTRICT dTW = &dst->get(0,y,z,Stencil::idx[TW]);
-         real_t * WALBERLA_RESTRICT dBE = &dst->get(0,y,z,Stencil::idx[BE]);
+         PdfValue_T * WALBERLA_RESTRICT dTW = &dst->get(0,y,z,Stencil::idx[TW]);
+         PdfValue_T * WALBERLA_RESTRICT dBE = &dst->get(0,y,z,Stencil::idx[BE]);
 
          X_LOOP
          (
             const real_t vel = velX[x] - velZ[x];
             const real_t vel_trm_TW_BE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dTW[x] = omega_trm * pTW[x] + omega_w2 * ( vel_trm_TW_BE - vel );
-            dBE[x] = omega_trm * pBE[x] + omega_w2 * ( vel_trm_TW_BE + vel );
+            dTW[x] = PdfValue_T( omega_trm * pTW[x] + omega_w2 * ( vel_trm_TW_BE - vel ) );
+            dBE[x] = PdfValue_T( omega_trm * pBE[x] + omega_w2 * ( vel_trm_TW_BE + vel ) );
          )
 
-         real_t * WALBERLA_RESTRICT dTE = &dst->get(0,y,z,Stencil::idx[TE]);
-         real_t * WALBERLA_RESTRICT dBW = &dst->get(0,y,z,Stencil::idx[BW]);
+         PdfValue_T * WALBERLA_RESTRICT dTE = &dst->get(0,y,z,Stencil::idx[TE]);
+         PdfValue_T * WALBERLA_RESTRICT dBW = &dst->get(0,y,z,Stencil::idx[BW]);
 
          X_LOOP
          (
             const real_t vel = velX[x] + velZ[x];
             const real_t vel_trm_TE_BW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dTE[x] = omega_trm * pTE[x] + omega_w2 * ( vel_trm_TE_BW + vel );
-            dBW[x] = omega_trm * pBW[x] + omega_w2 * ( vel_trm_TE_BW - vel );
+            dTE[x] = PdfValue_T( omega_trm * pTE[x] + omega_w2 * ( vel_trm_TE_BW + vel ) );
+            dBW[x] = PdfValue_T( omega_trm * pBW[x] + omega_w2 * ( vel_trm_TE_BW - vel ) );
          )
 
-         real_t * WALBERLA_RESTRICT dTS = &dst->get(0,y,z,Stencil::idx[TS]);
-         real_t * WALBERLA_RESTRICT dBN = &dst->get(0,y,z,Stencil::idx[BN]);
+         PdfValue_T * WALBERLA_RESTRICT dTS = &dst->get(0,y,z,Stencil::idx[TS]);
+         PdfValue_T * WALBERLA_RESTRICT dBN = &dst->get(0,y,z,Stencil::idx[BN]);
 
          X_LOOP
          (
             const real_t vel = velY[x] - velZ[x];
             const real_t vel_trm_TS_BN = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dTS[x] = omega_trm * pTS[x] + omega_w2 * ( vel_trm_TS_BN - vel );
-            dBN[x] = omega_trm * pBN[x] + omega_w2 * ( vel_trm_TS_BN + vel );
+            dTS[x] = PdfValue_T( omega_trm * pTS[x] + omega_w2 * ( vel_trm_TS_BN - vel ) );
+            dBN[x] = PdfValue_T( omega_trm * pBN[x] + omega_w2 * ( vel_trm_TS_BN + vel ) );
          )
 
-         real_t * WALBERLA_RESTRICT dTN = &dst->get(0,y,z,Stencil::idx[TN]);
-         real_t * WALBERLA_RESTRICT dBS = &dst->get(0,y,z,Stencil::idx[BS]);
+         PdfValue_T * WALBERLA_RESTRICT dTN = &dst->get(0,y,z,Stencil::idx[TN]);
+         PdfValue_T * WALBERLA_RESTRICT dBS = &dst->get(0,y,z,Stencil::idx[BS]);
 
          X_LOOP
          (
             const real_t vel = velY[x] + velZ[x];
             const real_t vel_trm_TN_BS = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dTN[x] = omega_trm * pTN[x] + omega_w2 * ( vel_trm_TN_BS + vel );
-            dBS[x] = omega_trm * pBS[x] + omega_w2 * ( vel_trm_TN_BS - vel );
+            dTN[x] = PdfValue_T( omega_trm * pTN[x] + omega_w2 * ( vel_trm_TN_BS + vel ) );
+            dBS[x] = PdfValue_T( omega_trm * pBS[x] + omega_w2 * ( vel_trm_TN_BS - vel ) );
          )
 
-         real_t * WALBERLA_RESTRICT dN = &dst->get(0,y,z,Stencil::idx[N]);
-         real_t * WALBERLA_RESTRICT dS = &dst->get(0,y,z,Stencil::idx[S]);
+         PdfValue_T * WALBERLA_RESTRICT dN = &dst->get(0,y,z,Stencil::idx[N]);
+         PdfValue_T * WALBERLA_RESTRICT dS = &dst->get(0,y,z,Stencil::idx[S]);
 
          X_LOOP
          (
             const real_t vel_trm_N_S = dir_indep_trm[x] + real_c(1.5) * velY[x] * velY[x];
 
-            dN[x] = omega_trm * pN[x] + omega_w1 * ( vel_trm_N_S + velY[x] );
-            dS[x] = omega_trm * pS[x] + omega_w1 * ( vel_trm_N_S - velY[x] );
+            dN[x] = PdfValue_T( omega_trm * pN[x] + omega_w1 * ( vel_trm_N_S + velY[x] ) );
+            dS[x] = PdfValue_T( omega_trm * pS[x] + omega_w1 * ( vel_trm_N_S - velY[x] ) );
          )
 
-         real_t * WALBERLA_RESTRICT dE = &dst->get(0,y,z,Stencil::idx[E]);
-         real_t * WALBERLA_RESTRICT dW = &dst->get(0,y,z,Stencil::idx[W]);
+         PdfValue_T * WALBERLA_RESTRICT dE = &dst->get(0,y,z,Stencil::idx[E]);
+         PdfValue_T * WALBERLA_RESTRICT dW = &dst->get(0,y,z,Stencil::idx[W]);
 
          X_LOOP
          (
             const real_t vel_trm_E_W = dir_indep_trm[x] + real_c(1.5) * velX[x] * velX[x];
 
-            dE[x] = omega_trm * pE[x] + omega_w1 * ( vel_trm_E_W + velX[x] );
-            dW[x] = omega_trm * pW[x] + omega_w1 * ( vel_trm_E_W - velX[x] );
+            dE[x] = PdfValue_T( omega_trm * pE[x] + omega_w1 * ( vel_trm_E_W + velX[x] ) );
+            dW[x] = PdfValue_T( omega_trm * pW[x] + omega_w1 * ( vel_trm_E_W - velX[x] ) );
          )
 
-         real_t * WALBERLA_RESTRICT dT = &dst->get(0,y,z,Stencil::idx[T]);
-         real_t * WALBERLA_RESTRICT dB = &dst->get(0,y,z,Stencil::idx[B]);
+         PdfValue_T * WALBERLA_RESTRICT dT = &dst->get(0,y,z,Stencil::idx[T]);
+         PdfValue_T * WALBERLA_RESTRICT dB = &dst->get(0,y,z,Stencil::idx[B]);
 
          X_LOOP
          (
             const real_t vel_trm_T_B = dir_indep_trm[x] + real_c(1.5) * velZ[x] * velZ[x];
 
-            dT[x] = omega_trm * pT[x] + omega_w1 * ( vel_trm_T_B + velZ[x] );
-            dB[x] = omega_trm * pB[x] + omega_w1 * ( vel_trm_T_B - velZ[x] );
+            dT[x] = PdfValue_T( omega_trm * pT[x] + omega_w1 * ( vel_trm_T_B + velZ[x] ) );
+            dB[x] = PdfValue_T( omega_trm * pB[x] + omega_w1 * ( vel_trm_T_B - velZ[x] ) );
          )
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -331,7 +338,7 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             dir_indep_trm[x] = one_third * rho - real_c(0.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            dst->get(x,y,z,Stencil::idx[C]) = omega_trm * dd_tmp_C + omega_w0 * dir_indep_trm[x];
+            dst->get(x,y,z,Stencil::idx[C]) = PdfValue_T( omega_trm * dd_tmp_C + omega_w0 * dir_indep_trm[x] );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -339,8 +346,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] - velY[x];
             const real_t vel_trm_NW_SE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dst->get(x,y,z,Stencil::idx[NW]) = omega_trm * src->get(x+1, y-1, z, Stencil::idx[NW]) + omega_w2 * ( vel_trm_NW_SE - vel );
-            dst->get(x,y,z,Stencil::idx[SE]) = omega_trm * src->get(x-1, y+1, z, Stencil::idx[SE]) + omega_w2 * ( vel_trm_NW_SE + vel );
+            dst->get(x,y,z,Stencil::idx[NW]) = PdfValue_T( omega_trm * src->get(x+1, y-1, z, Stencil::idx[NW]) + omega_w2 * ( vel_trm_NW_SE - vel ) );
+            dst->get(x,y,z,Stencil::idx[SE]) = PdfValue_T( omega_trm * src->get(x-1, y+1, z, Stencil::idx[SE]) + omega_w2 * ( vel_trm_NW_SE + vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -348,8 +355,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velY[x];
             const real_t vel_trm_NE_SW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dst->get(x,y,z,Stencil::idx[NE]) = omega_trm * src->get(x-1, y-1, z, Stencil::idx[NE]) + omega_w2 * ( vel_trm_NE_SW + vel );
-            dst->get(x,y,z,Stencil::idx[SW]) = omega_trm * src->get(x+1, y+1, z, Stencil::idx[SW]) + omega_w2 * ( vel_trm_NE_SW - vel );
+            dst->get(x,y,z,Stencil::idx[NE]) = PdfValue_T( omega_trm * src->get(x-1, y-1, z, Stencil::idx[NE]) + omega_w2 * ( vel_trm_NE_SW + vel ) );
+            dst->get(x,y,z,Stencil::idx[SW]) = PdfValue_T( omega_trm * src->get(x+1, y+1, z, Stencil::idx[SW]) + omega_w2 * ( vel_trm_NE_SW - vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -357,8 +364,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] - velZ[x];
             const real_t vel_trm_TW_BE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dst->get(x,y,z,Stencil::idx[TW]) = omega_trm * src->get(x+1, y, z-1, Stencil::idx[TW]) + omega_w2 * ( vel_trm_TW_BE - vel );
-            dst->get(x,y,z,Stencil::idx[BE]) = omega_trm * src->get(x-1, y, z+1, Stencil::idx[BE]) + omega_w2 * ( vel_trm_TW_BE + vel );
+            dst->get(x,y,z,Stencil::idx[TW]) = PdfValue_T( omega_trm * src->get(x+1, y, z-1, Stencil::idx[TW]) + omega_w2 * ( vel_trm_TW_BE - vel ) );
+            dst->get(x,y,z,Stencil::idx[BE]) = PdfValue_T( omega_trm * src->get(x-1, y, z+1, Stencil::idx[BE]) + omega_w2 * ( vel_trm_TW_BE + vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -366,8 +373,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velZ[x];
             const real_t vel_trm_TE_BW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dst->get(x,y,z,Stencil::idx[TE]) = omega_trm * src->get(x-1, y, z-1, Stencil::idx[TE]) + omega_w2 * ( vel_trm_TE_BW + vel );
-            dst->get(x,y,z,Stencil::idx[BW]) = omega_trm * src->get(x+1, y, z+1, Stencil::idx[BW]) + omega_w2 * ( vel_trm_TE_BW - vel );
+            dst->get(x,y,z,Stencil::idx[TE]) = PdfValue_T( omega_trm * src->get(x-1, y, z-1, Stencil::idx[TE]) + omega_w2 * ( vel_trm_TE_BW + vel ) );
+            dst->get(x,y,z,Stencil::idx[BW]) = PdfValue_T( omega_trm * src->get(x+1, y, z+1, Stencil::idx[BW]) + omega_w2 * ( vel_trm_TE_BW - vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -375,8 +382,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velY[x] - velZ[x];
             const real_t vel_trm_TS_BN = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dst->get(x,y,z,Stencil::idx[TS]) = omega_trm * src->get(x, y+1, z-1, Stencil::idx[TS]) + omega_w2 * ( vel_trm_TS_BN - vel );
-            dst->get(x,y,z,Stencil::idx[BN]) = omega_trm * src->get(x, y-1, z+1, Stencil::idx[BN]) + omega_w2 * ( vel_trm_TS_BN + vel );
+            dst->get(x,y,z,Stencil::idx[TS]) = PdfValue_T( omega_trm * src->get(x, y+1, z-1, Stencil::idx[TS]) + omega_w2 * ( vel_trm_TS_BN - vel ) );
+            dst->get(x,y,z,Stencil::idx[BN]) = PdfValue_T( omega_trm * src->get(x, y-1, z+1, Stencil::idx[BN]) + omega_w2 * ( vel_trm_TS_BN + vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -384,32 +391,32 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velY[x] + velZ[x];
             const real_t vel_trm_TN_BS = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dst->get(x,y,z,Stencil::idx[TN]) = omega_trm * src->get(x, y-1, z-1, Stencil::idx[TN]) + omega_w2 * ( vel_trm_TN_BS + vel );
-            dst->get(x,y,z,Stencil::idx[BS]) = omega_trm * src->get(x, y+1, z+1, Stencil::idx[BS]) + omega_w2 * ( vel_trm_TN_BS - vel );
+            dst->get(x,y,z,Stencil::idx[TN]) = PdfValue_T( omega_trm * src->get(x, y-1, z-1, Stencil::idx[TN]) + omega_w2 * ( vel_trm_TN_BS + vel ) );
+            dst->get(x,y,z,Stencil::idx[BS]) = PdfValue_T( omega_trm * src->get(x, y+1, z+1, Stencil::idx[BS]) + omega_w2 * ( vel_trm_TN_BS - vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             const real_t vel_trm_N_S = dir_indep_trm[x] + real_c(1.5) * velY[x] * velY[x];
 
-            dst->get(x,y,z,Stencil::idx[N]) = omega_trm * src->get(x, y-1, z, Stencil::idx[N]) + omega_w1 * ( vel_trm_N_S + velY[x] );
-            dst->get(x,y,z,Stencil::idx[S]) = omega_trm * src->get(x, y+1, z, Stencil::idx[S]) + omega_w1 * ( vel_trm_N_S - velY[x] );
+            dst->get(x,y,z,Stencil::idx[N]) = PdfValue_T( omega_trm * src->get(x, y-1, z, Stencil::idx[N]) + omega_w1 * ( vel_trm_N_S + velY[x] ) );
+            dst->get(x,y,z,Stencil::idx[S]) = PdfValue_T( omega_trm * src->get(x, y+1, z, Stencil::idx[S]) + omega_w1 * ( vel_trm_N_S - velY[x] ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             const real_t vel_trm_E_W = dir_indep_trm[x] + real_c(1.5) * velX[x] * velX[x];
 
-            dst->get(x,y,z,Stencil::idx[E]) = omega_trm * src->get(x-1, y, z, Stencil::idx[E]) + omega_w1 * ( vel_trm_E_W + velX[x] );
-            dst->get(x,y,z,Stencil::idx[W]) = omega_trm * src->get(x+1, y, z, Stencil::idx[W]) + omega_w1 * ( vel_trm_E_W - velX[x] );
+            dst->get(x,y,z,Stencil::idx[E]) = PdfValue_T( omega_trm * src->get(x-1, y, z, Stencil::idx[E]) + omega_w1 * ( vel_trm_E_W + velX[x] ) );
+            dst->get(x,y,z,Stencil::idx[W]) = PdfValue_T( omega_trm * src->get(x+1, y, z, Stencil::idx[W]) + omega_w1 * ( vel_trm_E_W - velX[x] ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             const real_t vel_trm_T_B = dir_indep_trm[x] + real_c(1.5) * velZ[x] * velZ[x];
 
-            dst->get(x,y,z,Stencil::idx[T]) = omega_trm * src->get(x, y, z-1, Stencil::idx[T]) + omega_w1 * ( vel_trm_T_B + velZ[x] );
-            dst->get(x,y,z,Stencil::idx[B]) = omega_trm * src->get(x, y, z+1, Stencil::idx[B]) + omega_w1 * ( vel_trm_T_B - velZ[x] );
+            dst->get(x,y,z,Stencil::idx[T]) = PdfValue_T( omega_trm * src->get(x, y, z-1, Stencil::idx[T]) + omega_w1 * ( vel_trm_T_B + velZ[x] ) );
+            dst->get(x,y,z,Stencil::idx[B]) = PdfValue_T( omega_trm * src->get(x, y, z+1, Stencil::idx[B]) + omega_w1 * ( vel_trm_T_B - velZ[x] ) );
          }
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -501,33 +508,33 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
          using namespace stencil;
 
-         real_t * WALBERLA_RESTRICT pC  = &src->get( 0, y, z, Stencil::idx[C]);
-         real_t * WALBERLA_RESTRICT pN  = &src->get( 0, y, z, Stencil::idx[N]);
-         real_t * WALBERLA_RESTRICT pS  = &src->get( 0, y, z, Stencil::idx[S]);
-         real_t * WALBERLA_RESTRICT pW  = &src->get( 0, y, z, Stencil::idx[W]);
-         real_t * WALBERLA_RESTRICT pE  = &src->get( 0, y, z, Stencil::idx[E]);
-         real_t * WALBERLA_RESTRICT pT  = &src->get( 0, y, z, Stencil::idx[T]);
-         real_t * WALBERLA_RESTRICT pB  = &src->get( 0, y, z, Stencil::idx[B]);
-         real_t * WALBERLA_RESTRICT pNW = &src->get( 0, y, z, Stencil::idx[NW]);
-         real_t * WALBERLA_RESTRICT pNE = &src->get( 0, y, z, Stencil::idx[NE]);
-         real_t * WALBERLA_RESTRICT pSW = &src->get( 0, y, z, Stencil::idx[SW]);
-         real_t * WALBERLA_RESTRICT pSE = &src->get( 0, y, z, Stencil::idx[SE]);
-         real_t * WALBERLA_RESTRICT pTN = &src->get( 0, y, z, Stencil::idx[TN]);
-         real_t * WALBERLA_RESTRICT pTS = &src->get( 0, y, z, Stencil::idx[TS]);
-         real_t * WALBERLA_RESTRICT pTW = &src->get( 0, y, z, Stencil::idx[TW]);
-         real_t * WALBERLA_RESTRICT pTE = &src->get( 0, y, z, Stencil::idx[TE]);
-         real_t * WALBERLA_RESTRICT pBN = &src->get( 0, y, z, Stencil::idx[BN]);
-         real_t * WALBERLA_RESTRICT pBS = &src->get( 0, y, z, Stencil::idx[BS]);
-         real_t * WALBERLA_RESTRICT pBW = &src->get( 0, y, z, Stencil::idx[BW]);
-         real_t * WALBERLA_RESTRICT pBE = &src->get( 0, y, z, Stencil::idx[BE]);
+         PdfValue_T * WALBERLA_RESTRICT pC  = &src->get( 0, y, z, Stencil::idx[C]);
+         PdfValue_T * WALBERLA_RESTRICT pN  = &src->get( 0, y, z, Stencil::idx[N]);
+         PdfValue_T * WALBERLA_RESTRICT pS  = &src->get( 0, y, z, Stencil::idx[S]);
+         PdfValue_T * WALBERLA_RESTRICT pW  = &src->get( 0, y, z, Stencil::idx[W]);
+         PdfValue_T * WALBERLA_RESTRICT pE  = &src->get( 0, y, z, Stencil::idx[E]);
+         PdfValue_T * WALBERLA_RESTRICT pT  = &src->get( 0, y, z, Stencil::idx[T]);
+         PdfValue_T * WALBERLA_RESTRICT pB  = &src->get( 0, y, z, Stencil::idx[B]);
+         PdfValue_T * WALBERLA_RESTRICT pNW = &src->get( 0, y, z, Stencil::idx[NW]);
+         PdfValue_T * WALBERLA_RESTRICT pNE = &src->get( 0, y, z, Stencil::idx[NE]);
+         PdfValue_T * WALBERLA_RESTRICT pSW = &src->get( 0, y, z, Stencil::idx[SW]);
+         PdfValue_T * WALBERLA_RESTRICT pSE = &src->get( 0, y, z, Stencil::idx[SE]);
+         PdfValue_T * WALBERLA_RESTRICT pTN = &src->get( 0, y, z, Stencil::idx[TN]);
+         PdfValue_T * WALBERLA_RESTRICT pTS = &src->get( 0, y, z, Stencil::idx[TS]);
+         PdfValue_T * WALBERLA_RESTRICT pTW = &src->get( 0, y, z, Stencil::idx[TW]);
+         PdfValue_T * WALBERLA_RESTRICT pTE = &src->get( 0, y, z, Stencil::idx[TE]);
+         PdfValue_T * WALBERLA_RESTRICT pBN = &src->get( 0, y, z, Stencil::idx[BN]);
+         PdfValue_T * WALBERLA_RESTRICT pBS = &src->get( 0, y, z, Stencil::idx[BS]);
+         PdfValue_T * WALBERLA_RESTRICT pBW = &src->get( 0, y, z, Stencil::idx[BW]);
+         PdfValue_T * WALBERLA_RESTRICT pBE = &src->get( 0, y, z, Stencil::idx[BE]);
 
          X_LOOP
          (
-            const real_t velX_trm = pE[x] + pNE[x] + pSE[x] + pTE[x] + pBE[x];
-            const real_t velY_trm = pN[x] + pNW[x] + pTN[x] + pBN[x];
-            const real_t velZ_trm = pT[x] + pTS[x] + pTW[x];
+            const real_t velX_trm = real_t( pE[x] ) + pNE[x] + pSE[x] + pTE[x] + pBE[x];
+            const real_t velY_trm = real_t( pN[x] ) + pNW[x] + pTN[x] + pBN[x];
+            const real_t velZ_trm = real_t( pT[x] ) + pTS[x] + pTW[x];
 
-            const real_t rho = pC[x] + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
+            const real_t rho = real_t( pC[x] ) + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
 
             velX[x] = velX_trm - pW[x]  - pNW[x] - pSW[x] - pTW[x] - pBW[x];
             velY[x] = velY_trm + pNE[x] - pS[x]  - pSW[x] - pSE[x] - pTS[x] - pBS[x];
@@ -535,7 +542,7 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             dir_indep_trm[x] = one_third * rho - real_c(0.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            pC[x] = omega_trm * pC[x] + omega_w0 * dir_indep_trm[x];
+            pC[x] = PdfValue_T( omega_trm * pC[x] + omega_w0 * dir_indep_trm[x] );
          )
 
          X_LOOP
@@ -543,8 +550,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] - velY[x];
             const real_t vel_trm_NW_SE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            pNW[x] = omega_trm * pNW[x] + omega_w2 * ( vel_trm_NW_SE - vel );
-            pSE[x] = omega_trm * pSE[x] + omega_w2 * ( vel_trm_NW_SE + vel );
+            pNW[x] = PdfValue_T( omega_trm * pNW[x] + omega_w2 * ( vel_trm_NW_SE - vel ) );
+            pSE[x] = PdfValue_T( omega_trm * pSE[x] + omega_w2 * ( vel_trm_NW_SE + vel ) );
          )
 
          X_LOOP
@@ -552,8 +559,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velY[x];
             const real_t vel_trm_NE_SW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            pNE[x] = omega_trm * pNE[x] + omega_w2 * ( vel_trm_NE_SW + vel );
-            pSW[x] = omega_trm * pSW[x] + omega_w2 * ( vel_trm_NE_SW - vel );
+            pNE[x] = PdfValue_T( omega_trm * pNE[x] + omega_w2 * ( vel_trm_NE_SW + vel ) );
+            pSW[x] = PdfValue_T( omega_trm * pSW[x] + omega_w2 * ( vel_trm_NE_SW - vel ) );
          )
 
          X_LOOP
@@ -561,8 +568,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] - velZ[x];
             const real_t vel_trm_TW_BE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            pTW[x] = omega_trm * pTW[x] + omega_w2 * ( vel_trm_TW_BE - vel );
-            pBE[x] = omega_trm * pBE[x] + omega_w2 * ( vel_trm_TW_BE + vel );
+            pTW[x] = PdfValue_T( omega_trm * pTW[x] + omega_w2 * ( vel_trm_TW_BE - vel ) );
+            pBE[x] = PdfValue_T( omega_trm * pBE[x] + omega_w2 * ( vel_trm_TW_BE + vel ) );
          )
 
          X_LOOP
@@ -570,8 +577,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velZ[x];
             const real_t vel_trm_TE_BW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            pTE[x] = omega_trm * pTE[x] + omega_w2 * ( vel_trm_TE_BW + vel );
-            pBW[x] = omega_trm * pBW[x] + omega_w2 * ( vel_trm_TE_BW - vel );
+            pTE[x] = PdfValue_T( omega_trm * pTE[x] + omega_w2 * ( vel_trm_TE_BW + vel ) );
+            pBW[x] = PdfValue_T( omega_trm * pBW[x] + omega_w2 * ( vel_trm_TE_BW - vel ) );
          )
 
          X_LOOP
@@ -579,8 +586,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velY[x] - velZ[x];
             const real_t vel_trm_TS_BN = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            pTS[x] = omega_trm * pTS[x] + omega_w2 * ( vel_trm_TS_BN - vel );
-            pBN[x] = omega_trm * pBN[x] + omega_w2 * ( vel_trm_TS_BN + vel );
+            pTS[x] = PdfValue_T( omega_trm * pTS[x] + omega_w2 * ( vel_trm_TS_BN - vel ) );
+            pBN[x] = PdfValue_T( omega_trm * pBN[x] + omega_w2 * ( vel_trm_TS_BN + vel ) );
          )
 
          X_LOOP
@@ -588,32 +595,32 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velY[x] + velZ[x];
             const real_t vel_trm_TN_BS = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            pTN[x] = omega_trm * pTN[x] + omega_w2 * ( vel_trm_TN_BS + vel );
-            pBS[x] = omega_trm * pBS[x] + omega_w2 * ( vel_trm_TN_BS - vel );
+            pTN[x] = PdfValue_T( omega_trm * pTN[x] + omega_w2 * ( vel_trm_TN_BS + vel ) );
+            pBS[x] = PdfValue_T( omega_trm * pBS[x] + omega_w2 * ( vel_trm_TN_BS - vel ) );
          )
 
          X_LOOP
          (
             const real_t vel_trm_N_S = dir_indep_trm[x] + real_c(1.5) * velY[x] * velY[x];
 
-            pN[x] = omega_trm * pN[x] + omega_w1 * ( vel_trm_N_S + velY[x] );
-            pS[x] = omega_trm * pS[x] + omega_w1 * ( vel_trm_N_S - velY[x] );
+            pN[x] = PdfValue_T( omega_trm * pN[x] + omega_w1 * ( vel_trm_N_S + velY[x] ) );
+            pS[x] = PdfValue_T( omega_trm * pS[x] + omega_w1 * ( vel_trm_N_S - velY[x] ) );
          )
 
          X_LOOP
          (
             const real_t vel_trm_E_W = dir_indep_trm[x] + real_c(1.5) * velX[x] * velX[x];
 
-            pE[x] = omega_trm * pE[x] + omega_w1 * ( vel_trm_E_W + velX[x] );
-            pW[x] = omega_trm * pW[x] + omega_w1 * ( vel_trm_E_W - velX[x] );
+            pE[x] = PdfValue_T( omega_trm * pE[x] + omega_w1 * ( vel_trm_E_W + velX[x] ) );
+            pW[x] = PdfValue_T( omega_trm * pW[x] + omega_w1 * ( vel_trm_E_W - velX[x] ) );
          )
 
          X_LOOP
          (
             const real_t vel_trm_T_B = dir_indep_trm[x] + real_c(1.5) * velZ[x] * velZ[x];
 
-            pT[x] = omega_trm * pT[x] + omega_w1 * ( vel_trm_T_B + velZ[x] );
-            pB[x] = omega_trm * pB[x] + omega_w1 * ( vel_trm_T_B - velZ[x] );
+            pT[x] = PdfValue_T( omega_trm * pT[x] + omega_w1 * ( vel_trm_T_B + velZ[x] ) );
+            pB[x] = PdfValue_T( omega_trm * pB[x] + omega_w1 * ( vel_trm_T_B - velZ[x] ) );
          )
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -658,7 +665,7 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             dir_indep_trm[x] = one_third * rho - real_c(0.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            src->get(x,y,z,Stencil::idx[C]) = omega_trm * dd_tmp_C + omega_w0 * dir_indep_trm[x];
+            src->get(x,y,z,Stencil::idx[C]) = PdfValue_T( omega_trm * dd_tmp_C + omega_w0 * dir_indep_trm[x] );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -666,8 +673,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] - velY[x];
             const real_t vel_trm_NW_SE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            src->get(x,y,z,Stencil::idx[NW]) = omega_trm * src->get(x,y,z,Stencil::idx[NW]) + omega_w2 * ( vel_trm_NW_SE - vel );
-            src->get(x,y,z,Stencil::idx[SE]) = omega_trm * src->get(x,y,z,Stencil::idx[SE]) + omega_w2 * ( vel_trm_NW_SE + vel );
+            src->get(x,y,z,Stencil::idx[NW]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[NW]) + omega_w2 * ( vel_trm_NW_SE - vel ) );
+            src->get(x,y,z,Stencil::idx[SE]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[SE]) + omega_w2 * ( vel_trm_NW_SE + vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -675,8 +682,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velY[x];
             const real_t vel_trm_NE_SW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            src->get(x,y,z,Stencil::idx[NE]) = omega_trm * src->get(x,y,z,Stencil::idx[NE]) + omega_w2 * ( vel_trm_NE_SW + vel );
-            src->get(x,y,z,Stencil::idx[SW]) = omega_trm * src->get(x,y,z,Stencil::idx[SW]) + omega_w2 * ( vel_trm_NE_SW - vel );
+            src->get(x,y,z,Stencil::idx[NE]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[NE]) + omega_w2 * ( vel_trm_NE_SW + vel ) );
+            src->get(x,y,z,Stencil::idx[SW]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[SW]) + omega_w2 * ( vel_trm_NE_SW - vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -684,8 +691,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] - velZ[x];
             const real_t vel_trm_TW_BE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            src->get(x,y,z,Stencil::idx[TW]) = omega_trm * src->get(x,y,z,Stencil::idx[TW]) + omega_w2 * ( vel_trm_TW_BE - vel );
-            src->get(x,y,z,Stencil::idx[BE]) = omega_trm * src->get(x,y,z,Stencil::idx[BE]) + omega_w2 * ( vel_trm_TW_BE + vel );
+            src->get(x,y,z,Stencil::idx[TW]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[TW]) + omega_w2 * ( vel_trm_TW_BE - vel ) );
+            src->get(x,y,z,Stencil::idx[BE]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[BE]) + omega_w2 * ( vel_trm_TW_BE + vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -693,8 +700,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velZ[x];
             const real_t vel_trm_TE_BW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            src->get(x,y,z,Stencil::idx[TE]) = omega_trm * src->get(x,y,z,Stencil::idx[TE]) + omega_w2 * ( vel_trm_TE_BW + vel );
-            src->get(x,y,z,Stencil::idx[BW]) = omega_trm * src->get(x,y,z,Stencil::idx[BW]) + omega_w2 * ( vel_trm_TE_BW - vel );
+            src->get(x,y,z,Stencil::idx[TE]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[TE]) + omega_w2 * ( vel_trm_TE_BW + vel ) );
+            src->get(x,y,z,Stencil::idx[BW]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[BW]) + omega_w2 * ( vel_trm_TE_BW - vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -702,8 +709,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velY[x] - velZ[x];
             const real_t vel_trm_TS_BN = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            src->get(x,y,z,Stencil::idx[TS]) = omega_trm * src->get(x,y,z,Stencil::idx[TS]) + omega_w2 * ( vel_trm_TS_BN - vel );
-            src->get(x,y,z,Stencil::idx[BN]) = omega_trm * src->get(x,y,z,Stencil::idx[BN]) + omega_w2 * ( vel_trm_TS_BN + vel );
+            src->get(x,y,z,Stencil::idx[TS]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[TS]) + omega_w2 * ( vel_trm_TS_BN - vel ) );
+            src->get(x,y,z,Stencil::idx[BN]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[BN]) + omega_w2 * ( vel_trm_TS_BN + vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -711,32 +718,32 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velY[x] + velZ[x];
             const real_t vel_trm_TN_BS = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            src->get(x,y,z,Stencil::idx[TN]) = omega_trm * src->get(x,y,z,Stencil::idx[TN]) + omega_w2 * ( vel_trm_TN_BS + vel );
-            src->get(x,y,z,Stencil::idx[BS]) = omega_trm * src->get(x,y,z,Stencil::idx[BS]) + omega_w2 * ( vel_trm_TN_BS - vel );
+            src->get(x,y,z,Stencil::idx[TN]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[TN]) + omega_w2 * ( vel_trm_TN_BS + vel ) );
+            src->get(x,y,z,Stencil::idx[BS]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[BS]) + omega_w2 * ( vel_trm_TN_BS - vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             const real_t vel_trm_N_S = dir_indep_trm[x] + real_c(1.5) * velY[x] * velY[x];
 
-            src->get(x,y,z,Stencil::idx[N]) = omega_trm * src->get(x,y,z,Stencil::idx[N]) + omega_w1 * ( vel_trm_N_S + velY[x] );
-            src->get(x,y,z,Stencil::idx[S]) = omega_trm * src->get(x,y,z,Stencil::idx[S]) + omega_w1 * ( vel_trm_N_S - velY[x] );
+            src->get(x,y,z,Stencil::idx[N]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[N]) + omega_w1 * ( vel_trm_N_S + velY[x] ) );
+            src->get(x,y,z,Stencil::idx[S]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[S]) + omega_w1 * ( vel_trm_N_S - velY[x] ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             const real_t vel_trm_E_W = dir_indep_trm[x] + real_c(1.5) * velX[x] * velX[x];
 
-            src->get(x,y,z,Stencil::idx[E]) = omega_trm * src->get(x,y,z,Stencil::idx[E]) + omega_w1 * ( vel_trm_E_W + velX[x] );
-            src->get(x,y,z,Stencil::idx[W]) = omega_trm * src->get(x,y,z,Stencil::idx[W]) + omega_w1 * ( vel_trm_E_W - velX[x] );
+            src->get(x,y,z,Stencil::idx[E]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[E]) + omega_w1 * ( vel_trm_E_W + velX[x] ) );
+            src->get(x,y,z,Stencil::idx[W]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[W]) + omega_w1 * ( vel_trm_E_W - velX[x] ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             const real_t vel_trm_T_B = dir_indep_trm[x] + real_c(1.5) * velZ[x] * velZ[x];
 
-            src->get(x,y,z,Stencil::idx[T]) = omega_trm * src->get(x,y,z,Stencil::idx[T]) + omega_w1 * ( vel_trm_T_B + velZ[x] );
-            src->get(x,y,z,Stencil::idx[B]) = omega_trm * src->get(x,y,z,Stencil::idx[B]) + omega_w1 * ( vel_trm_T_B - velZ[x] );
+            src->get(x,y,z,Stencil::idx[T]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[T]) + omega_w1 * ( vel_trm_T_B + velZ[x] ) );
+            src->get(x,y,z,Stencil::idx[B]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[B]) + omega_w1 * ( vel_trm_T_B - velZ[x] ) );
          }
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -781,6 +788,7 @@ public:
 
    typedef typename SweepBase<LatticeModel_T>::PdfField_T  PdfField_T;
    typedef typename LatticeModel_T::Stencil                Stencil;
+   typedef typename PdfField_T::value_type                 PdfValue_T;
 
    // block has NO dst pdf field
    SplitPureSweep( const BlockDataID & pdfField ) :
@@ -847,35 +855,35 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
          using namespace stencil;
 
-         real_t * WALBERLA_RESTRICT pNE = &src->get(-1, y-1, z  , Stencil::idx[NE]);
-         real_t * WALBERLA_RESTRICT pN  = &src->get(0 , y-1, z  , Stencil::idx[N]);
-         real_t * WALBERLA_RESTRICT pNW = &src->get(+1, y-1, z  , Stencil::idx[NW]);
-         real_t * WALBERLA_RESTRICT pW  = &src->get(+1, y  , z  , Stencil::idx[W]);
-         real_t * WALBERLA_RESTRICT pSW = &src->get(+1, y+1, z  , Stencil::idx[SW]);
-         real_t * WALBERLA_RESTRICT pS  = &src->get(0 , y+1, z  , Stencil::idx[S]);
-         real_t * WALBERLA_RESTRICT pSE = &src->get(-1, y+1, z  , Stencil::idx[SE]);
-         real_t * WALBERLA_RESTRICT pE  = &src->get(-1, y  , z  , Stencil::idx[E]);
-         real_t * WALBERLA_RESTRICT pT  = &src->get(0 , y  , z-1, Stencil::idx[T]);
-         real_t * WALBERLA_RESTRICT pTE = &src->get(-1, y  , z-1, Stencil::idx[TE]);
-         real_t * WALBERLA_RESTRICT pTN = &src->get(0 , y-1, z-1, Stencil::idx[TN]);
-         real_t * WALBERLA_RESTRICT pTW = &src->get(+1, y  , z-1, Stencil::idx[TW]);
-         real_t * WALBERLA_RESTRICT pTS = &src->get(0 , y+1, z-1, Stencil::idx[TS]);
-         real_t * WALBERLA_RESTRICT pB  = &src->get(0 , y  , z+1, Stencil::idx[B]);
-         real_t * WALBERLA_RESTRICT pBE = &src->get(-1, y  , z+1, Stencil::idx[BE]);
-         real_t * WALBERLA_RESTRICT pBN = &src->get(0 , y-1, z+1, Stencil::idx[BN]);
-         real_t * WALBERLA_RESTRICT pBW = &src->get(+1, y  , z+1, Stencil::idx[BW]);
-         real_t * WALBERLA_RESTRICT pBS = &src->get(0 , y+1, z+1, Stencil::idx[BS]);
-         real_t * WALBERLA_RESTRICT pC  = &src->get(0 , y  , z  , Stencil::idx[C]);
-
-         real_t * WALBERLA_RESTRICT dC = &dst->get(0,y,z,Stencil::idx[C]);
+         PdfValue_T * WALBERLA_RESTRICT pNE = &src->get(-1, y-1, z  , Stencil::idx[NE]);
+         PdfValue_T * WALBERLA_RESTRICT pN  = &src->get(0 , y-1, z  , Stencil::idx[N]);
+         PdfValue_T * WALBERLA_RESTRICT pNW = &src->get(+1, y-1, z  , Stencil::idx[NW]);
+         PdfValue_T * WALBERLA_RESTRICT pW  = &src->get(+1, y  , z  , Stencil::idx[W]);
+         PdfValue_T * WALBERLA_RESTRICT pSW = &src->get(+1, y+1, z  , Stencil::idx[SW]);
+         PdfValue_T * WALBERLA_RESTRICT pS  = &src->get(0 , y+1, z  , Stencil::idx[S]);
+         PdfValue_T * WALBERLA_RESTRICT pSE = &src->get(-1, y+1, z  , Stencil::idx[SE]);
+         PdfValue_T * WALBERLA_RESTRICT pE  = &src->get(-1, y  , z  , Stencil::idx[E]);
+         PdfValue_T * WALBERLA_RESTRICT pT  = &src->get(0 , y  , z-1, Stencil::idx[T]);
+         PdfValue_T * WALBERLA_RESTRICT pTE = &src->get(-1, y  , z-1, Stencil::idx[TE]);
+         PdfValue_T * WALBERLA_RESTRICT pTN = &src->get(0 , y-1, z-1, Stencil::idx[TN]);
+         PdfValue_T * WALBERLA_RESTRICT pTW = &src->get(+1, y  , z-1, Stencil::idx[TW]);
+         PdfValue_T * WALBERLA_RESTRICT pTS = &src->get(0 , y+1, z-1, Stencil::idx[TS]);
+         PdfValue_T * WALBERLA_RESTRICT pB  = &src->get(0 , y  , z+1, Stencil::idx[B]);
+         PdfValue_T * WALBERLA_RESTRICT pBE = &src->get(-1, y  , z+1, Stencil::idx[BE]);
+         PdfValue_T * WALBERLA_RESTRICT pBN = &src->get(0 , y-1, z+1, Stencil::idx[BN]);
+         PdfValue_T * WALBERLA_RESTRICT pBW = &src->get(+1, y  , z+1, Stencil::idx[BW]);
+         PdfValue_T * WALBERLA_RESTRICT pBS = &src->get(0 , y+1, z+1, Stencil::idx[BS]);
+         PdfValue_T * WALBERLA_RESTRICT pC  = &src->get(0 , y  , z  , Stencil::idx[C]);
+
+         PdfValue_T * WALBERLA_RESTRICT dC = &dst->get(0,y,z,Stencil::idx[C]);
 
          X_LOOP
          (
-              const real_t velX_trm = pE[x] + pNE[x] + pSE[x] + pTE[x] + pBE[x];
-              const real_t velY_trm = pN[x] + pNW[x] + pTN[x] + pBN[x];
-              const real_t velZ_trm = pT[x] + pTS[x] + pTW[x];
+              const real_t velX_trm = real_t( pE[x] ) + pNE[x] + pSE[x] + pTE[x] + pBE[x];
+              const real_t velY_trm = real_t( pN[x] ) + pNW[x] + pTN[x] + pBN[x];
+              const real_t velZ_trm = real_t( pT[x] ) + pTS[x] + pTW[x];
 
-              rho[x] = pC[x] + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
+              rho[x] = real_t( pC[x] ) + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
               const real_t rho_inv = real_t(1) / rho[x];
 
               velX[x] = rho_inv * ( velX_trm - pW[x]  - pNW[x] - pSW[x] - pTW[x] - pBW[x] );
@@ -884,47 +892,47 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
               dir_indep_trm[x] = one_third - real_c(0.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-              dC[x] = omega_trm * pC[x] + omega_w0 * rho[x] * dir_indep_trm[x];
+              dC[x] = PdfValue_T( omega_trm * pC[x] + omega_w0 * rho[x] * dir_indep_trm[x] );
          )
 
-         real_t * WALBERLA_RESTRICT dNW = &dst->get(0,y,z,Stencil::idx[NW]);
-         real_t * WALBERLA_RESTRICT dSE = &dst->get(0,y,z,Stencil::idx[SE]);
+         PdfValue_T * WALBERLA_RESTRICT dNW = &dst->get(0,y,z,Stencil::idx[NW]);
+         PdfValue_T * WALBERLA_RESTRICT dSE = &dst->get(0,y,z,Stencil::idx[SE]);
 
          X_LOOP
          (
             const real_t vel = velX[x] - velY[x];
             const real_t vel_trm_NW_SE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dNW[x] = omega_trm * pNW[x] + omega_w2 * rho[x] * ( vel_trm_NW_SE - vel );
-            dSE[x] = omega_trm * pSE[x] + omega_w2 * rho[x] * ( vel_trm_NW_SE + vel );
+            dNW[x] = PdfValue_T( omega_trm * pNW[x] + omega_w2 * rho[x] * ( vel_trm_NW_SE - vel ) );
+            dSE[x] = PdfValue_T( omega_trm * pSE[x] + omega_w2 * rho[x] * ( vel_trm_NW_SE + vel ) );
          )
 
-         real_t * WALBERLA_RESTRICT dNE = &dst->get(0,y,z,Stencil::idx[NE]);
-         real_t * WALBERLA_RESTRICT dSW = &dst->get(0,y,z,Stencil::idx[SW]);
+         PdfValue_T * WALBERLA_RESTRICT dNE = &dst->get(0,y,z,Stencil::idx[NE]);
+         PdfValue_T * WALBERLA_RESTRICT dSW = &dst->get(0,y,z,Stencil::idx[SW]);
 
          X_LOOP
          (
             const real_t vel = velX[x] + velY[x];
             const real_t vel_trm_NE_SW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dNE[x] = omega_trm * pNE[x] + omega_w2 * rho[x] * ( vel_trm_NE_SW + vel );
-            dSW[x] = omega_trm * pSW[x] + omega_w2 * rho[x] * ( vel_trm_NE_SW - vel );
+            dNE[x] = PdfValue_T( omega_trm * pNE[x] + omega_w2 * rho[x] * ( vel_trm_NE_SW + vel ) );
+            dSW[x] = PdfValue_T( omega_trm * pSW[x] + omega_w2 * rho[x] * ( vel_trm_NE_SW - vel ) );
          )
 
-         real_t * WALBERLA_RESTRICT dTW = &dst->get(0,y,z,Stencil::idx[TW]);
-         real_t * WALBERLA_RESTRICT dBE = &dst->get(0,y,z,Stencil::idx[BE]);
+         PdfValue_T * WALBERLA_RESTRICT dTW = &dst->get(0,y,z,Stencil::idx[TW]);
+         PdfValue_T * WALBERLA_RESTRICT dBE = &dst->get(0,y,z,Stencil::idx[BE]);
 
          X_LOOP
          (
             const real_t vel = velX[x] - velZ[x];
             const real_t vel_trm_TW_BE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dTW[x] = omega_trm * pTW[x] + omega_w2 * rho[x] * ( vel_trm_TW_BE - vel );
-            dBE[x] = omega_trm * pBE[x] + omega_w2 * rho[x] * ( vel_trm_TW_BE + vel );
+            dTW[x] = PdfValue_T( omega_trm * pTW[x] + omega_w2 * rho[x] * ( vel_trm_TW_BE - vel ) );
+            dBE[x] = PdfValue_T( omega_trm * pBE[x] + omega_w2 * rho[x] * ( vel_trm_TW_BE + vel ) );
          )
 
-         real_t * WALBERLA_RESTRICT dTE = &dst->get(0,y,z,Stencil::idx[TE]);
-         real_t * WALBERLA_RESTRICT dBW = &dst->get(0,y,z,Stencil::idx[BW]);
+         PdfValue_T * WALBERLA_RESTRICT dTE = &dst->get(0,y,z,Stencil::idx[TE]);
+         PdfValue_T * WALBERLA_RESTRICT dBW = &dst->get(0,y,z,Stencil::idx[BW]);
 
 
          X_LOOP
@@ -932,65 +940,65 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velZ[x];
             const real_t vel_trm_TE_BW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dTE[x] = omega_trm * pTE[x] + omega_w2 * rho[x] * ( vel_trm_TE_BW + vel );
-            dBW[x] = omega_trm * pBW[x] + omega_w2 * rho[x] * ( vel_trm_TE_BW - vel );
+            dTE[x] = PdfValue_T( omega_trm * pTE[x] + omega_w2 * rho[x] * ( vel_trm_TE_BW + vel ) );
+            dBW[x] = PdfValue_T( omega_trm * pBW[x] + omega_w2 * rho[x] * ( vel_trm_TE_BW - vel ) );
          )
 
-         real_t * WALBERLA_RESTRICT dTS = &dst->get(0,y,z,Stencil::idx[TS]);
-         real_t * WALBERLA_RESTRICT dBN = &dst->get(0,y,z,Stencil::idx[BN]);
+         PdfValue_T * WALBERLA_RESTRICT dTS = &dst->get(0,y,z,Stencil::idx[TS]);
+         PdfValue_T * WALBERLA_RESTRICT dBN = &dst->get(0,y,z,Stencil::idx[BN]);
 
          X_LOOP
          (
             const real_t vel = velY[x] - velZ[x];
             const real_t vel_trm_TS_BN = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dTS[x] = omega_trm * pTS[x] + omega_w2 * rho[x] * ( vel_trm_TS_BN - vel );
-            dBN[x] = omega_trm * pBN[x] + omega_w2 * rho[x] * ( vel_trm_TS_BN + vel );
+            dTS[x] = PdfValue_T( omega_trm * pTS[x] + omega_w2 * rho[x] * ( vel_trm_TS_BN - vel ) );
+            dBN[x] = PdfValue_T( omega_trm * pBN[x] + omega_w2 * rho[x] * ( vel_trm_TS_BN + vel ) );
          )
 
-         real_t * WALBERLA_RESTRICT dTN = &dst->get(0,y,z,Stencil::idx[TN]);
-         real_t * WALBERLA_RESTRICT dBS = &dst->get(0,y,z,Stencil::idx[BS]);
+         PdfValue_T * WALBERLA_RESTRICT dTN = &dst->get(0,y,z,Stencil::idx[TN]);
+         PdfValue_T * WALBERLA_RESTRICT dBS = &dst->get(0,y,z,Stencil::idx[BS]);
 
          X_LOOP
          (
             const real_t vel = velY[x] + velZ[x];
             const real_t vel_trm_TN_BS = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dTN[x] = omega_trm * pTN[x] + omega_w2 * rho[x] * ( vel_trm_TN_BS + vel );
-            dBS[x] = omega_trm * pBS[x] + omega_w2 * rho[x] * ( vel_trm_TN_BS - vel );
+            dTN[x] = PdfValue_T( omega_trm * pTN[x] + omega_w2 * rho[x] * ( vel_trm_TN_BS + vel ) );
+            dBS[x] = PdfValue_T( omega_trm * pBS[x] + omega_w2 * rho[x] * ( vel_trm_TN_BS - vel ) );
          )
 
-         real_t * WALBERLA_RESTRICT dN = &dst->get(0,y,z,Stencil::idx[N]);
-         real_t * WALBERLA_RESTRICT dS = &dst->get(0,y,z,Stencil::idx[S]);
+         PdfValue_T * WALBERLA_RESTRICT dN = &dst->get(0,y,z,Stencil::idx[N]);
+         PdfValue_T * WALBERLA_RESTRICT dS = &dst->get(0,y,z,Stencil::idx[S]);
 
          X_LOOP
          (
             const real_t vel_trm_N_S = dir_indep_trm[x] + real_c(1.5) * velY[x] * velY[x];
 
-            dN[x] = omega_trm * pN[x] + omega_w1 * rho[x] * ( vel_trm_N_S + velY[x] );
-            dS[x] = omega_trm * pS[x] + omega_w1 * rho[x] * ( vel_trm_N_S - velY[x] );
+            dN[x] = PdfValue_T( omega_trm * pN[x] + omega_w1 * rho[x] * ( vel_trm_N_S + velY[x] ) );
+            dS[x] = PdfValue_T( omega_trm * pS[x] + omega_w1 * rho[x] * ( vel_trm_N_S - velY[x] ) );
          )
 
-         real_t * WALBERLA_RESTRICT dE = &dst->get(0,y,z,Stencil::idx[E]);
-         real_t * WALBERLA_RESTRICT dW = &dst->get(0,y,z,Stencil::idx[W]);
+         PdfValue_T * WALBERLA_RESTRICT dE = &dst->get(0,y,z,Stencil::idx[E]);
+         PdfValue_T * WALBERLA_RESTRICT dW = &dst->get(0,y,z,Stencil::idx[W]);
 
          X_LOOP
          (
             const real_t vel_trm_E_W = dir_indep_trm[x] + real_c(1.5) * velX[x] * velX[x];
 
-            dE[x] = omega_trm * pE[x] + omega_w1 * rho[x] * ( vel_trm_E_W + velX[x] );
-            dW[x] = omega_trm * pW[x] + omega_w1 * rho[x] * ( vel_trm_E_W - velX[x] );
+            dE[x] = PdfValue_T( omega_trm * pE[x] + omega_w1 * rho[x] * ( vel_trm_E_W + velX[x] ) );
+            dW[x] = PdfValue_T( omega_trm * pW[x] + omega_w1 * rho[x] * ( vel_trm_E_W - velX[x] ) );
          )
 
-         real_t * WALBERLA_RESTRICT dT = &dst->get(0,y,z,Stencil::idx[T]);
-         real_t * WALBERLA_RESTRICT dB = &dst->get(0,y,z,Stencil::idx[B]);
+         PdfValue_T * WALBERLA_RESTRICT dT = &dst->get(0,y,z,Stencil::idx[T]);
+         PdfValue_T * WALBERLA_RESTRICT dB = &dst->get(0,y,z,Stencil::idx[B]);
 
          X_LOOP
          (
             const real_t vel_trm_T_B = dir_indep_trm[x] + real_c(1.5) * velZ[x] * velZ[x];
 
-            dT[x] = omega_trm * pT[x] + omega_w1 * rho[x] * ( vel_trm_T_B + velZ[x] );
-            dB[x] = omega_trm * pB[x] + omega_w1 * rho[x] * ( vel_trm_T_B - velZ[x] );
+            dT[x] = PdfValue_T( omega_trm * pT[x] + omega_w1 * rho[x] * ( vel_trm_T_B + velZ[x] ) );
+            dB[x] = PdfValue_T( omega_trm * pB[x] + omega_w1 * rho[x] * ( vel_trm_T_B - velZ[x] ) );
          )
 
        ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -1036,7 +1044,7 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             dir_indep_trm[x] = one_third - real_c(0.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            dst->get(x,y,z,Stencil::idx[C]) = omega_trm * dd_tmp_C + omega_w0 * rho[x] * dir_indep_trm[x];
+            dst->get(x,y,z,Stencil::idx[C]) = PdfValue_T( omega_trm * dd_tmp_C + omega_w0 * rho[x] * dir_indep_trm[x] );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1044,8 +1052,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] - velY[x];
             const real_t vel_trm_NW_SE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dst->get(x,y,z,Stencil::idx[NW]) = omega_trm * src->get(x+1, y-1, z, Stencil::idx[NW]) + omega_w2 * rho[x] * ( vel_trm_NW_SE - vel );
-            dst->get(x,y,z,Stencil::idx[SE]) = omega_trm * src->get(x-1, y+1, z, Stencil::idx[SE]) + omega_w2 * rho[x] * ( vel_trm_NW_SE + vel );
+            dst->get(x,y,z,Stencil::idx[NW]) = PdfValue_T( omega_trm * src->get(x+1, y-1, z, Stencil::idx[NW]) + omega_w2 * rho[x] * ( vel_trm_NW_SE - vel ) );
+            dst->get(x,y,z,Stencil::idx[SE]) = PdfValue_T( omega_trm * src->get(x-1, y+1, z, Stencil::idx[SE]) + omega_w2 * rho[x] * ( vel_trm_NW_SE + vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1053,8 +1061,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velY[x];
             const real_t vel_trm_NE_SW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dst->get(x,y,z,Stencil::idx[NE]) = omega_trm * src->get(x-1, y-1, z, Stencil::idx[NE]) + omega_w2 * rho[x] * ( vel_trm_NE_SW + vel );
-            dst->get(x,y,z,Stencil::idx[SW]) = omega_trm * src->get(x+1, y+1, z, Stencil::idx[SW]) + omega_w2 * rho[x] * ( vel_trm_NE_SW - vel );
+            dst->get(x,y,z,Stencil::idx[NE]) = PdfValue_T( omega_trm * src->get(x-1, y-1, z, Stencil::idx[NE]) + omega_w2 * rho[x] * ( vel_trm_NE_SW + vel ) );
+            dst->get(x,y,z,Stencil::idx[SW]) = PdfValue_T( omega_trm * src->get(x+1, y+1, z, Stencil::idx[SW]) + omega_w2 * rho[x] * ( vel_trm_NE_SW - vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1062,8 +1070,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] - velZ[x];
             const real_t vel_trm_TW_BE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dst->get(x,y,z,Stencil::idx[TW]) = omega_trm * src->get(x+1, y, z-1, Stencil::idx[TW]) + omega_w2 * rho[x] * ( vel_trm_TW_BE - vel );
-            dst->get(x,y,z,Stencil::idx[BE]) = omega_trm * src->get(x-1, y, z+1, Stencil::idx[BE]) + omega_w2 * rho[x] * ( vel_trm_TW_BE + vel );
+            dst->get(x,y,z,Stencil::idx[TW]) = PdfValue_T( omega_trm * src->get(x+1, y, z-1, Stencil::idx[TW]) + omega_w2 * rho[x] * ( vel_trm_TW_BE - vel ) );
+            dst->get(x,y,z,Stencil::idx[BE]) = PdfValue_T( omega_trm * src->get(x-1, y, z+1, Stencil::idx[BE]) + omega_w2 * rho[x] * ( vel_trm_TW_BE + vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1071,8 +1079,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velZ[x];
             const real_t vel_trm_TE_BW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dst->get(x,y,z,Stencil::idx[TE]) = omega_trm * src->get(x-1, y, z-1, Stencil::idx[TE]) + omega_w2 * rho[x] * ( vel_trm_TE_BW + vel );
-            dst->get(x,y,z,Stencil::idx[BW]) = omega_trm * src->get(x+1, y, z+1, Stencil::idx[BW]) + omega_w2 * rho[x] * ( vel_trm_TE_BW - vel );
+            dst->get(x,y,z,Stencil::idx[TE]) = PdfValue_T( omega_trm * src->get(x-1, y, z-1, Stencil::idx[TE]) + omega_w2 * rho[x] * ( vel_trm_TE_BW + vel ) );
+            dst->get(x,y,z,Stencil::idx[BW]) = PdfValue_T( omega_trm * src->get(x+1, y, z+1, Stencil::idx[BW]) + omega_w2 * rho[x] * ( vel_trm_TE_BW - vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1080,8 +1088,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velY[x] - velZ[x];
             const real_t vel_trm_TS_BN = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dst->get(x,y,z,Stencil::idx[TS]) = omega_trm * src->get(x, y+1, z-1, Stencil::idx[TS]) + omega_w2 * rho[x] * ( vel_trm_TS_BN - vel );
-            dst->get(x,y,z,Stencil::idx[BN]) = omega_trm * src->get(x, y-1, z+1, Stencil::idx[BN]) + omega_w2 * rho[x] * ( vel_trm_TS_BN + vel );
+            dst->get(x,y,z,Stencil::idx[TS]) = PdfValue_T( omega_trm * src->get(x, y+1, z-1, Stencil::idx[TS]) + omega_w2 * rho[x] * ( vel_trm_TS_BN - vel ) );
+            dst->get(x,y,z,Stencil::idx[BN]) = PdfValue_T( omega_trm * src->get(x, y-1, z+1, Stencil::idx[BN]) + omega_w2 * rho[x] * ( vel_trm_TS_BN + vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1089,32 +1097,32 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velY[x] + velZ[x];
             const real_t vel_trm_TN_BS = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            dst->get(x,y,z,Stencil::idx[TN]) = omega_trm * src->get(x, y-1, z-1, Stencil::idx[TN]) + omega_w2 * rho[x] * ( vel_trm_TN_BS + vel );
-            dst->get(x,y,z,Stencil::idx[BS]) = omega_trm * src->get(x, y+1, z+1, Stencil::idx[BS]) + omega_w2 * rho[x] * ( vel_trm_TN_BS - vel );
+            dst->get(x,y,z,Stencil::idx[TN]) = PdfValue_T( omega_trm * src->get(x, y-1, z-1, Stencil::idx[TN]) + omega_w2 * rho[x] * ( vel_trm_TN_BS + vel ) );
+            dst->get(x,y,z,Stencil::idx[BS]) = PdfValue_T( omega_trm * src->get(x, y+1, z+1, Stencil::idx[BS]) + omega_w2 * rho[x] * ( vel_trm_TN_BS - vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             const real_t vel_trm_N_S = dir_indep_trm[x] + real_c(1.5) * velY[x] * velY[x];
 
-            dst->get(x,y,z,Stencil::idx[N]) = omega_trm * src->get(x, y-1, z, Stencil::idx[N]) + omega_w1 * rho[x] * ( vel_trm_N_S + velY[x] );
-            dst->get(x,y,z,Stencil::idx[S]) = omega_trm * src->get(x, y+1, z, Stencil::idx[S]) + omega_w1 * rho[x] * ( vel_trm_N_S - velY[x] );
+            dst->get(x,y,z,Stencil::idx[N]) = PdfValue_T( omega_trm * src->get(x, y-1, z, Stencil::idx[N]) + omega_w1 * rho[x] * ( vel_trm_N_S + velY[x] ) );
+            dst->get(x,y,z,Stencil::idx[S]) = PdfValue_T( omega_trm * src->get(x, y+1, z, Stencil::idx[S]) + omega_w1 * rho[x] * ( vel_trm_N_S - velY[x] ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             const real_t vel_trm_E_W = dir_indep_trm[x] + real_c(1.5) * velX[x] * velX[x];
 
-            dst->get(x,y,z,Stencil::idx[E]) = omega_trm * src->get(x-1, y, z, Stencil::idx[E]) + omega_w1 * rho[x] * ( vel_trm_E_W + velX[x] );
-            dst->get(x,y,z,Stencil::idx[W]) = omega_trm * src->get(x+1, y, z, Stencil::idx[W]) + omega_w1 * rho[x] * ( vel_trm_E_W - velX[x] );
+            dst->get(x,y,z,Stencil::idx[E]) = PdfValue_T( omega_trm * src->get(x-1, y, z, Stencil::idx[E]) + omega_w1 * rho[x] * ( vel_trm_E_W + velX[x] ) );
+            dst->get(x,y,z,Stencil::idx[W]) = PdfValue_T( omega_trm * src->get(x+1, y, z, Stencil::idx[W]) + omega_w1 * rho[x] * ( vel_trm_E_W - velX[x] ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             const real_t vel_trm_T_B = dir_indep_trm[x] + real_c(1.5) * velZ[x] * velZ[x];
 
-            dst->get(x,y,z,Stencil::idx[T]) = omega_trm * src->get(x, y, z-1, Stencil::idx[T]) + omega_w1 * rho[x] * ( vel_trm_T_B + velZ[x] );
-            dst->get(x,y,z,Stencil::idx[B]) = omega_trm * src->get(x, y, z+1, Stencil::idx[B]) + omega_w1 * rho[x] * ( vel_trm_T_B - velZ[x] );
+            dst->get(x,y,z,Stencil::idx[T]) = PdfValue_T( omega_trm * src->get(x, y, z-1, Stencil::idx[T]) + omega_w1 * rho[x] * ( vel_trm_T_B + velZ[x] ) );
+            dst->get(x,y,z,Stencil::idx[B]) = PdfValue_T( omega_trm * src->get(x, y, z+1, Stencil::idx[B]) + omega_w1 * rho[x] * ( vel_trm_T_B - velZ[x] ) );
          }
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -1205,33 +1213,33 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
          using namespace stencil;
 
-         real_t * WALBERLA_RESTRICT pC  = &src->get( 0, y, z, Stencil::idx[C]);
-         real_t * WALBERLA_RESTRICT pN  = &src->get( 0, y, z, Stencil::idx[N]);
-         real_t * WALBERLA_RESTRICT pS  = &src->get( 0, y, z, Stencil::idx[S]);
-         real_t * WALBERLA_RESTRICT pW  = &src->get( 0, y, z, Stencil::idx[W]);
-         real_t * WALBERLA_RESTRICT pE  = &src->get( 0, y, z, Stencil::idx[E]);
-         real_t * WALBERLA_RESTRICT pT  = &src->get( 0, y, z, Stencil::idx[T]);
-         real_t * WALBERLA_RESTRICT pB  = &src->get( 0, y, z, Stencil::idx[B]);
-         real_t * WALBERLA_RESTRICT pNW = &src->get( 0, y, z, Stencil::idx[NW]);
-         real_t * WALBERLA_RESTRICT pNE = &src->get( 0, y, z, Stencil::idx[NE]);
-         real_t * WALBERLA_RESTRICT pSW = &src->get( 0, y, z, Stencil::idx[SW]);
-         real_t * WALBERLA_RESTRICT pSE = &src->get( 0, y, z, Stencil::idx[SE]);
-         real_t * WALBERLA_RESTRICT pTN = &src->get( 0, y, z, Stencil::idx[TN]);
-         real_t * WALBERLA_RESTRICT pTS = &src->get( 0, y, z, Stencil::idx[TS]);
-         real_t * WALBERLA_RESTRICT pTW = &src->get( 0, y, z, Stencil::idx[TW]);
-         real_t * WALBERLA_RESTRICT pTE = &src->get( 0, y, z, Stencil::idx[TE]);
-         real_t * WALBERLA_RESTRICT pBN = &src->get( 0, y, z, Stencil::idx[BN]);
-         real_t * WALBERLA_RESTRICT pBS = &src->get( 0, y, z, Stencil::idx[BS]);
-         real_t * WALBERLA_RESTRICT pBW = &src->get( 0, y, z, Stencil::idx[BW]);
-         real_t * WALBERLA_RESTRICT pBE = &src->get( 0, y, z, Stencil::idx[BE]);
+         PdfValue_T * WALBERLA_RESTRICT pC  = &src->get( 0, y, z, Stencil::idx[C]);
+         PdfValue_T * WALBERLA_RESTRICT pN  = &src->get( 0, y, z, Stencil::idx[N]);
+         PdfValue_T * WALBERLA_RESTRICT pS  = &src->get( 0, y, z, Stencil::idx[S]);
+         PdfValue_T * WALBERLA_RESTRICT pW  = &src->get( 0, y, z, Stencil::idx[W]);
+         PdfValue_T * WALBERLA_RESTRICT pE  = &src->get( 0, y, z, Stencil::idx[E]);
+         PdfValue_T * WALBERLA_RESTRICT pT  = &src->get( 0, y, z, Stencil::idx[T]);
+         PdfValue_T * WALBERLA_RESTRICT pB  = &src->get( 0, y, z, Stencil::idx[B]);
+         PdfValue_T * WALBERLA_RESTRICT pNW = &src->get( 0, y, z, Stencil::idx[NW]);
+         PdfValue_T * WALBERLA_RESTRICT pNE = &src->get( 0, y, z, Stencil::idx[NE]);
+         PdfValue_T * WALBERLA_RESTRICT pSW = &src->get( 0, y, z, Stencil::idx[SW]);
+         PdfValue_T * WALBERLA_RESTRICT pSE = &src->get( 0, y, z, Stencil::idx[SE]);
+         PdfValue_T * WALBERLA_RESTRICT pTN = &src->get( 0, y, z, Stencil::idx[TN]);
+         PdfValue_T * WALBERLA_RESTRICT pTS = &src->get( 0, y, z, Stencil::idx[TS]);
+         PdfValue_T * WALBERLA_RESTRICT pTW = &src->get( 0, y, z, Stencil::idx[TW]);
+         PdfValue_T * WALBERLA_RESTRICT pTE = &src->get( 0, y, z, Stencil::idx[TE]);
+         PdfValue_T * WALBERLA_RESTRICT pBN = &src->get( 0, y, z, Stencil::idx[BN]);
+         PdfValue_T * WALBERLA_RESTRICT pBS = &src->get( 0, y, z, Stencil::idx[BS]);
+         PdfValue_T * WALBERLA_RESTRICT pBW = &src->get( 0, y, z, Stencil::idx[BW]);
+         PdfValue_T * WALBERLA_RESTRICT pBE = &src->get( 0, y, z, Stencil::idx[BE]);
 
          X_LOOP
          (
-            const real_t velX_trm = pE[x] + pNE[x] + pSE[x] + pTE[x] + pBE[x];
-            const real_t velY_trm = pN[x] + pNW[x] + pTN[x] + pBN[x];
-            const real_t velZ_trm = pT[x] + pTS[x] + pTW[x];
+            const real_t velX_trm = real_t( pE[x] ) + pNE[x] + pSE[x] + pTE[x] + pBE[x];
+            const real_t velY_trm = real_t( pN[x] ) + pNW[x] + pTN[x] + pBN[x];
+            const real_t velZ_trm = real_t( pT[x] ) + pTS[x] + pTW[x];
 
-            rho[x] = pC[x] + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
+            rho[x] = real_t( pC[x] ) + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
             const real_t rho_inv = real_t(1) / rho[x];
 
             velX[x] = rho_inv * ( velX_trm - pW[x]  - pNW[x] - pSW[x] - pTW[x] - pBW[x] );
@@ -1240,7 +1248,7 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             dir_indep_trm[x] = one_third - real_c(0.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            pC[x] = omega_trm * pC[x] + omega_w0 * rho[x] * dir_indep_trm[x];
+            pC[x] = PdfValue_T( omega_trm * pC[x] + omega_w0 * rho[x] * dir_indep_trm[x] );
          )
 
          X_LOOP
@@ -1248,8 +1256,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] - velY[x];
             const real_t vel_trm_NW_SE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            pNW[x] = omega_trm * pNW[x] + omega_w2 * rho[x] * ( vel_trm_NW_SE - vel );
-            pSE[x] = omega_trm * pSE[x] + omega_w2 * rho[x] * ( vel_trm_NW_SE + vel );
+            pNW[x] = PdfValue_T( omega_trm * pNW[x] + omega_w2 * rho[x] * ( vel_trm_NW_SE - vel ) );
+            pSE[x] = PdfValue_T( omega_trm * pSE[x] + omega_w2 * rho[x] * ( vel_trm_NW_SE + vel ) );
          )
 
          X_LOOP
@@ -1257,8 +1265,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velY[x];
             const real_t vel_trm_NE_SW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            pNE[x] = omega_trm * pNE[x] + omega_w2 * rho[x] * ( vel_trm_NE_SW + vel );
-            pSW[x] = omega_trm * pSW[x] + omega_w2 * rho[x] * ( vel_trm_NE_SW - vel );
+            pNE[x] = PdfValue_T( omega_trm * pNE[x] + omega_w2 * rho[x] * ( vel_trm_NE_SW + vel ) );
+            pSW[x] = PdfValue_T( omega_trm * pSW[x] + omega_w2 * rho[x] * ( vel_trm_NE_SW - vel ) );
          )
 
          X_LOOP
@@ -1266,8 +1274,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] - velZ[x];
             const real_t vel_trm_TW_BE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            pTW[x] = omega_trm * pTW[x] + omega_w2 * rho[x] * ( vel_trm_TW_BE - vel );
-            pBE[x] = omega_trm * pBE[x] + omega_w2 * rho[x] * ( vel_trm_TW_BE + vel );
+            pTW[x] = PdfValue_T( omega_trm * pTW[x] + omega_w2 * rho[x] * ( vel_trm_TW_BE - vel ) );
+            pBE[x] = PdfValue_T( omega_trm * pBE[x] + omega_w2 * rho[x] * ( vel_trm_TW_BE + vel ) );
          )
 
          X_LOOP
@@ -1275,8 +1283,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velZ[x];
             const real_t vel_trm_TE_BW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            pTE[x] = omega_trm * pTE[x] + omega_w2 * rho[x] * ( vel_trm_TE_BW + vel );
-            pBW[x] = omega_trm * pBW[x] + omega_w2 * rho[x] * ( vel_trm_TE_BW - vel );
+            pTE[x] = PdfValue_T( omega_trm * pTE[x] + omega_w2 * rho[x] * ( vel_trm_TE_BW + vel ) );
+            pBW[x] = PdfValue_T( omega_trm * pBW[x] + omega_w2 * rho[x] * ( vel_trm_TE_BW - vel ) );
          )
 
          X_LOOP
@@ -1284,8 +1292,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velY[x] - velZ[x];
             const real_t vel_trm_TS_BN = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            pTS[x] = omega_trm * pTS[x] + omega_w2 * rho[x] * ( vel_trm_TS_BN - vel );
-            pBN[x] = omega_trm * pBN[x] + omega_w2 * rho[x] * ( vel_trm_TS_BN + vel );
+            pTS[x] = PdfValue_T( omega_trm * pTS[x] + omega_w2 * rho[x] * ( vel_trm_TS_BN - vel ) );
+            pBN[x] = PdfValue_T( omega_trm * pBN[x] + omega_w2 * rho[x] * ( vel_trm_TS_BN + vel ) );
          )
 
          X_LOOP
@@ -1293,32 +1301,32 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velY[x] + velZ[x];
             const real_t vel_trm_TN_BS = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            pTN[x] = omega_trm * pTN[x] + omega_w2 * rho[x] * ( vel_trm_TN_BS + vel );
-            pBS[x] = omega_trm * pBS[x] + omega_w2 * rho[x] * ( vel_trm_TN_BS - vel );
+            pTN[x] = PdfValue_T( omega_trm * pTN[x] + omega_w2 * rho[x] * ( vel_trm_TN_BS + vel ) );
+            pBS[x] = PdfValue_T( omega_trm * pBS[x] + omega_w2 * rho[x] * ( vel_trm_TN_BS - vel ) );
          )
 
          X_LOOP
          (
             const real_t vel_trm_N_S = dir_indep_trm[x] + real_c(1.5) * velY[x] * velY[x];
 
-            pN[x] = omega_trm * pN[x] + omega_w1 * rho[x] * ( vel_trm_N_S + velY[x] );
-            pS[x] = omega_trm * pS[x] + omega_w1 * rho[x] * ( vel_trm_N_S - velY[x] );
+            pN[x] = PdfValue_T( omega_trm * pN[x] + omega_w1 * rho[x] * ( vel_trm_N_S + velY[x] ) );
+            pS[x] = PdfValue_T( omega_trm * pS[x] + omega_w1 * rho[x] * ( vel_trm_N_S - velY[x] ) );
          )
 
          X_LOOP
          (
             const real_t vel_trm_E_W = dir_indep_trm[x] + real_c(1.5) * velX[x] * velX[x];
 
-            pE[x] = omega_trm * pE[x] + omega_w1 * rho[x] * ( vel_trm_E_W + velX[x] );
-            pW[x] = omega_trm * pW[x] + omega_w1 * rho[x] * ( vel_trm_E_W - velX[x] );
+            pE[x] = PdfValue_T( omega_trm * pE[x] + omega_w1 * rho[x] * ( vel_trm_E_W + velX[x] ) );
+            pW[x] = PdfValue_T( omega_trm * pW[x] + omega_w1 * rho[x] * ( vel_trm_E_W - velX[x] ) );
          )
 
          X_LOOP
          (
             const real_t vel_trm_T_B = dir_indep_trm[x] + real_c(1.5) * velZ[x] * velZ[x];
 
-            pT[x] = omega_trm * pT[x] + omega_w1 * rho[x] * ( vel_trm_T_B + velZ[x] );
-            pB[x] = omega_trm * pB[x] + omega_w1 * rho[x] * ( vel_trm_T_B - velZ[x] );
+            pT[x] = PdfValue_T( omega_trm * pT[x] + omega_w1 * rho[x] * ( vel_trm_T_B + velZ[x] ) );
+            pB[x] = PdfValue_T( omega_trm * pB[x] + omega_w1 * rho[x] * ( vel_trm_T_B - velZ[x] ) );
          )
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -1364,7 +1372,7 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             dir_indep_trm[x] = one_third - real_c(0.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            src->get(x,y,z,Stencil::idx[C]) = omega_trm * dd_tmp_C + omega_w0 * rho[x] * dir_indep_trm[x];
+            src->get(x,y,z,Stencil::idx[C]) = PdfValue_T( omega_trm * dd_tmp_C + omega_w0 * rho[x] * dir_indep_trm[x] );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1372,8 +1380,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] - velY[x];
             const real_t vel_trm_NW_SE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            src->get(x,y,z,Stencil::idx[NW]) = omega_trm * src->get(x,y,z,Stencil::idx[NW]) + omega_w2 * rho[x] * ( vel_trm_NW_SE - vel );
-            src->get(x,y,z,Stencil::idx[SE]) = omega_trm * src->get(x,y,z,Stencil::idx[SE]) + omega_w2 * rho[x] * ( vel_trm_NW_SE + vel );
+            src->get(x,y,z,Stencil::idx[NW]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[NW]) + omega_w2 * rho[x] * ( vel_trm_NW_SE - vel ) );
+            src->get(x,y,z,Stencil::idx[SE]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[SE]) + omega_w2 * rho[x] * ( vel_trm_NW_SE + vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1381,8 +1389,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velY[x];
             const real_t vel_trm_NE_SW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            src->get(x,y,z,Stencil::idx[NE]) = omega_trm * src->get(x,y,z,Stencil::idx[NE]) + omega_w2 * rho[x] * ( vel_trm_NE_SW + vel );
-            src->get(x,y,z,Stencil::idx[SW]) = omega_trm * src->get(x,y,z,Stencil::idx[SW]) + omega_w2 * rho[x] * ( vel_trm_NE_SW - vel );
+            src->get(x,y,z,Stencil::idx[NE]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[NE]) + omega_w2 * rho[x] * ( vel_trm_NE_SW + vel ) );
+            src->get(x,y,z,Stencil::idx[SW]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[SW]) + omega_w2 * rho[x] * ( vel_trm_NE_SW - vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1390,8 +1398,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] - velZ[x];
             const real_t vel_trm_TW_BE = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            src->get(x,y,z,Stencil::idx[TW]) = omega_trm * src->get(x,y,z,Stencil::idx[TW]) + omega_w2 * rho[x] * ( vel_trm_TW_BE - vel );
-            src->get(x,y,z,Stencil::idx[BE]) = omega_trm * src->get(x,y,z,Stencil::idx[BE]) + omega_w2 * rho[x] * ( vel_trm_TW_BE + vel );
+            src->get(x,y,z,Stencil::idx[TW]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[TW]) + omega_w2 * rho[x] * ( vel_trm_TW_BE - vel ) );
+            src->get(x,y,z,Stencil::idx[BE]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[BE]) + omega_w2 * rho[x] * ( vel_trm_TW_BE + vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1399,8 +1407,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velX[x] + velZ[x];
             const real_t vel_trm_TE_BW = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            src->get(x,y,z,Stencil::idx[TE]) = omega_trm * src->get(x,y,z,Stencil::idx[TE]) + omega_w2 * rho[x] * ( vel_trm_TE_BW + vel );
-            src->get(x,y,z,Stencil::idx[BW]) = omega_trm * src->get(x,y,z,Stencil::idx[BW]) + omega_w2 * rho[x] * ( vel_trm_TE_BW - vel );
+            src->get(x,y,z,Stencil::idx[TE]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[TE]) + omega_w2 * rho[x] * ( vel_trm_TE_BW + vel ) );
+            src->get(x,y,z,Stencil::idx[BW]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[BW]) + omega_w2 * rho[x] * ( vel_trm_TE_BW - vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1408,8 +1416,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velY[x] - velZ[x];
             const real_t vel_trm_TS_BN = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            src->get(x,y,z,Stencil::idx[TS]) = omega_trm * src->get(x,y,z,Stencil::idx[TS]) + omega_w2 * rho[x] * ( vel_trm_TS_BN - vel );
-            src->get(x,y,z,Stencil::idx[BN]) = omega_trm * src->get(x,y,z,Stencil::idx[BN]) + omega_w2 * rho[x] * ( vel_trm_TS_BN + vel );
+            src->get(x,y,z,Stencil::idx[TS]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[TS]) + omega_w2 * rho[x] * ( vel_trm_TS_BN - vel ) );
+            src->get(x,y,z,Stencil::idx[BN]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[BN]) + omega_w2 * rho[x] * ( vel_trm_TS_BN + vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1417,32 +1425,488 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t vel = velY[x] + velZ[x];
             const real_t vel_trm_TN_BS = dir_indep_trm[x] + real_c(1.5) * vel * vel;
 
-            src->get(x,y,z,Stencil::idx[TN]) = omega_trm * src->get(x,y,z,Stencil::idx[TN]) + omega_w2 * rho[x] * ( vel_trm_TN_BS + vel );
-            src->get(x,y,z,Stencil::idx[BS]) = omega_trm * src->get(x,y,z,Stencil::idx[BS]) + omega_w2 * rho[x] * ( vel_trm_TN_BS - vel );
+            src->get(x,y,z,Stencil::idx[TN]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[TN]) + omega_w2 * rho[x] * ( vel_trm_TN_BS + vel ) );
+            src->get(x,y,z,Stencil::idx[BS]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[BS]) + omega_w2 * rho[x] * ( vel_trm_TN_BS - vel ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             const real_t vel_trm_N_S = dir_indep_trm[x] + real_c(1.5) * velY[x] * velY[x];
 
-            src->get(x,y,z,Stencil::idx[N]) = omega_trm * src->get(x,y,z,Stencil::idx[N]) + omega_w1 * rho[x] * ( vel_trm_N_S + velY[x] );
-            src->get(x,y,z,Stencil::idx[S]) = omega_trm * src->get(x,y,z,Stencil::idx[S]) + omega_w1 * rho[x] * ( vel_trm_N_S - velY[x] );
+            src->get(x,y,z,Stencil::idx[N]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[N]) + omega_w1 * rho[x] * ( vel_trm_N_S + velY[x] ) );
+            src->get(x,y,z,Stencil::idx[S]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[S]) + omega_w1 * rho[x] * ( vel_trm_N_S - velY[x] ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             const real_t vel_trm_E_W = dir_indep_trm[x] + real_c(1.5) * velX[x] * velX[x];
 
-            src->get(x,y,z,Stencil::idx[E]) = omega_trm * src->get(x,y,z,Stencil::idx[E]) + omega_w1 * rho[x] * ( vel_trm_E_W + velX[x] );
-            src->get(x,y,z,Stencil::idx[W]) = omega_trm * src->get(x,y,z,Stencil::idx[W]) + omega_w1 * rho[x] * ( vel_trm_E_W - velX[x] );
+            src->get(x,y,z,Stencil::idx[E]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[E]) + omega_w1 * rho[x] * ( vel_trm_E_W + velX[x] ) );
+            src->get(x,y,z,Stencil::idx[W]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[W]) + omega_w1 * rho[x] * ( vel_trm_E_W - velX[x] ) );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             const real_t vel_trm_T_B = dir_indep_trm[x] + real_c(1.5) * velZ[x] * velZ[x];
 
-            src->get(x,y,z,Stencil::idx[T]) = omega_trm * src->get(x,y,z,Stencil::idx[T]) + omega_w1 * rho[x] * ( vel_trm_T_B + velZ[x] );
-            src->get(x,y,z,Stencil::idx[B]) = omega_trm * src->get(x,y,z,Stencil::idx[B]) + omega_w1 * rho[x] * ( vel_trm_T_B - velZ[x] );
+            src->get(x,y,z,Stencil::idx[T]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[T]) + omega_w1 * rho[x] * ( vel_trm_T_B + velZ[x] ) );
+            src->get(x,y,z,Stencil::idx[B]) = PdfValue_T( omega_trm * src->get(x,y,z,Stencil::idx[B]) + omega_w1 * rho[x] * ( vel_trm_T_B - velZ[x] ) );
+         }
+
+      ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
+   }
+
+   delete[] velX;
+   delete[] velY;
+   delete[] velZ;
+   delete[] rho;
+   delete[] dir_indep_trm;
+
+#ifdef _OPENMP
+   }
+#endif
+}
+
+
+
+//////////////////////////////////////////////
+// Generic split implementation for         //
+// D3Q15 and D3Q27:                         //
+// - incompressible & compressible          //
+// - no additional forces                   //
+//                                          //
+// Directions are processed pairwise        //
+// (direction + inverse direction), every   //
+// pair is handled in its own x-loop.       //
+//////////////////////////////////////////////
+
+template< typename LatticeModel_T >
+class SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                                            collision_model::SRT_tag >,
+                                                                            boost::mpl::bool_< LatticeModel_T::CollisionModel::constant >,
+                                                                            boost::mpl::or_< boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q15 >,
+                                                                                             boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q27 > >,
+                                                                            boost::is_same< typename LatticeModel_T::ForceModel::tag,
+                                                                                            force_model::None_tag >
+                                                                 > >::type > :
+   public SweepBase< LatticeModel_T >
+{
+public:
+
+   static_assert( (boost::is_same< typename LatticeModel_T::CollisionModel::tag, collision_model::SRT_tag >::value), "Only works with SRT!" );
+   static_assert( (boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q15 >::value ||
+                   boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q27 >::value),                      "Only works with D3Q15 or D3Q27!" );
+   static_assert( (boost::is_same< typename LatticeModel_T::ForceModel::tag, force_model::None_tag >::value),        "Only works without additional forces!" );
+   static_assert( LatticeModel_T::equilibriumAccuracyOrder == 2, "Only works for lattice models that require the equilibrium distribution to be order 2 accurate!" );
+
+   typedef typename SweepBase<LatticeModel_T>::PdfField_T  PdfField_T;
+   typedef typename LatticeModel_T::Stencil                Stencil;
+   typedef typename PdfField_T::value_type                 PdfValue_T;
+
+   // block has NO dst pdf field
+   SplitPureSweep( const BlockDataID & pdfField ) :
+      SweepBase<LatticeModel_T>( pdfField ) {}
+
+   // every block has a dedicated dst pdf field
+   SplitPureSweep( const BlockDataID & src, const BlockDataID & dst ) :
+      SweepBase<LatticeModel_T>( src, dst ) {}
+
+   void operator()( IBlock * const block );
+
+   void stream ( IBlock * const block, const uint_t numberOfGhostLayersToInclude = uint_t(0) );
+   void collide( IBlock * const block, const uint_t numberOfGhostLayersToInclude = uint_t(0) );
+};
+
+template< typename LatticeModel_T >
+void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                                                  collision_model::SRT_tag >,
+                                                                                  boost::mpl::bool_< LatticeModel_T::CollisionModel::constant >,
+                                                                                  boost::mpl::or_< boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q15 >,
+                                                                                                   boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q27 > >,
+                                                                                  boost::is_same< typename LatticeModel_T::ForceModel::tag,
+                                                                                                  force_model::None_tag > > >::type
+   >::operator()( IBlock * const block )
+{
+   PdfField_T * src( NULL );
+   PdfField_T * dst( NULL );
+
+   this->getFields( block, src, dst );
+
+   WALBERLA_ASSERT_GREATER_EQUAL( src->nrOfGhostLayers(), 1 );
+
+   // constants used during stream/collide
+
+   const real_t omega = src->latticeModel().collisionModel().omega();
+
+   const real_t omega_trm( real_t(1) - omega );
+   const real_t  omega_w0( real_t(3) * LatticeModel_T::w[ Stencil::idx[stencil::C] ] * omega );
+   const real_t one_third( real_t(1) / real_t(3) );
+
+   // loop constants
+
+   const cell_idx_t xSize = cell_idx_c( src->xSize() );
+
+#ifdef _OPENMP
+   #pragma omp parallel
+   {
+#endif
+   // temporaries, calculated by the first innermost loops
+
+   real_t * WALBERLA_RESTRICT velX = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT velY = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT velZ = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT rho  = new real_t[ uint_c( xSize ) ];
+
+   real_t * WALBERLA_RESTRICT rho_inv       = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT dir_indep_trm = new real_t[ uint_c( xSize ) ];
+
+   if( src->layout() == field::fzyx && dst->layout() == field::fzyx )
+   {
+      WALBERLA_FOR_ALL_CELLS_YZ_OMP( src, omp for schedule(static),
+
+         using namespace stencil;
+
+         PdfValue_T * WALBERLA_RESTRICT pC = &src->get( 0, y, z, Stencil::idx[C] );
+         PdfValue_T * WALBERLA_RESTRICT dC = &dst->get( 0, y, z, Stencil::idx[C] );
+
+         X_LOOP
+         (
+            rho[x]  = pC[x];
+            velX[x] = real_t(0);
+            velY[x] = real_t(0);
+            velZ[x] = real_t(0);
+         )
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d  = Stencil::dir_pos[i];
+            const Direction id = inverseDir[d];
+
+            PdfValue_T * WALBERLA_RESTRICT pD = &src->get( -cx[d], y - cy[d], z - cz[d], Stencil::idx[d]  );
+            PdfValue_T * WALBERLA_RESTRICT pI = &src->get(  cx[d], y + cy[d], z + cz[d], Stencil::idx[id] );
+
+            const real_t dx = real_c( cx[d] );
+            const real_t dy = real_c( cy[d] );
+            const real_t dz = real_c( cz[d] );
+
+            X_LOOP
+            (
+               const real_t sum  = real_t( pD[x] ) + pI[x];
+               const real_t diff = real_t( pD[x] ) - pI[x];
+
+               rho[x]  += sum;
+               velX[x] += dx * diff;
+               velY[x] += dy * diff;
+               velZ[x] += dz * diff;
+            )
+         }
+
+         X_LOOP
+         (
+            rho_inv[x] = LatticeModel_T::compressible ? ( real_t(1) / rho[x] ) : real_t(1);
+
+            dir_indep_trm[x] = one_third * rho[x] - real_c(0.5) * rho_inv[x] * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
+
+            dC[x] = PdfValue_T( omega_trm * pC[x] + omega_w0 * dir_indep_trm[x] );
+         )
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d  = Stencil::dir_pos[i];
+            const Direction id = inverseDir[d];
+
+            PdfValue_T * WALBERLA_RESTRICT pD = &src->get( -cx[d], y - cy[d], z - cz[d], Stencil::idx[d]  );
+            PdfValue_T * WALBERLA_RESTRICT pI = &src->get(  cx[d], y + cy[d], z + cz[d], Stencil::idx[id] );
+
+            PdfValue_T * WALBERLA_RESTRICT dD = &dst->get( 0, y, z, Stencil::idx[d]  );
+            PdfValue_T * WALBERLA_RESTRICT dI = &dst->get( 0, y, z, Stencil::idx[id] );
+
+            const real_t dx = real_c( cx[d] );
+            const real_t dy = real_c( cy[d] );
+            const real_t dz = real_c( cz[d] );
+
+            const real_t omega_w = real_t(3) * LatticeModel_T::w[ Stencil::idx[d] ] * omega;
+
+            X_LOOP
+            (
+               const real_t vel = dx * velX[x] + dy * velY[x] + dz * velZ[x];
+               const real_t vel_trm = dir_indep_trm[x] + real_c(1.5) * ( LatticeModel_T::compressible ? rho_inv[x] * vel * vel : vel * vel );
+
+               dD[x] = PdfValue_T( omega_trm * pD[x] + omega_w * ( vel_trm + vel ) );
+               dI[x] = PdfValue_T( omega_trm * pI[x] + omega_w * ( vel_trm - vel ) );
+            )
+         }
+
+      ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
+   }
+   else // ==> src->layout() == field::zyxf || dst->layout() == field::zyxf
+   {
+      WALBERLA_FOR_ALL_CELLS_YZ_OMP( src, omp for schedule(static),
+
+         using namespace stencil;
+
+         for( cell_idx_t x = 0; x != xSize; ++x )
+         {
+            rho[x]  = src->get( x, y, z, Stencil::idx[C] );
+            velX[x] = real_t(0);
+            velY[x] = real_t(0);
+            velZ[x] = real_t(0);
+         }
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d  = Stencil::dir_pos[i];
+            const Direction id = inverseDir[d];
+
+            for( cell_idx_t x = 0; x != xSize; ++x )
+            {
+               const real_t dd_tmp_d  = src->get( x - cx[d], y - cy[d], z - cz[d], Stencil::idx[d]  );
+               const real_t dd_tmp_id = src->get( x + cx[d], y + cy[d], z + cz[d], Stencil::idx[id] );
+
+               const real_t diff = dd_tmp_d - dd_tmp_id;
+
+               rho[x]  += dd_tmp_d + dd_tmp_id;
+               velX[x] += real_c( cx[d] ) * diff;
+               velY[x] += real_c( cy[d] ) * diff;
+               velZ[x] += real_c( cz[d] ) * diff;
+            }
+         }
+
+         for( cell_idx_t x = 0; x != xSize; ++x )
+         {
+            rho_inv[x] = LatticeModel_T::compressible ? ( real_t(1) / rho[x] ) : real_t(1);
+
+            dir_indep_trm[x] = one_third * rho[x] - real_c(0.5) * rho_inv[x] * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
+
+            dst->get( x, y, z, Stencil::idx[C] ) = PdfValue_T( omega_trm * src->get( x, y, z, Stencil::idx[C] ) + omega_w0 * dir_indep_trm[x] );
+         }
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d  = Stencil::dir_pos[i];
+            const Direction id = inverseDir[d];
+
+            const real_t omega_w = real_t(3) * LatticeModel_T::w[ Stencil::idx[d] ] * omega;
+
+            for( cell_idx_t x = 0; x != xSize; ++x )
+            {
+               const real_t vel = real_c( cx[d] ) * velX[x] + real_c( cy[d] ) * velY[x] + real_c( cz[d] ) * velZ[x];
+               const real_t vel_trm = dir_indep_trm[x] + real_c(1.5) * ( LatticeModel_T::compressible ? rho_inv[x] * vel * vel : vel * vel );
+
+               dst->get( x, y, z, Stencil::idx[d]  ) = PdfValue_T( omega_trm * src->get( x - cx[d], y - cy[d], z - cz[d], Stencil::idx[d]  ) + omega_w * ( vel_trm + vel ) );
+               dst->get( x, y, z, Stencil::idx[id] ) = PdfValue_T( omega_trm * src->get( x + cx[d], y + cy[d], z + cz[d], Stencil::idx[id] ) + omega_w * ( vel_trm - vel ) );
+            }
+         }
+
+      ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
+   }
+
+   delete[] velX;
+   delete[] velY;
+   delete[] velZ;
+   delete[] rho;
+   delete[] rho_inv;
+   delete[] dir_indep_trm;
+
+#ifdef _OPENMP
+   }
+#endif
+
+   src->swapDataPointers( dst );
+}
+
+template< typename LatticeModel_T >
+void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                                                  collision_model::SRT_tag >,
+                                                                                  boost::mpl::bool_< LatticeModel_T::CollisionModel::constant >,
+                                                                                  boost::mpl::or_< boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q15 >,
+                                                                                                   boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q27 > >,
+                                                                                  boost::is_same< typename LatticeModel_T::ForceModel::tag,
+                                                                                                  force_model::None_tag > > >::type
+   >::stream( IBlock * const block, const uint_t numberOfGhostLayersToInclude )
+{
+   PdfField_T * src( NULL );
+   PdfField_T * dst( NULL );
+
+   this->getFields( block, src, dst );
+
+   StreamEverything< LatticeModel_T >::execute( src, dst, numberOfGhostLayersToInclude );
+}
+
+template< typename LatticeModel_T >
+void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                                                  collision_model::SRT_tag >,
+                                                                                  boost::mpl::bool_< LatticeModel_T::CollisionModel::constant >,
+                                                                                  boost::mpl::or_< boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q15 >,
+                                                                                                   boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q27 > >,
+                                                                                  boost::is_same< typename LatticeModel_T::ForceModel::tag,
+                                                                                                  force_model::None_tag > > >::type
+#ifdef NDEBUG
+   >::collide( IBlock * const block, const uint_t /*numberOfGhostLayersToInclude*/ )
+#else
+   >::collide( IBlock * const block, const uint_t numberOfGhostLayersToInclude )
+#endif
+{
+   WALBERLA_ASSERT_EQUAL( numberOfGhostLayersToInclude, uint_t(0) ); // the implementation right now doesn't support inclusion of ghost layers in collide step!
+
+   PdfField_T * src = this->getSrcField( block );
+
+   WALBERLA_ASSERT_GREATER_EQUAL( src->nrOfGhostLayers(), numberOfGhostLayersToInclude );
+
+   // constants used during stream/collide
+
+   const real_t omega = src->latticeModel().collisionModel().omega();
+
+   const real_t omega_trm( real_t(1) - omega );
+   const real_t  omega_w0( real_t(3) * LatticeModel_T::w[ Stencil::idx[stencil::C] ] * omega );
+   const real_t one_third( real_t(1) / real_t(3) );
+
+   // loop constants
+
+   const cell_idx_t xSize = cell_idx_c( src->xSize() );
+
+#ifdef _OPENMP
+   #pragma omp parallel
+   {
+#endif
+   // temporaries, calculated by the first innermost loops
+
+   real_t * WALBERLA_RESTRICT velX = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT velY = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT velZ = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT rho  = new real_t[ uint_c( xSize ) ];
+
+   real_t * WALBERLA_RESTRICT rho_inv       = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT dir_indep_trm = new real_t[ uint_c( xSize ) ];
+
+   if( src->layout() == field::fzyx )
+   {
+      WALBERLA_FOR_ALL_CELLS_YZ_OMP( src, omp for schedule(static),
+
+         using namespace stencil;
+
+         PdfValue_T * WALBERLA_RESTRICT pC = &src->get( 0, y, z, Stencil::idx[C] );
+
+         X_LOOP
+         (
+            rho[x]  = pC[x];
+            velX[x] = real_t(0);
+            velY[x] = real_t(0);
+            velZ[x] = real_t(0);
+         )
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d = Stencil::dir_pos[i];
+
+            PdfValue_T * WALBERLA_RESTRICT pD = &src->get( 0, y, z, Stencil::idx[d] );
+            PdfValue_T * WALBERLA_RESTRICT pI = &src->get( 0, y, z, Stencil::invDirIdx(d) );
+
+            const real_t dx = real_c( cx[d] );
+            const real_t dy = real_c( cy[d] );
+            const real_t dz = real_c( cz[d] );
+
+            X_LOOP
+            (
+               const real_t sum  = real_t( pD[x] ) + pI[x];
+               const real_t diff = real_t( pD[x] ) - pI[x];
+
+               rho[x]  += sum;
+               velX[x] += dx * diff;
+               velY[x] += dy * diff;
+               velZ[x] += dz * diff;
+            )
+         }
+
+         X_LOOP
+         (
+            rho_inv[x] = LatticeModel_T::compressible ? ( real_t(1) / rho[x] ) : real_t(1);
+
+            dir_indep_trm[x] = one_third * rho[x] - real_c(0.5) * rho_inv[x] * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
+
+            pC[x] = PdfValue_T( omega_trm * pC[x] + omega_w0 * dir_indep_trm[x] );
+         )
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d = Stencil::dir_pos[i];
+
+            PdfValue_T * WALBERLA_RESTRICT pD = &src->get( 0, y, z, Stencil::idx[d] );
+            PdfValue_T * WALBERLA_RESTRICT pI = &src->get( 0, y, z, Stencil::invDirIdx(d) );
+
+            const real_t dx = real_c( cx[d] );
+            const real_t dy = real_c( cy[d] );
+            const real_t dz = real_c( cz[d] );
+
+            const real_t omega_w = real_t(3) * LatticeModel_T::w[ Stencil::idx[d] ] * omega;
+
+            X_LOOP
+            (
+               const real_t vel = dx * velX[x] + dy * velY[x] + dz * velZ[x];
+               const real_t vel_trm = dir_indep_trm[x] + real_c(1.5) * ( LatticeModel_T::compressible ? rho_inv[x] * vel * vel : vel * vel );
+
+               pD[x] = PdfValue_T( omega_trm * pD[x] + omega_w * ( vel_trm + vel ) );
+               pI[x] = PdfValue_T( omega_trm * pI[x] + omega_w * ( vel_trm - vel ) );
+            )
+         }
+
+      ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
+   }
+   else // ==> src->layout() == field::zyxf
+   {
+      WALBERLA_FOR_ALL_CELLS_YZ_OMP( src, omp for schedule(static),
+
+         using namespace stencil;
+
+         for( cell_idx_t x = 0; x != xSize; ++x )
+         {
+            rho[x]  = src->get( x, y, z, Stencil::idx[C] );
+            velX[x] = real_t(0);
+            velY[x] = real_t(0);
+            velZ[x] = real_t(0);
+         }
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d = Stencil::dir_pos[i];
+
+            for( cell_idx_t x = 0; x != xSize; ++x )
+            {
+               const real_t dd_tmp_d  = src->get( x, y, z, Stencil::idx[d] );
+               const real_t dd_tmp_id = src->get( x, y, z, Stencil::invDirIdx(d) );
+
+               const real_t diff = dd_tmp_d - dd_tmp_id;
+
+               rho[x]  += dd_tmp_d + dd_tmp_id;
+               velX[x] += real_c( cx[d] ) * diff;
+               velY[x] += real_c( cy[d] ) * diff;
+               velZ[x] += real_c( cz[d] ) * diff;
+            }
+         }
+
+         for( cell_idx_t x = 0; x != xSize; ++x )
+         {
+            rho_inv[x] = LatticeModel_T::compressible ? ( real_t(1) / rho[x] ) : real_t(1);
+
+            dir_indep_trm[x] = one_third * rho[x] - real_c(0.5) * rho_inv[x] * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
+
+            src->get( x, y, z, Stencil::idx[C] ) = PdfValue_T( omega_trm * src->get( x, y, z, Stencil::idx[C] ) + omega_w0 * dir_indep_trm[x] );
+         }
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d = Stencil::dir_pos[i];
+
+            const real_t omega_w = real_t(3) * LatticeModel_T::w[ Stencil::idx[d] ] * omega;
+
+            for( cell_idx_t x = 0; x != xSize; ++x )
+            {
+               const real_t vel = real_c( cx[d] ) * velX[x] + real_c( cy[d] ) * velY[x] + real_c( cz[d] ) * velZ[x];
+               const real_t vel_trm = dir_indep_trm[x] + real_c(1.5) * ( LatticeModel_T::compressible ? rho_inv[x] * vel * vel : vel * vel );
+
+               src->get( x, y, z, Stencil::idx[d]        ) = PdfValue_T( omega_trm * src->get( x, y, z, Stencil::idx[d]        ) + omega_w * ( vel_trm + vel ) );
+               src->get( x, y, z, Stencil::invDirIdx(d) ) = PdfValue_T( omega_trm * src->get( x, y, z, Stencil::invDirIdx(d) ) + omega_w * ( vel_trm - vel ) );
+            }
          }
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -1452,6 +1916,7 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
    delete[] velY;
    delete[] velZ;
    delete[] rho;
+   delete[] rho_inv;
    delete[] dir_indep_trm;
 
 #ifdef _OPENMP
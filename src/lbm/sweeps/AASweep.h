@@ -0,0 +1,225 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file AASweep.h
+//! \ingroup lbm
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "lbm/field/PdfField.h"
+#include "lbm/sweeps/AATimeStepTracker.h"
+#include "lbm/sweeps/cell_operations/DefaultCellOperation.h"
+
+#include "core/debug/Debug.h"
+#include "domain_decomposition/IBlock.h"
+#include "field/iterators/IteratorMacros.h"
+#include "stencil/Directions.h"
+
+
+namespace walberla {
+namespace lbm {
+
+
+
+namespace internal {
+
+/// Gives cell operations (see DefaultCellOperation) access to the PDFs of one cell of an in-place (AA) PDF field.
+/// 'neighbor' returns the PDFs that stream into the cell during an even/odd time step. operator[] addresses a local
+/// copy of the post-collision PDFs, which are written back to the field by 'store'.
+template< typename PdfField_T, bool EvenTimeStep >
+class AACellAccessor
+{
+public:
+
+   typedef typename PdfField_T::LatticeModel::Stencil Stencil;
+
+   AACellAccessor( PdfField_T * const field, const cell_idx_t x, const cell_idx_t y, const cell_idx_t z ) :
+      field_( field ), x_( x ), y_( y ), z_( z ) {}
+
+   cell_idx_t x() const { return x_; }
+   cell_idx_t y() const { return y_; }
+   cell_idx_t z() const { return z_; }
+
+   real_t neighbor( const cell_idx_t cx, const cell_idx_t cy, const cell_idx_t cz, const uint_t f ) const
+   {
+      if( EvenTimeStep )
+         return field_->get( x_, y_, z_, f );
+      return field_->get( x_ + cx, y_ + cy, z_ + cz, Stencil::invDirIdx( Stencil::dir[f] ) );
+   }
+
+   real_t neighbor( const stencil::Direction d, const uint_t f ) const
+   {
+      return neighbor( cell_idx_c( stencil::cx[d] ), cell_idx_c( stencil::cy[d] ), cell_idx_c( stencil::cz[d] ), f );
+   }
+
+         real_t & operator[]( const uint_t f )       { return pdfs_[f]; }
+   const real_t & operator[]( const uint_t f ) const { return pdfs_[f]; }
+
+   void store() const
+   {
+      for( auto d = Stencil::begin(); d != Stencil::end(); ++d )
+      {
+         if( EvenTimeStep )
+            field_->get( x_, y_, z_, d.toInvIdx() ) = pdfs_[ d.toIdx() ];
+         else
+            field_->get( x_ + d.cx(), y_ + d.cy(), z_ + d.cz(), d.toIdx() ) = pdfs_[ d.toIdx() ];
+      }
+   }
+
+private:
+
+   PdfField_T * const field_;
+   const cell_idx_t x_;
+   const cell_idx_t y_;
+   const cell_idx_t z_;
+
+   real_t pdfs_[ Stencil::Size ];
+};
+
+} // namespace internal
+
+
+
+//**********************************************************************************************************************
+/*!
+*   \brief Stream & collide sweep for the LBM that works in-place on one single PDF field (AA pattern)
+*
+*   In contrast to all other LBM sweeps, no temporary PDF field is required: memory consumption for the PDF data is
+*   halved and less data is transferred per lattice cell update. Even and odd time steps alternate:
+*   - even time step: the PDFs of a cell are read from the cell itself, collided, and written back to the same cell
+*                     into the slots of the inverse directions.
+*   - odd time step: the PDFs are read from the neighboring cells (slots of the inverse directions), collided,
+*                    and written to the neighboring cells (slots of their own directions).
+*   After an odd time step, the PDF field again is in the same (natural) state as after a time step of any other sweep.
+*
+*   The parity of the time step is shared with the AAPdfFieldPackInfo by means of an AATimeStepTracker that must be
+*   advanced after the communication:
+*
+*   \code
+*   auto tracker = make_shared< lbm::AATimeStepTracker >();
+*
+*   blockforest::communication::UniformBufferedScheme< LatticeModel_T::CommunicationStencil > communication( blocks );
+*   communication.addPackInfo( make_shared< lbm::AAPdfFieldPackInfo< LatticeModel_T > >( pdfFieldId, tracker ) );
+*
+*   timeloop.add() << Sweep( makeSharedSweep( lbm::makeAASweep< LatticeModel_T >( pdfFieldId, tracker ) ), "LB stream & collide (AA)" )
+*                  << AfterFunction( communication, "communication" )
+*                  << AfterFunction( makeSharedFunctor( tracker ), "AA time step tracker" );
+*   \endcode
+*
+*   The collision is performed by a cell operation (default: DefaultCellOperation), so all lattice models supported
+*   by DefaultCellOperation are available.
+*
+*   \warning Macroscopic values (density, velocity, ...) can only be evaluated after odd time steps, i.e. whenever
+*            tracker->isEvenTimeStep() returns true. Boundary handling (lbm/boundary) works on the natural PDF layout
+*            and is not supported: the AA sweep is meant for periodic domains or domains that are closed by
+*            communication.
+*/
+//**********************************************************************************************************************
+
+template< typename LatticeModel_T, typename CellOperation_T = DefaultCellOperation< LatticeModel_T > >
+class AASweep
+{
+public:
+
+   typedef PdfField< LatticeModel_T > PdfField_T;
+
+   AASweep( const BlockDataID & pdfField, const shared_ptr< AATimeStepTracker > & tracker,
+            const CellOperation_T & op = CellOperation_T() ) :
+      pdfField_( pdfField ), tracker_( tracker ), cellOperation_( op )
+   {
+      WALBERLA_ASSERT_NOT_NULLPTR( tracker_ );
+   }
+
+   const CellOperation_T & getCellOperation() const { return cellOperation_; }
+         CellOperation_T & getCellOperation()       { return cellOperation_; }
+
+   void operator()( IBlock * const block );
+
+private:
+
+   template< bool EvenTimeStep >
+   void streamCollide( PdfField_T * const pdfField ) const;
+
+
+
+   const BlockDataID pdfField_;
+   shared_ptr< AATimeStepTracker > tracker_;
+
+   CellOperation_T cellOperation_;
+};
+
+
+
+template< typename LatticeModel_T, typename CellOperation_T >
+void AASweep< LatticeModel_T, CellOperation_T >::operator()( IBlock * const block )
+{
+   PdfField_T * pdfField = block->getData< PdfField_T >( pdfField_ );
+
+   WALBERLA_ASSERT_NOT_NULLPTR( pdfField );
+   WALBERLA_ASSERT_GREATER_EQUAL( pdfField->nrOfGhostLayers(), 1 );
+
+   cellOperation_.configure( pdfField->latticeModel() );
+
+   if( tracker_->isEvenTimeStep() )
+      streamCollide< true >( pdfField );
+   else
+      streamCollide< false >( pdfField );
+}
+
+
+
+template< typename LatticeModel_T, typename CellOperation_T >
+template< bool EvenTimeStep >
+void AASweep< LatticeModel_T, CellOperation_T >::streamCollide( PdfField_T * const pdfField ) const
+{
+   typedef internal::AACellAccessor< PdfField_T, EvenTimeStep > Accessor_T;
+
+   // During odd time steps, cell (x,y,z) reads PDF i from (x,y,z)-c_i and writes PDF i to (x,y,z)+c_i. No PDF slot
+   // is accessed by two different cells, so all cells can be processed in parallel.
+
+   WALBERLA_FOR_ALL_CELLS_XYZ( pdfField,
+      Accessor_T src( pdfField, x, y, z );
+      Accessor_T dst( pdfField, x, y, z );
+      cellOperation_( src, dst );
+      dst.store();
+   )
+}
+
+
+
+///////////////////////////////
+// makeAASweep FUNCTIONS     //
+///////////////////////////////
+
+template< typename LatticeModel_T >
+shared_ptr< AASweep< LatticeModel_T > >
+makeAASweep( const BlockDataID & pdfFieldId, const shared_ptr< AATimeStepTracker > & tracker )
+{
+   return make_shared< AASweep< LatticeModel_T > >( pdfFieldId, tracker );
+}
+
+template< typename LatticeModel_T, typename CellOperation_T >
+shared_ptr< AASweep< LatticeModel_T, CellOperation_T > >
+makeAASweep( const BlockDataID & pdfFieldId, const shared_ptr< AATimeStepTracker > & tracker, const CellOperation_T & op )
+{
+   return make_shared< AASweep< LatticeModel_T, CellOperation_T > >( pdfFieldId, tracker, op );
+}
+
+
+
+} // namespace lbm
+} // namespace walberla
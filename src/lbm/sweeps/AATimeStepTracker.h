@@ -0,0 +1,54 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file AATimeStepTracker.h
+//! \ingroup lbm
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "core/DataTypes.h"
+
+
+namespace walberla {
+namespace lbm {
+
+
+
+/// Keeps track of whether the current time step of the in-place AA streaming scheme is an even or an odd one.
+/// One instance must be shared by the AASweep and the AAPdfFieldPackInfo of a PDF field. The tracker must be
+/// advanced (operator()) once per time step, after the sweep and the communication have been executed (see AASweep).
+class AATimeStepTracker
+{
+public:
+
+   AATimeStepTracker( const uint_t initialTimeStep = uint_t(0) ) : timeStep_( initialTimeStep ) {}
+
+   void operator()() { ++timeStep_; }
+
+   bool isEvenTimeStep() const { return ( timeStep_ & uint_t(1) ) == uint_t(0); }
+
+   uint_t getTimeStep() const { return timeStep_; }
+
+private:
+
+   uint_t timeStep_;
+};
+
+
+
+} // namespace lbm
+} // namespace walberla
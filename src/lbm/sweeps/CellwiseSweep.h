@@ -21,6 +21,8 @@
 
 #pragma once
 
+#include "InnerOuterSplit.h"
+
 
 
 namespace walberla {
@@ -76,6 +78,10 @@ namespace lbm {
 *
 *   Note that the shared pointer returned by all 'makeCellwiseSweep' functions can be captured by a SharedSweep
 *   for immediate registration at a time loop (see domain_decomposition::makeSharedSweep).
+*
+*   Besides the usual 'operator()', the sweep offers 'streamCollideInner' and 'streamCollideOuter' which together
+*   perform one stream & collide step for all interior cells of a block. Only the latter accesses the ghost layers.
+*   They are used by lbm::InnerOuterSplitTimeStep for overlapping the ghost layer exchange with the computation.
 */
 //**********************************************************************************************************************
 
@@ -129,10 +135,53 @@ class CellwiseSweep
          streamCollide( block, numberOfGhostLayersToInclude ); \
       } \
       \
-      void streamCollide( IBlock * const block, const uint_t numberOfGhostLayersToInclude = uint_t(0) ); \
+      void streamCollide( IBlock * const block, const uint_t numberOfGhostLayersToInclude = uint_t(0) ) \
+      { \
+         PdfField_T * src( NULL ); \
+         PdfField_T * dst( NULL ); \
+         this->getFields( block, src, dst ); \
+         \
+         WALBERLA_ASSERT_GREATER( src->nrOfGhostLayers(), numberOfGhostLayersToInclude ); \
+         WALBERLA_ASSERT_GREATER_EQUAL( dst->nrOfGhostLayers(), numberOfGhostLayersToInclude ); \
+         \
+         CellInterval cells = src->xyzSize(); \
+         cells.expand( cell_idx_c( numberOfGhostLayersToInclude ) ); \
+         streamCollide( block, src, dst, cells ); \
+         \
+         src->swapDataPointers( dst ); \
+      } \
+      \
+      /* stream & collide split into two calls for hiding the communication (see InnerOuterSplitTimeStep): */ \
+      /* streamCollideInner only processes interior cells that do not access the ghost layers during streaming, */ \
+      /* streamCollideOuter processes all remaining interior cells and swaps the src and dst field afterwards */ \
+      void streamCollideInner( IBlock * const block ) \
+      { \
+         PdfField_T * src = this->getSrcField( block ); \
+         PdfField_T * dst = this->getBlockLocalDstField( block, src ); \
+         \
+         const CellInterval inner = getInnerInterval< Stencil_T >( src->xyzSize() ); \
+         if( !inner.empty() ) \
+            streamCollide( block, src, dst, inner ); \
+      } \
+      \
+      void streamCollideOuter( IBlock * const block ) \
+      { \
+         PdfField_T * src = this->getSrcField( block ); \
+         PdfField_T * dst = this->getBlockLocalDstField( block, src ); \
+         \
+         const std::vector< CellInterval > outer = getOuterIntervals< Stencil_T >( src->xyzSize() ); \
+         for( auto cells = outer.begin(); cells != outer.end(); ++cells ) \
+            streamCollide( block, src, dst, *cells ); \
+         \
+         src->swapDataPointers( dst ); \
+      } \
       \
       void stream ( IBlock * const block, const uint_t numberOfGhostLayersToInclude = uint_t(0) ); \
       void collide( IBlock * const block, const uint_t numberOfGhostLayersToInclude = uint_t(0) ); \
+      \
+   private: \
+      \
+      void streamCollide( IBlock * const block, PdfField_T * const src, PdfField_T * const dst, const CellInterval & cells ); \
    }; \
    \
    template< typename LatticeModel_T, typename Filter_T, typename DensityVelocityIn_T, typename DensityVelocityOut_T > \
@@ -150,15 +199,10 @@ class CellwiseSweep
 #define WALBERLA_LBM_CELLWISE_SWEEP_STREAM_COLLIDE_HEAD( specialization) \
    template< typename LatticeModel_T, typename Filter_T, typename DensityVelocityIn_T, typename DensityVelocityOut_T > \
    void CellwiseSweep< LatticeModel_T, Filter_T, DensityVelocityIn_T, DensityVelocityOut_T, typename boost::enable_if< specialization >::type \
-      >::streamCollide( IBlock * const block, const uint_t numberOfGhostLayersToInclude ) \
+      >::streamCollide( IBlock * const block, PdfField_T * const src, PdfField_T * const dst, const CellInterval & cells ) \
    { \
-      PdfField_T * src( NULL ); \
-      PdfField_T * dst( NULL ); \
-      \
-      this->getFields( block, src, dst ); \
-      \
-      WALBERLA_ASSERT_GREATER( src->nrOfGhostLayers(), numberOfGhostLayersToInclude ); \
-      WALBERLA_ASSERT_GREATER_EQUAL( dst->nrOfGhostLayers(), numberOfGhostLayersToInclude ); \
+      WALBERLA_ASSERT_NOT_NULLPTR( src ); \
+      WALBERLA_ASSERT_NOT_NULLPTR( dst ); \
       \
       const auto & lm = src->latticeModel(); \
       dst->resetLatticeModel( lm ); /* required so that member functions for getting density and equilibrium velocity can be called for dst! */ \
@@ -167,7 +211,7 @@ class CellwiseSweep
       this->densityVelocityIn( *block ); \
       this->densityVelocityOut( *block );
 
-#define WALBERLA_LBM_CELLWISE_SWEEP_STREAM_COLLIDE_FOOT() src->swapDataPointers( dst ); }
+#define WALBERLA_LBM_CELLWISE_SWEEP_STREAM_COLLIDE_FOOT() }
 
 
 
@@ -0,0 +1,123 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file FusedBoundaryHandling.h
+//! \ingroup lbm
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "core/DataTypes.h"
+#include "core/cell/Cell.h"
+#include "core/debug/Debug.h"
+#include "domain_decomposition/BlockDataID.h"
+#include "domain_decomposition/IBlock.h"
+
+
+namespace walberla {
+namespace lbm {
+
+
+
+//**********************************************************************************************************************
+/*!
+*   \brief Interface for treating the boundary conditions of a block from within a stream & collide sweep
+*
+*   Usually, the boundary handling is executed as a separate sweep right before the LBM sweep, which means that the
+*   PDF field is traversed twice per time step. If a FusedBoundaryHandling is registered at a sweep that supports it
+*   (currently: the D3Q19 SRT and TRT implementations of lbm::SplitSweep), the sweep calls treatRow(y,z) right before
+*   it performs stream & collide for row (x-line) (y,z). Only the boundary links of this very row are treated - and
+*   exactly these links are read by the pull streaming of the row. Hence, the boundary values are still in cache when
+*   the sweep reads them and the separate boundary sweep must be removed from the time loop:
+*
+*   \code
+*   auto sweep = make_shared< lbm::SplitSweep< LatticeModel_T, FlagField_T > >( pdfFieldId, flagFieldId, Fluid_Flag );
+*   sweep->setFusedBoundaryHandling( lbm::makeFusedBoundaryHandling< BoundaryHandling_T >( boundaryHandlingId ) );
+*
+*   timeloop.add() << BeforeFunction( communication, "communication" )
+*                  << Sweep( makeSharedSweep( sweep ), "LB stream & collide (fused boundary handling)" );
+*   \endcode
+*
+*   Just like the boundary sweep, the fused treatment only considers boundary links of interior cells.
+*   beforeSweep() and afterSweep() are called once per block, treatRow() may be called concurrently from multiple
+*   threads for different rows.
+*/
+//**********************************************************************************************************************
+
+class FusedBoundaryHandling
+{
+public:
+
+   virtual ~FusedBoundaryHandling() {}
+
+   virtual void beforeSweep( IBlock * const block ) = 0;
+   virtual void treatRow( const cell_idx_t y, const cell_idx_t z ) = 0;
+   virtual void afterSweep() = 0;
+};
+
+
+
+/// Implementation of the FusedBoundaryHandling interface for boundary handlings of type ::walberla::BoundaryHandling
+/// (see boundary/BoundaryHandling.h) that are stored as block data. Blocks must be processed one after another.
+template< typename BoundaryHandling_T >
+class FusedBoundaryHandlingWrapper : public FusedBoundaryHandling
+{
+public:
+
+   FusedBoundaryHandlingWrapper( const BlockDataID & boundaryHandlingId ) : boundaryHandlingId_( boundaryHandlingId ), handling_( NULL ) {}
+
+   virtual ~FusedBoundaryHandlingWrapper() {}
+
+   void beforeSweep( IBlock * const block )
+   {
+      WALBERLA_ASSERT_NULLPTR( handling_ );
+      handling_ = block->getData< BoundaryHandling_T >( boundaryHandlingId_ );
+      WALBERLA_ASSERT_NOT_NULLPTR( handling_ );
+      handling_->beforeRowWiseTreatment();
+   }
+
+   void treatRow( const cell_idx_t y, const cell_idx_t z )
+   {
+      WALBERLA_ASSERT_NOT_NULLPTR( handling_ );
+      handling_->treatRow( y, z );
+   }
+
+   void afterSweep()
+   {
+      WALBERLA_ASSERT_NOT_NULLPTR( handling_ );
+      handling_->afterRowWiseTreatment();
+      handling_ = NULL;
+   }
+
+private:
+
+   const BlockDataID boundaryHandlingId_;
+
+   BoundaryHandling_T * handling_;
+};
+
+
+
+template< typename BoundaryHandling_T >
+shared_ptr< FusedBoundaryHandling > makeFusedBoundaryHandling( const BlockDataID & boundaryHandlingId )
+{
+   return make_shared< FusedBoundaryHandlingWrapper< BoundaryHandling_T > >( boundaryHandlingId );
+}
+
+
+
+} // namespace lbm
+} // namespace walberla
@@ -0,0 +1,238 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file InnerOuterSplit.h
+//! \ingroup lbm
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "core/DataTypes.h"
+#include "core/cell/CellInterval.h"
+#include "core/debug/CheckFunctions.h"
+#include "core/debug/Debug.h"
+#include "core/selectable/IsSetSelected.h"
+#include "core/uid/SUID.h"
+
+#include "domain_decomposition/BlockDataID.h"
+#include "domain_decomposition/IBlock.h"
+#include "domain_decomposition/StructuredBlockStorage.h"
+
+#include <functional>
+#include <vector>
+
+
+namespace walberla {
+namespace lbm {
+
+
+
+/// Returns all cells of 'interior' (= the cells of a block without ghost layers) that can be streamed without accessing
+/// the ghost layers, i.e., 'interior' shrunk by one cell in every dimension of the stencil. The result may be empty.
+template< typename Stencil_T >
+CellInterval getInnerInterval( const CellInterval & interior )
+{
+   CellInterval inner( interior );
+   inner.xMin() += cell_idx_t(1);
+   inner.xMax() -= cell_idx_t(1);
+   inner.yMin() += cell_idx_t(1);
+   inner.yMax() -= cell_idx_t(1);
+   if( Stencil_T::D == uint_t(3) )
+   {
+      inner.zMin() += cell_idx_t(1);
+      inner.zMax() -= cell_idx_t(1);
+   }
+   return inner;
+}
+
+
+
+/// Returns a set of disjoint, non-empty cell intervals that together cover 'interior' without the cells of
+/// getInnerInterval( interior ) - these are the cells that depend on ghost layer data during streaming.
+template< typename Stencil_T >
+std::vector< CellInterval > getOuterIntervals( const CellInterval & interior )
+{
+   std::vector< CellInterval > outer;
+
+   const CellInterval inner = getInnerInterval< Stencil_T >( interior );
+   if( inner.empty() )
+   {
+      if( !interior.empty() )
+         outer.push_back( interior );
+      return outer;
+   }
+
+   if( Stencil_T::D == uint_t(3) )
+   {
+      outer.push_back( CellInterval( interior.xMin(), interior.yMin(), interior.zMin(), interior.xMax(), interior.yMax(), interior.zMin() ) );
+      outer.push_back( CellInterval( interior.xMin(), interior.yMin(), interior.zMax(), interior.xMax(), interior.yMax(), interior.zMax() ) );
+   }
+
+   outer.push_back( CellInterval( interior.xMin(), interior.yMin(), inner.zMin(), interior.xMax(), interior.yMin(), inner.zMax() ) );
+   outer.push_back( CellInterval( interior.xMin(), interior.yMax(), inner.zMin(), interior.xMax(), interior.yMax(), inner.zMax() ) );
+
+   outer.push_back( CellInterval( interior.xMin(), inner.yMin(), inner.zMin(), interior.xMin(), inner.yMax(), inner.zMax() ) );
+   outer.push_back( CellInterval( interior.xMax(), inner.yMin(), inner.zMin(), interior.xMax(), inner.yMax(), inner.zMax() ) );
+
+   return outer;
+}
+
+
+
+//**********************************************************************************************************************
+/*!
+*   \brief Time step for uniform grids that overlaps the ghost layer exchange with the stream & collide sweep
+*
+*   Executing the communication, the boundary handling, and the sweep one after another leaves the processes idle while
+*   waiting for the ghost layer data of their neighbors. This time step hides the communication behind the computation
+*   of all cells that do not depend on ghost layer data:
+*
+*   1. communication->startCommunication()
+*   2. for all blocks: boundary handling + stream & collide of the inner cells ( sweep->streamCollideInner( block ) )
+*   3. communication->wait()
+*   4. for all blocks: boundary handling + stream & collide of the remaining cells ( sweep->streamCollideOuter( block ) )
+*
+*   The sweep must provide streamCollideInner/streamCollideOuter (e.g., lbm::CellwiseSweep) and a Stencil_T typedef.
+*   The communication scheme must provide startCommunication/wait (e.g., blockforest::communication::UniformBufferedScheme).
+*   Boundary handlings registered via addBoundaryHandling are treated region-wise (see BoundaryHandling::operator()( CellInterval )),
+*   hence boundary conditions that need the complete PDF field in beforeBoundaryTreatment() must not be used.
+*
+*   \code
+*   auto timeStep = make_shared< lbm::InnerOuterSplitTimeStep< Sweep_T, Communication_T > >( blocks, communication, sweep );
+*   timeStep->addBoundaryHandling< BoundaryHandling_T >( boundaryHandlingId );
+*   timeloop.addFuncAfterTimeStep( makeSharedFunctor( timeStep ), "LB time step (communication hiding)" );
+*   \endcode
+*/
+//**********************************************************************************************************************
+
+template< typename Sweep_T, typename Communication_T >
+class InnerOuterSplitTimeStep
+{
+public:
+
+   typedef typename Sweep_T::Stencil_T Stencil_T;
+
+   typedef std::function< void ( IBlock * ) > BlockFunction;
+
+private:
+
+   template< typename BoundaryHandling_T >
+   class InnerBoundaryTreatment
+   {
+   public:
+      InnerBoundaryTreatment( const BlockDataID & handlingId ) : handlingId_( handlingId ) {}
+      void operator()( IBlock * block )
+      {
+         BoundaryHandling_T * handling = block->getData< BoundaryHandling_T >( handlingId_ );
+         WALBERLA_ASSERT_NOT_NULLPTR( handling );
+         handling->beforeBoundaryTreatment();
+         (*handling)( getInnerInterval< Stencil_T >( handling->getFlagField()->xyzSize() ) );
+      }
+   private:
+      BlockDataID handlingId_;
+   };
+
+   template< typename BoundaryHandling_T >
+   class OuterBoundaryTreatment
+   {
+   public:
+      OuterBoundaryTreatment( const BlockDataID & handlingId ) : handlingId_( handlingId ) {}
+      void operator()( IBlock * block )
+      {
+         BoundaryHandling_T * handling = block->getData< BoundaryHandling_T >( handlingId_ );
+         WALBERLA_ASSERT_NOT_NULLPTR( handling );
+         const std::vector< CellInterval > outer = getOuterIntervals< Stencil_T >( handling->getFlagField()->xyzSize() );
+         for( auto cells = outer.begin(); cells != outer.end(); ++cells )
+            (*handling)( *cells );
+         handling->afterBoundaryTreatment();
+      }
+   private:
+      BlockDataID handlingId_;
+   };
+
+public:
+
+   InnerOuterSplitTimeStep( const weak_ptr< StructuredBlockStorage > & blocks, const shared_ptr< Communication_T > & communication,
+                            const shared_ptr< Sweep_T > & sweep,
+                            const Set<SUID> & requiredBlockSelectors = Set<SUID>::emptySet(),
+                            const Set<SUID> & incompatibleBlockSelectors = Set<SUID>::emptySet() ) :
+      blocks_( blocks ), communication_( communication ), sweep_( sweep ),
+      requiredBlockSelectors_( requiredBlockSelectors ), incompatibleBlockSelectors_( incompatibleBlockSelectors )
+   {}
+
+   /// Boundary handlings are executed (in the order of registration) right before the sweep processes the same region.
+   template< typename BoundaryHandling_T >
+   void addBoundaryHandling( const BlockDataID & boundaryHandlingId )
+   {
+      innerFunctions_.push_back( InnerBoundaryTreatment< BoundaryHandling_T >( boundaryHandlingId ) );
+      outerFunctions_.push_back( OuterBoundaryTreatment< BoundaryHandling_T >( boundaryHandlingId ) );
+   }
+
+   void operator()()
+   {
+      auto blocks = blocks_.lock();
+      WALBERLA_CHECK_NOT_NULLPTR( blocks, "Trying to access 'InnerOuterSplitTimeStep' for a block storage object that doesn't exist anymore" );
+
+      communication_->startCommunication();
+
+      for( auto block = blocks->begin( requiredBlockSelectors_, incompatibleBlockSelectors_ ); block != blocks->end(); ++block )
+      {
+         for( auto function = innerFunctions_.begin(); function != innerFunctions_.end(); ++function )
+            (*function)( block.get() );
+         sweep_->streamCollideInner( block.get() );
+      }
+
+      communication_->wait();
+
+      for( auto block = blocks->begin( requiredBlockSelectors_, incompatibleBlockSelectors_ ); block != blocks->end(); ++block )
+      {
+         for( auto function = outerFunctions_.begin(); function != outerFunctions_.end(); ++function )
+            (*function)( block.get() );
+         sweep_->streamCollideOuter( block.get() );
+      }
+   }
+
+private:
+
+   weak_ptr< StructuredBlockStorage > blocks_;
+
+   shared_ptr< Communication_T > communication_;
+   shared_ptr< Sweep_T > sweep_;
+
+   std::vector< BlockFunction > innerFunctions_;
+   std::vector< BlockFunction > outerFunctions_;
+
+   Set<SUID> requiredBlockSelectors_;
+   Set<SUID> incompatibleBlockSelectors_;
+};
+
+
+
+template< typename Sweep_T, typename Communication_T >
+shared_ptr< InnerOuterSplitTimeStep< Sweep_T, Communication_T > >
+makeInnerOuterSplitTimeStep( const weak_ptr< StructuredBlockStorage > & blocks, const shared_ptr< Communication_T > & communication,
+                             const shared_ptr< Sweep_T > & sweep,
+                             const Set<SUID> & requiredBlockSelectors = Set<SUID>::emptySet(),
+                             const Set<SUID> & incompatibleBlockSelectors = Set<SUID>::emptySet() )
+{
+   typedef InnerOuterSplitTimeStep< Sweep_T, Communication_T > TS_T;
+   return shared_ptr< TS_T >( new TS_T( blocks, communication, sweep, requiredBlockSelectors, incompatibleBlockSelectors ) );
+}
+
+
+
+} // namespace lbm
+} // namespace walberla
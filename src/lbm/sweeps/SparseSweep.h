@@ -0,0 +1,342 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file SparseSweep.h
+//! \ingroup lbm
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "lbm/sweeps/FlagFieldSweepBase.h"
+#include "lbm/sweeps/cell_operations/DefaultCellOperation.h"
+
+#include "core/OpenMP.h"
+#include "core/debug/Debug.h"
+#include "stencil/Directions.h"
+
+#include <boost/type_traits/is_same.hpp>
+
+#include <map>
+#include <vector>
+
+
+namespace walberla {
+namespace lbm {
+
+
+
+namespace internal {
+
+/// Compact list of all cells of one block that are processed by the SparseSweep.
+/// All offsets are given relative to the address of PDF component 0 of cell (0,0,0).
+struct SparseCellList
+{
+   uint_t size() const { return offsets.size(); }
+
+   std::vector< cell_idx_t > offsets;     ///< offset of PDF component 0 of every cell
+   std::vector< cell_idx_t > coordinates; ///< x, y, and z coordinate of every cell
+   std::vector< cell_idx_t > pull;        ///< Stencil::Size offsets per cell: where to pull PDF component f from
+};
+
+
+
+/// Gives cell operations (see DefaultCellOperation) access to one cell of a SparseCellList.
+/// 'neighbor' reads from the source field at the precomputed pull offsets, operator[] addresses the destination field.
+template< typename LatticeModel_T >
+class SparseCellAccessor
+{
+public:
+
+   typedef typename LatticeModel_T::Stencil Stencil;
+
+   SparseCellAccessor( const real_t * const src, real_t * const dst, const cell_idx_t fStride,
+                       const cell_idx_t offset, const cell_idx_t * const pull, const cell_idx_t * const coordinates ) :
+      src_( src ), dst_( dst + offset ), fStride_( fStride ), pull_( pull ), coordinates_( coordinates ) {}
+
+   cell_idx_t x() const { return coordinates_[0]; }
+   cell_idx_t y() const { return coordinates_[1]; }
+   cell_idx_t z() const { return coordinates_[2]; }
+
+   real_t neighbor( const cell_idx_t cx, const cell_idx_t cy, const cell_idx_t cz, const uint_t f ) const
+   {
+      WALBERLA_ASSERT_EQUAL( cx, -cell_idx_c( stencil::cx[ Stencil::dir[f] ] ) );
+      WALBERLA_ASSERT_EQUAL( cy, -cell_idx_c( stencil::cy[ Stencil::dir[f] ] ) );
+      WALBERLA_ASSERT_EQUAL( cz, -cell_idx_c( stencil::cz[ Stencil::dir[f] ] ) );
+      WALBERLA_UNUSED( cx ); WALBERLA_UNUSED( cy ); WALBERLA_UNUSED( cz );
+      return src_[ pull_[f] ];
+   }
+
+   real_t neighbor( const stencil::Direction d, const uint_t f ) const
+   {
+      WALBERLA_ASSERT_EQUAL( d, stencil::inverseDir[ Stencil::dir[f] ] );
+      WALBERLA_UNUSED( d );
+      return src_[ pull_[f] ];
+   }
+
+         real_t & operator[]( const uint_t f )       { return dst_[ cell_idx_c(f) * fStride_ ]; }
+   const real_t & operator[]( const uint_t f ) const { return dst_[ cell_idx_c(f) * fStride_ ]; }
+
+private:
+
+   const real_t * const src_;
+         real_t * const dst_;
+   const cell_idx_t fStride_;
+
+   const cell_idx_t * const pull_;
+   const cell_idx_t * const coordinates_;
+};
+
+} // namespace internal
+
+
+
+//**********************************************************************************************************************
+/*!
+*   \brief Stream & collide sweep for the LBM that only iterates a precomputed list of fluid cells
+*
+*   For domains in which most cells are not fluid cells (porous media, packed beds, ...), iterating the entire block
+*   and checking the flag field for every cell (see CellwiseSweep, SplitSweep) wastes most of the memory bandwidth.
+*   This sweep extracts all cells that are marked with a flag of the LBM mask into a compact list once for every
+*   block. For every cell in this list, the offsets of all PDF values that are pulled during streaming are
+*   precomputed, so that the time step is performed without any flag field access and without any branching.
+*
+*   If a set of bounce back flags is specified, pulling from a cell marked with one of these flags is replaced by
+*   reading the inverse PDF of the cell itself. This is identical to the NoSlip boundary condition of the
+*   BoundaryHandling, which thus does not have to be executed for these flags anymore. All other boundary conditions
+*   must still be treated by the BoundaryHandling before the sweep is executed.
+*
+*   The PDF field is stored densely, so the SparseSweep can be combined with everything else that works on PDF fields
+*   (boundary handling, VTK output, ...). For communication, a SparsePdfFieldPackInfo which only sends the PDFs of
+*   fluid cells is the natural choice:
+*
+*   \code
+*   blockforest::communication::UniformBufferedScheme< LatticeModel_T::CommunicationStencil > communication( blocks );
+*   communication.addPackInfo( make_shared< lbm::SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T > >( pdfFieldId, flagFieldId, fluid, true ) );
+*
+*   auto sweep = lbm::makeSparseSweep< LatticeModel_T, FlagField_T >( pdfFieldId, flagFieldId, fluid, noSlip );
+*   timeloop.add() << BeforeFunction( communication, "communication" )
+*                  << Sweep( makeSharedSweep( sweep ), "LB stream & collide (sparse)" );
+*   \endcode
+*
+*   The cell lists are built the first time the sweep is executed on a block. Whenever the flag field is changed
+*   (geometry change) or the block structure is changed (refinement, load balancing), 'invalidate' must be called
+*   so that the lists are rebuilt.
+*
+*   The flag field must have at least one ghost layer and the flags in the ghost layer must be valid.
+*   The collision is performed by a cell operation (default: DefaultCellOperation).
+*/
+//**********************************************************************************************************************
+
+template< typename LatticeModel_T, typename FlagField_T, typename CellOperation_T = DefaultCellOperation< LatticeModel_T > >
+class SparseSweep : FlagFieldSweepBase< LatticeModel_T, FlagField_T >
+{
+public:
+
+   typedef typename FlagFieldSweepBase< LatticeModel_T, FlagField_T >::PdfField_T PdfField_T;
+   typedef typename FlagFieldSweepBase< LatticeModel_T, FlagField_T >::flag_t     flag_t;
+   typedef typename LatticeModel_T::Stencil                                         Stencil;
+
+   static_assert( (boost::is_same< typename PdfStorage< LatticeModel_T >::type, real_t >::value), "Only works with PDFs stored as real_t (not with lbm::MixedPrecision)!" );
+
+   // block has NO dst pdf field
+   SparseSweep( const BlockDataID & pdfField, const ConstBlockDataID & flagField, const Set< FlagUID > & lbmMask,
+                const Set< FlagUID > & bounceBackMask = Set< FlagUID >::emptySet(), const CellOperation_T & op = CellOperation_T() ) :
+      FlagFieldSweepBase< LatticeModel_T, FlagField_T >( pdfField, flagField, lbmMask ), bounceBackMask_( bounceBackMask ), cellOperation_( op ) {}
+
+   // every block has a dedicated dst pdf field
+   SparseSweep( const BlockDataID & src, const BlockDataID & dst, const ConstBlockDataID & flagField, const Set< FlagUID > & lbmMask,
+                const Set< FlagUID > & bounceBackMask = Set< FlagUID >::emptySet(), const CellOperation_T & op = CellOperation_T() ) :
+      FlagFieldSweepBase< LatticeModel_T, FlagField_T >( src, dst, flagField, lbmMask ), bounceBackMask_( bounceBackMask ), cellOperation_( op ) {}
+
+   virtual ~SparseSweep() {}
+
+   const CellOperation_T & getCellOperation() const { return cellOperation_; }
+         CellOperation_T & getCellOperation()       { return cellOperation_; }
+
+   /// Discards the cell lists of all blocks, they are rebuilt the next time the sweep is executed
+   void invalidate() { cellLists_.clear(); }
+   /// Discards the cell list of one block, it is rebuilt the next time the sweep is executed on this block
+   void invalidate( const IBlock * const block ) { cellLists_.erase( block ); }
+
+   /// Returns the number of cells that are processed on 'block' (0 if the cell list is not yet built)
+   uint_t numberOfCells( const IBlock * const block ) const
+   {
+      auto list = cellLists_.find( block );
+      return ( list != cellLists_.end() ) ? list->second.size() : uint_t(0);
+   }
+
+   void operator()( IBlock * const block );
+
+private:
+
+   void buildCellList( internal::SparseCellList & list, const PdfField_T * const pdfField, const FlagField_T * const flagField,
+                       const flag_t lbm ) const;
+
+
+
+   const Set< FlagUID > bounceBackMask_;
+
+   CellOperation_T cellOperation_;
+
+   std::map< const IBlock *, internal::SparseCellList > cellLists_;
+};
+
+
+
+template< typename LatticeModel_T, typename FlagField_T, typename CellOperation_T >
+void SparseSweep< LatticeModel_T, FlagField_T, CellOperation_T >::operator()( IBlock * const block )
+{
+   PdfField_T * src( NULL );
+   PdfField_T * dst( NULL );
+   const FlagField_T * flagField( NULL );
+
+   auto lbm = this->getLbmMaskAndFields( block, src, dst, flagField );
+
+   WALBERLA_ASSERT_NOT_NULLPTR( src );
+   WALBERLA_ASSERT_NOT_NULLPTR( dst );
+   WALBERLA_ASSERT_NOT_NULLPTR( flagField );
+
+   WALBERLA_ASSERT_GREATER_EQUAL( src->nrOfGhostLayers(), 1 );
+   WALBERLA_ASSERT_GREATER_EQUAL( flagField->nrOfGhostLayers(), 1 );
+
+   // both fields must share the same memory layout, since the same offsets are used for src and dst
+   WALBERLA_ASSERT_EQUAL( src->xStride(), dst->xStride() );
+   WALBERLA_ASSERT_EQUAL( src->yStride(), dst->yStride() );
+   WALBERLA_ASSERT_EQUAL( src->zStride(), dst->zStride() );
+   WALBERLA_ASSERT_EQUAL( src->fStride(), dst->fStride() );
+
+   auto list = cellLists_.find( block );
+   if( list == cellLists_.end() )
+   {
+      list = cellLists_.insert( std::make_pair( block, internal::SparseCellList() ) ).first;
+      buildCellList( list->second, src, flagField, lbm );
+   }
+   const internal::SparseCellList & cells = list->second;
+
+   // execute stream & collide kernels
+
+   const auto & lm = src->latticeModel();
+   dst->resetLatticeModel( lm ); /* required so that member functions for getting density and equilibrium velocity can be called for dst! */
+
+   cellOperation_.configure( lm );
+
+   const real_t * const srcBase = &( src->get( cell_idx_t(0), cell_idx_t(0), cell_idx_t(0), uint_t(0) ) );
+         real_t * const dstBase = &( dst->get( cell_idx_t(0), cell_idx_t(0), cell_idx_t(0), uint_t(0) ) );
+
+   const cell_idx_t fStride = src->fStride();
+
+   const int numberOfCells = int_c( cells.size() );
+
+#ifdef _OPENMP
+   #pragma omp parallel for schedule(static)
+#endif
+   for( int i = 0; i < numberOfCells; ++i )
+   {
+      const uint_t cell = uint_c(i);
+      internal::SparseCellAccessor< LatticeModel_T > accessor( srcBase, dstBase, fStride, cells.offsets[ cell ],
+                                                               &( cells.pull[ cell * Stencil::Size ] ), &( cells.coordinates[ cell * uint_t(3) ] ) );
+      cellOperation_( accessor, accessor );
+   }
+
+   src->swapDataPointers( dst );
+}
+
+
+
+template< typename LatticeModel_T, typename FlagField_T, typename CellOperation_T >
+void SparseSweep< LatticeModel_T, FlagField_T, CellOperation_T >::buildCellList( internal::SparseCellList & list, const PdfField_T * const pdfField,
+                                                                                 const FlagField_T * const flagField, const flag_t lbm ) const
+{
+   const flag_t bounceBack = bounceBackMask_.empty() ? flag_t(0) : flagField->getMask( bounceBackMask_ );
+
+   const real_t * const base = &( pdfField->get( cell_idx_t(0), cell_idx_t(0), cell_idx_t(0), uint_t(0) ) );
+
+   auto offset = [ pdfField, base ]( const cell_idx_t x, const cell_idx_t y, const cell_idx_t z, const uint_t f )
+   {
+      return cell_idx_c( &( pdfField->get( x, y, z, f ) ) - base );
+   };
+
+   list.offsets.clear();
+   list.coordinates.clear();
+   list.pull.clear();
+
+   const cell_idx_t xSize = cell_idx_c( pdfField->xSize() );
+   const cell_idx_t ySize = cell_idx_c( pdfField->ySize() );
+   const cell_idx_t zSize = cell_idx_c( pdfField->zSize() );
+
+   for( cell_idx_t z = 0; z < zSize; ++z ) {
+      for( cell_idx_t y = 0; y < ySize; ++y ) {
+         for( cell_idx_t x = 0; x < xSize; ++x )
+         {
+            if( !flagField->isPartOfMaskSet( x, y, z, lbm ) )
+               continue;
+
+            list.offsets.push_back( offset( x, y, z, uint_t(0) ) );
+
+            list.coordinates.push_back( x );
+            list.coordinates.push_back( y );
+            list.coordinates.push_back( z );
+
+            for( auto d = Stencil::begin(); d != Stencil::end(); ++d )
+            {
+               const cell_idx_t nx = x - cell_idx_c( d.cx() );
+               const cell_idx_t ny = y - cell_idx_c( d.cy() );
+               const cell_idx_t nz = z - cell_idx_c( d.cz() );
+
+               if( flagField->isPartOfMaskSet( nx, ny, nz, bounceBack ) )
+                  list.pull.push_back( offset( x, y, z, d.toInvIdx() ) );
+               else
+                  list.pull.push_back( offset( nx, ny, nz, d.toIdx() ) );
+            }
+         }
+      }
+   }
+}
+
+
+
+///////////////////////////////
+// makeSparseSweep FUNCTIONS //
+///////////////////////////////
+
+template< typename LatticeModel_T, typename FlagField_T >
+shared_ptr< SparseSweep< LatticeModel_T, FlagField_T > >
+makeSparseSweep( const BlockDataID & pdfFieldId, const ConstBlockDataID & flagFieldId, const Set< FlagUID > & cellsToEvaluate,
+                 const Set< FlagUID > & bounceBackCells = Set< FlagUID >::emptySet() )
+{
+   return make_shared< SparseSweep< LatticeModel_T, FlagField_T > >( pdfFieldId, flagFieldId, cellsToEvaluate, bounceBackCells );
+}
+
+template< typename LatticeModel_T, typename FlagField_T >
+shared_ptr< SparseSweep< LatticeModel_T, FlagField_T > >
+makeSparseSweep( const BlockDataID & src, const BlockDataID & dst, const ConstBlockDataID & flagFieldId, const Set< FlagUID > & cellsToEvaluate,
+                 const Set< FlagUID > & bounceBackCells = Set< FlagUID >::emptySet() )
+{
+   return make_shared< SparseSweep< LatticeModel_T, FlagField_T > >( src, dst, flagFieldId, cellsToEvaluate, bounceBackCells );
+}
+
+template< typename LatticeModel_T, typename FlagField_T, typename CellOperation_T >
+shared_ptr< SparseSweep< LatticeModel_T, FlagField_T, CellOperation_T > >
+makeSparseSweep( const BlockDataID & pdfFieldId, const ConstBlockDataID & flagFieldId, const Set< FlagUID > & cellsToEvaluate,
+                 const Set< FlagUID > & bounceBackCells, const CellOperation_T & op )
+{
+   return make_shared< SparseSweep< LatticeModel_T, FlagField_T, CellOperation_T > >( pdfFieldId, flagFieldId, cellsToEvaluate, bounceBackCells, op );
+}
+
+
+
+} // namespace lbm
+} // namespace walberla
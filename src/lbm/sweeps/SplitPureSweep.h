@@ -41,3 +41,4 @@ class SplitPureSweep
 #include "lbm/srt/SplitPureSweep.impl.h"
 #include "lbm/trt/SplitPureSweep.impl.h"
 #include "lbm/mrt/SplitPureSweep.impl.h"
+#include "lbm/cumulant/SplitPureSweep.impl.h"
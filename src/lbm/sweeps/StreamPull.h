@@ -83,8 +83,8 @@ void StreamPullEverything< LatticeModel_T, Enable >::execute( PdfField_T * src,
          const cell_idx_t xSize = cell_idx_c( src->xSize() );
          for( auto d = Stencil_T::begin(); d != Stencil_T::end(); ++d )
          {
-            real_t * srcPtr = &src->get( -cell_idx_c( numberOfGhostLayersToInclude )-d.cx(), y-d.cy(), z-d.cz(), d.toIdx() );
-            real_t * dstPtr = &dst->get( -cell_idx_c( numberOfGhostLayersToInclude ), y, z, d.toIdx() );
+            const typename PdfField_T::value_type * srcPtr = &src->get( -cell_idx_c( numberOfGhostLayersToInclude )-d.cx(), y-d.cy(), z-d.cz(), d.toIdx() );
+                  typename PdfField_T::value_type * dstPtr = &dst->get( -cell_idx_c( numberOfGhostLayersToInclude ), y, z, d.toIdx() );
             std::copy( srcPtr, srcPtr + xSize + cell_idx_t(2) * cell_idx_c( numberOfGhostLayersToInclude ), dstPtr );
          }
 
@@ -137,8 +137,8 @@ void StreamPullEverything< LatticeModel_T, typename boost::enable_if_c< boost::i
          const cell_idx_t xSize = cell_idx_c( src->xSize() );
          for( auto d = Stencil_T::begin(); d != Stencil_T::end(); ++d )
          {
-            real_t * srcPtr = &src->get( -cell_idx_c( numberOfGhostLayersToInclude )-d.cx(), y-d.cy(), z-d.cz(), d.toIdx() );
-            real_t * dstPtr = &dst->get( -cell_idx_c( numberOfGhostLayersToInclude ), y, z, d.toIdx() );
+            const typename PdfField_T::value_type * srcPtr = &src->get( -cell_idx_c( numberOfGhostLayersToInclude )-d.cx(), y-d.cy(), z-d.cz(), d.toIdx() );
+                  typename PdfField_T::value_type * dstPtr = &dst->get( -cell_idx_c( numberOfGhostLayersToInclude ), y, z, d.toIdx() );
             std::copy( srcPtr, srcPtr + xSize + cell_idx_t(2) * cell_idx_c( numberOfGhostLayersToInclude ), dstPtr );
          }
 
@@ -200,8 +200,8 @@ void StreamPullEverything< LatticeModel_T, typename boost::enable_if_c< boost::i
          const cell_idx_t xSize = cell_idx_c( src->xSize() );
          for( auto d = Stencil_T::begin(); d != Stencil_T::end(); ++d )
          {
-            real_t * srcPtr = &src->get( -cell_idx_c( numberOfGhostLayersToInclude )-d.cx(), y-d.cy(), z-d.cz(), d.toIdx() );
-            real_t * dstPtr = &dst->get( -cell_idx_c( numberOfGhostLayersToInclude ), y, z, d.toIdx() );
+            const typename PdfField_T::value_type * srcPtr = &src->get( -cell_idx_c( numberOfGhostLayersToInclude )-d.cx(), y-d.cy(), z-d.cz(), d.toIdx() );
+                  typename PdfField_T::value_type * dstPtr = &dst->get( -cell_idx_c( numberOfGhostLayersToInclude ), y, z, d.toIdx() );
             std::copy( srcPtr, srcPtr + xSize + cell_idx_t(2) * cell_idx_c( numberOfGhostLayersToInclude ), dstPtr );
          }
 
@@ -273,8 +273,8 @@ void StreamPullEverything< LatticeModel_T, typename boost::enable_if_c< boost::i
          const cell_idx_t xSize = cell_idx_c( src->xSize() );
          for( auto d = Stencil_T::begin(); d != Stencil_T::end(); ++d )
          {
-            real_t * srcPtr = &src->get( -cell_idx_c( numberOfGhostLayersToInclude )-d.cx(), y-d.cy(), z-d.cz(), d.toIdx() );
-            real_t * dstPtr = &dst->get( -cell_idx_c( numberOfGhostLayersToInclude ), y, z, d.toIdx() );
+            const typename PdfField_T::value_type * srcPtr = &src->get( -cell_idx_c( numberOfGhostLayersToInclude )-d.cx(), y-d.cy(), z-d.cz(), d.toIdx() );
+                  typename PdfField_T::value_type * dstPtr = &dst->get( -cell_idx_c( numberOfGhostLayersToInclude ), y, z, d.toIdx() );
             std::copy( srcPtr, srcPtr + xSize + cell_idx_t(2) * cell_idx_c( numberOfGhostLayersToInclude ), dstPtr );
          }
 
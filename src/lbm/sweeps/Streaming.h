@@ -190,8 +190,8 @@ void StreamEverything< LatticeModel_T, typename boost::enable_if< boost::mpl::no
          const cell_idx_t xSize = cell_idx_c( src->xSize() );
          for( auto d = Stencil::begin(); d != Stencil::end(); ++d )
          {
-            real_t * srcPtr = &src->get( -cell_idx_c( numberOfGhostLayersToInclude )-d.cx(), y-d.cy(), z-d.cz(), d.toIdx() );
-            real_t * dstPtr = &dst->get( -cell_idx_c( numberOfGhostLayersToInclude ), y, z, d.toIdx() );
+            const typename PdfField_T::value_type * srcPtr = &src->get( -cell_idx_c( numberOfGhostLayersToInclude )-d.cx(), y-d.cy(), z-d.cz(), d.toIdx() );
+                  typename PdfField_T::value_type * dstPtr = &dst->get( -cell_idx_c( numberOfGhostLayersToInclude ), y, z, d.toIdx() );
             std::copy( srcPtr, srcPtr + xSize + cell_idx_t(2) * cell_idx_c( numberOfGhostLayersToInclude ), dstPtr );
          }
 
@@ -242,8 +242,8 @@ void StreamEverything< LatticeModel_T, typename boost::enable_if< boost::is_same
          const cell_idx_t xSize = cell_idx_c( src->xSize() );
          for( auto d = Stencil::begin(); d != Stencil::end(); ++d )
          {
-            real_t * srcPtr = &src->get( -cell_idx_c( numberOfGhostLayersToInclude )-d.cx(), y-d.cy(), z-d.cz(), d.toIdx() );
-            real_t * dstPtr = &dst->get( -cell_idx_c( numberOfGhostLayersToInclude ), y, z, d.toIdx() );
+            const typename PdfField_T::value_type * srcPtr = &src->get( -cell_idx_c( numberOfGhostLayersToInclude )-d.cx(), y-d.cy(), z-d.cz(), d.toIdx() );
+                  typename PdfField_T::value_type * dstPtr = &dst->get( -cell_idx_c( numberOfGhostLayersToInclude ), y, z, d.toIdx() );
             std::copy( srcPtr, srcPtr + xSize + cell_idx_t(2) * cell_idx_c( numberOfGhostLayersToInclude ), dstPtr );
          }
 
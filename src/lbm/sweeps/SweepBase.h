@@ -30,6 +30,7 @@
 #include "field/SwapableCompare.h"
 #include "field/iterators/IteratorMacros.h"
 
+#include <map>
 #include <set>
 #include <vector>
 
@@ -65,7 +66,11 @@ public:
       src_( src ), dstFromBlockData_( true ), dst_( dst ), filter_( _filter ),
       densityVelocityIn_( _densityVelocityIn ), densityVelocityOut_( _densityVelocityOut ) {}
 
-   virtual ~SweepBase() { for( auto field = dstFields_.begin(); field != dstFields_.end(); ++field ) delete *field; }
+   virtual ~SweepBase()
+   {
+      for( auto field = dstFields_.begin(); field != dstFields_.end(); ++field ) delete *field;
+      for( auto field = blockDstFields_.begin(); field != blockDstFields_.end(); ++field ) delete field->second;
+   }
 
    void filter( IBlock & block ) { filter_( block ); }
    bool filter( const cell_idx_t x, const cell_idx_t y, const cell_idx_t z ) const { return filter_(x,y,z); }
@@ -88,6 +93,7 @@ protected:
 
    inline PdfField_T * getSrcField( IBlock * const block ) const;
           PdfField_T * getDstField( IBlock * const block, PdfField_T * const src );
+          PdfField_T * getBlockLocalDstField( IBlock * const block, PdfField_T * const src );
 
    inline void getFields( IBlock * const block, PdfField_T * & src, PdfField_T * & dst );
 
@@ -98,6 +104,7 @@ protected:
    const bool dstFromBlockData_;
    const BlockDataID dst_ {};
    std::set< PdfField_T *, field::SwapableCompare< PdfField_T * > > dstFields_;
+   std::map< IBlockID::IDType, PdfField_T * > blockDstFields_; // temporary fields that must not be shared between blocks
 
    Filter_T filter_;
    DensityVelocityIn_T densityVelocityIn_;
@@ -160,6 +167,53 @@ SweepBase< LatticeModel_T, Filter_T, DensityVelocityIn_T, DensityVelocityOut_T >
 
 
 
+/// Same as getDstField, but if no dedicated dst field is available, the temporary field is exclusively used by 'block'.
+/// Required if a time step is split into multiple calls per block that all write into the temporary field and other
+/// blocks are processed in between (see streamCollideInner/streamCollideOuter of lbm::CellwiseSweep).
+template< typename LatticeModel_T, typename Filter_T, typename DensityVelocityIn_T, typename DensityVelocityOut_T >
+typename SweepBase< LatticeModel_T, Filter_T, DensityVelocityIn_T, DensityVelocityOut_T >::PdfField_T *
+SweepBase< LatticeModel_T, Filter_T, DensityVelocityIn_T, DensityVelocityOut_T >::getBlockLocalDstField( IBlock * const block, PdfField_T * const src )
+{
+   WALBERLA_ASSERT_NOT_NULLPTR( block );
+   WALBERLA_ASSERT_NOT_NULLPTR( src );
+
+   if( dstFromBlockData_ )
+   {
+      PdfField_T * dst = block->getData<PdfField_T>( dst_ );
+      WALBERLA_ASSERT_NOT_NULLPTR( dst );
+      return dst;
+   }
+
+   // The fields are identified by the ID of the block, not by its address: after blocks are removed (refinement, load
+   // balancing), the address of a removed block may be reused by a new block. A block that is replaced by a block with
+   // the same ID but a different size gets a new temporary field.
+   auto it = blockDstFields_.find( block->getId().getID() );
+   if( it != blockDstFields_.end() )
+   {
+      WALBERLA_ASSERT_NOT_NULLPTR( it->second );
+      const field::SwapableCompare< PdfField_T * > swapable;
+      if( !swapable( it->second, src ) && !swapable( src, it->second ) )
+         return it->second;
+
+      delete it->second;
+      blockDstFields_.erase( it );
+   }
+
+   PdfField_T * dst = src->cloneUninitialized();
+   WALBERLA_ASSERT_NOT_NULLPTR( dst );
+
+   // take care of proper thread<->memory assignment (first-touch allocation policy !)
+   WALBERLA_FOR_ALL_CELLS_INCLUDING_GHOST_LAYER_XYZ( dst,
+      for( uint_t f = uint_t(0); f < LatticeModel_T::Stencil::Size; ++f )
+         dst->get(x,y,z,f) = std::numeric_limits< typename PdfField_T::value_type >::quiet_NaN();
+   )
+   blockDstFields_[ block->getId().getID() ] = dst;
+
+   return dst;
+}
+
+
+
 template< typename LatticeModel_T, typename Filter_T, typename DensityVelocityIn_T, typename DensityVelocityOut_T >
 inline void SweepBase< LatticeModel_T, Filter_T, DensityVelocityIn_T, DensityVelocityOut_T >::getFields( IBlock * const block,
                                                                                                          PdfField_T * & src, PdfField_T * & dst )
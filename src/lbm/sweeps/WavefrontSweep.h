@@ -0,0 +1,201 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file WavefrontSweep.h
+//! \ingroup lbm
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "lbm/sweeps/SweepBase.h"
+#include "lbm/sweeps/cell_operations/DefaultCellOperation.h"
+
+#include "core/OpenMP.h"
+#include "core/debug/Debug.h"
+
+
+namespace walberla {
+namespace lbm {
+
+
+
+//**********************************************************************************************************************
+/*!
+*   \brief Stream & collide sweep for the LBM that performs several time steps at once (temporal blocking)
+*
+*   Every execution of the sweep performs 'numberOfTimeSteps' (T) time steps on a block. The PDF field must have at
+*   least T ghost layers, all of which must be synchronized before the sweep is executed (see
+*   WavefrontPdfFieldPackInfo). The ghost layers are updated alongside the interior: the first time step is performed
+*   on the interior plus T-1 ghost layers, the second one on the interior plus T-2 ghost layers, and so on. Hence,
+*   communication is only required every T time steps.
+*
+*   Within a block, the time steps are processed as a wavefront along the z-axis: while time step 1 updates xy-slice z,
+*   time step 2 updates slice z-1, time step 3 updates slice z-2, etc. The data of T+2 slices of the source and the
+*   destination field is reused from cache, so the PDF field is streamed from main memory only once per T time steps
+*   (instead of once per time step). Blocks should be chosen such that T+2 xy-slices of both PDF fields fit into the
+*   cache.
+*
+*   \code
+*   blockforest::communication::UniformBufferedScheme< stencil::D3Q27 > communication( blocks );
+*   communication.addPackInfo( make_shared< lbm::WavefrontPdfFieldPackInfo< LatticeModel_T > >( pdfFieldId, T ) );
+*
+*   // every time loop iteration corresponds to T time steps!
+*   timeloop.add() << BeforeFunction( communication, "communication" )
+*                  << Sweep( makeSharedSweep( lbm::makeWavefrontSweep< LatticeModel_T >( pdfFieldId, T ) ), "LB stream & collide (wavefront)" );
+*   \endcode
+*
+*   The collision is performed by a cell operation (default: DefaultCellOperation) in all cells of the block
+*   (just like the "pure" kernels, see SplitPureSweep). Boundary handling (lbm/boundary) only treats one ghost layer
+*   for one time step and is not supported: the wavefront sweep is meant for periodic domains or domains that are
+*   closed by communication.
+*/
+//**********************************************************************************************************************
+
+template< typename LatticeModel_T, typename CellOperation_T = DefaultCellOperation< LatticeModel_T > >
+class WavefrontSweep : SweepBase< LatticeModel_T >
+{
+public:
+
+   typedef typename SweepBase< LatticeModel_T >::PdfField_T PdfField_T;
+
+   // block has NO dst pdf field
+   WavefrontSweep( const BlockDataID & pdfField, const uint_t numberOfTimeSteps, const CellOperation_T & op = CellOperation_T() ) :
+      SweepBase< LatticeModel_T >( pdfField ), numberOfTimeSteps_( numberOfTimeSteps ), cellOperation_( op )
+   {
+      WALBERLA_ASSERT_GREATER( numberOfTimeSteps_, uint_t(0) );
+   }
+
+   // every block has a dedicated dst pdf field
+   WavefrontSweep( const BlockDataID & src, const BlockDataID & dst, const uint_t numberOfTimeSteps, const CellOperation_T & op = CellOperation_T() ) :
+      SweepBase< LatticeModel_T >( src, dst ), numberOfTimeSteps_( numberOfTimeSteps ), cellOperation_( op )
+   {
+      WALBERLA_ASSERT_GREATER( numberOfTimeSteps_, uint_t(0) );
+   }
+
+   virtual ~WavefrontSweep() {}
+
+   uint_t numberOfTimeSteps() const { return numberOfTimeSteps_; }
+
+   const CellOperation_T & getCellOperation() const { return cellOperation_; }
+         CellOperation_T & getCellOperation()       { return cellOperation_; }
+
+   void operator()( IBlock * const block );
+
+private:
+
+   const uint_t numberOfTimeSteps_;
+
+   CellOperation_T cellOperation_;
+};
+
+
+
+template< typename LatticeModel_T, typename CellOperation_T >
+void WavefrontSweep< LatticeModel_T, CellOperation_T >::operator()( IBlock * const block )
+{
+   PdfField_T * src( NULL );
+   PdfField_T * dst( NULL );
+   this->getFields( block, src, dst );
+
+   WALBERLA_ASSERT_NOT_NULLPTR( src );
+   WALBERLA_ASSERT_NOT_NULLPTR( dst );
+
+   WALBERLA_ASSERT_GREATER_EQUAL( src->nrOfGhostLayers(), numberOfTimeSteps_ );
+   WALBERLA_ASSERT_GREATER_EQUAL( dst->nrOfGhostLayers(), numberOfTimeSteps_ );
+
+   // execute stream & collide kernels
+
+   const auto & lm = src->latticeModel();
+   dst->resetLatticeModel( lm ); /* required so that member functions for getting density and equilibrium velocity can be called for dst! */
+
+   cellOperation_.configure( lm );
+
+   // time step t reads from fields[t % 2] and writes to fields[(t+1) % 2]
+   PdfField_T * const fields[2] = { src, dst };
+
+   const cell_idx_t steps = cell_idx_c( numberOfTimeSteps_ );
+
+   const cell_idx_t xSize = cell_idx_c( src->xSize() );
+   const cell_idx_t ySize = cell_idx_c( src->ySize() );
+   const cell_idx_t zSize = cell_idx_c( src->zSize() );
+
+   // Time step t updates slice z = w - t. Slices z-1, z, and z+1 of time step t-1 are always available: slice z+1 was
+   // updated by time step t-1 in the same wavefront iteration w (right before), all other slices in previous iterations.
+   // Time step t only overwrites slices of fields[(t+1) % 2] that are not read by time step t-1 anymore.
+
+   for( cell_idx_t w = -( steps - cell_idx_t(1) ); w < zSize + steps - cell_idx_t(1); ++w )
+   {
+      for( cell_idx_t t = 0; t < steps; ++t )
+      {
+         const cell_idx_t gl = steps - cell_idx_t(1) - t; // number of ghost layers that are updated by time step t
+         const cell_idx_t z = w - t;
+
+         if( z < -gl || z >= zSize + gl )
+            continue;
+
+         PdfField_T * const s = fields[ t & 1 ];
+         PdfField_T * const d = fields[ ( t + 1 ) & 1 ];
+
+#ifdef _OPENMP
+         const int iyBegin = int_c( -gl );
+         const int iyEnd   = int_c( ySize + gl );
+         #pragma omp parallel for schedule(static)
+         for( int iy = iyBegin; iy < iyEnd; ++iy ) {
+            const cell_idx_t y = cell_idx_c( iy );
+#else
+         for( cell_idx_t y = -gl; y < ySize + gl; ++y ) {
+#endif
+            for( cell_idx_t x = -gl; x < xSize + gl; ++x )
+               cellOperation_( s, d, x, y, z );
+         }
+      }
+   }
+
+   if( ( numberOfTimeSteps_ & uint_t(1) ) == uint_t(1) )
+      src->swapDataPointers( dst );
+}
+
+
+
+//////////////////////////////////
+// makeWavefrontSweep FUNCTIONS //
+//////////////////////////////////
+
+template< typename LatticeModel_T >
+shared_ptr< WavefrontSweep< LatticeModel_T > >
+makeWavefrontSweep( const BlockDataID & pdfFieldId, const uint_t numberOfTimeSteps )
+{
+   return make_shared< WavefrontSweep< LatticeModel_T > >( pdfFieldId, numberOfTimeSteps );
+}
+
+template< typename LatticeModel_T >
+shared_ptr< WavefrontSweep< LatticeModel_T > >
+makeWavefrontSweep( const BlockDataID & src, const BlockDataID & dst, const uint_t numberOfTimeSteps )
+{
+   return make_shared< WavefrontSweep< LatticeModel_T > >( src, dst, numberOfTimeSteps );
+}
+
+template< typename LatticeModel_T, typename CellOperation_T >
+shared_ptr< WavefrontSweep< LatticeModel_T, CellOperation_T > >
+makeWavefrontSweep( const BlockDataID & pdfFieldId, const uint_t numberOfTimeSteps, const CellOperation_T & op )
+{
+   return make_shared< WavefrontSweep< LatticeModel_T, CellOperation_T > >( pdfFieldId, numberOfTimeSteps, op );
+}
+
+
+
+} // namespace lbm
+} // namespace walberla
@@ -22,11 +22,17 @@
 
 #pragma once
 
+#include "AASweep.h"
+#include "AATimeStepTracker.h"
 #include "ActiveCellSweep.h"
 #include "CellwiseSweep.h"
+#include "FusedBoundaryHandling.h"
+#include "InnerOuterSplit.h"
+#include "SparseSweep.h"
 #include "SplitPureSweep.h"
 #include "SplitSweep.h"
 #include "SweepWrappers.h"
+#include "WavefrontSweep.h"
 
 #include "cell_operations/AdvectionDiffusionCellOperation.h"
 #include "cell_operations/DefaultCellOperation.h"
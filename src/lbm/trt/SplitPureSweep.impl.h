@@ -26,7 +26,9 @@
 #pragma once
 
 #include "lbm/lattice_model/LatticeModelBase.h"
+#include "lbm/lattice_model/D3Q15.h"
 #include "lbm/lattice_model/D3Q19.h"
+#include "lbm/lattice_model/D3Q27.h"
 #include "lbm/sweeps/Streaming.h"
 #include "lbm/sweeps/SweepBase.h"
 #include "lbm/IntelCompilerOptimization.h"
@@ -52,6 +54,10 @@ namespace lbm {
 // Optimized D3Q19 implementation:                   //
 //                     incompressible | compressible //
 //          no forces:       x               x       //
+//                                                   //
+// Split D3Q15 & D3Q27 implementation:               //
+//                     incompressible | compressible //
+//          no forces:       x               x       //
 ///////////////////////////////////////////////////////
 
 
@@ -81,6 +87,7 @@ public:
 
    typedef typename SweepBase<LatticeModel_T>::PdfField_T  PdfField_T;
    typedef typename LatticeModel_T::Stencil                Stencil;
+   typedef typename PdfField_T::value_type                 PdfValue_T;
 
    // block has NO dst pdf field
    SplitPureSweep( const BlockDataID & pdfField ) :
@@ -152,35 +159,35 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
          using namespace stencil;
 
-         real_t * WALBERLA_RESTRICT pNE = &src->get(-1, y-1, z  , Stencil::idx[NE]);
-         real_t * WALBERLA_RESTRICT pN  = &src->get(0 , y-1, z  , Stencil::idx[N]);
-         real_t * WALBERLA_RESTRICT pNW = &src->get(+1, y-1, z  , Stencil::idx[NW]);
-         real_t * WALBERLA_RESTRICT pW  = &src->get(+1, y  , z  , Stencil::idx[W]);
-         real_t * WALBERLA_RESTRICT pSW = &src->get(+1, y+1, z  , Stencil::idx[SW]);
-         real_t * WALBERLA_RESTRICT pS  = &src->get(0 , y+1, z  , Stencil::idx[S]);
-         real_t * WALBERLA_RESTRICT pSE = &src->get(-1, y+1, z  , Stencil::idx[SE]);
-         real_t * WALBERLA_RESTRICT pE  = &src->get(-1, y  , z  , Stencil::idx[E]);
-         real_t * WALBERLA_RESTRICT pT  = &src->get(0 , y  , z-1, Stencil::idx[T]);
-         real_t * WALBERLA_RESTRICT pTE = &src->get(-1, y  , z-1, Stencil::idx[TE]);
-         real_t * WALBERLA_RESTRICT pTN = &src->get(0 , y-1, z-1, Stencil::idx[TN]);
-         real_t * WALBERLA_RESTRICT pTW = &src->get(+1, y  , z-1, Stencil::idx[TW]);
-         real_t * WALBERLA_RESTRICT pTS = &src->get(0 , y+1, z-1, Stencil::idx[TS]);
-         real_t * WALBERLA_RESTRICT pB  = &src->get(0 , y  , z+1, Stencil::idx[B]);
-         real_t * WALBERLA_RESTRICT pBE = &src->get(-1, y  , z+1, Stencil::idx[BE]);
-         real_t * WALBERLA_RESTRICT pBN = &src->get(0 , y-1, z+1, Stencil::idx[BN]);
-         real_t * WALBERLA_RESTRICT pBW = &src->get(+1, y  , z+1, Stencil::idx[BW]);
-         real_t * WALBERLA_RESTRICT pBS = &src->get(0 , y+1, z+1, Stencil::idx[BS]);
-         real_t * WALBERLA_RESTRICT pC  = &src->get(0 , y  , z  , Stencil::idx[C]);
-
-         real_t * WALBERLA_RESTRICT dC = &dst->get(0,y,z,Stencil::idx[C]);
+         PdfValue_T * WALBERLA_RESTRICT pNE = &src->get(-1, y-1, z  , Stencil::idx[NE]);
+         PdfValue_T * WALBERLA_RESTRICT pN  = &src->get(0 , y-1, z  , Stencil::idx[N]);
+         PdfValue_T * WALBERLA_RESTRICT pNW = &src->get(+1, y-1, z  , Stencil::idx[NW]);
+         PdfValue_T * WALBERLA_RESTRICT pW  = &src->get(+1, y  , z  , Stencil::idx[W]);
+         PdfValue_T * WALBERLA_RESTRICT pSW = &src->get(+1, y+1, z  , Stencil::idx[SW]);
+         PdfValue_T * WALBERLA_RESTRICT pS  = &src->get(0 , y+1, z  , Stencil::idx[S]);
+         PdfValue_T * WALBERLA_RESTRICT pSE = &src->get(-1, y+1, z  , Stencil::idx[SE]);
+         PdfValue_T * WALBERLA_RESTRICT pE  = &src->get(-1, y  , z  , Stencil::idx[E]);
+         PdfValue_T * WALBERLA_RESTRICT pT  = &src->get(0 , y  , z-1, Stencil::idx[T]);
+         PdfValue_T * WALBERLA_RESTRICT pTE = &src->get(-1, y  , z-1, Stencil::idx[TE]);
+         PdfValue_T * WALBERLA_RESTRICT pTN = &src->get(0 , y-1, z-1, Stencil::idx[TN]);
+         PdfValue_T * WALBERLA_RESTRICT pTW = &src->get(+1, y  , z-1, Stencil::idx[TW]);
+         PdfValue_T * WALBERLA_RESTRICT pTS = &src->get(0 , y+1, z-1, Stencil::idx[TS]);
+         PdfValue_T * WALBERLA_RESTRICT pB  = &src->get(0 , y  , z+1, Stencil::idx[B]);
+         PdfValue_T * WALBERLA_RESTRICT pBE = &src->get(-1, y  , z+1, Stencil::idx[BE]);
+         PdfValue_T * WALBERLA_RESTRICT pBN = &src->get(0 , y-1, z+1, Stencil::idx[BN]);
+         PdfValue_T * WALBERLA_RESTRICT pBW = &src->get(+1, y  , z+1, Stencil::idx[BW]);
+         PdfValue_T * WALBERLA_RESTRICT pBS = &src->get(0 , y+1, z+1, Stencil::idx[BS]);
+         PdfValue_T * WALBERLA_RESTRICT pC  = &src->get(0 , y  , z  , Stencil::idx[C]);
+
+         PdfValue_T * WALBERLA_RESTRICT dC = &dst->get(0,y,z,Stencil::idx[C]);
 
          X_LOOP
          (
-            const real_t velX_trm = pE[x] + pNE[x] + pSE[x] + pTE[x] + pBE[x];
-            const real_t velY_trm = pN[x] + pNW[x] + pTN[x] + pBN[x];
-            const real_t velZ_trm = pT[x] + pTS[x] + pTW[x];
+            const real_t velX_trm = real_t( pE[x] ) + pNE[x] + pSE[x] + pTE[x] + pBE[x];
+            const real_t velY_trm = real_t( pN[x] ) + pNW[x] + pTN[x] + pBN[x];
+            const real_t velZ_trm = real_t( pT[x] ) + pTS[x] + pTW[x];
 
-            const real_t rho = pC[x] + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
+            const real_t rho = real_t( pC[x] ) + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
 
             velX[x] = velX_trm - pW[x]  - pNW[x] - pSW[x] - pTW[x] - pBW[x];
             velY[x] = velY_trm + pNE[x] - pS[x]  - pSW[x] - pSE[x] - pTS[x] - pBS[x];
@@ -188,121 +195,121 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             feq_common[x] = rho - real_t(1.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            dC[x] = pC[x] * (real_t(1.0) - lambda_e) + lambda_e * t0 * feq_common[x];
+            dC[x] = PdfValue_T( pC[x] * (real_t(1.0) - lambda_e) + lambda_e * t0 * feq_common[x] );
          )
 
-         real_t * WALBERLA_RESTRICT dNE = &dst->get(0,y,z,Stencil::idx[NE]);
-         real_t * WALBERLA_RESTRICT dSW = &dst->get(0,y,z,Stencil::idx[SW]);
+         PdfValue_T * WALBERLA_RESTRICT dNE = &dst->get(0,y,z,Stencil::idx[NE]);
+         PdfValue_T * WALBERLA_RESTRICT dSW = &dst->get(0,y,z,Stencil::idx[SW]);
 
          X_LOOP
          (
             const real_t velXPY = velX[x] + velY[x];
-            const real_t  sym_NE_SW = lambda_e_scaled * ( pNE[x] + pSW[x] - fac2 * velXPY * velXPY - t2x2 * feq_common[x] );
-            const real_t asym_NE_SW = lambda_d_scaled * ( pNE[x] - pSW[x] - real_t(3.0) * t2x2 * velXPY );
+            const real_t  sym_NE_SW = lambda_e_scaled * ( real_t( pNE[x] ) + pSW[x] - fac2 * velXPY * velXPY - t2x2 * feq_common[x] );
+            const real_t asym_NE_SW = lambda_d_scaled * ( real_t( pNE[x] ) - pSW[x] - real_t(3.0) * t2x2 * velXPY );
 
-            dNE[x] = pNE[x] - sym_NE_SW - asym_NE_SW;
-            dSW[x] = pSW[x] - sym_NE_SW + asym_NE_SW;
+            dNE[x] = PdfValue_T( pNE[x] - sym_NE_SW - asym_NE_SW );
+            dSW[x] = PdfValue_T( pSW[x] - sym_NE_SW + asym_NE_SW );
          )
 
-         real_t * WALBERLA_RESTRICT dSE = &dst->get(0,y,z,Stencil::idx[SE]);
-         real_t * WALBERLA_RESTRICT dNW = &dst->get(0,y,z,Stencil::idx[NW]);
+         PdfValue_T * WALBERLA_RESTRICT dSE = &dst->get(0,y,z,Stencil::idx[SE]);
+         PdfValue_T * WALBERLA_RESTRICT dNW = &dst->get(0,y,z,Stencil::idx[NW]);
 
          X_LOOP
          (
             const real_t velXMY = velX[x] - velY[x];
-            const real_t  sym_SE_NW = lambda_e_scaled * ( pSE[x] + pNW[x] - fac2 * velXMY * velXMY - t2x2 * feq_common[x] );
-            const real_t asym_SE_NW = lambda_d_scaled * ( pSE[x] - pNW[x] - real_t(3.0) * t2x2 * velXMY );
+            const real_t  sym_SE_NW = lambda_e_scaled * ( real_t( pSE[x] ) + pNW[x] - fac2 * velXMY * velXMY - t2x2 * feq_common[x] );
+            const real_t asym_SE_NW = lambda_d_scaled * ( real_t( pSE[x] ) - pNW[x] - real_t(3.0) * t2x2 * velXMY );
 
-            dSE[x] = pSE[x] - sym_SE_NW - asym_SE_NW;
-            dNW[x] = pNW[x] - sym_SE_NW + asym_SE_NW;
+            dSE[x] = PdfValue_T( pSE[x] - sym_SE_NW - asym_SE_NW );
+            dNW[x] = PdfValue_T( pNW[x] - sym_SE_NW + asym_SE_NW );
          )
 
-         real_t * WALBERLA_RESTRICT dTE = &dst->get(0,y,z,Stencil::idx[TE]);
-         real_t * WALBERLA_RESTRICT dBW = &dst->get(0,y,z,Stencil::idx[BW]);
+         PdfValue_T * WALBERLA_RESTRICT dTE = &dst->get(0,y,z,Stencil::idx[TE]);
+         PdfValue_T * WALBERLA_RESTRICT dBW = &dst->get(0,y,z,Stencil::idx[BW]);
 
          X_LOOP
          (
             const real_t velXPZ = velX[x] + velZ[x];
-            const real_t  sym_TE_BW = lambda_e_scaled * ( pTE[x] + pBW[x] - fac2 * velXPZ * velXPZ - t2x2 * feq_common[x] );
-            const real_t asym_TE_BW = lambda_d_scaled * ( pTE[x] - pBW[x] - real_t(3.0) * t2x2 * velXPZ );
+            const real_t  sym_TE_BW = lambda_e_scaled * ( real_t( pTE[x] ) + pBW[x] - fac2 * velXPZ * velXPZ - t2x2 * feq_common[x] );
+            const real_t asym_TE_BW = lambda_d_scaled * ( real_t( pTE[x] ) - pBW[x] - real_t(3.0) * t2x2 * velXPZ );
 
-            dTE[x] = pTE[x] - sym_TE_BW - asym_TE_BW;
-            dBW[x] = pBW[x] - sym_TE_BW + asym_TE_BW;
+            dTE[x] = PdfValue_T( pTE[x] - sym_TE_BW - asym_TE_BW );
+            dBW[x] = PdfValue_T( pBW[x] - sym_TE_BW + asym_TE_BW );
          )
 
-         real_t * WALBERLA_RESTRICT dBE = &dst->get(0,y,z,Stencil::idx[BE]);
-         real_t * WALBERLA_RESTRICT dTW = &dst->get(0,y,z,Stencil::idx[TW]);
+         PdfValue_T * WALBERLA_RESTRICT dBE = &dst->get(0,y,z,Stencil::idx[BE]);
+         PdfValue_T * WALBERLA_RESTRICT dTW = &dst->get(0,y,z,Stencil::idx[TW]);
 
          X_LOOP
          (
             const real_t velXMZ = velX[x] - velZ[x];
-            const real_t  sym_BE_TW = lambda_e_scaled * ( pBE[x] + pTW[x] - fac2 * velXMZ * velXMZ - t2x2 * feq_common[x] );
-            const real_t asym_BE_TW = lambda_d_scaled * ( pBE[x] - pTW[x] - real_t(3.0) * t2x2 * velXMZ );
+            const real_t  sym_BE_TW = lambda_e_scaled * ( real_t( pBE[x] ) + pTW[x] - fac2 * velXMZ * velXMZ - t2x2 * feq_common[x] );
+            const real_t asym_BE_TW = lambda_d_scaled * ( real_t( pBE[x] ) - pTW[x] - real_t(3.0) * t2x2 * velXMZ );
 
-            dBE[x] = pBE[x] - sym_BE_TW - asym_BE_TW;
-            dTW[x] = pTW[x] - sym_BE_TW + asym_BE_TW;
+            dBE[x] = PdfValue_T( pBE[x] - sym_BE_TW - asym_BE_TW );
+            dTW[x] = PdfValue_T( pTW[x] - sym_BE_TW + asym_BE_TW );
          )
 
-         real_t * WALBERLA_RESTRICT dTN = &dst->get(0,y,z,Stencil::idx[TN]);
-         real_t * WALBERLA_RESTRICT dBS = &dst->get(0,y,z,Stencil::idx[BS]);
+         PdfValue_T * WALBERLA_RESTRICT dTN = &dst->get(0,y,z,Stencil::idx[TN]);
+         PdfValue_T * WALBERLA_RESTRICT dBS = &dst->get(0,y,z,Stencil::idx[BS]);
 
          X_LOOP
          (
             const real_t velYPZ = velY[x] + velZ[x];
-            const real_t  sym_TN_BS = lambda_e_scaled * ( pTN[x] + pBS[x] - fac2 * velYPZ * velYPZ - t2x2 * feq_common[x] );
-            const real_t asym_TN_BS = lambda_d_scaled * ( pTN[x] - pBS[x] - real_t(3.0) * t2x2 * velYPZ );
+            const real_t  sym_TN_BS = lambda_e_scaled * ( real_t( pTN[x] ) + pBS[x] - fac2 * velYPZ * velYPZ - t2x2 * feq_common[x] );
+            const real_t asym_TN_BS = lambda_d_scaled * ( real_t( pTN[x] ) - pBS[x] - real_t(3.0) * t2x2 * velYPZ );
 
-            dTN[x] = pTN[x] - sym_TN_BS - asym_TN_BS;
-            dBS[x] = pBS[x] - sym_TN_BS + asym_TN_BS;
+            dTN[x] = PdfValue_T( pTN[x] - sym_TN_BS - asym_TN_BS );
+            dBS[x] = PdfValue_T( pBS[x] - sym_TN_BS + asym_TN_BS );
          )
 
-         real_t * WALBERLA_RESTRICT dBN = &dst->get(0,y,z,Stencil::idx[BN]);
-         real_t * WALBERLA_RESTRICT dTS = &dst->get(0,y,z,Stencil::idx[TS]);
+         PdfValue_T * WALBERLA_RESTRICT dBN = &dst->get(0,y,z,Stencil::idx[BN]);
+         PdfValue_T * WALBERLA_RESTRICT dTS = &dst->get(0,y,z,Stencil::idx[TS]);
 
          X_LOOP
          (
             const real_t velYMZ = velY[x] - velZ[x];
-            const real_t  sym_BN_TS = lambda_e_scaled * ( pBN[x] + pTS[x] - fac2 * velYMZ * velYMZ - t2x2 * feq_common[x] );
-            const real_t asym_BN_TS = lambda_d_scaled * ( pBN[x] - pTS[x] - real_t(3.0) * t2x2 * velYMZ );
+            const real_t  sym_BN_TS = lambda_e_scaled * ( real_t( pBN[x] ) + pTS[x] - fac2 * velYMZ * velYMZ - t2x2 * feq_common[x] );
+            const real_t asym_BN_TS = lambda_d_scaled * ( real_t( pBN[x] ) - pTS[x] - real_t(3.0) * t2x2 * velYMZ );
 
-            dBN[x] = pBN[x] - sym_BN_TS - asym_BN_TS;
-            dTS[x] = pTS[x] - sym_BN_TS + asym_BN_TS;
+            dBN[x] = PdfValue_T( pBN[x] - sym_BN_TS - asym_BN_TS );
+            dTS[x] = PdfValue_T( pTS[x] - sym_BN_TS + asym_BN_TS );
          )
 
-         real_t * WALBERLA_RESTRICT dN = &dst->get(0,y,z,Stencil::idx[N]);
-         real_t * WALBERLA_RESTRICT dS = &dst->get(0,y,z,Stencil::idx[S]);
+         PdfValue_T * WALBERLA_RESTRICT dN = &dst->get(0,y,z,Stencil::idx[N]);
+         PdfValue_T * WALBERLA_RESTRICT dS = &dst->get(0,y,z,Stencil::idx[S]);
 
          X_LOOP
          (
-            const real_t  sym_N_S = lambda_e_scaled * ( pN[x] + pS[x] - fac1 * velY[x] * velY[x] - t1x2 * feq_common[x] );
-            const real_t asym_N_S = lambda_d_scaled * ( pN[x] - pS[x] - real_t(3.0) * t1x2 * velY[x] );
+            const real_t  sym_N_S = lambda_e_scaled * ( real_t( pN[x] ) + pS[x] - fac1 * velY[x] * velY[x] - t1x2 * feq_common[x] );
+            const real_t asym_N_S = lambda_d_scaled * ( real_t( pN[x] ) - pS[x] - real_t(3.0) * t1x2 * velY[x] );
 
-            dN[x] = pN[x] - sym_N_S - asym_N_S;
-            dS[x] = pS[x] - sym_N_S + asym_N_S;
+            dN[x] = PdfValue_T( pN[x] - sym_N_S - asym_N_S );
+            dS[x] = PdfValue_T( pS[x] - sym_N_S + asym_N_S );
          )
 
-         real_t * WALBERLA_RESTRICT dE = &dst->get(0,y,z,Stencil::idx[E]);
-         real_t * WALBERLA_RESTRICT dW = &dst->get(0,y,z,Stencil::idx[W]);
+         PdfValue_T * WALBERLA_RESTRICT dE = &dst->get(0,y,z,Stencil::idx[E]);
+         PdfValue_T * WALBERLA_RESTRICT dW = &dst->get(0,y,z,Stencil::idx[W]);
 
          X_LOOP
          (
-            const real_t  sym_E_W = lambda_e_scaled * ( pE[x] + pW[x] - fac1 * velX[x] * velX[x] - t1x2 * feq_common[x] );
-            const real_t asym_E_W = lambda_d_scaled * ( pE[x] - pW[x] - real_t(3.0) * t1x2 * velX[x] );
+            const real_t  sym_E_W = lambda_e_scaled * ( real_t( pE[x] ) + pW[x] - fac1 * velX[x] * velX[x] - t1x2 * feq_common[x] );
+            const real_t asym_E_W = lambda_d_scaled * ( real_t( pE[x] ) - pW[x] - real_t(3.0) * t1x2 * velX[x] );
 
-            dE[x] = pE[x] - sym_E_W - asym_E_W;
-            dW[x] = pW[x] - sym_E_W + asym_E_W;
+            dE[x] = PdfValue_T( pE[x] - sym_E_W - asym_E_W );
+            dW[x] = PdfValue_T( pW[x] - sym_E_W + asym_E_W );
          )
 
-         real_t * WALBERLA_RESTRICT dT = &dst->get(0,y,z,Stencil::idx[T]);
-         real_t * WALBERLA_RESTRICT dB = &dst->get(0,y,z,Stencil::idx[B]);
+         PdfValue_T * WALBERLA_RESTRICT dT = &dst->get(0,y,z,Stencil::idx[T]);
+         PdfValue_T * WALBERLA_RESTRICT dB = &dst->get(0,y,z,Stencil::idx[B]);
 
          X_LOOP
          (
-            const real_t  sym_T_B = lambda_e_scaled * ( pT[x] + pB[x] - fac1 * velZ[x] * velZ[x] - t1x2 * feq_common[x] );
-            const real_t asym_T_B = lambda_d_scaled * ( pT[x] - pB[x] - real_t(3.0) * t1x2 * velZ[x] );
+            const real_t  sym_T_B = lambda_e_scaled * ( real_t( pT[x] ) + pB[x] - fac1 * velZ[x] * velZ[x] - t1x2 * feq_common[x] );
+            const real_t asym_T_B = lambda_d_scaled * ( real_t( pT[x] ) - pB[x] - real_t(3.0) * t1x2 * velZ[x] );
 
-            dT[x] = pT[x] - sym_T_B - asym_T_B;
-            dB[x] = pB[x] - sym_T_B + asym_T_B;
+            dT[x] = PdfValue_T( pT[x] - sym_T_B - asym_T_B );
+            dB[x] = PdfValue_T( pB[x] - sym_T_B + asym_T_B );
          )
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -347,7 +354,7 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             feq_common[x] = rho - real_t(1.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            dst->get( x, y, z, Stencil::idx[C] ) = dd_tmp_C * (real_t(1.0) - lambda_e) + lambda_e * t0 * feq_common[x];
+            dst->get( x, y, z, Stencil::idx[C] ) = PdfValue_T( dd_tmp_C * (real_t(1.0) - lambda_e) + lambda_e * t0 * feq_common[x] );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -359,8 +366,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_NE_SW = lambda_e_scaled * ( dd_tmp_NE + dd_tmp_SW - fac2 * velXPY * velXPY - t2x2 * feq_common[x] );
             const real_t asym_NE_SW = lambda_d_scaled * ( dd_tmp_NE - dd_tmp_SW - real_t(3.0) * t2x2 * velXPY );
 
-            dst->get( x, y, z, Stencil::idx[NE] ) = dd_tmp_NE - sym_NE_SW - asym_NE_SW;
-            dst->get( x, y, z, Stencil::idx[SW] ) = dd_tmp_SW - sym_NE_SW + asym_NE_SW;
+            dst->get( x, y, z, Stencil::idx[NE] ) = PdfValue_T( dd_tmp_NE - sym_NE_SW - asym_NE_SW );
+            dst->get( x, y, z, Stencil::idx[SW] ) = PdfValue_T( dd_tmp_SW - sym_NE_SW + asym_NE_SW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -372,8 +379,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_SE_NW = lambda_e_scaled * ( dd_tmp_SE + dd_tmp_NW - fac2 * velXMY * velXMY - t2x2 * feq_common[x] );
             const real_t asym_SE_NW = lambda_d_scaled * ( dd_tmp_SE - dd_tmp_NW - real_t(3.0) * t2x2 * velXMY );
 
-            dst->get( x, y, z, Stencil::idx[SE] ) = dd_tmp_SE - sym_SE_NW - asym_SE_NW;
-            dst->get( x, y, z, Stencil::idx[NW] ) = dd_tmp_NW - sym_SE_NW + asym_SE_NW;
+            dst->get( x, y, z, Stencil::idx[SE] ) = PdfValue_T( dd_tmp_SE - sym_SE_NW - asym_SE_NW );
+            dst->get( x, y, z, Stencil::idx[NW] ) = PdfValue_T( dd_tmp_NW - sym_SE_NW + asym_SE_NW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -385,8 +392,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_TE_BW = lambda_e_scaled * ( dd_tmp_TE + dd_tmp_BW - fac2 * velXPZ * velXPZ - t2x2 * feq_common[x] );
             const real_t asym_TE_BW = lambda_d_scaled * ( dd_tmp_TE - dd_tmp_BW - real_t(3.0) * t2x2 * velXPZ );
 
-            dst->get( x, y, z, Stencil::idx[TE] ) = dd_tmp_TE - sym_TE_BW - asym_TE_BW;
-            dst->get( x, y, z, Stencil::idx[BW] ) = dd_tmp_BW - sym_TE_BW + asym_TE_BW;
+            dst->get( x, y, z, Stencil::idx[TE] ) = PdfValue_T( dd_tmp_TE - sym_TE_BW - asym_TE_BW );
+            dst->get( x, y, z, Stencil::idx[BW] ) = PdfValue_T( dd_tmp_BW - sym_TE_BW + asym_TE_BW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -398,8 +405,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_BE_TW = lambda_e_scaled * ( dd_tmp_BE + dd_tmp_TW - fac2 * velXMZ * velXMZ - t2x2 * feq_common[x] );
             const real_t asym_BE_TW = lambda_d_scaled * ( dd_tmp_BE - dd_tmp_TW - real_t(3.0) * t2x2 * velXMZ );
 
-            dst->get( x, y, z, Stencil::idx[BE] ) = dd_tmp_BE - sym_BE_TW - asym_BE_TW;
-            dst->get( x, y, z, Stencil::idx[TW] ) = dd_tmp_TW - sym_BE_TW + asym_BE_TW;
+            dst->get( x, y, z, Stencil::idx[BE] ) = PdfValue_T( dd_tmp_BE - sym_BE_TW - asym_BE_TW );
+            dst->get( x, y, z, Stencil::idx[TW] ) = PdfValue_T( dd_tmp_TW - sym_BE_TW + asym_BE_TW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -411,8 +418,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_TN_BS = lambda_e_scaled * ( dd_tmp_TN + dd_tmp_BS - fac2 * velYPZ * velYPZ - t2x2 * feq_common[x] );
             const real_t asym_TN_BS = lambda_d_scaled * ( dd_tmp_TN - dd_tmp_BS - real_t(3.0) * t2x2 * velYPZ );
 
-            dst->get( x, y, z, Stencil::idx[TN] ) = dd_tmp_TN - sym_TN_BS - asym_TN_BS;
-            dst->get( x, y, z, Stencil::idx[BS] ) = dd_tmp_BS - sym_TN_BS + asym_TN_BS;
+            dst->get( x, y, z, Stencil::idx[TN] ) = PdfValue_T( dd_tmp_TN - sym_TN_BS - asym_TN_BS );
+            dst->get( x, y, z, Stencil::idx[BS] ) = PdfValue_T( dd_tmp_BS - sym_TN_BS + asym_TN_BS );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -424,8 +431,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_BN_TS = lambda_e_scaled * ( dd_tmp_BN + dd_tmp_TS - fac2 * velYMZ * velYMZ - t2x2 * feq_common[x] );
             const real_t asym_BN_TS = lambda_d_scaled * ( dd_tmp_BN - dd_tmp_TS - real_t(3.0) * t2x2 * velYMZ );
 
-            dst->get( x, y, z, Stencil::idx[BN] ) = dd_tmp_BN - sym_BN_TS - asym_BN_TS;
-            dst->get( x, y, z, Stencil::idx[TS] ) = dd_tmp_TS - sym_BN_TS + asym_BN_TS;
+            dst->get( x, y, z, Stencil::idx[BN] ) = PdfValue_T( dd_tmp_BN - sym_BN_TS - asym_BN_TS );
+            dst->get( x, y, z, Stencil::idx[TS] ) = PdfValue_T( dd_tmp_TS - sym_BN_TS + asym_BN_TS );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -436,8 +443,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_N_S = lambda_e_scaled * ( dd_tmp_N + dd_tmp_S - fac1 * velY[x] * velY[x] - t1x2 * feq_common[x] );
             const real_t asym_N_S = lambda_d_scaled * ( dd_tmp_N - dd_tmp_S - real_t(3.0) * t1x2 * velY[x] );
 
-            dst->get( x, y, z, Stencil::idx[N] ) = dd_tmp_N - sym_N_S - asym_N_S;
-            dst->get( x, y, z, Stencil::idx[S] ) = dd_tmp_S - sym_N_S + asym_N_S;
+            dst->get( x, y, z, Stencil::idx[N] ) = PdfValue_T( dd_tmp_N - sym_N_S - asym_N_S );
+            dst->get( x, y, z, Stencil::idx[S] ) = PdfValue_T( dd_tmp_S - sym_N_S + asym_N_S );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -448,8 +455,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_E_W = lambda_e_scaled * ( dd_tmp_E + dd_tmp_W - fac1 * velX[x] * velX[x] - t1x2 * feq_common[x] );
             const real_t asym_E_W = lambda_d_scaled * ( dd_tmp_E - dd_tmp_W - real_t(3.0) * t1x2 * velX[x] );
 
-            dst->get( x, y, z, Stencil::idx[E] ) = dd_tmp_E - sym_E_W - asym_E_W;
-            dst->get( x, y, z, Stencil::idx[W] ) = dd_tmp_W - sym_E_W + asym_E_W;
+            dst->get( x, y, z, Stencil::idx[E] ) = PdfValue_T( dd_tmp_E - sym_E_W - asym_E_W );
+            dst->get( x, y, z, Stencil::idx[W] ) = PdfValue_T( dd_tmp_W - sym_E_W + asym_E_W );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -460,8 +467,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_T_B = lambda_e_scaled * ( dd_tmp_T + dd_tmp_B - fac1 * velZ[x] * velZ[x] - t1x2 * feq_common[x] );
             const real_t asym_T_B = lambda_d_scaled * ( dd_tmp_T - dd_tmp_B - real_t(3.0) * t1x2 * velZ[x] );
 
-            dst->get( x, y, z, Stencil::idx[T] ) = dd_tmp_T - sym_T_B - asym_T_B;
-            dst->get( x, y, z, Stencil::idx[B] ) = dd_tmp_B - sym_T_B + asym_T_B;
+            dst->get( x, y, z, Stencil::idx[T] ) = PdfValue_T( dd_tmp_T - sym_T_B - asym_T_B );
+            dst->get( x, y, z, Stencil::idx[B] ) = PdfValue_T( dd_tmp_B - sym_T_B + asym_T_B );
          }
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -555,33 +562,33 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
          using namespace stencil;
 
-         real_t * WALBERLA_RESTRICT pC  = &src->get( 0, y, z, Stencil::idx[C]);
-         real_t * WALBERLA_RESTRICT pN  = &src->get( 0, y, z, Stencil::idx[N]);
-         real_t * WALBERLA_RESTRICT pS  = &src->get( 0, y, z, Stencil::idx[S]);
-         real_t * WALBERLA_RESTRICT pW  = &src->get( 0, y, z, Stencil::idx[W]);
-         real_t * WALBERLA_RESTRICT pE  = &src->get( 0, y, z, Stencil::idx[E]);
-         real_t * WALBERLA_RESTRICT pT  = &src->get( 0, y, z, Stencil::idx[T]);
-         real_t * WALBERLA_RESTRICT pB  = &src->get( 0, y, z, Stencil::idx[B]);
-         real_t * WALBERLA_RESTRICT pNW = &src->get( 0, y, z, Stencil::idx[NW]);
-         real_t * WALBERLA_RESTRICT pNE = &src->get( 0, y, z, Stencil::idx[NE]);
-         real_t * WALBERLA_RESTRICT pSW = &src->get( 0, y, z, Stencil::idx[SW]);
-         real_t * WALBERLA_RESTRICT pSE = &src->get( 0, y, z, Stencil::idx[SE]);
-         real_t * WALBERLA_RESTRICT pTN = &src->get( 0, y, z, Stencil::idx[TN]);
-         real_t * WALBERLA_RESTRICT pTS = &src->get( 0, y, z, Stencil::idx[TS]);
-         real_t * WALBERLA_RESTRICT pTW = &src->get( 0, y, z, Stencil::idx[TW]);
-         real_t * WALBERLA_RESTRICT pTE = &src->get( 0, y, z, Stencil::idx[TE]);
-         real_t * WALBERLA_RESTRICT pBN = &src->get( 0, y, z, Stencil::idx[BN]);
-         real_t * WALBERLA_RESTRICT pBS = &src->get( 0, y, z, Stencil::idx[BS]);
-         real_t * WALBERLA_RESTRICT pBW = &src->get( 0, y, z, Stencil::idx[BW]);
-         real_t * WALBERLA_RESTRICT pBE = &src->get( 0, y, z, Stencil::idx[BE]);
+         PdfValue_T * WALBERLA_RESTRICT pC  = &src->get( 0, y, z, Stencil::idx[C]);
+         PdfValue_T * WALBERLA_RESTRICT pN  = &src->get( 0, y, z, Stencil::idx[N]);
+         PdfValue_T * WALBERLA_RESTRICT pS  = &src->get( 0, y, z, Stencil::idx[S]);
+         PdfValue_T * WALBERLA_RESTRICT pW  = &src->get( 0, y, z, Stencil::idx[W]);
+         PdfValue_T * WALBERLA_RESTRICT pE  = &src->get( 0, y, z, Stencil::idx[E]);
+         PdfValue_T * WALBERLA_RESTRICT pT  = &src->get( 0, y, z, Stencil::idx[T]);
+         PdfValue_T * WALBERLA_RESTRICT pB  = &src->get( 0, y, z, Stencil::idx[B]);
+         PdfValue_T * WALBERLA_RESTRICT pNW = &src->get( 0, y, z, Stencil::idx[NW]);
+         PdfValue_T * WALBERLA_RESTRICT pNE = &src->get( 0, y, z, Stencil::idx[NE]);
+         PdfValue_T * WALBERLA_RESTRICT pSW = &src->get( 0, y, z, Stencil::idx[SW]);
+         PdfValue_T * WALBERLA_RESTRICT pSE = &src->get( 0, y, z, Stencil::idx[SE]);
+         PdfValue_T * WALBERLA_RESTRICT pTN = &src->get( 0, y, z, Stencil::idx[TN]);
+         PdfValue_T * WALBERLA_RESTRICT pTS = &src->get( 0, y, z, Stencil::idx[TS]);
+         PdfValue_T * WALBERLA_RESTRICT pTW = &src->get( 0, y, z, Stencil::idx[TW]);
+         PdfValue_T * WALBERLA_RESTRICT pTE = &src->get( 0, y, z, Stencil::idx[TE]);
+         PdfValue_T * WALBERLA_RESTRICT pBN = &src->get( 0, y, z, Stencil::idx[BN]);
+         PdfValue_T * WALBERLA_RESTRICT pBS = &src->get( 0, y, z, Stencil::idx[BS]);
+         PdfValue_T * WALBERLA_RESTRICT pBW = &src->get( 0, y, z, Stencil::idx[BW]);
+         PdfValue_T * WALBERLA_RESTRICT pBE = &src->get( 0, y, z, Stencil::idx[BE]);
 
          X_LOOP
          (
-            const real_t velX_trm = pE[x] + pNE[x] + pSE[x] + pTE[x] + pBE[x];
-            const real_t velY_trm = pN[x] + pNW[x] + pTN[x] + pBN[x];
-            const real_t velZ_trm = pT[x] + pTS[x] + pTW[x];
+            const real_t velX_trm = real_t( pE[x] ) + pNE[x] + pSE[x] + pTE[x] + pBE[x];
+            const real_t velY_trm = real_t( pN[x] ) + pNW[x] + pTN[x] + pBN[x];
+            const real_t velZ_trm = real_t( pT[x] ) + pTS[x] + pTW[x];
 
-            const real_t rho = pC[x] + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
+            const real_t rho = real_t( pC[x] ) + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
 
             velX[x] = velX_trm - pW[x]  - pNW[x] - pSW[x] - pTW[x] - pBW[x];
             velY[x] = velY_trm + pNE[x] - pS[x]  - pSW[x] - pSE[x] - pTS[x] - pBS[x];
@@ -589,94 +596,94 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             feq_common[x] = rho - real_t(1.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            pC[x] = pC[x] * (real_t(1.0) - lambda_e) + lambda_e * t0 * feq_common[x];
+            pC[x] = PdfValue_T( pC[x] * (real_t(1.0) - lambda_e) + lambda_e * t0 * feq_common[x] );
          )
 
          X_LOOP
          (
             const real_t velXPY = velX[x] + velY[x];
-            const real_t  sym_NE_SW = lambda_e_scaled * ( pNE[x] + pSW[x] - fac2 * velXPY * velXPY - t2x2 * feq_common[x] );
-            const real_t asym_NE_SW = lambda_d_scaled * ( pNE[x] - pSW[x] - real_t(3.0) * t2x2 * velXPY );
+            const real_t  sym_NE_SW = lambda_e_scaled * ( real_t( pNE[x] ) + pSW[x] - fac2 * velXPY * velXPY - t2x2 * feq_common[x] );
+            const real_t asym_NE_SW = lambda_d_scaled * ( real_t( pNE[x] ) - pSW[x] - real_t(3.0) * t2x2 * velXPY );
 
-            pNE[x] = pNE[x] - sym_NE_SW - asym_NE_SW;
-            pSW[x] = pSW[x] - sym_NE_SW + asym_NE_SW;
+            pNE[x] = PdfValue_T( pNE[x] - sym_NE_SW - asym_NE_SW );
+            pSW[x] = PdfValue_T( pSW[x] - sym_NE_SW + asym_NE_SW );
          )
 
          X_LOOP
          (
             const real_t velXMY = velX[x] - velY[x];
-            const real_t  sym_SE_NW = lambda_e_scaled * ( pSE[x] + pNW[x] - fac2 * velXMY * velXMY - t2x2 * feq_common[x] );
-            const real_t asym_SE_NW = lambda_d_scaled * ( pSE[x] - pNW[x] - real_t(3.0) * t2x2 * velXMY );
+            const real_t  sym_SE_NW = lambda_e_scaled * ( real_t( pSE[x] ) + pNW[x] - fac2 * velXMY * velXMY - t2x2 * feq_common[x] );
+            const real_t asym_SE_NW = lambda_d_scaled * ( real_t( pSE[x] ) - pNW[x] - real_t(3.0) * t2x2 * velXMY );
 
-            pSE[x] = pSE[x] - sym_SE_NW - asym_SE_NW;
-            pNW[x] = pNW[x] - sym_SE_NW + asym_SE_NW;
+            pSE[x] = PdfValue_T( pSE[x] - sym_SE_NW - asym_SE_NW );
+            pNW[x] = PdfValue_T( pNW[x] - sym_SE_NW + asym_SE_NW );
          )
 
          X_LOOP
          (
             const real_t velXPZ = velX[x] + velZ[x];
-            const real_t  sym_TE_BW = lambda_e_scaled * ( pTE[x] + pBW[x] - fac2 * velXPZ * velXPZ - t2x2 * feq_common[x] );
-            const real_t asym_TE_BW = lambda_d_scaled * ( pTE[x] - pBW[x] - real_t(3.0) * t2x2 * velXPZ );
+            const real_t  sym_TE_BW = lambda_e_scaled * ( real_t( pTE[x] ) + pBW[x] - fac2 * velXPZ * velXPZ - t2x2 * feq_common[x] );
+            const real_t asym_TE_BW = lambda_d_scaled * ( real_t( pTE[x] ) - pBW[x] - real_t(3.0) * t2x2 * velXPZ );
 
-            pTE[x] = pTE[x] - sym_TE_BW - asym_TE_BW;
-            pBW[x] = pBW[x] - sym_TE_BW + asym_TE_BW;
+            pTE[x] = PdfValue_T( pTE[x] - sym_TE_BW - asym_TE_BW );
+            pBW[x] = PdfValue_T( pBW[x] - sym_TE_BW + asym_TE_BW );
          )
 
          X_LOOP
          (
             const real_t velXMZ = velX[x] - velZ[x];
-            const real_t  sym_BE_TW = lambda_e_scaled * ( pBE[x] + pTW[x] - fac2 * velXMZ * velXMZ - t2x2 * feq_common[x] );
-            const real_t asym_BE_TW = lambda_d_scaled * ( pBE[x] - pTW[x] - real_t(3.0) * t2x2 * velXMZ );
+            const real_t  sym_BE_TW = lambda_e_scaled * ( real_t( pBE[x] ) + pTW[x] - fac2 * velXMZ * velXMZ - t2x2 * feq_common[x] );
+            const real_t asym_BE_TW = lambda_d_scaled * ( real_t( pBE[x] ) - pTW[x] - real_t(3.0) * t2x2 * velXMZ );
 
-            pBE[x] = pBE[x] - sym_BE_TW - asym_BE_TW;
-            pTW[x] = pTW[x] - sym_BE_TW + asym_BE_TW;
+            pBE[x] = PdfValue_T( pBE[x] - sym_BE_TW - asym_BE_TW );
+            pTW[x] = PdfValue_T( pTW[x] - sym_BE_TW + asym_BE_TW );
          )
 
          X_LOOP
          (
             const real_t velYPZ = velY[x] + velZ[x];
-            const real_t  sym_TN_BS = lambda_e_scaled * ( pTN[x] + pBS[x] - fac2 * velYPZ * velYPZ - t2x2 * feq_common[x] );
-            const real_t asym_TN_BS = lambda_d_scaled * ( pTN[x] - pBS[x] - real_t(3.0) * t2x2 * velYPZ );
+            const real_t  sym_TN_BS = lambda_e_scaled * ( real_t( pTN[x] ) + pBS[x] - fac2 * velYPZ * velYPZ - t2x2 * feq_common[x] );
+            const real_t asym_TN_BS = lambda_d_scaled * ( real_t( pTN[x] ) - pBS[x] - real_t(3.0) * t2x2 * velYPZ );
 
-            pTN[x] = pTN[x] - sym_TN_BS - asym_TN_BS;
-            pBS[x] = pBS[x] - sym_TN_BS + asym_TN_BS;
+            pTN[x] = PdfValue_T( pTN[x] - sym_TN_BS - asym_TN_BS );
+            pBS[x] = PdfValue_T( pBS[x] - sym_TN_BS + asym_TN_BS );
          )
 
          X_LOOP
          (
             const real_t velYMZ = velY[x] - velZ[x];
-            const real_t  sym_BN_TS = lambda_e_scaled * ( pBN[x] + pTS[x] - fac2 * velYMZ * velYMZ - t2x2 * feq_common[x] );
-            const real_t asym_BN_TS = lambda_d_scaled * ( pBN[x] - pTS[x] - real_t(3.0) * t2x2 * velYMZ );
+            const real_t  sym_BN_TS = lambda_e_scaled * ( real_t( pBN[x] ) + pTS[x] - fac2 * velYMZ * velYMZ - t2x2 * feq_common[x] );
+            const real_t asym_BN_TS = lambda_d_scaled * ( real_t( pBN[x] ) - pTS[x] - real_t(3.0) * t2x2 * velYMZ );
 
-            pBN[x] = pBN[x] - sym_BN_TS - asym_BN_TS;
-            pTS[x] = pTS[x] - sym_BN_TS + asym_BN_TS;
+            pBN[x] = PdfValue_T( pBN[x] - sym_BN_TS - asym_BN_TS );
+            pTS[x] = PdfValue_T( pTS[x] - sym_BN_TS + asym_BN_TS );
          )
 
          X_LOOP
          (
-            const real_t  sym_N_S = lambda_e_scaled * ( pN[x] + pS[x] - fac1 * velY[x] * velY[x] - t1x2 * feq_common[x] );
-            const real_t asym_N_S = lambda_d_scaled * ( pN[x] - pS[x] - real_t(3.0) * t1x2 * velY[x] );
+            const real_t  sym_N_S = lambda_e_scaled * ( real_t( pN[x] ) + pS[x] - fac1 * velY[x] * velY[x] - t1x2 * feq_common[x] );
+            const real_t asym_N_S = lambda_d_scaled * ( real_t( pN[x] ) - pS[x] - real_t(3.0) * t1x2 * velY[x] );
 
-            pN[x] = pN[x] - sym_N_S - asym_N_S;
-            pS[x] = pS[x] - sym_N_S + asym_N_S;
+            pN[x] = PdfValue_T( pN[x] - sym_N_S - asym_N_S );
+            pS[x] = PdfValue_T( pS[x] - sym_N_S + asym_N_S );
          )
 
          X_LOOP
          (
-            const real_t  sym_E_W = lambda_e_scaled * ( pE[x] + pW[x] - fac1 * velX[x] * velX[x] - t1x2 * feq_common[x] );
-            const real_t asym_E_W = lambda_d_scaled * ( pE[x] - pW[x] - real_t(3.0) * t1x2 * velX[x] );
+            const real_t  sym_E_W = lambda_e_scaled * ( real_t( pE[x] ) + pW[x] - fac1 * velX[x] * velX[x] - t1x2 * feq_common[x] );
+            const real_t asym_E_W = lambda_d_scaled * ( real_t( pE[x] ) - pW[x] - real_t(3.0) * t1x2 * velX[x] );
 
-            pE[x] = pE[x] - sym_E_W - asym_E_W;
-            pW[x] = pW[x] - sym_E_W + asym_E_W;
+            pE[x] = PdfValue_T( pE[x] - sym_E_W - asym_E_W );
+            pW[x] = PdfValue_T( pW[x] - sym_E_W + asym_E_W );
          )
 
          X_LOOP
          (
-            const real_t  sym_T_B = lambda_e_scaled * ( pT[x] + pB[x] - fac1 * velZ[x] * velZ[x] - t1x2 * feq_common[x] );
-            const real_t asym_T_B = lambda_d_scaled * ( pT[x] - pB[x] - real_t(3.0) * t1x2 * velZ[x] );
+            const real_t  sym_T_B = lambda_e_scaled * ( real_t( pT[x] ) + pB[x] - fac1 * velZ[x] * velZ[x] - t1x2 * feq_common[x] );
+            const real_t asym_T_B = lambda_d_scaled * ( real_t( pT[x] ) - pB[x] - real_t(3.0) * t1x2 * velZ[x] );
 
-            pT[x] = pT[x] - sym_T_B - asym_T_B;
-            pB[x] = pB[x] - sym_T_B + asym_T_B;
+            pT[x] = PdfValue_T( pT[x] - sym_T_B - asym_T_B );
+            pB[x] = PdfValue_T( pB[x] - sym_T_B + asym_T_B );
          )
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -721,7 +728,7 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             feq_common[x] = rho - real_t(1.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            src->get( x, y, z, Stencil::idx[C] ) = dd_tmp_C * (real_t(1.0) - lambda_e) + lambda_e * t0 * feq_common[x];
+            src->get( x, y, z, Stencil::idx[C] ) = PdfValue_T( dd_tmp_C * (real_t(1.0) - lambda_e) + lambda_e * t0 * feq_common[x] );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -733,8 +740,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_NE_SW = lambda_e_scaled * ( dd_tmp_NE + dd_tmp_SW - fac2 * velXPY * velXPY - t2x2 * feq_common[x] );
             const real_t asym_NE_SW = lambda_d_scaled * ( dd_tmp_NE - dd_tmp_SW - real_t(3.0) * t2x2 * velXPY );
 
-            src->get( x, y, z, Stencil::idx[NE] ) = dd_tmp_NE - sym_NE_SW - asym_NE_SW;
-            src->get( x, y, z, Stencil::idx[SW] ) = dd_tmp_SW - sym_NE_SW + asym_NE_SW;
+            src->get( x, y, z, Stencil::idx[NE] ) = PdfValue_T( dd_tmp_NE - sym_NE_SW - asym_NE_SW );
+            src->get( x, y, z, Stencil::idx[SW] ) = PdfValue_T( dd_tmp_SW - sym_NE_SW + asym_NE_SW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -746,8 +753,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_SE_NW = lambda_e_scaled * ( dd_tmp_SE + dd_tmp_NW - fac2 * velXMY * velXMY - t2x2 * feq_common[x] );
             const real_t asym_SE_NW = lambda_d_scaled * ( dd_tmp_SE - dd_tmp_NW - real_t(3.0) * t2x2 * velXMY );
 
-            src->get( x, y, z, Stencil::idx[SE] ) = dd_tmp_SE - sym_SE_NW - asym_SE_NW;
-            src->get( x, y, z, Stencil::idx[NW] ) = dd_tmp_NW - sym_SE_NW + asym_SE_NW;
+            src->get( x, y, z, Stencil::idx[SE] ) = PdfValue_T( dd_tmp_SE - sym_SE_NW - asym_SE_NW );
+            src->get( x, y, z, Stencil::idx[NW] ) = PdfValue_T( dd_tmp_NW - sym_SE_NW + asym_SE_NW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -759,8 +766,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_TE_BW = lambda_e_scaled * ( dd_tmp_TE + dd_tmp_BW - fac2 * velXPZ * velXPZ - t2x2 * feq_common[x] );
             const real_t asym_TE_BW = lambda_d_scaled * ( dd_tmp_TE - dd_tmp_BW - real_t(3.0) * t2x2 * velXPZ );
 
-            src->get( x, y, z, Stencil::idx[TE] ) = dd_tmp_TE - sym_TE_BW - asym_TE_BW;
-            src->get( x, y, z, Stencil::idx[BW] ) = dd_tmp_BW - sym_TE_BW + asym_TE_BW;
+            src->get( x, y, z, Stencil::idx[TE] ) = PdfValue_T( dd_tmp_TE - sym_TE_BW - asym_TE_BW );
+            src->get( x, y, z, Stencil::idx[BW] ) = PdfValue_T( dd_tmp_BW - sym_TE_BW + asym_TE_BW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -772,8 +779,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_BE_TW = lambda_e_scaled * ( dd_tmp_BE + dd_tmp_TW - fac2 * velXMZ * velXMZ - t2x2 * feq_common[x] );
             const real_t asym_BE_TW = lambda_d_scaled * ( dd_tmp_BE - dd_tmp_TW - real_t(3.0) * t2x2 * velXMZ );
 
-            src->get( x, y, z, Stencil::idx[BE] ) = dd_tmp_BE - sym_BE_TW - asym_BE_TW;
-            src->get( x, y, z, Stencil::idx[TW] ) = dd_tmp_TW - sym_BE_TW + asym_BE_TW;
+            src->get( x, y, z, Stencil::idx[BE] ) = PdfValue_T( dd_tmp_BE - sym_BE_TW - asym_BE_TW );
+            src->get( x, y, z, Stencil::idx[TW] ) = PdfValue_T( dd_tmp_TW - sym_BE_TW + asym_BE_TW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -785,8 +792,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_TN_BS = lambda_e_scaled * ( dd_tmp_TN + dd_tmp_BS - fac2 * velYPZ * velYPZ - t2x2 * feq_common[x] );
             const real_t asym_TN_BS = lambda_d_scaled * ( dd_tmp_TN - dd_tmp_BS - real_t(3.0) * t2x2 * velYPZ );
 
-            src->get( x, y, z, Stencil::idx[TN] ) = dd_tmp_TN - sym_TN_BS - asym_TN_BS;
-            src->get( x, y, z, Stencil::idx[BS] ) = dd_tmp_BS - sym_TN_BS + asym_TN_BS;
+            src->get( x, y, z, Stencil::idx[TN] ) = PdfValue_T( dd_tmp_TN - sym_TN_BS - asym_TN_BS );
+            src->get( x, y, z, Stencil::idx[BS] ) = PdfValue_T( dd_tmp_BS - sym_TN_BS + asym_TN_BS );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -798,8 +805,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_BN_TS = lambda_e_scaled * ( dd_tmp_BN + dd_tmp_TS - fac2 * velYMZ * velYMZ - t2x2 * feq_common[x] );
             const real_t asym_BN_TS = lambda_d_scaled * ( dd_tmp_BN - dd_tmp_TS - real_t(3.0) * t2x2 * velYMZ );
 
-            src->get( x, y, z, Stencil::idx[BN] ) = dd_tmp_BN - sym_BN_TS - asym_BN_TS;
-            src->get( x, y, z, Stencil::idx[TS] ) = dd_tmp_TS - sym_BN_TS + asym_BN_TS;
+            src->get( x, y, z, Stencil::idx[BN] ) = PdfValue_T( dd_tmp_BN - sym_BN_TS - asym_BN_TS );
+            src->get( x, y, z, Stencil::idx[TS] ) = PdfValue_T( dd_tmp_TS - sym_BN_TS + asym_BN_TS );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -810,8 +817,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_N_S = lambda_e_scaled * ( dd_tmp_N + dd_tmp_S - fac1 * velY[x] * velY[x] - t1x2 * feq_common[x] );
             const real_t asym_N_S = lambda_d_scaled * ( dd_tmp_N - dd_tmp_S - real_t(3.0) * t1x2 * velY[x] );
 
-            src->get( x, y, z, Stencil::idx[N] ) = dd_tmp_N - sym_N_S - asym_N_S;
-            src->get( x, y, z, Stencil::idx[S] ) = dd_tmp_S - sym_N_S + asym_N_S;
+            src->get( x, y, z, Stencil::idx[N] ) = PdfValue_T( dd_tmp_N - sym_N_S - asym_N_S );
+            src->get( x, y, z, Stencil::idx[S] ) = PdfValue_T( dd_tmp_S - sym_N_S + asym_N_S );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -822,8 +829,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_E_W = lambda_e_scaled * ( dd_tmp_E + dd_tmp_W - fac1 * velX[x] * velX[x] - t1x2 * feq_common[x] );
             const real_t asym_E_W = lambda_d_scaled * ( dd_tmp_E - dd_tmp_W - real_t(3.0) * t1x2 * velX[x] );
 
-            src->get( x, y, z, Stencil::idx[E] ) = dd_tmp_E - sym_E_W - asym_E_W;
-            src->get( x, y, z, Stencil::idx[W] ) = dd_tmp_W - sym_E_W + asym_E_W;
+            src->get( x, y, z, Stencil::idx[E] ) = PdfValue_T( dd_tmp_E - sym_E_W - asym_E_W );
+            src->get( x, y, z, Stencil::idx[W] ) = PdfValue_T( dd_tmp_W - sym_E_W + asym_E_W );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -834,8 +841,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_T_B = lambda_e_scaled * ( dd_tmp_T + dd_tmp_B - fac1 * velZ[x] * velZ[x] - t1x2 * feq_common[x] );
             const real_t asym_T_B = lambda_d_scaled * ( dd_tmp_T - dd_tmp_B - real_t(3.0) * t1x2 * velZ[x] );
 
-            src->get( x, y, z, Stencil::idx[T] ) = dd_tmp_T - sym_T_B - asym_T_B;
-            src->get( x, y, z, Stencil::idx[B] ) = dd_tmp_B - sym_T_B + asym_T_B;
+            src->get( x, y, z, Stencil::idx[T] ) = PdfValue_T( dd_tmp_T - sym_T_B - asym_T_B );
+            src->get( x, y, z, Stencil::idx[B] ) = PdfValue_T( dd_tmp_B - sym_T_B + asym_T_B );
          }
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -879,6 +886,7 @@ public:
 
    typedef typename SweepBase<LatticeModel_T>::PdfField_T  PdfField_T;
    typedef typename LatticeModel_T::Stencil                Stencil;
+   typedef typename PdfField_T::value_type                 PdfValue_T;
 
    // block has NO dst pdf field
    SplitPureSweep( const BlockDataID & pdfField ) :
@@ -953,35 +961,35 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
          using namespace stencil;
 
-         real_t * WALBERLA_RESTRICT pNE = &src->get(-1, y-1, z  , Stencil::idx[NE]);
-         real_t * WALBERLA_RESTRICT pN  = &src->get(0 , y-1, z  , Stencil::idx[N]);
-         real_t * WALBERLA_RESTRICT pNW = &src->get(+1, y-1, z  , Stencil::idx[NW]);
-         real_t * WALBERLA_RESTRICT pW  = &src->get(+1, y  , z  , Stencil::idx[W]);
-         real_t * WALBERLA_RESTRICT pSW = &src->get(+1, y+1, z  , Stencil::idx[SW]);
-         real_t * WALBERLA_RESTRICT pS  = &src->get(0 , y+1, z  , Stencil::idx[S]);
-         real_t * WALBERLA_RESTRICT pSE = &src->get(-1, y+1, z  , Stencil::idx[SE]);
-         real_t * WALBERLA_RESTRICT pE  = &src->get(-1, y  , z  , Stencil::idx[E]);
-         real_t * WALBERLA_RESTRICT pT  = &src->get(0 , y  , z-1, Stencil::idx[T]);
-         real_t * WALBERLA_RESTRICT pTE = &src->get(-1, y  , z-1, Stencil::idx[TE]);
-         real_t * WALBERLA_RESTRICT pTN = &src->get(0 , y-1, z-1, Stencil::idx[TN]);
-         real_t * WALBERLA_RESTRICT pTW = &src->get(+1, y  , z-1, Stencil::idx[TW]);
-         real_t * WALBERLA_RESTRICT pTS = &src->get(0 , y+1, z-1, Stencil::idx[TS]);
-         real_t * WALBERLA_RESTRICT pB  = &src->get(0 , y  , z+1, Stencil::idx[B]);
-         real_t * WALBERLA_RESTRICT pBE = &src->get(-1, y  , z+1, Stencil::idx[BE]);
-         real_t * WALBERLA_RESTRICT pBN = &src->get(0 , y-1, z+1, Stencil::idx[BN]);
-         real_t * WALBERLA_RESTRICT pBW = &src->get(+1, y  , z+1, Stencil::idx[BW]);
-         real_t * WALBERLA_RESTRICT pBS = &src->get(0 , y+1, z+1, Stencil::idx[BS]);
-         real_t * WALBERLA_RESTRICT pC  = &src->get(0 , y  , z  , Stencil::idx[C]);
-
-         real_t * WALBERLA_RESTRICT dC = &dst->get(0,y,z,Stencil::idx[C]);
+         PdfValue_T * WALBERLA_RESTRICT pNE = &src->get(-1, y-1, z  , Stencil::idx[NE]);
+         PdfValue_T * WALBERLA_RESTRICT pN  = &src->get(0 , y-1, z  , Stencil::idx[N]);
+         PdfValue_T * WALBERLA_RESTRICT pNW = &src->get(+1, y-1, z  , Stencil::idx[NW]);
+         PdfValue_T * WALBERLA_RESTRICT pW  = &src->get(+1, y  , z  , Stencil::idx[W]);
+         PdfValue_T * WALBERLA_RESTRICT pSW = &src->get(+1, y+1, z  , Stencil::idx[SW]);
+         PdfValue_T * WALBERLA_RESTRICT pS  = &src->get(0 , y+1, z  , Stencil::idx[S]);
+         PdfValue_T * WALBERLA_RESTRICT pSE = &src->get(-1, y+1, z  , Stencil::idx[SE]);
+         PdfValue_T * WALBERLA_RESTRICT pE  = &src->get(-1, y  , z  , Stencil::idx[E]);
+         PdfValue_T * WALBERLA_RESTRICT pT  = &src->get(0 , y  , z-1, Stencil::idx[T]);
+         PdfValue_T * WALBERLA_RESTRICT pTE = &src->get(-1, y  , z-1, Stencil::idx[TE]);
+         PdfValue_T * WALBERLA_RESTRICT pTN = &src->get(0 , y-1, z-1, Stencil::idx[TN]);
+         PdfValue_T * WALBERLA_RESTRICT pTW = &src->get(+1, y  , z-1, Stencil::idx[TW]);
+         PdfValue_T * WALBERLA_RESTRICT pTS = &src->get(0 , y+1, z-1, Stencil::idx[TS]);
+         PdfValue_T * WALBERLA_RESTRICT pB  = &src->get(0 , y  , z+1, Stencil::idx[B]);
+         PdfValue_T * WALBERLA_RESTRICT pBE = &src->get(-1, y  , z+1, Stencil::idx[BE]);
+         PdfValue_T * WALBERLA_RESTRICT pBN = &src->get(0 , y-1, z+1, Stencil::idx[BN]);
+         PdfValue_T * WALBERLA_RESTRICT pBW = &src->get(+1, y  , z+1, Stencil::idx[BW]);
+         PdfValue_T * WALBERLA_RESTRICT pBS = &src->get(0 , y+1, z+1, Stencil::idx[BS]);
+         PdfValue_T * WALBERLA_RESTRICT pC  = &src->get(0 , y  , z  , Stencil::idx[C]);
+
+         PdfValue_T * WALBERLA_RESTRICT dC = &dst->get(0,y,z,Stencil::idx[C]);
 
          X_LOOP
          (
-            const real_t velX_trm = pE[x] + pNE[x] + pSE[x] + pTE[x] + pBE[x];
-            const real_t velY_trm = pN[x] + pNW[x] + pTN[x] + pBN[x];
-            const real_t velZ_trm = pT[x] + pTS[x] + pTW[x];
+            const real_t velX_trm = real_t( pE[x] ) + pNE[x] + pSE[x] + pTE[x] + pBE[x];
+            const real_t velY_trm = real_t( pN[x] ) + pNW[x] + pTN[x] + pBN[x];
+            const real_t velZ_trm = real_t( pT[x] ) + pTS[x] + pTW[x];
 
-            const real_t rho = pC[x] + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
+            const real_t rho = real_t( pC[x] ) + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
             const real_t invRho = real_t(1.0) / rho;
 
             velX[x] = invRho * ( velX_trm - pW[x]  - pNW[x] - pSW[x] - pTW[x] - pBW[x] );
@@ -995,121 +1003,121 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             feq_common[x] = real_t(1.0) - real_t(1.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            dC[x] = pC[x] * (real_t(1.0) - lambda_e) + lambda_e * t0_0 * rho * feq_common[x];
+            dC[x] = PdfValue_T( pC[x] * (real_t(1.0) - lambda_e) + lambda_e * t0_0 * rho * feq_common[x] );
          )
 
-         real_t * WALBERLA_RESTRICT dNE = &dst->get(0,y,z,Stencil::idx[NE]);
-         real_t * WALBERLA_RESTRICT dSW = &dst->get(0,y,z,Stencil::idx[SW]);
+         PdfValue_T * WALBERLA_RESTRICT dNE = &dst->get(0,y,z,Stencil::idx[NE]);
+         PdfValue_T * WALBERLA_RESTRICT dSW = &dst->get(0,y,z,Stencil::idx[SW]);
 
          X_LOOP
          (
             const real_t velXPY = velX[x] + velY[x];
-            const real_t  sym_NE_SW = lambda_e_scaled * ( pNE[x] + pSW[x] - fac2[x] * velXPY * velXPY - t2x2[x] * feq_common[x] );
-            const real_t asym_NE_SW = lambda_d_scaled * ( pNE[x] - pSW[x] - real_t(3.0) * t2x2[x] * velXPY );
+            const real_t  sym_NE_SW = lambda_e_scaled * ( real_t( pNE[x] ) + pSW[x] - fac2[x] * velXPY * velXPY - t2x2[x] * feq_common[x] );
+            const real_t asym_NE_SW = lambda_d_scaled * ( real_t( pNE[x] ) - pSW[x] - real_t(3.0) * t2x2[x] * velXPY );
 
-            dNE[x] = pNE[x] - sym_NE_SW - asym_NE_SW;
-            dSW[x] = pSW[x] - sym_NE_SW + asym_NE_SW;
+            dNE[x] = PdfValue_T( pNE[x] - sym_NE_SW - asym_NE_SW );
+            dSW[x] = PdfValue_T( pSW[x] - sym_NE_SW + asym_NE_SW );
          )
 
-         real_t * WALBERLA_RESTRICT dSE = &dst->get(0,y,z,Stencil::idx[SE]);
-         real_t * WALBERLA_RESTRICT dNW = &dst->get(0,y,z,Stencil::idx[NW]);
+         PdfValue_T * WALBERLA_RESTRICT dSE = &dst->get(0,y,z,Stencil::idx[SE]);
+         PdfValue_T * WALBERLA_RESTRICT dNW = &dst->get(0,y,z,Stencil::idx[NW]);
 
          X_LOOP
          (
             const real_t velXMY = velX[x] - velY[x];
-            const real_t  sym_SE_NW = lambda_e_scaled * ( pSE[x] + pNW[x] - fac2[x] * velXMY * velXMY - t2x2[x] * feq_common[x] );
-            const real_t asym_SE_NW = lambda_d_scaled * ( pSE[x] - pNW[x] - real_t(3.0) * t2x2[x] * velXMY );
+            const real_t  sym_SE_NW = lambda_e_scaled * ( real_t( pSE[x] ) + pNW[x] - fac2[x] * velXMY * velXMY - t2x2[x] * feq_common[x] );
+            const real_t asym_SE_NW = lambda_d_scaled * ( real_t( pSE[x] ) - pNW[x] - real_t(3.0) * t2x2[x] * velXMY );
 
-            dSE[x] = pSE[x] - sym_SE_NW - asym_SE_NW;
-            dNW[x] = pNW[x] - sym_SE_NW + asym_SE_NW;
+            dSE[x] = PdfValue_T( pSE[x] - sym_SE_NW - asym_SE_NW );
+            dNW[x] = PdfValue_T( pNW[x] - sym_SE_NW + asym_SE_NW );
          )
 
-         real_t * WALBERLA_RESTRICT dTE = &dst->get(0,y,z,Stencil::idx[TE]);
-         real_t * WALBERLA_RESTRICT dBW = &dst->get(0,y,z,Stencil::idx[BW]);
+         PdfValue_T * WALBERLA_RESTRICT dTE = &dst->get(0,y,z,Stencil::idx[TE]);
+         PdfValue_T * WALBERLA_RESTRICT dBW = &dst->get(0,y,z,Stencil::idx[BW]);
 
          X_LOOP
          (
             const real_t velXPZ = velX[x] + velZ[x];
-            const real_t  sym_TE_BW = lambda_e_scaled * ( pTE[x] + pBW[x] - fac2[x] * velXPZ * velXPZ - t2x2[x] * feq_common[x] );
-            const real_t asym_TE_BW = lambda_d_scaled * ( pTE[x] - pBW[x] - real_t(3.0) * t2x2[x] * velXPZ );
+            const real_t  sym_TE_BW = lambda_e_scaled * ( real_t( pTE[x] ) + pBW[x] - fac2[x] * velXPZ * velXPZ - t2x2[x] * feq_common[x] );
+            const real_t asym_TE_BW = lambda_d_scaled * ( real_t( pTE[x] ) - pBW[x] - real_t(3.0) * t2x2[x] * velXPZ );
 
-            dTE[x] = pTE[x] - sym_TE_BW - asym_TE_BW;
-            dBW[x] = pBW[x] - sym_TE_BW + asym_TE_BW;
+            dTE[x] = PdfValue_T( pTE[x] - sym_TE_BW - asym_TE_BW );
+            dBW[x] = PdfValue_T( pBW[x] - sym_TE_BW + asym_TE_BW );
          )
 
-         real_t * WALBERLA_RESTRICT dBE = &dst->get(0,y,z,Stencil::idx[BE]);
-         real_t * WALBERLA_RESTRICT dTW = &dst->get(0,y,z,Stencil::idx[TW]);
+         PdfValue_T * WALBERLA_RESTRICT dBE = &dst->get(0,y,z,Stencil::idx[BE]);
+         PdfValue_T * WALBERLA_RESTRICT dTW = &dst->get(0,y,z,Stencil::idx[TW]);
 
          X_LOOP
          (
             const real_t velXMZ = velX[x] - velZ[x];
-            const real_t  sym_BE_TW = lambda_e_scaled * ( pBE[x] + pTW[x] - fac2[x] * velXMZ * velXMZ - t2x2[x] * feq_common[x] );
-            const real_t asym_BE_TW = lambda_d_scaled * ( pBE[x] - pTW[x] - real_t(3.0) * t2x2[x] * velXMZ );
+            const real_t  sym_BE_TW = lambda_e_scaled * ( real_t( pBE[x] ) + pTW[x] - fac2[x] * velXMZ * velXMZ - t2x2[x] * feq_common[x] );
+            const real_t asym_BE_TW = lambda_d_scaled * ( real_t( pBE[x] ) - pTW[x] - real_t(3.0) * t2x2[x] * velXMZ );
 
-            dBE[x] = pBE[x] - sym_BE_TW - asym_BE_TW;
-            dTW[x] = pTW[x] - sym_BE_TW + asym_BE_TW;
+            dBE[x] = PdfValue_T( pBE[x] - sym_BE_TW - asym_BE_TW );
+            dTW[x] = PdfValue_T( pTW[x] - sym_BE_TW + asym_BE_TW );
          )
 
-         real_t * WALBERLA_RESTRICT dTN = &dst->get(0,y,z,Stencil::idx[TN]);
-         real_t * WALBERLA_RESTRICT dBS = &dst->get(0,y,z,Stencil::idx[BS]);
+         PdfValue_T * WALBERLA_RESTRICT dTN = &dst->get(0,y,z,Stencil::idx[TN]);
+         PdfValue_T * WALBERLA_RESTRICT dBS = &dst->get(0,y,z,Stencil::idx[BS]);
 
          X_LOOP
          (
             const real_t velYPZ = velY[x] + velZ[x];
-            const real_t  sym_TN_BS = lambda_e_scaled * ( pTN[x] + pBS[x] - fac2[x] * velYPZ * velYPZ - t2x2[x] * feq_common[x] );
-            const real_t asym_TN_BS = lambda_d_scaled * ( pTN[x] - pBS[x] - real_t(3.0) * t2x2[x] * velYPZ );
+            const real_t  sym_TN_BS = lambda_e_scaled * ( real_t( pTN[x] ) + pBS[x] - fac2[x] * velYPZ * velYPZ - t2x2[x] * feq_common[x] );
+            const real_t asym_TN_BS = lambda_d_scaled * ( real_t( pTN[x] ) - pBS[x] - real_t(3.0) * t2x2[x] * velYPZ );
 
-            dTN[x] = pTN[x] - sym_TN_BS - asym_TN_BS;
-            dBS[x] = pBS[x] - sym_TN_BS + asym_TN_BS;
+            dTN[x] = PdfValue_T( pTN[x] - sym_TN_BS - asym_TN_BS );
+            dBS[x] = PdfValue_T( pBS[x] - sym_TN_BS + asym_TN_BS );
          )
 
-         real_t * WALBERLA_RESTRICT dBN = &dst->get(0,y,z,Stencil::idx[BN]);
-         real_t * WALBERLA_RESTRICT dTS = &dst->get(0,y,z,Stencil::idx[TS]);
+         PdfValue_T * WALBERLA_RESTRICT dBN = &dst->get(0,y,z,Stencil::idx[BN]);
+         PdfValue_T * WALBERLA_RESTRICT dTS = &dst->get(0,y,z,Stencil::idx[TS]);
 
          X_LOOP
          (
             const real_t velYMZ = velY[x] - velZ[x];
-            const real_t  sym_BN_TS = lambda_e_scaled * ( pBN[x] + pTS[x] - fac2[x] * velYMZ * velYMZ - t2x2[x] * feq_common[x] );
-            const real_t asym_BN_TS = lambda_d_scaled * ( pBN[x] - pTS[x] - real_t(3.0) * t2x2[x] * velYMZ );
+            const real_t  sym_BN_TS = lambda_e_scaled * ( real_t( pBN[x] ) + pTS[x] - fac2[x] * velYMZ * velYMZ - t2x2[x] * feq_common[x] );
+            const real_t asym_BN_TS = lambda_d_scaled * ( real_t( pBN[x] ) - pTS[x] - real_t(3.0) * t2x2[x] * velYMZ );
 
-            dBN[x] = pBN[x] - sym_BN_TS - asym_BN_TS;
-            dTS[x] = pTS[x] - sym_BN_TS + asym_BN_TS;
+            dBN[x] = PdfValue_T( pBN[x] - sym_BN_TS - asym_BN_TS );
+            dTS[x] = PdfValue_T( pTS[x] - sym_BN_TS + asym_BN_TS );
          )
 
-         real_t * WALBERLA_RESTRICT dN = &dst->get(0,y,z,Stencil::idx[N]);
-         real_t * WALBERLA_RESTRICT dS = &dst->get(0,y,z,Stencil::idx[S]);
+         PdfValue_T * WALBERLA_RESTRICT dN = &dst->get(0,y,z,Stencil::idx[N]);
+         PdfValue_T * WALBERLA_RESTRICT dS = &dst->get(0,y,z,Stencil::idx[S]);
 
          X_LOOP
          (
-            const real_t  sym_N_S = lambda_e_scaled * ( pN[x] + pS[x] - fac1[x] * velY[x] * velY[x] - t1x2[x] * feq_common[x] );
-            const real_t asym_N_S = lambda_d_scaled * ( pN[x] - pS[x] - real_t(3.0) * t1x2[x] * velY[x] );
+            const real_t  sym_N_S = lambda_e_scaled * ( real_t( pN[x] ) + pS[x] - fac1[x] * velY[x] * velY[x] - t1x2[x] * feq_common[x] );
+            const real_t asym_N_S = lambda_d_scaled * ( real_t( pN[x] ) - pS[x] - real_t(3.0) * t1x2[x] * velY[x] );
 
-            dN[x] = pN[x] - sym_N_S - asym_N_S;
-            dS[x] = pS[x] - sym_N_S + asym_N_S;
+            dN[x] = PdfValue_T( pN[x] - sym_N_S - asym_N_S );
+            dS[x] = PdfValue_T( pS[x] - sym_N_S + asym_N_S );
          )
 
-         real_t * WALBERLA_RESTRICT dE = &dst->get(0,y,z,Stencil::idx[E]);
-         real_t * WALBERLA_RESTRICT dW = &dst->get(0,y,z,Stencil::idx[W]);
+         PdfValue_T * WALBERLA_RESTRICT dE = &dst->get(0,y,z,Stencil::idx[E]);
+         PdfValue_T * WALBERLA_RESTRICT dW = &dst->get(0,y,z,Stencil::idx[W]);
 
          X_LOOP
          (
-            const real_t  sym_E_W = lambda_e_scaled * ( pE[x] + pW[x] - fac1[x] * velX[x] * velX[x] - t1x2[x] * feq_common[x] );
-            const real_t asym_E_W = lambda_d_scaled * ( pE[x] - pW[x] - real_t(3.0) * t1x2[x] * velX[x] );
+            const real_t  sym_E_W = lambda_e_scaled * ( real_t( pE[x] ) + pW[x] - fac1[x] * velX[x] * velX[x] - t1x2[x] * feq_common[x] );
+            const real_t asym_E_W = lambda_d_scaled * ( real_t( pE[x] ) - pW[x] - real_t(3.0) * t1x2[x] * velX[x] );
 
-            dE[x] = pE[x] - sym_E_W - asym_E_W;
-            dW[x] = pW[x] - sym_E_W + asym_E_W;
+            dE[x] = PdfValue_T( pE[x] - sym_E_W - asym_E_W );
+            dW[x] = PdfValue_T( pW[x] - sym_E_W + asym_E_W );
          )
 
-         real_t * WALBERLA_RESTRICT dT = &dst->get(0,y,z,Stencil::idx[T]);
-         real_t * WALBERLA_RESTRICT dB = &dst->get(0,y,z,Stencil::idx[B]);
+         PdfValue_T * WALBERLA_RESTRICT dT = &dst->get(0,y,z,Stencil::idx[T]);
+         PdfValue_T * WALBERLA_RESTRICT dB = &dst->get(0,y,z,Stencil::idx[B]);
 
          X_LOOP
          (
-            const real_t  sym_T_B = lambda_e_scaled * ( pT[x] + pB[x] - fac1[x] * velZ[x] * velZ[x] - t1x2[x] * feq_common[x] );
-            const real_t asym_T_B = lambda_d_scaled * ( pT[x] - pB[x] - real_t(3.0) * t1x2[x] * velZ[x] );
+            const real_t  sym_T_B = lambda_e_scaled * ( real_t( pT[x] ) + pB[x] - fac1[x] * velZ[x] * velZ[x] - t1x2[x] * feq_common[x] );
+            const real_t asym_T_B = lambda_d_scaled * ( real_t( pT[x] ) - pB[x] - real_t(3.0) * t1x2[x] * velZ[x] );
 
-            dT[x] = pT[x] - sym_T_B - asym_T_B;
-            dB[x] = pB[x] - sym_T_B + asym_T_B;
+            dT[x] = PdfValue_T( pT[x] - sym_T_B - asym_T_B );
+            dB[x] = PdfValue_T( pB[x] - sym_T_B + asym_T_B );
          )
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -1160,7 +1168,7 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             feq_common[x] = real_t(1.0) - real_t(1.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            dst->get( x, y, z, Stencil::idx[C] ) = dd_tmp_C * (real_t(1.0) - lambda_e) + lambda_e * t0_0 * rho * feq_common[x];
+            dst->get( x, y, z, Stencil::idx[C] ) = PdfValue_T( dd_tmp_C * (real_t(1.0) - lambda_e) + lambda_e * t0_0 * rho * feq_common[x] );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1172,8 +1180,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_NE_SW = lambda_e_scaled * ( dd_tmp_NE + dd_tmp_SW - fac2[x] * velXPY * velXPY - t2x2[x] * feq_common[x] );
             const real_t asym_NE_SW = lambda_d_scaled * ( dd_tmp_NE - dd_tmp_SW - real_t(3.0) * t2x2[x] * velXPY );
 
-            dst->get( x, y, z, Stencil::idx[NE] ) = dd_tmp_NE - sym_NE_SW - asym_NE_SW;
-            dst->get( x, y, z, Stencil::idx[SW] ) = dd_tmp_SW - sym_NE_SW + asym_NE_SW;
+            dst->get( x, y, z, Stencil::idx[NE] ) = PdfValue_T( dd_tmp_NE - sym_NE_SW - asym_NE_SW );
+            dst->get( x, y, z, Stencil::idx[SW] ) = PdfValue_T( dd_tmp_SW - sym_NE_SW + asym_NE_SW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1185,8 +1193,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_SE_NW = lambda_e_scaled * ( dd_tmp_SE + dd_tmp_NW - fac2[x] * velXMY * velXMY - t2x2[x] * feq_common[x] );
             const real_t asym_SE_NW = lambda_d_scaled * ( dd_tmp_SE - dd_tmp_NW - real_t(3.0) * t2x2[x] * velXMY );
 
-            dst->get( x, y, z, Stencil::idx[SE] ) = dd_tmp_SE - sym_SE_NW - asym_SE_NW;
-            dst->get( x, y, z, Stencil::idx[NW] ) = dd_tmp_NW - sym_SE_NW + asym_SE_NW;
+            dst->get( x, y, z, Stencil::idx[SE] ) = PdfValue_T( dd_tmp_SE - sym_SE_NW - asym_SE_NW );
+            dst->get( x, y, z, Stencil::idx[NW] ) = PdfValue_T( dd_tmp_NW - sym_SE_NW + asym_SE_NW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1198,8 +1206,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_TE_BW = lambda_e_scaled * ( dd_tmp_TE + dd_tmp_BW - fac2[x] * velXPZ * velXPZ - t2x2[x] * feq_common[x] );
             const real_t asym_TE_BW = lambda_d_scaled * ( dd_tmp_TE - dd_tmp_BW - real_t(3.0) * t2x2[x] * velXPZ );
 
-            dst->get( x, y, z, Stencil::idx[TE] ) = dd_tmp_TE - sym_TE_BW - asym_TE_BW;
-            dst->get( x, y, z, Stencil::idx[BW] ) = dd_tmp_BW - sym_TE_BW + asym_TE_BW;
+            dst->get( x, y, z, Stencil::idx[TE] ) = PdfValue_T( dd_tmp_TE - sym_TE_BW - asym_TE_BW );
+            dst->get( x, y, z, Stencil::idx[BW] ) = PdfValue_T( dd_tmp_BW - sym_TE_BW + asym_TE_BW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1211,8 +1219,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_BE_TW = lambda_e_scaled * ( dd_tmp_BE + dd_tmp_TW - fac2[x] * velXMZ * velXMZ - t2x2[x] * feq_common[x] );
             const real_t asym_BE_TW = lambda_d_scaled * ( dd_tmp_BE - dd_tmp_TW - real_t(3.0) * t2x2[x] * velXMZ );
 
-            dst->get( x, y, z, Stencil::idx[BE] ) = dd_tmp_BE - sym_BE_TW - asym_BE_TW;
-            dst->get( x, y, z, Stencil::idx[TW] ) = dd_tmp_TW - sym_BE_TW + asym_BE_TW;
+            dst->get( x, y, z, Stencil::idx[BE] ) = PdfValue_T( dd_tmp_BE - sym_BE_TW - asym_BE_TW );
+            dst->get( x, y, z, Stencil::idx[TW] ) = PdfValue_T( dd_tmp_TW - sym_BE_TW + asym_BE_TW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1224,8 +1232,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_TN_BS = lambda_e_scaled * ( dd_tmp_TN + dd_tmp_BS - fac2[x] * velYPZ * velYPZ - t2x2[x] * feq_common[x] );
             const real_t asym_TN_BS = lambda_d_scaled * ( dd_tmp_TN - dd_tmp_BS - real_t(3.0) * t2x2[x] * velYPZ );
 
-            dst->get( x, y, z, Stencil::idx[TN] ) = dd_tmp_TN - sym_TN_BS - asym_TN_BS;
-            dst->get( x, y, z, Stencil::idx[BS] ) = dd_tmp_BS - sym_TN_BS + asym_TN_BS;
+            dst->get( x, y, z, Stencil::idx[TN] ) = PdfValue_T( dd_tmp_TN - sym_TN_BS - asym_TN_BS );
+            dst->get( x, y, z, Stencil::idx[BS] ) = PdfValue_T( dd_tmp_BS - sym_TN_BS + asym_TN_BS );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1237,8 +1245,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_BN_TS = lambda_e_scaled * ( dd_tmp_BN + dd_tmp_TS - fac2[x] * velYMZ * velYMZ - t2x2[x] * feq_common[x] );
             const real_t asym_BN_TS = lambda_d_scaled * ( dd_tmp_BN - dd_tmp_TS - real_t(3.0) * t2x2[x] * velYMZ );
 
-            dst->get( x, y, z, Stencil::idx[BN] ) = dd_tmp_BN - sym_BN_TS - asym_BN_TS;
-            dst->get( x, y, z, Stencil::idx[TS] ) = dd_tmp_TS - sym_BN_TS + asym_BN_TS;
+            dst->get( x, y, z, Stencil::idx[BN] ) = PdfValue_T( dd_tmp_BN - sym_BN_TS - asym_BN_TS );
+            dst->get( x, y, z, Stencil::idx[TS] ) = PdfValue_T( dd_tmp_TS - sym_BN_TS + asym_BN_TS );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1249,8 +1257,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_N_S = lambda_e_scaled * ( dd_tmp_N + dd_tmp_S - fac1[x] * velY[x] * velY[x] - t1x2[x] * feq_common[x] );
             const real_t asym_N_S = lambda_d_scaled * ( dd_tmp_N - dd_tmp_S - real_t(3.0) * t1x2[x] * velY[x] );
 
-            dst->get( x, y, z, Stencil::idx[N] ) = dd_tmp_N - sym_N_S - asym_N_S;
-            dst->get( x, y, z, Stencil::idx[S] ) = dd_tmp_S - sym_N_S + asym_N_S;
+            dst->get( x, y, z, Stencil::idx[N] ) = PdfValue_T( dd_tmp_N - sym_N_S - asym_N_S );
+            dst->get( x, y, z, Stencil::idx[S] ) = PdfValue_T( dd_tmp_S - sym_N_S + asym_N_S );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1261,8 +1269,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_E_W = lambda_e_scaled * ( dd_tmp_E + dd_tmp_W - fac1[x] * velX[x] * velX[x] - t1x2[x] * feq_common[x] );
             const real_t asym_E_W = lambda_d_scaled * ( dd_tmp_E - dd_tmp_W - real_t(3.0) * t1x2[x] * velX[x] );
 
-            dst->get( x, y, z, Stencil::idx[E] ) = dd_tmp_E - sym_E_W - asym_E_W;
-            dst->get( x, y, z, Stencil::idx[W] ) = dd_tmp_W - sym_E_W + asym_E_W;
+            dst->get( x, y, z, Stencil::idx[E] ) = PdfValue_T( dd_tmp_E - sym_E_W - asym_E_W );
+            dst->get( x, y, z, Stencil::idx[W] ) = PdfValue_T( dd_tmp_W - sym_E_W + asym_E_W );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1273,8 +1281,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_T_B = lambda_e_scaled * ( dd_tmp_T + dd_tmp_B - fac1[x] * velZ[x] * velZ[x] - t1x2[x] * feq_common[x] );
             const real_t asym_T_B = lambda_d_scaled * ( dd_tmp_T - dd_tmp_B - real_t(3.0) * t1x2[x] * velZ[x] );
 
-            dst->get( x, y, z, Stencil::idx[T] ) = dd_tmp_T - sym_T_B - asym_T_B;
-            dst->get( x, y, z, Stencil::idx[B] ) = dd_tmp_B - sym_T_B + asym_T_B;
+            dst->get( x, y, z, Stencil::idx[T] ) = PdfValue_T( dd_tmp_T - sym_T_B - asym_T_B );
+            dst->get( x, y, z, Stencil::idx[B] ) = PdfValue_T( dd_tmp_B - sym_T_B + asym_T_B );
          }
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -1375,33 +1383,33 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
          using namespace stencil;
 
-         real_t * WALBERLA_RESTRICT pC  = &src->get( 0, y, z, Stencil::idx[C]);
-         real_t * WALBERLA_RESTRICT pN  = &src->get( 0, y, z, Stencil::idx[N]);
-         real_t * WALBERLA_RESTRICT pS  = &src->get( 0, y, z, Stencil::idx[S]);
-         real_t * WALBERLA_RESTRICT pW  = &src->get( 0, y, z, Stencil::idx[W]);
-         real_t * WALBERLA_RESTRICT pE  = &src->get( 0, y, z, Stencil::idx[E]);
-         real_t * WALBERLA_RESTRICT pT  = &src->get( 0, y, z, Stencil::idx[T]);
-         real_t * WALBERLA_RESTRICT pB  = &src->get( 0, y, z, Stencil::idx[B]);
-         real_t * WALBERLA_RESTRICT pNW = &src->get( 0, y, z, Stencil::idx[NW]);
-         real_t * WALBERLA_RESTRICT pNE = &src->get( 0, y, z, Stencil::idx[NE]);
-         real_t * WALBERLA_RESTRICT pSW = &src->get( 0, y, z, Stencil::idx[SW]);
-         real_t * WALBERLA_RESTRICT pSE = &src->get( 0, y, z, Stencil::idx[SE]);
-         real_t * WALBERLA_RESTRICT pTN = &src->get( 0, y, z, Stencil::idx[TN]);
-         real_t * WALBERLA_RESTRICT pTS = &src->get( 0, y, z, Stencil::idx[TS]);
-         real_t * WALBERLA_RESTRICT pTW = &src->get( 0, y, z, Stencil::idx[TW]);
-         real_t * WALBERLA_RESTRICT pTE = &src->get( 0, y, z, Stencil::idx[TE]);
-         real_t * WALBERLA_RESTRICT pBN = &src->get( 0, y, z, Stencil::idx[BN]);
-         real_t * WALBERLA_RESTRICT pBS = &src->get( 0, y, z, Stencil::idx[BS]);
-         real_t * WALBERLA_RESTRICT pBW = &src->get( 0, y, z, Stencil::idx[BW]);
-         real_t * WALBERLA_RESTRICT pBE = &src->get( 0, y, z, Stencil::idx[BE]);
+         PdfValue_T * WALBERLA_RESTRICT pC  = &src->get( 0, y, z, Stencil::idx[C]);
+         PdfValue_T * WALBERLA_RESTRICT pN  = &src->get( 0, y, z, Stencil::idx[N]);
+         PdfValue_T * WALBERLA_RESTRICT pS  = &src->get( 0, y, z, Stencil::idx[S]);
+         PdfValue_T * WALBERLA_RESTRICT pW  = &src->get( 0, y, z, Stencil::idx[W]);
+         PdfValue_T * WALBERLA_RESTRICT pE  = &src->get( 0, y, z, Stencil::idx[E]);
+         PdfValue_T * WALBERLA_RESTRICT pT  = &src->get( 0, y, z, Stencil::idx[T]);
+         PdfValue_T * WALBERLA_RESTRICT pB  = &src->get( 0, y, z, Stencil::idx[B]);
+         PdfValue_T * WALBERLA_RESTRICT pNW = &src->get( 0, y, z, Stencil::idx[NW]);
+         PdfValue_T * WALBERLA_RESTRICT pNE = &src->get( 0, y, z, Stencil::idx[NE]);
+         PdfValue_T * WALBERLA_RESTRICT pSW = &src->get( 0, y, z, Stencil::idx[SW]);
+         PdfValue_T * WALBERLA_RESTRICT pSE = &src->get( 0, y, z, Stencil::idx[SE]);
+         PdfValue_T * WALBERLA_RESTRICT pTN = &src->get( 0, y, z, Stencil::idx[TN]);
+         PdfValue_T * WALBERLA_RESTRICT pTS = &src->get( 0, y, z, Stencil::idx[TS]);
+         PdfValue_T * WALBERLA_RESTRICT pTW = &src->get( 0, y, z, Stencil::idx[TW]);
+         PdfValue_T * WALBERLA_RESTRICT pTE = &src->get( 0, y, z, Stencil::idx[TE]);
+         PdfValue_T * WALBERLA_RESTRICT pBN = &src->get( 0, y, z, Stencil::idx[BN]);
+         PdfValue_T * WALBERLA_RESTRICT pBS = &src->get( 0, y, z, Stencil::idx[BS]);
+         PdfValue_T * WALBERLA_RESTRICT pBW = &src->get( 0, y, z, Stencil::idx[BW]);
+         PdfValue_T * WALBERLA_RESTRICT pBE = &src->get( 0, y, z, Stencil::idx[BE]);
 
          X_LOOP
          (
-            const real_t velX_trm = pE[x] + pNE[x] + pSE[x] + pTE[x] + pBE[x];
-            const real_t velY_trm = pN[x] + pNW[x] + pTN[x] + pBN[x];
-            const real_t velZ_trm = pT[x] + pTS[x] + pTW[x];
+            const real_t velX_trm = real_t( pE[x] ) + pNE[x] + pSE[x] + pTE[x] + pBE[x];
+            const real_t velY_trm = real_t( pN[x] ) + pNW[x] + pTN[x] + pBN[x];
+            const real_t velZ_trm = real_t( pT[x] ) + pTS[x] + pTW[x];
 
-            const real_t rho = pC[x] + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
+            const real_t rho = real_t( pC[x] ) + pS[x] + pW[x] + pB[x] + pSW[x] + pBS[x] + pBW[x] + velX_trm + velY_trm + velZ_trm;
             const real_t invRho = real_t(1.0) / rho;
 
             velX[x] = invRho * ( velX_trm - pW[x]  - pNW[x] - pSW[x] - pTW[x] - pBW[x] );
@@ -1415,94 +1423,94 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             feq_common[x] = real_t(1.0) - real_t(1.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            pC[x] = pC[x] * (real_t(1.0) - lambda_e) + lambda_e * t0_0 * rho * feq_common[x];
+            pC[x] = PdfValue_T( pC[x] * (real_t(1.0) - lambda_e) + lambda_e * t0_0 * rho * feq_common[x] );
          )
 
          X_LOOP
          (
             const real_t velXPY = velX[x] + velY[x];
-            const real_t  sym_NE_SW = lambda_e_scaled * ( pNE[x] + pSW[x] - fac2[x] * velXPY * velXPY - t2x2[x] * feq_common[x] );
-            const real_t asym_NE_SW = lambda_d_scaled * ( pNE[x] - pSW[x] - real_t(3.0) * t2x2[x] * velXPY );
+            const real_t  sym_NE_SW = lambda_e_scaled * ( real_t( pNE[x] ) + pSW[x] - fac2[x] * velXPY * velXPY - t2x2[x] * feq_common[x] );
+            const real_t asym_NE_SW = lambda_d_scaled * ( real_t( pNE[x] ) - pSW[x] - real_t(3.0) * t2x2[x] * velXPY );
 
-            pNE[x] = pNE[x] - sym_NE_SW - asym_NE_SW;
-            pSW[x] = pSW[x] - sym_NE_SW + asym_NE_SW;
+            pNE[x] = PdfValue_T( pNE[x] - sym_NE_SW - asym_NE_SW );
+            pSW[x] = PdfValue_T( pSW[x] - sym_NE_SW + asym_NE_SW );
          )
 
          X_LOOP
          (
             const real_t velXMY = velX[x] - velY[x];
-            const real_t  sym_SE_NW = lambda_e_scaled * ( pSE[x] + pNW[x] - fac2[x] * velXMY * velXMY - t2x2[x] * feq_common[x] );
-            const real_t asym_SE_NW = lambda_d_scaled * ( pSE[x] - pNW[x] - real_t(3.0) * t2x2[x] * velXMY );
+            const real_t  sym_SE_NW = lambda_e_scaled * ( real_t( pSE[x] ) + pNW[x] - fac2[x] * velXMY * velXMY - t2x2[x] * feq_common[x] );
+            const real_t asym_SE_NW = lambda_d_scaled * ( real_t( pSE[x] ) - pNW[x] - real_t(3.0) * t2x2[x] * velXMY );
 
-            pSE[x] = pSE[x] - sym_SE_NW - asym_SE_NW;
-            pNW[x] = pNW[x] - sym_SE_NW + asym_SE_NW;
+            pSE[x] = PdfValue_T( pSE[x] - sym_SE_NW - asym_SE_NW );
+            pNW[x] = PdfValue_T( pNW[x] - sym_SE_NW + asym_SE_NW );
          )
 
          X_LOOP
          (
             const real_t velXPZ = velX[x] + velZ[x];
-            const real_t  sym_TE_BW = lambda_e_scaled * ( pTE[x] + pBW[x] - fac2[x] * velXPZ * velXPZ - t2x2[x] * feq_common[x] );
-            const real_t asym_TE_BW = lambda_d_scaled * ( pTE[x] - pBW[x] - real_t(3.0) * t2x2[x] * velXPZ );
+            const real_t  sym_TE_BW = lambda_e_scaled * ( real_t( pTE[x] ) + pBW[x] - fac2[x] * velXPZ * velXPZ - t2x2[x] * feq_common[x] );
+            const real_t asym_TE_BW = lambda_d_scaled * ( real_t( pTE[x] ) - pBW[x] - real_t(3.0) * t2x2[x] * velXPZ );
 
-            pTE[x] = pTE[x] - sym_TE_BW - asym_TE_BW;
-            pBW[x] = pBW[x] - sym_TE_BW + asym_TE_BW;
+            pTE[x] = PdfValue_T( pTE[x] - sym_TE_BW - asym_TE_BW );
+            pBW[x] = PdfValue_T( pBW[x] - sym_TE_BW + asym_TE_BW );
          )
 
          X_LOOP
          (
             const real_t velXMZ = velX[x] - velZ[x];
-            const real_t  sym_BE_TW = lambda_e_scaled * ( pBE[x] + pTW[x] - fac2[x] * velXMZ * velXMZ - t2x2[x] * feq_common[x] );
-            const real_t asym_BE_TW = lambda_d_scaled * ( pBE[x] - pTW[x] - real_t(3.0) * t2x2[x] * velXMZ );
+            const real_t  sym_BE_TW = lambda_e_scaled * ( real_t( pBE[x] ) + pTW[x] - fac2[x] * velXMZ * velXMZ - t2x2[x] * feq_common[x] );
+            const real_t asym_BE_TW = lambda_d_scaled * ( real_t( pBE[x] ) - pTW[x] - real_t(3.0) * t2x2[x] * velXMZ );
 
-            pBE[x] = pBE[x] - sym_BE_TW - asym_BE_TW;
-            pTW[x] = pTW[x] - sym_BE_TW + asym_BE_TW;
+            pBE[x] = PdfValue_T( pBE[x] - sym_BE_TW - asym_BE_TW );
+            pTW[x] = PdfValue_T( pTW[x] - sym_BE_TW + asym_BE_TW );
          )
 
          X_LOOP
          (
             const real_t velYPZ = velY[x] + velZ[x];
-            const real_t  sym_TN_BS = lambda_e_scaled * ( pTN[x] + pBS[x] - fac2[x] * velYPZ * velYPZ - t2x2[x] * feq_common[x] );
-            const real_t asym_TN_BS = lambda_d_scaled * ( pTN[x] - pBS[x] - real_t(3.0) * t2x2[x] * velYPZ );
+            const real_t  sym_TN_BS = lambda_e_scaled * ( real_t( pTN[x] ) + pBS[x] - fac2[x] * velYPZ * velYPZ - t2x2[x] * feq_common[x] );
+            const real_t asym_TN_BS = lambda_d_scaled * ( real_t( pTN[x] ) - pBS[x] - real_t(3.0) * t2x2[x] * velYPZ );
 
-            pTN[x] = pTN[x] - sym_TN_BS - asym_TN_BS;
-            pBS[x] = pBS[x] - sym_TN_BS + asym_TN_BS;
+            pTN[x] = PdfValue_T( pTN[x] - sym_TN_BS - asym_TN_BS );
+            pBS[x] = PdfValue_T( pBS[x] - sym_TN_BS + asym_TN_BS );
          )
 
          X_LOOP
          (
             const real_t velYMZ = velY[x] - velZ[x];
-            const real_t  sym_BN_TS = lambda_e_scaled * ( pBN[x] + pTS[x] - fac2[x] * velYMZ * velYMZ - t2x2[x] * feq_common[x] );
-            const real_t asym_BN_TS = lambda_d_scaled * ( pBN[x] - pTS[x] - real_t(3.0) * t2x2[x] * velYMZ );
+            const real_t  sym_BN_TS = lambda_e_scaled * ( real_t( pBN[x] ) + pTS[x] - fac2[x] * velYMZ * velYMZ - t2x2[x] * feq_common[x] );
+            const real_t asym_BN_TS = lambda_d_scaled * ( real_t( pBN[x] ) - pTS[x] - real_t(3.0) * t2x2[x] * velYMZ );
 
-            pBN[x] = pBN[x] - sym_BN_TS - asym_BN_TS;
-            pTS[x] = pTS[x] - sym_BN_TS + asym_BN_TS;
+            pBN[x] = PdfValue_T( pBN[x] - sym_BN_TS - asym_BN_TS );
+            pTS[x] = PdfValue_T( pTS[x] - sym_BN_TS + asym_BN_TS );
          )
 
          X_LOOP
          (
-            const real_t  sym_N_S = lambda_e_scaled * ( pN[x] + pS[x] - fac1[x] * velY[x] * velY[x] - t1x2[x] * feq_common[x] );
-            const real_t asym_N_S = lambda_d_scaled * ( pN[x] - pS[x] - real_t(3.0) * t1x2[x] * velY[x] );
+            const real_t  sym_N_S = lambda_e_scaled * ( real_t( pN[x] ) + pS[x] - fac1[x] * velY[x] * velY[x] - t1x2[x] * feq_common[x] );
+            const real_t asym_N_S = lambda_d_scaled * ( real_t( pN[x] ) - pS[x] - real_t(3.0) * t1x2[x] * velY[x] );
 
-            pN[x] = pN[x] - sym_N_S - asym_N_S;
-            pS[x] = pS[x] - sym_N_S + asym_N_S;
+            pN[x] = PdfValue_T( pN[x] - sym_N_S - asym_N_S );
+            pS[x] = PdfValue_T( pS[x] - sym_N_S + asym_N_S );
          )
 
          X_LOOP
          (
-            const real_t  sym_E_W = lambda_e_scaled * ( pE[x] + pW[x] - fac1[x] * velX[x] * velX[x] - t1x2[x] * feq_common[x] );
-            const real_t asym_E_W = lambda_d_scaled * ( pE[x] - pW[x] - real_t(3.0) * t1x2[x] * velX[x] );
+            const real_t  sym_E_W = lambda_e_scaled * ( real_t( pE[x] ) + pW[x] - fac1[x] * velX[x] * velX[x] - t1x2[x] * feq_common[x] );
+            const real_t asym_E_W = lambda_d_scaled * ( real_t( pE[x] ) - pW[x] - real_t(3.0) * t1x2[x] * velX[x] );
 
-            pE[x] = pE[x] - sym_E_W - asym_E_W;
-            pW[x] = pW[x] - sym_E_W + asym_E_W;
+            pE[x] = PdfValue_T( pE[x] - sym_E_W - asym_E_W );
+            pW[x] = PdfValue_T( pW[x] - sym_E_W + asym_E_W );
          )
 
          X_LOOP
          (
-            const real_t  sym_T_B = lambda_e_scaled * ( pT[x] + pB[x] - fac1[x] * velZ[x] * velZ[x] - t1x2[x] * feq_common[x] );
-            const real_t asym_T_B = lambda_d_scaled * ( pT[x] - pB[x] - real_t(3.0) * t1x2[x] * velZ[x] );
+            const real_t  sym_T_B = lambda_e_scaled * ( real_t( pT[x] ) + pB[x] - fac1[x] * velZ[x] * velZ[x] - t1x2[x] * feq_common[x] );
+            const real_t asym_T_B = lambda_d_scaled * ( real_t( pT[x] ) - pB[x] - real_t(3.0) * t1x2[x] * velZ[x] );
 
-            pT[x] = pT[x] - sym_T_B - asym_T_B;
-            pB[x] = pB[x] - sym_T_B + asym_T_B;
+            pT[x] = PdfValue_T( pT[x] - sym_T_B - asym_T_B );
+            pB[x] = PdfValue_T( pB[x] - sym_T_B + asym_T_B );
          )
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -1553,7 +1561,7 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
             feq_common[x] = real_t(1.0) - real_t(1.5) * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
 
-            src->get( x, y, z, Stencil::idx[C] ) = dd_tmp_C * (real_t(1.0) - lambda_e) + lambda_e * t0_0 * rho * feq_common[x];
+            src->get( x, y, z, Stencil::idx[C] ) = PdfValue_T( dd_tmp_C * (real_t(1.0) - lambda_e) + lambda_e * t0_0 * rho * feq_common[x] );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1565,8 +1573,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_NE_SW = lambda_e_scaled * ( dd_tmp_NE + dd_tmp_SW - fac2[x] * velXPY * velXPY - t2x2[x] * feq_common[x] );
             const real_t asym_NE_SW = lambda_d_scaled * ( dd_tmp_NE - dd_tmp_SW - real_t(3.0) * t2x2[x] * velXPY );
 
-            src->get( x, y, z, Stencil::idx[NE] ) = dd_tmp_NE - sym_NE_SW - asym_NE_SW;
-            src->get( x, y, z, Stencil::idx[SW] ) = dd_tmp_SW - sym_NE_SW + asym_NE_SW;
+            src->get( x, y, z, Stencil::idx[NE] ) = PdfValue_T( dd_tmp_NE - sym_NE_SW - asym_NE_SW );
+            src->get( x, y, z, Stencil::idx[SW] ) = PdfValue_T( dd_tmp_SW - sym_NE_SW + asym_NE_SW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1578,8 +1586,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_SE_NW = lambda_e_scaled * ( dd_tmp_SE + dd_tmp_NW - fac2[x] * velXMY * velXMY - t2x2[x] * feq_common[x] );
             const real_t asym_SE_NW = lambda_d_scaled * ( dd_tmp_SE - dd_tmp_NW - real_t(3.0) * t2x2[x] * velXMY );
 
-            src->get( x, y, z, Stencil::idx[SE] ) = dd_tmp_SE - sym_SE_NW - asym_SE_NW;
-            src->get( x, y, z, Stencil::idx[NW] ) = dd_tmp_NW - sym_SE_NW + asym_SE_NW;
+            src->get( x, y, z, Stencil::idx[SE] ) = PdfValue_T( dd_tmp_SE - sym_SE_NW - asym_SE_NW );
+            src->get( x, y, z, Stencil::idx[NW] ) = PdfValue_T( dd_tmp_NW - sym_SE_NW + asym_SE_NW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1591,8 +1599,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_TE_BW = lambda_e_scaled * ( dd_tmp_TE + dd_tmp_BW - fac2[x] * velXPZ * velXPZ - t2x2[x] * feq_common[x] );
             const real_t asym_TE_BW = lambda_d_scaled * ( dd_tmp_TE - dd_tmp_BW - real_t(3.0) * t2x2[x] * velXPZ );
 
-            src->get( x, y, z, Stencil::idx[TE] ) = dd_tmp_TE - sym_TE_BW - asym_TE_BW;
-            src->get( x, y, z, Stencil::idx[BW] ) = dd_tmp_BW - sym_TE_BW + asym_TE_BW;
+            src->get( x, y, z, Stencil::idx[TE] ) = PdfValue_T( dd_tmp_TE - sym_TE_BW - asym_TE_BW );
+            src->get( x, y, z, Stencil::idx[BW] ) = PdfValue_T( dd_tmp_BW - sym_TE_BW + asym_TE_BW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1604,8 +1612,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_BE_TW = lambda_e_scaled * ( dd_tmp_BE + dd_tmp_TW - fac2[x] * velXMZ * velXMZ - t2x2[x] * feq_common[x] );
             const real_t asym_BE_TW = lambda_d_scaled * ( dd_tmp_BE - dd_tmp_TW - real_t(3.0) * t2x2[x] * velXMZ );
 
-            src->get( x, y, z, Stencil::idx[BE] ) = dd_tmp_BE - sym_BE_TW - asym_BE_TW;
-            src->get( x, y, z, Stencil::idx[TW] ) = dd_tmp_TW - sym_BE_TW + asym_BE_TW;
+            src->get( x, y, z, Stencil::idx[BE] ) = PdfValue_T( dd_tmp_BE - sym_BE_TW - asym_BE_TW );
+            src->get( x, y, z, Stencil::idx[TW] ) = PdfValue_T( dd_tmp_TW - sym_BE_TW + asym_BE_TW );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1617,8 +1625,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_TN_BS = lambda_e_scaled * ( dd_tmp_TN + dd_tmp_BS - fac2[x] * velYPZ * velYPZ - t2x2[x] * feq_common[x] );
             const real_t asym_TN_BS = lambda_d_scaled * ( dd_tmp_TN - dd_tmp_BS - real_t(3.0) * t2x2[x] * velYPZ );
 
-            src->get( x, y, z, Stencil::idx[TN] ) = dd_tmp_TN - sym_TN_BS - asym_TN_BS;
-            src->get( x, y, z, Stencil::idx[BS] ) = dd_tmp_BS - sym_TN_BS + asym_TN_BS;
+            src->get( x, y, z, Stencil::idx[TN] ) = PdfValue_T( dd_tmp_TN - sym_TN_BS - asym_TN_BS );
+            src->get( x, y, z, Stencil::idx[BS] ) = PdfValue_T( dd_tmp_BS - sym_TN_BS + asym_TN_BS );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1630,8 +1638,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_BN_TS = lambda_e_scaled * ( dd_tmp_BN + dd_tmp_TS - fac2[x] * velYMZ * velYMZ - t2x2[x] * feq_common[x] );
             const real_t asym_BN_TS = lambda_d_scaled * ( dd_tmp_BN - dd_tmp_TS - real_t(3.0) * t2x2[x] * velYMZ );
 
-            src->get( x, y, z, Stencil::idx[BN] ) = dd_tmp_BN - sym_BN_TS - asym_BN_TS;
-            src->get( x, y, z, Stencil::idx[TS] ) = dd_tmp_TS - sym_BN_TS + asym_BN_TS;
+            src->get( x, y, z, Stencil::idx[BN] ) = PdfValue_T( dd_tmp_BN - sym_BN_TS - asym_BN_TS );
+            src->get( x, y, z, Stencil::idx[TS] ) = PdfValue_T( dd_tmp_TS - sym_BN_TS + asym_BN_TS );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1642,8 +1650,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_N_S = lambda_e_scaled * ( dd_tmp_N + dd_tmp_S - fac1[x] * velY[x] * velY[x] - t1x2[x] * feq_common[x] );
             const real_t asym_N_S = lambda_d_scaled * ( dd_tmp_N - dd_tmp_S - real_t(3.0) * t1x2[x] * velY[x] );
 
-            src->get( x, y, z, Stencil::idx[N] ) = dd_tmp_N - sym_N_S - asym_N_S;
-            src->get( x, y, z, Stencil::idx[S] ) = dd_tmp_S - sym_N_S + asym_N_S;
+            src->get( x, y, z, Stencil::idx[N] ) = PdfValue_T( dd_tmp_N - sym_N_S - asym_N_S );
+            src->get( x, y, z, Stencil::idx[S] ) = PdfValue_T( dd_tmp_S - sym_N_S + asym_N_S );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1654,8 +1662,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_E_W = lambda_e_scaled * ( dd_tmp_E + dd_tmp_W - fac1[x] * velX[x] * velX[x] - t1x2[x] * feq_common[x] );
             const real_t asym_E_W = lambda_d_scaled * ( dd_tmp_E - dd_tmp_W - real_t(3.0) * t1x2[x] * velX[x] );
 
-            src->get( x, y, z, Stencil::idx[E] ) = dd_tmp_E - sym_E_W - asym_E_W;
-            src->get( x, y, z, Stencil::idx[W] ) = dd_tmp_W - sym_E_W + asym_E_W;
+            src->get( x, y, z, Stencil::idx[E] ) = PdfValue_T( dd_tmp_E - sym_E_W - asym_E_W );
+            src->get( x, y, z, Stencil::idx[W] ) = PdfValue_T( dd_tmp_W - sym_E_W + asym_E_W );
          }
 
          for( cell_idx_t x = 0; x != xSize; ++x )
@@ -1666,8 +1674,8 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
             const real_t  sym_T_B = lambda_e_scaled * ( dd_tmp_T + dd_tmp_B - fac1[x] * velZ[x] * velZ[x] - t1x2[x] * feq_common[x] );
             const real_t asym_T_B = lambda_d_scaled * ( dd_tmp_T - dd_tmp_B - real_t(3.0) * t1x2[x] * velZ[x] );
 
-            src->get( x, y, z, Stencil::idx[T] ) = dd_tmp_T - sym_T_B - asym_T_B;
-            src->get( x, y, z, Stencil::idx[B] ) = dd_tmp_B - sym_T_B + asym_T_B;
+            src->get( x, y, z, Stencil::idx[T] ) = PdfValue_T( dd_tmp_T - sym_T_B - asym_T_B );
+            src->get( x, y, z, Stencil::idx[B] ) = PdfValue_T( dd_tmp_B - sym_T_B + asym_T_B );
          }
 
       ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
@@ -1689,6 +1697,489 @@ void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_
 
 
 
+//////////////////////////////////////////////
+// Generic split implementation for         //
+// D3Q15 and D3Q27:                         //
+// - incompressible & compressible          //
+// - no additional forces                   //
+//                                          //
+// Directions are processed pairwise        //
+// (direction + inverse direction), every   //
+// pair is handled in its own x-loop.       //
+//////////////////////////////////////////////
+
+template< typename LatticeModel_T >
+class SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                                            collision_model::TRT_tag >,
+                                                                            boost::mpl::or_< boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q15 >,
+                                                                                             boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q27 > >,
+                                                                            boost::is_same< typename LatticeModel_T::ForceModel::tag,
+                                                                                            force_model::None_tag >
+                                                                 > >::type > :
+   public SweepBase< LatticeModel_T >
+{
+public:
+
+   static_assert( (boost::is_same< typename LatticeModel_T::CollisionModel::tag, collision_model::TRT_tag >::value), "Only works with TRT!" );
+   static_assert( (boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q15 >::value ||
+                   boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q27 >::value),                      "Only works with D3Q15 or D3Q27!" );
+   static_assert( (boost::is_same< typename LatticeModel_T::ForceModel::tag, force_model::None_tag >::value),        "Only works without additional forces!" );
+   static_assert( LatticeModel_T::equilibriumAccuracyOrder == 2, "Only works for lattice models that require the equilibrium distribution to be order 2 accurate!" );
+
+   typedef typename SweepBase<LatticeModel_T>::PdfField_T  PdfField_T;
+   typedef typename LatticeModel_T::Stencil                Stencil;
+   typedef typename PdfField_T::value_type                 PdfValue_T;
+
+   // block has NO dst pdf field
+   SplitPureSweep( const BlockDataID & pdfField ) :
+      SweepBase<LatticeModel_T>( pdfField ) {}
+
+   // every block has a dedicated dst pdf field
+   SplitPureSweep( const BlockDataID & src, const BlockDataID & dst ) :
+      SweepBase<LatticeModel_T>( src, dst ) {}
+
+   void operator()( IBlock * const block );
+
+   void stream ( IBlock * const block, const uint_t numberOfGhostLayersToInclude = uint_t(0) );
+   void collide( IBlock * const block, const uint_t numberOfGhostLayersToInclude = uint_t(0) );
+};
+
+template< typename LatticeModel_T >
+void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                                                  collision_model::TRT_tag >,
+                                                                                  boost::mpl::or_< boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q15 >,
+                                                                                                   boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q27 > >,
+                                                                                  boost::is_same< typename LatticeModel_T::ForceModel::tag,
+                                                                                                  force_model::None_tag > > >::type
+   >::operator()( IBlock * const block )
+{
+   PdfField_T * src( NULL );
+   PdfField_T * dst( NULL );
+
+   this->getFields( block, src, dst );
+
+   WALBERLA_ASSERT_GREATER_EQUAL( src->nrOfGhostLayers(), 1 );
+
+   // constants used during stream/collide
+
+   const real_t lambda_e =  src->latticeModel().collisionModel().lambda_e();
+   const real_t lambda_d =  src->latticeModel().collisionModel().lambda_d();
+
+   // common prefactors for calculating the equilibrium parts
+   const real_t t0 = LatticeModel_T::w[ Stencil::idx[stencil::C] ];
+
+   const real_t inv2csq2 = real_t(1.0) / ( real_t(2.0) * ( real_t(1.0) / real_t(3.0) ) * ( real_t(1.0) / real_t(3.0) ) ); //speed of sound related factor for equilibrium distribution function
+
+   // relaxation parameter variables
+   const real_t lambda_e_scaled = real_t(0.5) * lambda_e; // 0.5 times the usual value ...
+   const real_t lambda_d_scaled = real_t(0.5) * lambda_d; // ... due to the way of calculations
+
+   // loop constants
+
+   const cell_idx_t xSize = cell_idx_c( src->xSize() );
+
+#ifdef _OPENMP
+   #pragma omp parallel
+   {
+#endif
+   // temporaries, calculated by the first innermost loops
+
+   real_t * WALBERLA_RESTRICT velX = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT velY = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT velZ = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT rho  = new real_t[ uint_c( xSize ) ];
+
+   real_t * WALBERLA_RESTRICT rho_inv       = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT feq_common    = new real_t[ uint_c( xSize ) ];
+
+   if( src->layout() == field::fzyx && dst->layout() == field::fzyx )
+   {
+      WALBERLA_FOR_ALL_CELLS_YZ_OMP( src, omp for schedule(static),
+
+         using namespace stencil;
+
+         PdfValue_T * WALBERLA_RESTRICT pC = &src->get( 0, y, z, Stencil::idx[C] );
+         PdfValue_T * WALBERLA_RESTRICT dC = &dst->get( 0, y, z, Stencil::idx[C] );
+
+         X_LOOP
+         (
+            rho[x]  = pC[x];
+            velX[x] = real_t(0);
+            velY[x] = real_t(0);
+            velZ[x] = real_t(0);
+         )
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d  = Stencil::dir_pos[i];
+            const Direction id = inverseDir[d];
+
+            PdfValue_T * WALBERLA_RESTRICT pD = &src->get( -cx[d], y - cy[d], z - cz[d], Stencil::idx[d]  );
+            PdfValue_T * WALBERLA_RESTRICT pI = &src->get(  cx[d], y + cy[d], z + cz[d], Stencil::idx[id] );
+
+            const real_t dx = real_c( cx[d] );
+            const real_t dy = real_c( cy[d] );
+            const real_t dz = real_c( cz[d] );
+
+            X_LOOP
+            (
+               const real_t sum  = real_t( pD[x] ) + pI[x];
+               const real_t diff = real_t( pD[x] ) - pI[x];
+
+               rho[x]  += sum;
+               velX[x] += dx * diff;
+               velY[x] += dy * diff;
+               velZ[x] += dz * diff;
+            )
+         }
+
+         X_LOOP
+         (
+            rho_inv[x] = LatticeModel_T::compressible ? ( real_t(1) / rho[x] ) : real_t(1);
+
+            feq_common[x] = rho[x] - real_t(1.5) * rho_inv[x] * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
+
+            dC[x] = PdfValue_T( pC[x] * (real_t(1.0) - lambda_e) + lambda_e * t0 * feq_common[x] );
+         )
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d  = Stencil::dir_pos[i];
+            const Direction id = inverseDir[d];
+
+            PdfValue_T * WALBERLA_RESTRICT pD = &src->get( -cx[d], y - cy[d], z - cz[d], Stencil::idx[d]  );
+            PdfValue_T * WALBERLA_RESTRICT pI = &src->get(  cx[d], y + cy[d], z + cz[d], Stencil::idx[id] );
+
+            PdfValue_T * WALBERLA_RESTRICT dD = &dst->get( 0, y, z, Stencil::idx[d]  );
+            PdfValue_T * WALBERLA_RESTRICT dI = &dst->get( 0, y, z, Stencil::idx[id] );
+
+            const real_t dx = real_c( cx[d] );
+            const real_t dy = real_c( cy[d] );
+            const real_t dz = real_c( cz[d] );
+
+            const real_t t2x2 = real_t(2.0) * LatticeModel_T::w[ Stencil::idx[d] ];
+            const real_t fac2 = t2x2 * inv2csq2;
+
+            X_LOOP
+            (
+               const real_t vel = dx * velX[x] + dy * velY[x] + dz * velZ[x];
+
+               const real_t  sym = lambda_e_scaled * ( real_t( pD[x] ) + pI[x] - fac2 * ( LatticeModel_T::compressible ? rho_inv[x] * vel * vel : vel * vel ) - t2x2 * feq_common[x] );
+               const real_t asym = lambda_d_scaled * ( real_t( pD[x] ) - pI[x] - real_t(3.0) * t2x2 * vel );
+
+               dD[x] = PdfValue_T( pD[x] - sym - asym );
+               dI[x] = PdfValue_T( pI[x] - sym + asym );
+            )
+         }
+
+      ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
+   }
+   else // ==> src->layout() == field::zyxf || dst->layout() == field::zyxf
+   {
+      WALBERLA_FOR_ALL_CELLS_YZ_OMP( src, omp for schedule(static),
+
+         using namespace stencil;
+
+         for( cell_idx_t x = 0; x != xSize; ++x )
+         {
+            rho[x]  = src->get( x, y, z, Stencil::idx[C] );
+            velX[x] = real_t(0);
+            velY[x] = real_t(0);
+            velZ[x] = real_t(0);
+         }
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d  = Stencil::dir_pos[i];
+            const Direction id = inverseDir[d];
+
+            for( cell_idx_t x = 0; x != xSize; ++x )
+            {
+               const real_t dd_tmp_d  = src->get( x - cx[d], y - cy[d], z - cz[d], Stencil::idx[d]  );
+               const real_t dd_tmp_id = src->get( x + cx[d], y + cy[d], z + cz[d], Stencil::idx[id] );
+
+               const real_t diff = dd_tmp_d - dd_tmp_id;
+
+               rho[x]  += dd_tmp_d + dd_tmp_id;
+               velX[x] += real_c( cx[d] ) * diff;
+               velY[x] += real_c( cy[d] ) * diff;
+               velZ[x] += real_c( cz[d] ) * diff;
+            }
+         }
+
+         for( cell_idx_t x = 0; x != xSize; ++x )
+         {
+            rho_inv[x] = LatticeModel_T::compressible ? ( real_t(1) / rho[x] ) : real_t(1);
+
+            feq_common[x] = rho[x] - real_t(1.5) * rho_inv[x] * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
+
+            dst->get( x, y, z, Stencil::idx[C] ) = PdfValue_T( src->get( x, y, z, Stencil::idx[C] ) * (real_t(1.0) - lambda_e) + lambda_e * t0 * feq_common[x] );
+         }
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d  = Stencil::dir_pos[i];
+            const Direction id = inverseDir[d];
+
+            const real_t t2x2 = real_t(2.0) * LatticeModel_T::w[ Stencil::idx[d] ];
+            const real_t fac2 = t2x2 * inv2csq2;
+
+            for( cell_idx_t x = 0; x != xSize; ++x )
+            {
+               const real_t vel = real_c( cx[d] ) * velX[x] + real_c( cy[d] ) * velY[x] + real_c( cz[d] ) * velZ[x];
+
+               const real_t dd_tmp_d  = src->get( x - cx[d], y - cy[d], z - cz[d], Stencil::idx[d]  );
+               const real_t dd_tmp_id = src->get( x + cx[d], y + cy[d], z + cz[d], Stencil::idx[id] );
+
+               const real_t  sym = lambda_e_scaled * ( dd_tmp_d + dd_tmp_id - fac2 * ( LatticeModel_T::compressible ? rho_inv[x] * vel * vel : vel * vel ) - t2x2 * feq_common[x] );
+               const real_t asym = lambda_d_scaled * ( dd_tmp_d - dd_tmp_id - real_t(3.0) * t2x2 * vel );
+
+               dst->get( x, y, z, Stencil::idx[d]  ) = PdfValue_T( dd_tmp_d  - sym - asym );
+               dst->get( x, y, z, Stencil::idx[id] ) = PdfValue_T( dd_tmp_id - sym + asym );
+            }
+         }
+
+      ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
+   }
+
+   delete[] velX;
+   delete[] velY;
+   delete[] velZ;
+   delete[] rho;
+   delete[] rho_inv;
+   delete[] feq_common;
+
+#ifdef _OPENMP
+   }
+#endif
+
+   src->swapDataPointers( dst );
+}
+
+template< typename LatticeModel_T >
+void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                                                  collision_model::TRT_tag >,
+                                                                                  boost::mpl::or_< boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q15 >,
+                                                                                                   boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q27 > >,
+                                                                                  boost::is_same< typename LatticeModel_T::ForceModel::tag,
+                                                                                                  force_model::None_tag > > >::type
+   >::stream( IBlock * const block, const uint_t numberOfGhostLayersToInclude )
+{
+   PdfField_T * src( NULL );
+   PdfField_T * dst( NULL );
+
+   this->getFields( block, src, dst );
+
+   StreamEverything< LatticeModel_T >::execute( src, dst, numberOfGhostLayersToInclude );
+}
+
+template< typename LatticeModel_T >
+void SplitPureSweep< LatticeModel_T, typename boost::enable_if< boost::mpl::and_< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                                                  collision_model::TRT_tag >,
+                                                                                  boost::mpl::or_< boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q15 >,
+                                                                                                   boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q27 > >,
+                                                                                  boost::is_same< typename LatticeModel_T::ForceModel::tag,
+                                                                                                  force_model::None_tag > > >::type
+#ifdef NDEBUG
+   >::collide( IBlock * const block, const uint_t /*numberOfGhostLayersToInclude*/ )
+#else
+   >::collide( IBlock * const block, const uint_t numberOfGhostLayersToInclude )
+#endif
+{
+   WALBERLA_ASSERT_EQUAL( numberOfGhostLayersToInclude, uint_t(0) ); // the implementation right now doesn't support inclusion of ghost layers in collide step!
+
+   PdfField_T * src = this->getSrcField( block );
+
+   WALBERLA_ASSERT_GREATER_EQUAL( src->nrOfGhostLayers(), numberOfGhostLayersToInclude );
+
+   // constants used during stream/collide
+
+   const real_t lambda_e =  src->latticeModel().collisionModel().lambda_e();
+   const real_t lambda_d =  src->latticeModel().collisionModel().lambda_d();
+
+   // common prefactors for calculating the equilibrium parts
+   const real_t t0 = LatticeModel_T::w[ Stencil::idx[stencil::C] ];
+
+   const real_t inv2csq2 = real_t(1.0) / ( real_t(2.0) * ( real_t(1.0) / real_t(3.0) ) * ( real_t(1.0) / real_t(3.0) ) ); //speed of sound related factor for equilibrium distribution function
+
+   // relaxation parameter variables
+   const real_t lambda_e_scaled = real_t(0.5) * lambda_e; // 0.5 times the usual value ...
+   const real_t lambda_d_scaled = real_t(0.5) * lambda_d; // ... due to the way of calculations
+
+   // loop constants
+
+   const cell_idx_t xSize = cell_idx_c( src->xSize() );
+
+#ifdef _OPENMP
+   #pragma omp parallel
+   {
+#endif
+   // temporaries, calculated by the first innermost loops
+
+   real_t * WALBERLA_RESTRICT velX = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT velY = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT velZ = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT rho  = new real_t[ uint_c( xSize ) ];
+
+   real_t * WALBERLA_RESTRICT rho_inv       = new real_t[ uint_c( xSize ) ];
+   real_t * WALBERLA_RESTRICT feq_common    = new real_t[ uint_c( xSize ) ];
+
+   if( src->layout() == field::fzyx )
+   {
+      WALBERLA_FOR_ALL_CELLS_YZ_OMP( src, omp for schedule(static),
+
+         using namespace stencil;
+
+         PdfValue_T * WALBERLA_RESTRICT pC = &src->get( 0, y, z, Stencil::idx[C] );
+
+         X_LOOP
+         (
+            rho[x]  = pC[x];
+            velX[x] = real_t(0);
+            velY[x] = real_t(0);
+            velZ[x] = real_t(0);
+         )
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d = Stencil::dir_pos[i];
+
+            PdfValue_T * WALBERLA_RESTRICT pD = &src->get( 0, y, z, Stencil::idx[d] );
+            PdfValue_T * WALBERLA_RESTRICT pI = &src->get( 0, y, z, Stencil::invDirIdx(d) );
+
+            const real_t dx = real_c( cx[d] );
+            const real_t dy = real_c( cy[d] );
+            const real_t dz = real_c( cz[d] );
+
+            X_LOOP
+            (
+               const real_t sum  = real_t( pD[x] ) + pI[x];
+               const real_t diff = real_t( pD[x] ) - pI[x];
+
+               rho[x]  += sum;
+               velX[x] += dx * diff;
+               velY[x] += dy * diff;
+               velZ[x] += dz * diff;
+            )
+         }
+
+         X_LOOP
+         (
+            rho_inv[x] = LatticeModel_T::compressible ? ( real_t(1) / rho[x] ) : real_t(1);
+
+            feq_common[x] = rho[x] - real_t(1.5) * rho_inv[x] * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
+
+            pC[x] = PdfValue_T( pC[x] * (real_t(1.0) - lambda_e) + lambda_e * t0 * feq_common[x] );
+         )
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d = Stencil::dir_pos[i];
+
+            PdfValue_T * WALBERLA_RESTRICT pD = &src->get( 0, y, z, Stencil::idx[d] );
+            PdfValue_T * WALBERLA_RESTRICT pI = &src->get( 0, y, z, Stencil::invDirIdx(d) );
+
+            const real_t dx = real_c( cx[d] );
+            const real_t dy = real_c( cy[d] );
+            const real_t dz = real_c( cz[d] );
+
+            const real_t t2x2 = real_t(2.0) * LatticeModel_T::w[ Stencil::idx[d] ];
+            const real_t fac2 = t2x2 * inv2csq2;
+
+            X_LOOP
+            (
+               const real_t vel = dx * velX[x] + dy * velY[x] + dz * velZ[x];
+
+               const real_t  sym = lambda_e_scaled * ( real_t( pD[x] ) + pI[x] - fac2 * ( LatticeModel_T::compressible ? rho_inv[x] * vel * vel : vel * vel ) - t2x2 * feq_common[x] );
+               const real_t asym = lambda_d_scaled * ( real_t( pD[x] ) - pI[x] - real_t(3.0) * t2x2 * vel );
+
+               pD[x] = PdfValue_T( pD[x] - sym - asym );
+               pI[x] = PdfValue_T( pI[x] - sym + asym );
+            )
+         }
+
+      ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
+   }
+   else // ==> src->layout() == field::zyxf
+   {
+      WALBERLA_FOR_ALL_CELLS_YZ_OMP( src, omp for schedule(static),
+
+         using namespace stencil;
+
+         for( cell_idx_t x = 0; x != xSize; ++x )
+         {
+            rho[x]  = src->get( x, y, z, Stencil::idx[C] );
+            velX[x] = real_t(0);
+            velY[x] = real_t(0);
+            velZ[x] = real_t(0);
+         }
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d = Stencil::dir_pos[i];
+
+            for( cell_idx_t x = 0; x != xSize; ++x )
+            {
+               const real_t dd_tmp_d  = src->get( x, y, z, Stencil::idx[d] );
+               const real_t dd_tmp_id = src->get( x, y, z, Stencil::invDirIdx(d) );
+
+               const real_t diff = dd_tmp_d - dd_tmp_id;
+
+               rho[x]  += dd_tmp_d + dd_tmp_id;
+               velX[x] += real_c( cx[d] ) * diff;
+               velY[x] += real_c( cy[d] ) * diff;
+               velZ[x] += real_c( cz[d] ) * diff;
+            }
+         }
+
+         for( cell_idx_t x = 0; x != xSize; ++x )
+         {
+            rho_inv[x] = LatticeModel_T::compressible ? ( real_t(1) / rho[x] ) : real_t(1);
+
+            feq_common[x] = rho[x] - real_t(1.5) * rho_inv[x] * ( velX[x] * velX[x] + velY[x] * velY[x] + velZ[x] * velZ[x] );
+
+            src->get( x, y, z, Stencil::idx[C] ) = PdfValue_T( src->get( x, y, z, Stencil::idx[C] ) * (real_t(1.0) - lambda_e) + lambda_e * t0 * feq_common[x] );
+         }
+
+         for( uint_t i = 0; i != Stencil::POS_Q; ++i )
+         {
+            const Direction d = Stencil::dir_pos[i];
+
+            const real_t t2x2 = real_t(2.0) * LatticeModel_T::w[ Stencil::idx[d] ];
+            const real_t fac2 = t2x2 * inv2csq2;
+
+            for( cell_idx_t x = 0; x != xSize; ++x )
+            {
+               const real_t vel = real_c( cx[d] ) * velX[x] + real_c( cy[d] ) * velY[x] + real_c( cz[d] ) * velZ[x];
+
+               const real_t dd_tmp_d  = src->get( x, y, z, Stencil::idx[d]        );
+               const real_t dd_tmp_id = src->get( x, y, z, Stencil::invDirIdx(d) );
+
+               const real_t  sym = lambda_e_scaled * ( dd_tmp_d + dd_tmp_id - fac2 * ( LatticeModel_T::compressible ? rho_inv[x] * vel * vel : vel * vel ) - t2x2 * feq_common[x] );
+               const real_t asym = lambda_d_scaled * ( dd_tmp_d - dd_tmp_id - real_t(3.0) * t2x2 * vel );
+
+               src->get( x, y, z, Stencil::idx[d]        ) = PdfValue_T( dd_tmp_d  - sym - asym );
+               src->get( x, y, z, Stencil::invDirIdx(d) ) = PdfValue_T( dd_tmp_id - sym + asym );
+            }
+         }
+
+      ) // WALBERLA_FOR_ALL_CELLS_YZ_OMP
+   }
+
+   delete[] velX;
+   delete[] velY;
+   delete[] velZ;
+   delete[] rho;
+   delete[] rho_inv;
+   delete[] feq_common;
+
+#ifdef _OPENMP
+   }
+#endif
+}
+
+
+
 } // namespace lbm
 } // namespace walberla
 
@@ -23,10 +23,13 @@
 #include "lbm/lattice_model/D3Q19.h"
 #include "lbm/lattice_model/LatticeModelBase.h"
 #include "lbm/sweeps/FlagFieldSweepBase.h"
+#include "lbm/sweeps/FusedBoundaryHandling.h"
 #include "lbm/sweeps/Streaming.h"
 
 #include "field/iterators/IteratorMacros.h"
 
+#include "simd/RuntimeDispatch.h"
+
 #include <boost/mpl/logical.hpp>
 #include <boost/mpl/bool.hpp>
 #include <boost/type_traits/is_same.hpp>
@@ -71,6 +74,7 @@ public:
    static_assert( LatticeModel_T::compressible == false,                                                             "Only works with incompressible models!" );
    static_assert( (boost::is_same< typename LatticeModel_T::ForceModel::tag, force_model::None_tag >::value),        "Only works without additional forces!" );
    static_assert( LatticeModel_T::equilibriumAccuracyOrder == 2, "Only works for lattice models that require the equilibrium distribution to be order 2 accurate!" );
+   static_assert( (boost::is_same< typename PdfStorage< LatticeModel_T >::type, real_t >::value), "Only works with PDFs stored as real_t (not with lbm::MixedPrecision)!" );
 
    typedef typename FlagFieldSweepBase<LatticeModel_T,FlagField_T>::PdfField_T  PdfField_T;
    typedef typename LatticeModel_T::Stencil                                     Stencil;
@@ -87,6 +91,29 @@ public:
 
    void stream ( IBlock * const block, const uint_t numberOfGhostLayersToInclude = uint_t(0) );
    void collide( IBlock * const block, const uint_t numberOfGhostLayersToInclude = uint_t(0) );
+
+   /// If set, operator() treats the boundary links of each row right before the row is streamed & collided
+   /// (see FusedBoundaryHandling). stream() and collide() never treat boundaries.
+   void setFusedBoundaryHandling( const shared_ptr< FusedBoundaryHandling > & fused ) { fusedBoundaryHandling_ = fused; }
+
+   /// Instruction set the stream & collide kernel of operator() is executed with (see simd/RuntimeDispatch.h).
+   /// Defaults to the most capable instruction set supported by the CPU the program is running on.
+   void setInstructionSet( const simd::InstructionSet is ) { instructionSet_ = simd::supportedInstructionSet( is ); }
+   simd::InstructionSet getInstructionSet() const { return instructionSet_; }
+
+private:
+
+   typedef typename FlagField_T::flag_t flag_t;
+
+   void streamCollide( PdfField_T * const src, PdfField_T * const dst, const FlagField_T * const flagField, const flag_t lbm );
+#ifdef WALBERLA_SIMD_MULTIVERSIONING
+   WALBERLA_SIMD_TARGET_AVX2   void streamCollideAVX2  ( PdfField_T * const src, PdfField_T * const dst, const FlagField_T * const flagField, const flag_t lbm ) { streamCollide( src, dst, flagField, lbm ); }
+   WALBERLA_SIMD_TARGET_AVX512 void streamCollideAVX512( PdfField_T * const src, PdfField_T * const dst, const FlagField_T * const flagField, const flag_t lbm ) { streamCollide( src, dst, flagField, lbm ); }
+#endif
+
+   shared_ptr< FusedBoundaryHandling > fusedBoundaryHandling_;
+
+   simd::InstructionSet instructionSet_ = simd::bestAvailableInstructionSet();
 };
 
 template< typename LatticeModel_T, typename FlagField_T >
@@ -104,8 +131,43 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
 
    auto lbm = this->getLbmMaskAndFields( block, src, dst, flagField );
 
+   if( fusedBoundaryHandling_ )
+      fusedBoundaryHandling_->beforeSweep( block );
+
    WALBERLA_ASSERT_GREATER_EQUAL( src->nrOfGhostLayers(), 1 );
 
+#ifdef _OPENMP
+   #pragma omp parallel
+   {
+#endif
+#ifdef WALBERLA_SIMD_MULTIVERSIONING
+   if( instructionSet_ == simd::AVX512 )
+      streamCollideAVX512( src, dst, flagField, lbm );
+   else if( instructionSet_ == simd::AVX2 )
+      streamCollideAVX2( src, dst, flagField, lbm );
+   else
+#endif
+   streamCollide( src, dst, flagField, lbm );
+#ifdef _OPENMP
+   }
+#endif
+
+   if( fusedBoundaryHandling_ )
+      fusedBoundaryHandling_->afterSweep();
+
+   src->swapDataPointers( dst );
+}
+
+template< typename LatticeModel_T, typename FlagField_T >
+void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::mpl::and_< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                                                           collision_model::TRT_tag >,
+                                                                                           boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q19 >,
+                                                                                           boost::mpl::not_< boost::mpl::bool_< LatticeModel_T::compressible > >,
+                                                                                           boost::is_same< typename LatticeModel_T::ForceModel::tag,
+                                                                                                           force_model::None_tag > > >::type
+   >::streamCollide( PdfField_T * const src, PdfField_T * const dst,
+                     const FlagField_T * const flagField, const flag_t lbm )
+{
    // constants used during stream/collide
 
    const real_t lambda_e =  src->latticeModel().collisionModel().lambda_e();
@@ -128,10 +190,6 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
 
    const cell_idx_t xSize = cell_idx_c( src->xSize() );
 
-#ifdef _OPENMP
-   #pragma omp parallel
-   {
-#endif
    // temporaries, calculated by the first innermost loop
 
    real_t * WALBERLA_RESTRICT velX = new real_t[ uint_c(xSize) ];
@@ -148,6 +206,9 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
 
          using namespace stencil;
 
+         if( fusedBoundaryHandling_ )
+            fusedBoundaryHandling_->treatRow( y, z );
+
          real_t * WALBERLA_RESTRICT pNE = &src->get(-1, y-1, z  , Stencil::idx[NE]);
          real_t * WALBERLA_RESTRICT pN  = &src->get(0 , y-1, z  , Stencil::idx[N]);
          real_t * WALBERLA_RESTRICT pNW = &src->get(+1, y-1, z  , Stencil::idx[NW]);
@@ -170,7 +231,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
 
          real_t * WALBERLA_RESTRICT dC = &dst->get(0,y,z,Stencil::idx[C]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( flagField->isPartOfMaskSet( x, y, z, lbm ) )
             {
@@ -196,7 +257,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dNE = &dst->get(0,y,z,Stencil::idx[NE]);
          real_t * WALBERLA_RESTRICT dSW = &dst->get(0,y,z,Stencil::idx[SW]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -212,7 +273,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dSE = &dst->get(0,y,z,Stencil::idx[SE]);
          real_t * WALBERLA_RESTRICT dNW = &dst->get(0,y,z,Stencil::idx[NW]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -228,7 +289,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dTE = &dst->get(0,y,z,Stencil::idx[TE]);
          real_t * WALBERLA_RESTRICT dBW = &dst->get(0,y,z,Stencil::idx[BW]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -244,7 +305,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dBE = &dst->get(0,y,z,Stencil::idx[BE]);
          real_t * WALBERLA_RESTRICT dTW = &dst->get(0,y,z,Stencil::idx[TW]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -260,7 +321,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dTN = &dst->get(0,y,z,Stencil::idx[TN]);
          real_t * WALBERLA_RESTRICT dBS = &dst->get(0,y,z,Stencil::idx[BS]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -276,7 +337,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dBN = &dst->get(0,y,z,Stencil::idx[BN]);
          real_t * WALBERLA_RESTRICT dTS = &dst->get(0,y,z,Stencil::idx[TS]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -292,7 +353,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dN = &dst->get(0,y,z,Stencil::idx[N]);
          real_t * WALBERLA_RESTRICT dS = &dst->get(0,y,z,Stencil::idx[S]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -307,7 +368,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dE = &dst->get(0,y,z,Stencil::idx[E]);
          real_t * WALBERLA_RESTRICT dW = &dst->get(0,y,z,Stencil::idx[W]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -322,7 +383,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dT = &dst->get(0,y,z,Stencil::idx[T]);
          real_t * WALBERLA_RESTRICT dB = &dst->get(0,y,z,Stencil::idx[B]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -342,6 +403,9 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
 
          using namespace stencil;
 
+         if( fusedBoundaryHandling_ )
+            fusedBoundaryHandling_->treatRow( y, z );
+
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             if( flagField->isPartOfMaskSet( x, y, z, lbm ) )
@@ -534,12 +598,6 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
    delete[] velZ;
    delete[] feq_common;
    delete[] perform_lbm;
-
-#ifdef _OPENMP
-   }
-#endif
-
-   src->swapDataPointers( dst );
 }
 
 template< typename LatticeModel_T, typename FlagField_T >
@@ -1013,6 +1071,7 @@ public:
    static_assert( LatticeModel_T::compressible,                                                                      "Only works with compressible models!" );
    static_assert( (boost::is_same< typename LatticeModel_T::ForceModel::tag, force_model::None_tag >::value),        "Only works without additional forces!" );
    static_assert( LatticeModel_T::equilibriumAccuracyOrder == 2, "Only works for lattice models that require the equilibrium distribution to be order 2 accurate!" );
+   static_assert( (boost::is_same< typename PdfStorage< LatticeModel_T >::type, real_t >::value), "Only works with PDFs stored as real_t (not with lbm::MixedPrecision)!" );
 
    typedef typename FlagFieldSweepBase<LatticeModel_T,FlagField_T>::PdfField_T  PdfField_T;
    typedef typename LatticeModel_T::Stencil                                     Stencil;
@@ -1029,6 +1088,29 @@ public:
 
    void stream ( IBlock * const block, const uint_t numberOfGhostLayersToInclude = uint_t(0) );
    void collide( IBlock * const block, const uint_t numberOfGhostLayersToInclude = uint_t(0) );
+
+   /// If set, operator() treats the boundary links of each row right before the row is streamed & collided
+   /// (see FusedBoundaryHandling). stream() and collide() never treat boundaries.
+   void setFusedBoundaryHandling( const shared_ptr< FusedBoundaryHandling > & fused ) { fusedBoundaryHandling_ = fused; }
+
+   /// Instruction set the stream & collide kernel of operator() is executed with (see simd/RuntimeDispatch.h).
+   /// Defaults to the most capable instruction set supported by the CPU the program is running on.
+   void setInstructionSet( const simd::InstructionSet is ) { instructionSet_ = simd::supportedInstructionSet( is ); }
+   simd::InstructionSet getInstructionSet() const { return instructionSet_; }
+
+private:
+
+   typedef typename FlagField_T::flag_t flag_t;
+
+   void streamCollide( PdfField_T * const src, PdfField_T * const dst, const FlagField_T * const flagField, const flag_t lbm );
+#ifdef WALBERLA_SIMD_MULTIVERSIONING
+   WALBERLA_SIMD_TARGET_AVX2   void streamCollideAVX2  ( PdfField_T * const src, PdfField_T * const dst, const FlagField_T * const flagField, const flag_t lbm ) { streamCollide( src, dst, flagField, lbm ); }
+   WALBERLA_SIMD_TARGET_AVX512 void streamCollideAVX512( PdfField_T * const src, PdfField_T * const dst, const FlagField_T * const flagField, const flag_t lbm ) { streamCollide( src, dst, flagField, lbm ); }
+#endif
+
+   shared_ptr< FusedBoundaryHandling > fusedBoundaryHandling_;
+
+   simd::InstructionSet instructionSet_ = simd::bestAvailableInstructionSet();
 };
 
 template< typename LatticeModel_T, typename FlagField_T >
@@ -1046,8 +1128,43 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
 
    auto lbm = this->getLbmMaskAndFields( block, src, dst, flagField );
 
+   if( fusedBoundaryHandling_ )
+      fusedBoundaryHandling_->beforeSweep( block );
+
    WALBERLA_ASSERT_GREATER_EQUAL( src->nrOfGhostLayers(), 1 );
 
+#ifdef _OPENMP
+   #pragma omp parallel
+   {
+#endif
+#ifdef WALBERLA_SIMD_MULTIVERSIONING
+   if( instructionSet_ == simd::AVX512 )
+      streamCollideAVX512( src, dst, flagField, lbm );
+   else if( instructionSet_ == simd::AVX2 )
+      streamCollideAVX2( src, dst, flagField, lbm );
+   else
+#endif
+   streamCollide( src, dst, flagField, lbm );
+#ifdef _OPENMP
+   }
+#endif
+
+   if( fusedBoundaryHandling_ )
+      fusedBoundaryHandling_->afterSweep();
+
+   src->swapDataPointers( dst );
+}
+
+template< typename LatticeModel_T, typename FlagField_T >
+void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::mpl::and_< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                                                           collision_model::TRT_tag >,
+                                                                                           boost::is_same< typename LatticeModel_T::Stencil, stencil::D3Q19 >,
+                                                                                           boost::mpl::bool_< LatticeModel_T::compressible >,
+                                                                                           boost::is_same< typename LatticeModel_T::ForceModel::tag,
+                                                                                                           force_model::None_tag > > >::type
+   >::streamCollide( PdfField_T * const src, PdfField_T * const dst,
+                     const FlagField_T * const flagField, const flag_t lbm )
+{
    // constants used during stream/collide
 
    const real_t lambda_e =  src->latticeModel().collisionModel().lambda_e();
@@ -1068,10 +1185,6 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
 
    const cell_idx_t xSize = cell_idx_c( src->xSize() );
 
-#ifdef _OPENMP
-   #pragma omp parallel
-   {
-#endif
    // temporaries, calculated by the first innermost loop
 
    real_t * WALBERLA_RESTRICT velX = new real_t[ uint_c(xSize) ];
@@ -1093,6 +1206,9 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
 
          using namespace stencil;
 
+         if( fusedBoundaryHandling_ )
+            fusedBoundaryHandling_->treatRow( y, z );
+
          real_t * WALBERLA_RESTRICT pNE = &src->get(-1, y-1, z  , Stencil::idx[NE]);
          real_t * WALBERLA_RESTRICT pN  = &src->get(0 , y-1, z  , Stencil::idx[N]);
          real_t * WALBERLA_RESTRICT pNW = &src->get(+1, y-1, z  , Stencil::idx[NW]);
@@ -1115,7 +1231,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
 
          real_t * WALBERLA_RESTRICT dC = &dst->get(0,y,z,Stencil::idx[C]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( flagField->isPartOfMaskSet( x, y, z, lbm ) )
             {
@@ -1147,7 +1263,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dNE = &dst->get(0,y,z,Stencil::idx[NE]);
          real_t * WALBERLA_RESTRICT dSW = &dst->get(0,y,z,Stencil::idx[SW]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -1163,7 +1279,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dSE = &dst->get(0,y,z,Stencil::idx[SE]);
          real_t * WALBERLA_RESTRICT dNW = &dst->get(0,y,z,Stencil::idx[NW]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -1179,7 +1295,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dTE = &dst->get(0,y,z,Stencil::idx[TE]);
          real_t * WALBERLA_RESTRICT dBW = &dst->get(0,y,z,Stencil::idx[BW]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -1195,7 +1311,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dBE = &dst->get(0,y,z,Stencil::idx[BE]);
          real_t * WALBERLA_RESTRICT dTW = &dst->get(0,y,z,Stencil::idx[TW]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -1211,7 +1327,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dTN = &dst->get(0,y,z,Stencil::idx[TN]);
          real_t * WALBERLA_RESTRICT dBS = &dst->get(0,y,z,Stencil::idx[BS]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -1227,7 +1343,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dBN = &dst->get(0,y,z,Stencil::idx[BN]);
          real_t * WALBERLA_RESTRICT dTS = &dst->get(0,y,z,Stencil::idx[TS]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -1243,7 +1359,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dN = &dst->get(0,y,z,Stencil::idx[N]);
          real_t * WALBERLA_RESTRICT dS = &dst->get(0,y,z,Stencil::idx[S]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -1258,7 +1374,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dE = &dst->get(0,y,z,Stencil::idx[E]);
          real_t * WALBERLA_RESTRICT dW = &dst->get(0,y,z,Stencil::idx[W]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -1273,7 +1389,7 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
          real_t * WALBERLA_RESTRICT dT = &dst->get(0,y,z,Stencil::idx[T]);
          real_t * WALBERLA_RESTRICT dB = &dst->get(0,y,z,Stencil::idx[B]);
 
-         X_LOOP
+         X_LOOP_IVDEP
          (
             if( perform_lbm[x] )
             {
@@ -1293,6 +1409,9 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
 
          using namespace stencil;
 
+         if( fusedBoundaryHandling_ )
+            fusedBoundaryHandling_->treatRow( y, z );
+
          for( cell_idx_t x = 0; x != xSize; ++x )
          {
             if( flagField->isPartOfMaskSet( x, y, z, lbm ) )
@@ -1495,12 +1614,6 @@ void SplitSweep< LatticeModel_T, FlagField_T, typename boost::enable_if< boost::
    delete[] fac2;
    delete[] feq_common;
    delete[] perform_lbm;
-
-#ifdef _OPENMP
-   }
-#endif
-
-   src->swapDataPointers( dst );
 }
 
 template< typename LatticeModel_T, typename FlagField_T >
@@ -84,6 +84,7 @@ public:
    static_assert( LatticeModel_T::compressible == false,                                                             "Only works with incompressible models!" );
    static_assert( (boost::is_same< typename LatticeModel_T::ForceModel::tag, force_model::None_tag >::value),        "Only works without additional forces!" );
    static_assert( LatticeModel_T::equilibriumAccuracyOrder == 2, "Only works for lattice models that require the equilibrium distribution to be order 2 accurate!" );
+   static_assert( (boost::is_same< typename PdfStorage< LatticeModel_T >::type, real_t >::value), "Only works with PDFs stored as real_t (not with lbm::MixedPrecision)!" );
 
    typedef typename SweepBase<LatticeModel_T>::PdfField_T  PdfField_T;
    typedef typename LatticeModel_T::Stencil                Stencil;
@@ -1075,6 +1076,7 @@ public:
    static_assert( LatticeModel_T::compressible,                                                                      "Only works with compressible models!" );
    static_assert( (boost::is_same< typename LatticeModel_T::ForceModel::tag, force_model::None_tag >::value),        "Only works without additional forces!" );
    static_assert( LatticeModel_T::equilibriumAccuracyOrder == 2, "Only works for lattice models that require the equilibrium distribution to be order 2 accurate!" );
+   static_assert( (boost::is_same< typename PdfStorage< LatticeModel_T >::type, real_t >::value), "Only works with PDFs stored as real_t (not with lbm::MixedPrecision)!" );
 
    typedef typename SweepBase<LatticeModel_T>::PdfField_T  PdfField_T;
    typedef typename LatticeModel_T::Stencil                Stencil;
@@ -590,9 +590,99 @@ void DefaultCellOperation< LatticeModel_T, typename boost::enable_if< boost::mpl
                                                                                                         force_model::None_tag > > >::type
    >::operator()( FieldPtrOrIterator & src, FieldPtrOrIterator & dst ) const
 {
-   operator()( const_cast< PdfField_T * >( static_cast< const PdfField_T * >(src.getField()) ),
-               const_cast< PdfField_T * >( static_cast< const PdfField_T * >(dst.getField()) ),
-               src.x(), src.y(), src.z() );
+   using namespace stencil;
+
+   const real_t dd_tmp_NE = src.neighbor( SW, Stencil::idx[NE] );
+   const real_t dd_tmp_N  = src.neighbor( S , Stencil::idx[N] );
+   const real_t dd_tmp_NW = src.neighbor( SE, Stencil::idx[NW] );
+   const real_t dd_tmp_W  = src.neighbor( E , Stencil::idx[W] );
+   const real_t dd_tmp_SW = src.neighbor( NE, Stencil::idx[SW] );
+   const real_t dd_tmp_S  = src.neighbor( N , Stencil::idx[S] );
+   const real_t dd_tmp_SE = src.neighbor( NW, Stencil::idx[SE] );
+   const real_t dd_tmp_E  = src.neighbor( W , Stencil::idx[E] );
+   const real_t dd_tmp_T  = src.neighbor( B , Stencil::idx[T] );
+   const real_t dd_tmp_TE = src.neighbor( BW, Stencil::idx[TE] );
+   const real_t dd_tmp_TN = src.neighbor( BS, Stencil::idx[TN] );
+   const real_t dd_tmp_TW = src.neighbor( BE, Stencil::idx[TW] );
+   const real_t dd_tmp_TS = src.neighbor( BN, Stencil::idx[TS] );
+   const real_t dd_tmp_B  = src.neighbor( T , Stencil::idx[B] );
+   const real_t dd_tmp_BE = src.neighbor( TW, Stencil::idx[BE] );
+   const real_t dd_tmp_BN = src.neighbor( TS, Stencil::idx[BN] );
+   const real_t dd_tmp_BW = src.neighbor( TE, Stencil::idx[BW] );
+   const real_t dd_tmp_BS = src.neighbor( TN, Stencil::idx[BS] );
+   const real_t dd_tmp_C  = src.neighbor( C , Stencil::idx[C] );
+
+   const real_t velX_trm = dd_tmp_E + dd_tmp_NE + dd_tmp_SE + dd_tmp_TE + dd_tmp_BE;
+   const real_t velY_trm = dd_tmp_N + dd_tmp_NW + dd_tmp_TN + dd_tmp_BN;
+   const real_t velZ_trm = dd_tmp_T + dd_tmp_TS + dd_tmp_TW;
+
+   const real_t rho = dd_tmp_C + dd_tmp_S + dd_tmp_W + dd_tmp_B + dd_tmp_SW + dd_tmp_BS + dd_tmp_BW + velX_trm + velY_trm + velZ_trm;
+   const real_t invRho = real_t(1.0) / rho;
+
+   const real_t velX = invRho * ( velX_trm - dd_tmp_W  - dd_tmp_NW - dd_tmp_SW - dd_tmp_TW - dd_tmp_BW );
+   const real_t velY = invRho * ( velY_trm + dd_tmp_NE - dd_tmp_S  - dd_tmp_SW - dd_tmp_SE - dd_tmp_TS - dd_tmp_BS );
+   const real_t velZ = invRho * ( velZ_trm + dd_tmp_TN + dd_tmp_TE - dd_tmp_B  - dd_tmp_BN - dd_tmp_BS - dd_tmp_BW - dd_tmp_BE );
+
+   const real_t feq_common = real_t(1.0) - real_t(1.5) * ( velX * velX + velY * velY + velZ * velZ );
+
+   dst[ Stencil::idx[C] ] = dd_tmp_C * (real_t(1.0) - lambda_e_) + lambda_e_ * t0_0_ * rho * feq_common;
+
+   const real_t t2x2 = t2x2_0_ * rho;
+   const real_t fac2 = t2x2 * (real_t(9.0) / real_t(2.0));
+
+   const real_t velXPY = velX + velY;
+   const real_t  sym_NE_SW = lambda_e_scaled_ * ( dd_tmp_NE + dd_tmp_SW - fac2 * velXPY * velXPY - t2x2 * feq_common );
+   const real_t asym_NE_SW = lambda_d_scaled_ * ( dd_tmp_NE - dd_tmp_SW - real_t(3.0) * t2x2 * velXPY );
+   dst[ Stencil::idx[NE] ] = dd_tmp_NE - sym_NE_SW - asym_NE_SW;
+   dst[ Stencil::idx[SW] ] = dd_tmp_SW - sym_NE_SW + asym_NE_SW;
+
+   const real_t velXMY = velX - velY;
+   const real_t  sym_SE_NW = lambda_e_scaled_ * ( dd_tmp_SE + dd_tmp_NW - fac2 * velXMY * velXMY - t2x2 * feq_common );
+   const real_t asym_SE_NW = lambda_d_scaled_ * ( dd_tmp_SE - dd_tmp_NW - real_t(3.0) * t2x2 * velXMY );
+   dst[ Stencil::idx[SE] ] = dd_tmp_SE - sym_SE_NW - asym_SE_NW;
+   dst[ Stencil::idx[NW] ] = dd_tmp_NW - sym_SE_NW + asym_SE_NW;
+
+   const real_t velXPZ = velX + velZ;
+   const real_t  sym_TE_BW = lambda_e_scaled_ * ( dd_tmp_TE + dd_tmp_BW - fac2 * velXPZ * velXPZ - t2x2 * feq_common );
+   const real_t asym_TE_BW = lambda_d_scaled_ * ( dd_tmp_TE - dd_tmp_BW - real_t(3.0) * t2x2 * velXPZ );
+   dst[ Stencil::idx[TE] ] = dd_tmp_TE - sym_TE_BW - asym_TE_BW;
+   dst[ Stencil::idx[BW] ] = dd_tmp_BW - sym_TE_BW + asym_TE_BW;
+
+   const real_t velXMZ = velX - velZ;
+   const real_t  sym_BE_TW = lambda_e_scaled_ * ( dd_tmp_BE + dd_tmp_TW - fac2 * velXMZ * velXMZ - t2x2 * feq_common );
+   const real_t asym_BE_TW = lambda_d_scaled_ * ( dd_tmp_BE - dd_tmp_TW - real_t(3.0) * t2x2 * velXMZ );
+   dst[ Stencil::idx[BE] ] = dd_tmp_BE - sym_BE_TW - asym_BE_TW;
+   dst[ Stencil::idx[TW] ] = dd_tmp_TW - sym_BE_TW + asym_BE_TW;
+
+   const real_t velYPZ = velY + velZ;
+   const real_t  sym_TN_BS = lambda_e_scaled_ * ( dd_tmp_TN + dd_tmp_BS - fac2 * velYPZ * velYPZ - t2x2 * feq_common );
+   const real_t asym_TN_BS = lambda_d_scaled_ * ( dd_tmp_TN - dd_tmp_BS - real_t(3.0) * t2x2 * velYPZ );
+   dst[ Stencil::idx[TN] ] = dd_tmp_TN - sym_TN_BS - asym_TN_BS;
+   dst[ Stencil::idx[BS] ] = dd_tmp_BS - sym_TN_BS + asym_TN_BS;
+
+   const real_t velYMZ = velY - velZ;
+   const real_t  sym_BN_TS = lambda_e_scaled_ * ( dd_tmp_BN + dd_tmp_TS - fac2 * velYMZ * velYMZ - t2x2 * feq_common );
+   const real_t asym_BN_TS = lambda_d_scaled_ * ( dd_tmp_BN - dd_tmp_TS - real_t(3.0) * t2x2 * velYMZ );
+   dst[ Stencil::idx[BN] ] = dd_tmp_BN - sym_BN_TS - asym_BN_TS;
+   dst[ Stencil::idx[TS] ] = dd_tmp_TS - sym_BN_TS + asym_BN_TS;
+
+   const real_t t1x2 = t1x2_0_ * rho;
+   const real_t fac1 = t1x2 * (real_t(9.0) / real_t(2.0));
+
+   const real_t  sym_N_S = lambda_e_scaled_ * ( dd_tmp_N + dd_tmp_S - fac1 * velY * velY - t1x2 * feq_common );
+   const real_t asym_N_S = lambda_d_scaled_ * ( dd_tmp_N - dd_tmp_S - real_t(3.0) * t1x2 * velY );
+   dst[ Stencil::idx[N] ] = dd_tmp_N - sym_N_S - asym_N_S;
+   dst[ Stencil::idx[S] ] = dd_tmp_S - sym_N_S + asym_N_S;
+
+   const real_t  sym_E_W = lambda_e_scaled_ * ( dd_tmp_E + dd_tmp_W - fac1 * velX * velX - t1x2 * feq_common );
+   const real_t asym_E_W = lambda_d_scaled_ * ( dd_tmp_E - dd_tmp_W - real_t(3.0) * t1x2 * velX );
+   dst[ Stencil::idx[E] ] = dd_tmp_E - sym_E_W - asym_E_W;
+   dst[ Stencil::idx[W] ] = dd_tmp_W - sym_E_W + asym_E_W;
+
+   const real_t  sym_T_B = lambda_e_scaled_ * ( dd_tmp_T + dd_tmp_B  - fac1 * velZ * velZ - t1x2 * feq_common );
+   const real_t asym_T_B = lambda_d_scaled_ * ( dd_tmp_T - dd_tmp_B - real_t(3.0) * t1x2 * velZ );
+   dst[ Stencil::idx[T] ] = dd_tmp_T - sym_T_B - asym_T_B;
+   dst[ Stencil::idx[B] ] = dd_tmp_B - sym_T_B + asym_T_B;
 }
 
 
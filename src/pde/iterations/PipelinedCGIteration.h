@@ -0,0 +1,378 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file PipelinedCGIteration.h
+//! \ingroup pde
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "core/Set.h"
+#include "core/logging/Logging.h"
+#include "core/mpi/Reduce.h"
+#include "core/uid/SUID.h"
+
+#include "domain_decomposition/BlockStorage.h"
+
+#include "field/GhostLayerField.h"
+#include "field/iterators/IteratorMacros.h"
+
+#include <functional>
+#include <vector>
+
+
+
+namespace walberla {
+namespace pde {
+
+
+
+//**********************************************************************************************************************
+/*!
+*   \brief Pipelined conjugate gradient method (Ghysels & Vanroose)
+*
+*   Mathematically equivalent to CGIteration, but both scalar products of an iteration ( r*r and w*r, with w = Ar )
+*   are combined into a single non-blocking reduction (mpi::allReduceAsync) that overlaps with the communication of w
+*   and the matrix-vector product q = Aw. Hence, there is only one global synchronization point per iteration, and
+*   its latency is hidden by the stencil application. The price are four additional fields (w, p, s, q) and a
+*   slightly reduced numerical stability, i.e., the residual may stagnate at a higher level than for CGIteration.
+*
+*   'synchronizeW' must synchronize the ghost layer of w, which is the only field whose neighbor values are accessed
+*   during the iteration.
+*/
+//**********************************************************************************************************************
+
+template< typename Stencil_T >
+class PipelinedCGIteration
+{
+public:
+
+   typedef GhostLayerField< real_t, 1 >                Field_T;
+   typedef GhostLayerField< real_t, Stencil_T::Size >  StencilField_T;
+
+   PipelinedCGIteration( BlockStorage & blocks,
+                         const BlockDataID & uId, const BlockDataID & rId, const BlockDataID & wId, const BlockDataID & pId,
+                         const BlockDataID & sId, const BlockDataID & zId, const BlockDataID & qId,
+                         const BlockDataID & fId, const BlockDataID & stencilId,
+                         const uint_t iterations, const std::function< void () > & synchronizeW,
+                         const real_t residualNormThreshold = real_t(0),
+                         const Set<SUID> & requiredSelectors     = Set<SUID>::emptySet(),
+                         const Set<SUID> & incompatibleSelectors = Set<SUID>::emptySet() );
+
+   void operator()();
+
+protected:
+
+   //////////////////////////////////////
+   // building blocks for pipelined CG //
+   //////////////////////////////////////
+   void calcR();                       // r = f - Au
+   void copyField( const BlockDataID & srcId, const BlockDataID & dstId );
+   void calcAw();                      // q = Aw
+   std::vector< real_t > scalarProductsRRWR(); // process local r*r and w*r
+   void update( const real_t alpha, const real_t beta ); // z = q + beta * z, s = w + beta * s, p = r + beta * p,
+                                                         // u = u + alpha * p, r = r - alpha * s, w = w - alpha * z
+
+
+
+   BlockStorage & blocks_;
+
+   const BlockDataID uId_;
+   const BlockDataID rId_;
+   const BlockDataID wId_;
+   const BlockDataID pId_;
+   const BlockDataID sId_;
+   const BlockDataID zId_;
+   const BlockDataID qId_;
+   const BlockDataID fId_;
+   const BlockDataID stencilId_;
+
+   real_t cells_;
+
+   uint_t iterations_;
+   real_t residualNormThreshold_;
+
+   std::function< void () > synchronizeW_;
+
+   Set<SUID> requiredSelectors_;
+   Set<SUID> incompatibleSelectors_;
+};
+
+
+
+template< typename Stencil_T >
+PipelinedCGIteration< Stencil_T >::PipelinedCGIteration( BlockStorage & blocks,
+                                                         const BlockDataID & uId, const BlockDataID & rId, const BlockDataID & wId, const BlockDataID & pId,
+                                                         const BlockDataID & sId, const BlockDataID & zId, const BlockDataID & qId,
+                                                         const BlockDataID & fId, const BlockDataID & stencilId,
+                                                         const uint_t iterations, const std::function< void () > & synchronizeW,
+                                                         const real_t residualNormThreshold,
+                                                         const Set<SUID> & requiredSelectors, const Set<SUID> & incompatibleSelectors ) :
+   blocks_( blocks ), uId_( uId ), rId_( rId ), wId_( wId ), pId_( pId ), sId_( sId ), zId_( zId ), qId_( qId ),
+   fId_( fId ), stencilId_( stencilId ),
+   iterations_( iterations ),
+   residualNormThreshold_( residualNormThreshold ),
+   synchronizeW_( synchronizeW ),
+   requiredSelectors_( requiredSelectors ), incompatibleSelectors_( incompatibleSelectors )
+{
+   uint_t cells( uint_t(0) );
+
+   for( auto block = blocks_.begin( requiredSelectors_, incompatibleSelectors_ ); block != blocks_.end(); ++block )
+   {
+      const Field_T * const u = block->template getData< const Field_T >( uId_ );
+      cells += u->xyzSize().numCells();
+   }
+
+   cells_ = real_c( cells );
+   mpi::allReduceInplace( cells_, mpi::SUM );
+}
+
+
+
+template< typename Stencil_T >
+void PipelinedCGIteration< Stencil_T >::operator()()
+{
+   WALBERLA_LOG_PROGRESS_ON_ROOT( "Starting pipelined CG iteration with a maximum number of " << iterations_ << " iterations" );
+
+   calcR(); // r = f - Au
+
+   // w = Ar (r has no ghost layer synchronization -> A is applied to w)
+   copyField( rId_, wId_ );
+   synchronizeW_();
+   calcAw();
+   copyField( qId_, wId_ );
+
+   real_t gammaOld( real_t(0) );
+   real_t alphaOld( real_t(0) );
+
+   uint_t i( uint_t(0) );
+   while( i < iterations_ )
+   {
+      auto reduction = mpi::allReduceAsync( scalarProductsRRWR(), mpi::SUM ); // gamma = r*r, delta = w*r
+
+      // overlaps with the reduction
+      synchronizeW_();
+      calcAw(); // q = Aw
+
+      const std::vector< real_t > & result = reduction.get();
+      const real_t gamma = result[0];
+      const real_t delta = result[1];
+
+      const real_t residualNorm = std::sqrt( gamma / cells_ );
+      if( residualNorm < residualNormThreshold_ )
+      {
+         WALBERLA_LOG_PROGRESS_ON_ROOT( "Aborting pipelined CG iteration (residual norm threshold reached):"
+                                        "\n  residual norm threshold: " << residualNormThreshold_ <<
+                                        "\n  residual norm:           " << residualNorm );
+         break;
+      }
+
+      real_t alpha( real_t(0) );
+      real_t beta ( real_t(0) );
+      if( i == uint_t(0) )
+      {
+         alpha = gamma / delta;
+      }
+      else
+      {
+         beta  = gamma / gammaOld;
+         alpha = gamma / ( delta - beta * gamma / alphaOld );
+      }
+
+      update( alpha, beta );
+
+      gammaOld = gamma;
+      alphaOld = alpha;
+
+      ++i;
+   }
+
+   WALBERLA_LOG_PROGRESS_ON_ROOT( "Pipelined CG iteration finished after " << i << " iterations" );
+}
+
+
+
+template< typename Stencil_T >
+void PipelinedCGIteration< Stencil_T >::calcR()  // r = f - Au
+{
+   for( auto block = blocks_.begin( requiredSelectors_, incompatibleSelectors_ ); block != blocks_.end(); ++block )
+   {
+      Field_T * rf             = block->template getData< Field_T >( rId_ );
+      Field_T * ff             = block->template getData< Field_T >( fId_ );
+      Field_T * uf             = block->template getData< Field_T >( uId_ );
+      StencilField_T * stencil = block->template getData< StencilField_T >( stencilId_ );
+
+      WALBERLA_ASSERT_NOT_NULLPTR( rf      );
+      WALBERLA_ASSERT_NOT_NULLPTR( ff      );
+      WALBERLA_ASSERT_NOT_NULLPTR( uf      );
+      WALBERLA_ASSERT_NOT_NULLPTR( stencil );
+
+      WALBERLA_ASSERT_EQUAL( rf->xyzSize(), ff->xyzSize()      );
+      WALBERLA_ASSERT_EQUAL( rf->xyzSize(), uf->xyzSize()      );
+      WALBERLA_ASSERT_EQUAL( rf->xyzSize(), stencil->xyzSize() );
+
+      WALBERLA_ASSERT_GREATER_EQUAL( uf->nrOfGhostLayers(), 1 );
+
+      WALBERLA_FOR_ALL_CELLS_XYZ( uf,
+
+         rf->get(x,y,z) = ff->get(x,y,z);
+
+         for( auto dir = Stencil_T::begin(); dir != Stencil_T::end(); ++dir )
+            rf->get(x,y,z) -= stencil->get( x, y, z, dir.toIdx() ) * uf->getNeighbor( x, y, z, *dir );
+      )
+   }
+}
+
+
+
+template< typename Stencil_T >
+void PipelinedCGIteration< Stencil_T >::copyField( const BlockDataID & srcId, const BlockDataID & dstId )
+{
+   for( auto block = blocks_.begin( requiredSelectors_, incompatibleSelectors_ ); block != blocks_.end(); ++block )
+   {
+      Field_T * src = block->template getData< Field_T >( srcId );
+      Field_T * dst = block->template getData< Field_T >( dstId );
+
+      WALBERLA_ASSERT_NOT_NULLPTR( src );
+      WALBERLA_ASSERT_NOT_NULLPTR( dst );
+
+      WALBERLA_ASSERT_EQUAL( src->xyzSize(), dst->xyzSize() );
+
+      WALBERLA_FOR_ALL_CELLS_XYZ( src,
+
+         dst->get(x,y,z) = src->get(x,y,z);
+      )
+   }
+}
+
+
+
+template< typename Stencil_T >
+void PipelinedCGIteration< Stencil_T >::calcAw() // q = Aw
+{
+   for( auto block = blocks_.begin( requiredSelectors_, incompatibleSelectors_ ); block != blocks_.end(); ++block )
+   {
+      Field_T * qf             = block->template getData< Field_T >( qId_ );
+      Field_T * wf             = block->template getData< Field_T >( wId_ );
+      StencilField_T * stencil = block->template getData< StencilField_T >( stencilId_ );
+
+      WALBERLA_ASSERT_NOT_NULLPTR( qf );
+      WALBERLA_ASSERT_NOT_NULLPTR( wf );
+
+      WALBERLA_ASSERT_EQUAL( qf->xyzSize(), wf->xyzSize() );
+
+      WALBERLA_ASSERT_GREATER_EQUAL( wf->nrOfGhostLayers(), 1 );
+
+      WALBERLA_FOR_ALL_CELLS_XYZ( wf,
+
+         qf->get(x,y,z) = stencil->get( x, y, z, Stencil_T::idx[stencil::C] ) * wf->get(x,y,z);
+
+         for( auto dir = Stencil_T::beginNoCenter(); dir != Stencil_T::end(); ++dir )
+            qf->get(x,y,z) += stencil->get( x, y, z, dir.toIdx() ) * wf->getNeighbor( x, y, z, *dir );
+      )
+   }
+}
+
+
+
+template< typename Stencil_T >
+std::vector< real_t > PipelinedCGIteration< Stencil_T >::scalarProductsRRWR() // r*r and w*r
+{
+   real_t rr( real_t(0) );
+   real_t wr( real_t(0) );
+
+   for( auto block = blocks_.begin( requiredSelectors_, incompatibleSelectors_ ); block != blocks_.end(); ++block )
+   {
+      Field_T * rf = block->template getData< Field_T >( rId_ );
+      Field_T * wf = block->template getData< Field_T >( wId_ );
+
+      WALBERLA_ASSERT_NOT_NULLPTR( rf );
+      WALBERLA_ASSERT_NOT_NULLPTR( wf );
+
+      WALBERLA_ASSERT_EQUAL( rf->xyzSize(), wf->xyzSize() );
+
+      real_t blockRR( real_t(0) );
+      real_t blockWR( real_t(0) );
+
+      WALBERLA_FOR_ALL_CELLS_XYZ_OMP( rf, omp parallel for schedule(static) reduction(+:blockRR,blockWR),
+
+         const real_t v = rf->get(x,y,z);
+         blockRR += v * v;
+         blockWR += wf->get(x,y,z) * v;
+      )
+
+      rr += blockRR;
+      wr += blockWR;
+   }
+
+   std::vector< real_t > result( 2 );
+   result[0] = rr;
+   result[1] = wr;
+   return result;
+}
+
+
+
+template< typename Stencil_T >
+void PipelinedCGIteration< Stencil_T >::update( const real_t alpha, const real_t beta )
+{
+   for( auto block = blocks_.begin( requiredSelectors_, incompatibleSelectors_ ); block != blocks_.end(); ++block )
+   {
+      Field_T * uf = block->template getData< Field_T >( uId_ );
+      Field_T * rf = block->template getData< Field_T >( rId_ );
+      Field_T * wf = block->template getData< Field_T >( wId_ );
+      Field_T * pf = block->template getData< Field_T >( pId_ );
+      Field_T * sf = block->template getData< Field_T >( sId_ );
+      Field_T * zf = block->template getData< Field_T >( zId_ );
+      Field_T * qf = block->template getData< Field_T >( qId_ );
+
+      WALBERLA_ASSERT_NOT_NULLPTR( uf );
+      WALBERLA_ASSERT_NOT_NULLPTR( rf );
+      WALBERLA_ASSERT_NOT_NULLPTR( wf );
+      WALBERLA_ASSERT_NOT_NULLPTR( pf );
+      WALBERLA_ASSERT_NOT_NULLPTR( sf );
+      WALBERLA_ASSERT_NOT_NULLPTR( zf );
+      WALBERLA_ASSERT_NOT_NULLPTR( qf );
+
+      WALBERLA_ASSERT_EQUAL( uf->xyzSize(), rf->xyzSize() );
+      WALBERLA_ASSERT_EQUAL( uf->xyzSize(), wf->xyzSize() );
+      WALBERLA_ASSERT_EQUAL( uf->xyzSize(), pf->xyzSize() );
+      WALBERLA_ASSERT_EQUAL( uf->xyzSize(), sf->xyzSize() );
+      WALBERLA_ASSERT_EQUAL( uf->xyzSize(), zf->xyzSize() );
+      WALBERLA_ASSERT_EQUAL( uf->xyzSize(), qf->xyzSize() );
+
+      // all vector updates are fused into one sweep over the block
+      WALBERLA_FOR_ALL_CELLS_XYZ( uf,
+
+         const real_t zv = qf->get(x,y,z) + beta * zf->get(x,y,z);
+         const real_t sv = wf->get(x,y,z) + beta * sf->get(x,y,z);
+         const real_t pv = rf->get(x,y,z) + beta * pf->get(x,y,z);
+
+         zf->get(x,y,z) = zv;
+         sf->get(x,y,z) = sv;
+         pf->get(x,y,z) = pv;
+
+         uf->get(x,y,z) = uf->get(x,y,z) + alpha * pv;
+         rf->get(x,y,z) = rf->get(x,y,z) - alpha * sv;
+         wf->get(x,y,z) = wf->get(x,y,z) - alpha * zv;
+      )
+   }
+}
+
+
+
+} // namespace pde
+} // namespace walberla
@@ -25,5 +25,6 @@
 #include "CGIteration.h"
 #include "CGFixedStencilIteration.h"
 #include "JacobiIteration.h"
+#include "PipelinedCGIteration.h"
 #include "RBGSIteration.h"
 #include "VCycles.h"
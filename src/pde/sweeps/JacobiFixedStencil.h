@@ -23,6 +23,7 @@
 
 #include "StencilSweepBase.h"
 #include "field/iterators/IteratorMacros.h"
+#include "simd/RuntimeDispatch.h"
 #include "stencil/Directions.h"
 
 
@@ -48,6 +49,21 @@ public:
       StencilSweepBase< Stencil_T >( src, dst, fFieldId, weights ) {}
 
    void operator()( IBlock * const block );
+
+   /// Instruction set the sweep is executed with (see simd/RuntimeDispatch.h).
+   /// Defaults to the most capable instruction set supported by the CPU the program is running on.
+   void setInstructionSet( const simd::InstructionSet is ) { instructionSet_ = simd::supportedInstructionSet( is ); }
+   simd::InstructionSet getInstructionSet() const { return instructionSet_; }
+
+private:
+
+   void update( Field_T * const sf, Field_T * const df, const Field_T * const ff, const real_t * const weights );
+#ifdef WALBERLA_SIMD_MULTIVERSIONING
+   WALBERLA_SIMD_TARGET_AVX2   void updateAVX2  ( Field_T * const sf, Field_T * const df, const Field_T * const ff, const real_t * const weights ) { update( sf, df, ff, weights ); }
+   WALBERLA_SIMD_TARGET_AVX512 void updateAVX512( Field_T * const sf, Field_T * const df, const Field_T * const ff, const real_t * const weights ) { update( sf, df, ff, weights ); }
+#endif
+
+   simd::InstructionSet instructionSet_ = simd::bestAvailableInstructionSet();
 };
 
 
@@ -67,8 +83,33 @@ void JacobiFixedStencil< Stencil_T >::operator()( IBlock * const block )
    for( auto dir = Stencil_T::beginNoCenter(); dir != Stencil_T::end(); ++dir )
       weights[ dir.toIdx() ] = this->w( dir.toIdx() );
    weights[ Stencil_T::idx[ stencil::C ] ] = real_t(1) / this->w( Stencil_T::idx[ stencil::C ] ); // center already inverted here!
- 
-   WALBERLA_FOR_ALL_CELLS_XYZ( sf,
+
+#ifdef _OPENMP
+   #pragma omp parallel
+   {
+#endif
+#ifdef WALBERLA_SIMD_MULTIVERSIONING
+   if( instructionSet_ == simd::AVX512 )
+      updateAVX512( sf, df, ff, weights );
+   else if( instructionSet_ == simd::AVX2 )
+      updateAVX2( sf, df, ff, weights );
+   else
+#endif
+   update( sf, df, ff, weights );
+#ifdef _OPENMP
+   }
+#endif
+
+   sf->swapDataPointers( df );
+}
+
+
+
+template< typename Stencil_T >
+void JacobiFixedStencil< Stencil_T >::update( Field_T * const sf, Field_T * const df, const Field_T * const ff, const real_t * const weights )
+{
+   // called from within a parallel region (see operator()), hence only the work is shared among the threads
+   WALBERLA_FOR_ALL_CELLS_XYZ_OMP( sf, omp for schedule(static),
    
       df->get(x,y,z) = ff->get(x,y,z);
 
@@ -77,9 +118,7 @@ void JacobiFixedStencil< Stencil_T >::operator()( IBlock * const block )
 
       df->get(x,y,z) *= weights[ Stencil_T::idx[ stencil::C ] ];   
    
-   ) // WALBERLA_FOR_ALL_CELLS_XYZ
-
-   sf->swapDataPointers( df );
+   ) // WALBERLA_FOR_ALL_CELLS_XYZ_OMP
 }
 
 
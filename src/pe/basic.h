@@ -32,6 +32,7 @@
 
 #include "pe/rigidbody/StorageDataHandling.h"
 #include "pe/ccd/HashGridsDataHandling.h"
+#include "pe/ccd/VerletListCCDDataHandling.h"
 #include "pe/fcd/SimpleFCDDataHandling.h"
 #include "pe/bg/SimpleBGDataHandling.h"
 #include "pe/cr/DEM.h"
@@ -203,6 +203,37 @@ void HashGrids::HashGrid::update( BodyID body )
 }
 //*************************************************************************************************
 
+//*************************************************************************************************
+/*!\brief Gathers the bodies of this hash grid and copies of their AABBs into contiguous arrays.
+ *
+ * \return The number of bodies stored in this grid.
+ *
+ * The bodies are ordered by cell, the cells in the order of \a occupiedCells_. Every occupied cell
+ * stores the index of its first body (=> 'firstBody_'), so the AABBs of the bodies of any cell can
+ * be accessed without touching the bodies themselves. Has to be called before process() and
+ * processBodies() whenever bodies were moved, added or removed.
+ */
+size_t HashGrids::HashGrid::collectBodies()
+{
+   gridBodies_.resize( bodyCount_ );
+   gridBoxes_.resize( bodyCount_ );
+
+   size_t index = 0;
+   for( auto cellIt = occupiedCells_.begin(); cellIt < occupiedCells_.end(); ++cellIt ) {
+      (*cellIt)->firstBody_ = index;
+      BodyVector* cellBodies = (*cellIt)->bodies_;
+      for( auto bodyIt = cellBodies->begin(); bodyIt < cellBodies->end(); ++bodyIt, ++index ) {
+         gridBodies_[index] = *bodyIt;
+         gridBoxes_[index]  = (*bodyIt)->getAABB();
+      }
+   }
+   WALBERLA_ASSERT_EQUAL( index, bodyCount_ );
+
+   return bodyCount_;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Clears the hash grid.
  *
@@ -871,50 +902,89 @@ void HashGrids::update(WcTimingTree* tt)
       //                        its current grid (=> "grid->remove()") and reassigned to a grid with
       //                        suitably sized cells (=> "addGrid()").
 
+      //                     The checks are performed for all bodies in parallel, only the bodies
+      //                     whose grid or cell association changed are reassigned (sequentially).
+
+      updateBodies( bodystorage_ );
+
+      if( &bodystorage_ != &bodystorageShadowCopies_ ) {
+         updateBodies( bodystorageShadowCopies_ );
+      }
+   }
+   if (tt != nullptr) tt->stop("Update");
+}
+
+//*************************************************************************************************
+/*!\brief Updates the grid and cell associations of all bodies of a body storage.
+ *
+ * \param storage The body storage whose bodies are updated.
+ * \return void
+ *
+ * The bodies whose grid association (size of the AABB) or cell association (hash value) changed
+ * are determined by all OpenMP threads. These bodies are then reassigned sequentially and in the
+ * order of the body storage.
+ */
+void HashGrids::updateBodies( BodyStorage& storage )
+{
+   // The team may be smaller than omp_get_max_threads() (dynamic adjustment, nested regions), hence all buffers are
+   // cleared here and not by the threads that use them.
+   threadBodies_.resize( size_t( omp_get_max_threads() ) );
+   for( auto bodies = threadBodies_.begin(); bodies != threadBodies_.end(); ++bodies )
+      bodies->clear();
+
+   const int numberOfBodies = int_c( storage.size() );
+
+#ifdef _OPENMP
+   #pragma omp parallel
+#endif
+   {
+#ifdef _OPENMP
+      BodyVector& movedBodies = threadBodies_[ size_t( omp_get_thread_num() ) ];
+#else
+      BodyVector& movedBodies = threadBodies_[0];
+#endif
+
+#ifdef _OPENMP
+      #pragma omp for schedule(static)
+#endif
+      for( int i = 0; i < numberOfBodies; ++i )
       {
-         for( auto& body : bodystorage_ )
-         {
-            HashGrid* grid = static_cast<HashGrid*>( body.getGrid() );
+         BodyID body = storage.at( size_t(i) );
+         const HashGrid* grid = static_cast<const HashGrid*>( body->getGrid() );
 
-            if( grid != nullptr )
-            {
-               real_t size     = body.getAABBSize();
-               real_t cellSpan = grid->getCellSpan();
+         if( grid != nullptr )
+         {
+            real_t size     = body->getAABBSize();
+            real_t cellSpan = grid->getCellSpan();
 
-               if( size >= cellSpan || size < ( cellSpan / hierarchyFactor ) ) {
-                  grid->remove( &body );
-                  addGrid( &body );
-               }
-               else {
-                  grid->update( &body );
-               }
+            if( size >= cellSpan || size < ( cellSpan / hierarchyFactor ) || grid->hasMoved( body ) ) {
+               movedBodies.push_back( body );
             }
          }
       }
+   }
 
-      if( &bodystorage_ != &bodystorageShadowCopies_ ) {
-         for( auto& body : bodystorageShadowCopies_ )
-         {
-            HashGrid* grid = static_cast<HashGrid*>( body.getGrid() );
+   for( auto bodies = threadBodies_.begin(); bodies != threadBodies_.end(); ++bodies )
+   {
+      for( auto bodyIt = bodies->begin(); bodyIt != bodies->end(); ++bodyIt )
+      {
+         BodyID    body = *bodyIt;
+         HashGrid* grid = static_cast<HashGrid*>( body->getGrid() );
 
-            if( grid != nullptr )
-            {
-               real_t size     = body.getAABBSize();
-               real_t cellSpan = grid->getCellSpan();
+         real_t size     = body->getAABBSize();
+         real_t cellSpan = grid->getCellSpan();
 
-               if( size >= cellSpan || size < ( cellSpan / hierarchyFactor ) ) {
-                  grid->remove( &body );
-                  addGrid( &body );
-               }
-               else {
-                  grid->update( &body );
-               }
-            }
+         if( size >= cellSpan || size < ( cellSpan / hierarchyFactor ) ) {
+            grid->remove( body );
+            addGrid( body );
+         }
+         else {
+            grid->update( body );
          }
       }
    }
-   if (tt != nullptr) tt->stop("Update");
 }
+//*************************************************************************************************
 
 //**Implementation of ICCD interface ********************************************************
 //*************************************************************************************************
@@ -938,37 +1008,80 @@ PossibleContacts& HashGrids::generatePossibleContacts( WcTimingTree* tt )
    if (tt != nullptr) tt->start("Detection");
    // ----- DETECTION STEP ----- //
 
-   // Contact generation by traversing through all hash grids (which are sorted in ascending order
-   // with respect to the size of their cells).
+   if (tt != nullptr) tt->start("CollectBodies");
    for( auto gridIt = gridList_.begin(); gridIt != gridList_.end(); ++gridIt ) {
-
-      // Contact generation for all bodies stored in the currently processed grid 'grid'.
-      BodyID* bodies     = nullptr;
-      size_t  bodyCount = (*gridIt)->process( &bodies, contacts_ );
-
-      if( bodyCount > 0 ) {
-
-         // Test all bodies stored in 'grid' against bodies stored in grids with larger sized cells.
-         auto nextGridIt = gridIt;
-         for( ++nextGridIt; nextGridIt != gridList_.end(); ++nextGridIt ) {
-            (*nextGridIt)->processBodies( bodies, bodyCount, contacts_ );
-         }
-
-         BodyID* bodiesEnd = bodies + bodyCount;
-         for( BodyID* a = bodies; a < bodiesEnd; ++a ) {
-            // Test all bodies stored in 'grid' against all bodies stored in 'nonGridBodies_'.
-            for( auto bIt = nonGridBodies_.begin(); bIt < nonGridBodies_.end(); ++bIt ) {
-               collide( *a, *bIt, contacts_ );
+      (*gridIt)->collectBodies();
+   }
+   if (tt != nullptr) tt->stop("CollectBodies");
+
+   if (tt != nullptr) tt->start("PairTests");
+   // The pair tests are distributed among the OpenMP threads. Every thread stores its contacts in
+   // its own buffer, the buffers are concatenated in the order of the threads afterwards.
+   threadContacts_.resize( size_t( omp_get_max_threads() ) );
+   for( auto c = threadContacts_.begin(); c != threadContacts_.end(); ++c )
+      c->clear();
+
+#ifdef _OPENMP
+   #pragma omp parallel
+#endif
+   {
+#ifdef _OPENMP
+      PossibleContacts& contacts = threadContacts_[ size_t( omp_get_thread_num() ) ];
+#else
+      PossibleContacts& contacts = threadContacts_[0];
+#endif
+
+      // Contact generation by traversing through all hash grids (which are sorted in ascending order
+      // with respect to the size of their cells).
+      for( auto gridIt = gridList_.begin(); gridIt != gridList_.end(); ++gridIt ) {
+
+         // Contact generation for all bodies stored in the currently processed grid 'grid'.
+         const HashGrid* grid = *gridIt;
+         grid->process( contacts );
+
+         const size_t bodyCount = grid->getBodyCount();
+         if( bodyCount > 0 ) {
+
+            const BodyID* bodies = grid->getBodies();
+            const AABB*   boxes  = grid->getBoxes();
+
+            // Test all bodies stored in 'grid' against bodies stored in grids with larger sized cells.
+            auto nextGridIt = gridIt;
+            for( ++nextGridIt; nextGridIt != gridList_.end(); ++nextGridIt ) {
+               (*nextGridIt)->processBodies( bodies, boxes, bodyCount, contacts );
             }
-            // Test all bodies stored in 'grid' against all bodies stored in 'globalStorage_'.
-            for( auto bIt = globalStorage_.begin(); bIt < globalStorage_.end(); ++bIt ) {
-               collide( *a, &(*bIt), contacts_ );
+
+            const int numberOfBodies = int_c( bodyCount );
+#ifdef _OPENMP
+            #pragma omp for schedule(static) nowait
+#endif
+            for( int i = 0; i < numberOfBodies; ++i ) {
+               BodyID a = bodies[i];
+               // Test all bodies stored in 'grid' against all bodies stored in 'nonGridBodies_'.
+               for( auto bIt = nonGridBodies_.begin(); bIt < nonGridBodies_.end(); ++bIt ) {
+                  collide( a, *bIt, contacts );
+               }
+               // Test all bodies stored in 'grid' against all bodies stored in 'globalStorage_'.
+               for( auto bIt = globalStorage_.begin(); bIt < globalStorage_.end(); ++bIt ) {
+                  collide( a, &(*bIt), contacts );
+               }
             }
          }
       }
+   }
 
-      delete[] bodies;
+   if( threadContacts_.size() == 1 ) {
+      contacts_.swap( threadContacts_[0] );
+   }
+   else {
+      size_t numberOfContacts = 0;
+      for( auto c = threadContacts_.begin(); c != threadContacts_.end(); ++c )
+         numberOfContacts += c->size();
+      contacts_.reserve( numberOfContacts );
+      for( auto c = threadContacts_.begin(); c != threadContacts_.end(); ++c )
+         contacts_.insert( contacts_.end(), c->begin(), c->end() );
    }
+   if (tt != nullptr) tt->stop("PairTests");
 
    for( auto aIt = nonGridBodies_.begin(); aIt < nonGridBodies_.end(); ++aIt ) {
       // Pairwise test (=> contact generation) for all bodies that are stored in 'nonGridBodies_'.
@@ -34,6 +34,7 @@
 #include <core/logging/Logging.h>
 #include <core/debug/Debug.h>
 #include <core/NonCopyable.h>
+#include <core/OpenMP.h>
 
 #include <cmath>
 #include <list>
@@ -136,6 +137,9 @@ private:
                                              cells in the hash grid. */
          size_t      occupiedCellsId_;  //!< The cell's index in the \a occupiedCells_ vector.
          int         lastNonFixedBody_; //!< marks the last body in the array which is not fixed
+         size_t      firstBody_;        /*!< \brief Index of the cell's first body in the grid-global
+                                             \a gridBodies_ and \a gridBoxes_ arrays. */
+                                        /*!< Only valid after a call to collectBodies(). */
       };
       //*******************************************************************************************
 
@@ -163,6 +167,7 @@ private:
       /*!\name Getter functions */
       //@{
       real_t getCellSpan() const { return cellSpan_; }  //!< Getter for \a cellSpan_.
+      size_t getBodyCount() const { return bodyCount_; }  //!< Getter for \a bodyCount_.
       //@}
       //*******************************************************************************************
 
@@ -178,12 +183,17 @@ private:
       /*!\name Utility functions */
       //@{
       void update( BodyID body );
+      inline bool hasMoved( BodyID body ) const { return hash( body ) != body->getHash(); }
+
+      size_t collectBodies();
+      const BodyID* getBodies() const { return gridBodies_.data(); }  //!< Bodies gathered by collectBodies().
+      const AABB*   getBoxes () const { return gridBoxes_.data(); }   //!< AABBs gathered by collectBodies().
 
       template< typename Contacts >
-      size_t process      ( BodyID** gridBodies, Contacts& contacts ) const;
+      void process      ( Contacts& contacts ) const;
 
       template< typename Contacts >
-      void   processBodies( BodyID* bodies, size_t bodyCount, Contacts& contacts ) const;
+      void processBodies( const BodyID* bodies, const AABB* boxes, size_t bodyCount, Contacts& contacts ) const;
       
       template<typename BodyTuple>
       BodyID getRayIntersectingBody(const raytracing::Ray& ray, const AABB& blockAABB, real_t& t, Vec3& n,
@@ -251,6 +261,11 @@ private:
 
       size_t bodyCount_;  //!< Number of bodies assigned to this hash grid.
 
+      BodyVector        gridBodies_;  //!< All bodies of this grid, ordered by cell (see collectBodies()).
+      std::vector<AABB> gridBoxes_;   /*!< \brief Copies of the AABBs of the bodies in \a gridBodies_.
+                                           The contiguous copies are used for the batched overlap tests
+                                           of the detection step. */
+
       offset_t stdNeighborOffset_[27];  /*!< \brief Array of offsets to the neighboring cells (valid
                                                     for all the inner cells of the hash grid). */
       //@}
@@ -315,6 +330,10 @@ protected:
    //@{
    template< typename Contacts >
    static inline void collide( BodyID a, BodyID b, Contacts& contacts );
+
+   template< typename Contacts >
+   static inline void collide( BodyID a, const AABB& aBox, const BodyID* bodies, const AABB* boxes, size_t count,
+                               Contacts& contacts );
    //@}
    //**********************************************************************************************
 
@@ -330,7 +349,8 @@ private:
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   static inline bool powerOfTwo( size_t number );
+          void        updateBodies( BodyStorage& storage );
+   static inline bool powerOfTwo  ( size_t number );
    //@}
    //**********************************************************************************************
 
@@ -361,6 +381,8 @@ private:
                                       faster than involving the far more complex mechanisms of the
                                       hierarchical hash grids. */
    int          observedBodyCount_;  /// number of bodies currently tracked by this hashgrid
+   std::vector<PossibleContacts> threadContacts_;  //!< Contact buffers of the OpenMP threads (detection step).
+   std::vector<BodyVector>       threadBodies_;    //!< Bodies found to be moved by the OpenMP threads (update step).
    //@}
    //**********************************************************************************************
 };
@@ -379,71 +401,60 @@ private:
 //*************************************************************************************************
 /*!\brief Processes this hash grid for colliding bodies.
  *
- * \param gridBodies Linear array of (handles to) all the bodies stored in this hash grid.
  * \param contacts Contact container for the generated contacts.
- * \return The number of bodies stored in this grid - which is the number of bodies stored in \a gridBodies.
+ * \return void
  *
  * This function generates all contacts between all rigid bodies that are assigned to this grid. The
- * contacts are added to the contact container \a contacts. Moreover, a linear array that contains
- * (handles to) all bodies that are stored in this grid is returned in order to being able to check
- * these bodies against other bodies that are stored in grids with larger sized cells.
+ * contacts are added to the contact container \a contacts. The bodies and AABBs of this grid have to
+ * be gathered by collectBodies() beforehand.
+ *
+ * If called within an OpenMP parallel region, the occupied cells are distributed among the threads
+ * of the team (without a barrier at the end), each thread adding its contacts to its own \a contacts.
  */
 template< typename Contacts >  // Contact container type
-size_t HashGrids::HashGrid::process( BodyID** gridBodies, Contacts& contacts ) const
+void HashGrids::HashGrid::process( Contacts& contacts ) const
 {
-   BodyID* bodies = new BodyID[ bodyCount_ ];
-   *gridBodies    = bodies;
+   const int numberOfCells = int_c( occupiedCells_.size() );
 
    // Iterate through all cells that are occupied by bodies (=> 'occupiedCells_') and ...
-   for( typename CellVector::const_iterator cell = occupiedCells_.begin(); cell < occupiedCells_.end(); ++cell )
+#ifdef _OPENMP
+   #pragma omp for schedule(static) nowait
+#endif
+   for( int c = 0; c < numberOfCells; ++c )
    {
-      BodyVector* cellBodies = (*cell)->bodies_;
-
-      // ... perform pairwise collision checks within each of these cells.
-      for( auto aIt = cellBodies->begin(); aIt < cellBodies->end(); ++aIt ) {
-         auto end = cellBodies->begin();
-         if ((*aIt)->isFixed())
-         {
-            end = cellBodies->begin() + ((*cell)->lastNonFixedBody_ + 1);
-         } else
-         {
-            end = cellBodies->end();
-         }
-         for( auto bIt = aIt + 1; bIt < end; ++bIt ) {
-            WALBERLA_ASSERT( !((*aIt)->isFixed() && (*bIt)->isFixed()), "collision between two fixed bodies" );
-            HashGrids::collide( *aIt, *bIt, contacts );
-         }
-         *(bodies++) = *aIt;
+      const Cell*   cell     = occupiedCells_[ size_t(c) ];
+      const BodyID* bodies   = cell->bodies_->data();
+      const AABB*   boxes    = gridBoxes_.data() + cell->firstBody_;
+      const size_t  count    = cell->bodies_->size();
+      const size_t  nonFixed = size_t( cell->lastNonFixedBody_ + 1 );
+
+      // ... perform pairwise collision checks within each of these cells. Fixed bodies are stored
+      // after all non-fixed bodies, hence fixed bodies are only checked against non-fixed bodies.
+      for( size_t a = 0; a < count; ++a ) {
+         const size_t end = bodies[a]->isFixed() ? nonFixed : count;
+         if( a + 1 < end )
+            HashGrids::collide( bodies[a], boxes[a], bodies + a + 1, boxes + a + 1, end - a - 1, contacts );
       }
 
       // Moreover, check all the bodies that are stored in the currently processed cell against all
       // bodies that are stored in the first half of all directly adjacent cells.
       for( unsigned int i = 0; i < 13; ++i )
       {
-         Cell*       nbCell   = (*cell) + (*cell)->neighborOffset_[i];
-         BodyVector* nbBodies = nbCell->bodies_;
+         const Cell*       nbCell   = cell + cell->neighborOffset_[i];
+         const BodyVector* nbBodies = nbCell->bodies_;
 
-         if( nbBodies != NULL )
+         if( nbBodies != nullptr )
          {
-            for( auto aIt = cellBodies->begin(); aIt < cellBodies->end(); ++aIt ) {
-               auto endNeighbour = nbBodies->begin();
-               if ((*aIt)->isFixed())
-               {
-                  endNeighbour = nbBodies->begin() + (nbCell->lastNonFixedBody_ + 1);
-               } else
-               {
-                  endNeighbour = nbBodies->end();
-               }
-               for( auto bIt = nbBodies->begin(); bIt < endNeighbour; ++bIt ) {
-                  WALBERLA_ASSERT( !((*aIt)->isFixed() && (*bIt)->isFixed()), "collision between two fixed bodies" );
-                  HashGrids::collide( *aIt, *bIt, contacts );
-               }
+            const AABB*  nbBoxes    = gridBoxes_.data() + nbCell->firstBody_;
+            const size_t nbNonFixed = size_t( nbCell->lastNonFixedBody_ + 1 );
+
+            for( size_t a = 0; a < count; ++a ) {
+               HashGrids::collide( bodies[a], boxes[a], nbBodies->data(), nbBoxes,
+                                   bodies[a]->isFixed() ? nbNonFixed : nbBodies->size(), contacts );
             }
          }
       }
    }
-
-   return bodyCount_;
 }
 //*************************************************************************************************
 
@@ -454,45 +465,48 @@ size_t HashGrids::HashGrid::process( BodyID** gridBodies, Contacts& contacts ) c
  *
  * \param bodies Linear array of (handles to) all the bodies that are about to be checked for
  *        collisions with the bodies that are stored in this grid.
+ * \param boxes Linear array of the AABBs of the bodies in \a bodies.
  * \param bodyCount The number of bodies that are stored in \a bodies.
  * \param contacts Contact container for the generated contacts.
  * \return void
  *
  * This function generates all contacts between the rigid bodies that are stored in \a bodies and
  * all the rigid bodies that are assigned to this grid. The contacts are added to the contact
- * container \a contacts.
+ * container \a contacts. The bodies and AABBs of this grid have to be gathered by collectBodies()
+ * beforehand.
+ *
+ * If called within an OpenMP parallel region, the bodies in \a bodies are distributed among the
+ * threads of the team (without a barrier at the end).
  */
 template< typename Contacts >  // Contact container type
-void HashGrids::HashGrid::processBodies( BodyID* bodies, size_t bodyCount, Contacts& contacts ) const
+void HashGrids::HashGrid::processBodies( const BodyID* bodies, const AABB* boxes, size_t bodyCount, Contacts& contacts ) const
 {
+   const int numberOfBodies = int_c( bodyCount );
+
    // For each body 'a' that is stored in 'bodies' ...
-   for( BodyID* aIt = bodies; aIt < bodies + bodyCount; ++aIt )
+#ifdef _OPENMP
+   #pragma omp for schedule(static) nowait
+#endif
+   for( int i = 0; i < numberOfBodies; ++i )
    {
+      const BodyID a    = bodies[i];
+      const AABB&  aBox = boxes[i];
+
       // ... calculate the body's cell association (=> "hash()") within this hash grid and ...
-      Cell* cell = cell_ + hash( *aIt );
+      const Cell* cell = cell_ + hashPoint( aBox.xMin(), aBox.yMin(), aBox.zMin() );
 
       // ... check 'a' against every body that is stored in this or in any of the directly adjacent
       // cells. Note: one entry in the offset array of a cell is always referring back to the cell
       // itself. As a consequence, a specific cell X and all of its neighbors can be addressed by
       // simply iterating through all entries of X's offset array!
-      for( unsigned int i = 0; i < 27; ++i )
+      for( unsigned int j = 0; j < 27; ++j )
       {
-         Cell*       nbCell   = cell + cell->neighborOffset_[i];
-         BodyVector* nbBodies = nbCell->bodies_;
-
-         if( nbBodies != NULL ) {
-            auto endNeighbour = nbBodies->begin();
-            if ((*aIt)->isFixed())
-            {
-               endNeighbour = nbBodies->begin() + (nbCell->lastNonFixedBody_ + 1);
-            } else
-            {
-               endNeighbour = nbBodies->end();
-            }
-            for( auto bIt = nbBodies->begin(); bIt != endNeighbour; ++bIt ) {
-               WALBERLA_ASSERT( !((*aIt)->isFixed() && (*bIt)->isFixed()), "collision between two fixed bodies" );
-               HashGrids::collide( *aIt, *bIt, contacts );
-            }
+         const Cell*       nbCell   = cell + cell->neighborOffset_[j];
+         const BodyVector* nbBodies = nbCell->bodies_;
+
+         if( nbBodies != nullptr ) {
+            const size_t count = a->isFixed() ? size_t( nbCell->lastNonFixedBody_ + 1 ) : nbBodies->size();
+            HashGrids::collide( a, aBox, nbBodies->data(), gridBoxes_.data() + nbCell->firstBody_, count, contacts );
          }
       }
    }
@@ -835,6 +849,46 @@ void HashGrids::collide( BodyID a, BodyID b, Contacts& contacts )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checks a body against a batch of bodies and generates the related points of contact.
+ *
+ * \param a The first body.
+ * \param aBox The AABB of the first body.
+ * \param bodies Linear array of \a count bodies that are checked against \a a.
+ * \param boxes Linear array of the AABBs of the bodies in \a bodies.
+ * \param count The number of bodies in \a bodies.
+ * \param contacts Contact container for the generated contacts.
+ * \return void
+ *
+ * Equivalent to calling collide( a, bodies[i], contacts ) for all bodies, but the overlap tests are
+ * performed on the contiguous array \a boxes. The bodies themselves are only accessed for the pairs
+ * with overlapping bounding boxes.
+ */
+template< typename Contacts >  // Contact container type
+void HashGrids::collide( BodyID a, const AABB& aBox, const BodyID* bodies, const AABB* boxes, size_t count,
+                         Contacts& contacts )
+{
+   for( size_t i = 0; i < count; ++i )
+   {
+      if( aBox.intersects( boxes[i] ) )  // Testing for overlapping bounding boxes
+      {
+         BodyID b = bodies[i];
+         WALBERLA_ASSERT( !(a->isFixed() && b->isFixed()), "collision between two fixed bodies" );
+
+         if( !a->hasInfiniteMass() || !b->hasInfiniteMass() )  // Ignoring contacts between two fixed bodies
+         {
+            //make sure to always store in the correct order (a<b)
+            if( a->getSystemID() > b->getSystemID() )
+               contacts.push_back( std::make_pair(b, a) );
+            else
+               contacts.push_back( std::make_pair(a, b) );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
 }  // namespace ccd
 
 }  // namespace pe
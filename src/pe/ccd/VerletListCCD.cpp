@@ -0,0 +1,235 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file VerletListCCD.cpp
+//
+//======================================================================================================================
+
+#include "VerletListCCD.h"
+
+#include "pe/rigidbody/BodyStorage.h"
+
+#include "core/debug/CheckFunctions.h"
+#include "core/debug/Debug.h"
+#include "core/logging/Logging.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace walberla {
+namespace pe {
+namespace ccd {
+
+VerletListCCD::VerletListCCD(BodyStorage& globalStorage, Storage& storage, real_t skin)
+   : globalStorage_(globalStorage), storage_(storage), skin_(skin), rebuildRequired_(true), numberOfRebuilds_(0)
+{
+   WALBERLA_CHECK_GREATER_EQUAL( skin_, real_t(0), "The skin distance must not be negative." );
+
+   // The Verlet list holds handles to the bodies, hence it is rebuilt whenever the set of bodies changes.
+   auto requireRebuild = [this]( BodyID ){ rebuildRequired_ = true; };
+
+   storage_[0].registerAddCallback( "VerletListCCD", requireRebuild );
+   storage_[0].registerRemoveCallback( "VerletListCCD", requireRebuild );
+
+   storage_[1].registerAddCallback( "VerletListCCD", requireRebuild );
+   storage_[1].registerRemoveCallback( "VerletListCCD", requireRebuild );
+}
+
+VerletListCCD::~VerletListCCD()
+{
+   storage_[0].deregisterAddCallback( "VerletListCCD" );
+   storage_[0].deregisterRemoveCallback( "VerletListCCD" );
+
+   storage_[1].deregisterAddCallback( "VerletListCCD" );
+   storage_[1].deregisterRemoveCallback( "VerletListCCD" );
+}
+
+
+PossibleContacts& VerletListCCD::generatePossibleContacts( WcTimingTree* tt ){
+   contacts_.clear();
+
+   if (tt != nullptr) tt->start("VerletListCCD");
+
+   if (tt != nullptr) tt->start("RebuildCheck");
+   const bool rebuildRequired = isRebuildRequired();
+   if (tt != nullptr) tt->stop("RebuildCheck");
+
+   if( rebuildRequired )
+   {
+      if (tt != nullptr) tt->start("Rebuild");
+      rebuild();
+      if (tt != nullptr) tt->stop("Rebuild");
+   }
+
+   if (tt != nullptr) tt->start("PairTests");
+   for (auto it = pairs_.begin(); it != pairs_.end(); ++it)
+   {
+      if ( ( !it->first->hasInfiniteMass() || !it->second->hasInfiniteMass() ) &&  // Ignoring contacts between two fixed bodies
+           ( it->first->getAABB().intersects( it->second->getAABB() ) ) )         // Testing for overlapping bounding boxes
+      {
+         contacts_.push_back( *it );
+      }
+   }
+
+   for (auto it1 = bodies_.begin(); it1 != bodies_.end(); ++it1)
+   {
+      for (auto it2 = globalStorage_.begin(); it2 != globalStorage_.end(); ++it2)
+      {
+         if ( ( !(*it1)->hasInfiniteMass() || !it2->hasInfiniteMass() ) &&
+              ( (*it1)->getAABB().intersects( it2->getAABB() ) ) )
+         {
+            if ( (*it1)->getSystemID() > it2->getSystemID() )
+               contacts_.push_back(std::make_pair(it2.getBodyID(), *it1));
+            else
+               contacts_.push_back(std::make_pair(*it1, it2.getBodyID()));
+         }
+      }
+   }
+   if (tt != nullptr) tt->stop("PairTests");
+
+   if (tt != nullptr) tt->stop("VerletListCCD");
+
+   return contacts_;
+}
+
+int VerletListCCD::getObservedBodyCount() const
+{
+   return static_cast<int> (globalStorage_.size() + storage_[0].size() + storage_[1].size());
+}
+
+/// The list is invalid if bodies were added or removed, or if the AABB of any body left its extended AABB.
+bool VerletListCCD::isRebuildRequired() const
+{
+   if( rebuildRequired_ )
+      return true;
+
+   for( size_t i = 0; i < bodies_.size(); ++i )
+   {
+      if( !verletBoxes_[i].contains( bodies_[i]->getAABB() ) )
+         return true;
+   }
+
+   return false;
+}
+
+void VerletListCCD::rebuild()
+{
+   WALBERLA_LOG_DETAIL( "Rebuilding Verlet list." );
+
+   rebuildRequired_ = false;
+   ++numberOfRebuilds_;
+
+   bodies_.clear();
+   for( auto& body : storage_[0] )
+      bodies_.push_back( &body );
+   for( auto& body : storage_[1] )
+      bodies_.push_back( &body );
+
+   const size_t numberOfBodies = bodies_.size();
+   verletBoxes_.resize( numberOfBodies );
+   pairs_.clear();
+
+   if( numberOfBodies == 0 )
+      return;
+
+   // extended AABBs and the region spanned by their min corners (=> cell association)
+   real_t maxExtent( 0 );
+   Vec3 minCorner( std::numeric_limits<real_t>::max() );
+   Vec3 maxCorner( -std::numeric_limits<real_t>::max() );
+   for( size_t i = 0; i < numberOfBodies; ++i )
+   {
+      verletBoxes_[i] = bodies_[i]->getAABB().getExtended( real_t(0.5) * skin_ );
+      const AABB& box = verletBoxes_[i];
+      maxExtent = std::max( maxExtent, std::max( box.xSize(), std::max( box.ySize(), box.zSize() ) ) );
+      for( uint_t d = 0; d < 3; ++d )
+      {
+         minCorner[d] = std::min( minCorner[d], box.minCorner()[d] );
+         maxCorner[d] = std::max( maxCorner[d], box.minCorner()[d] );
+      }
+   }
+
+   // Two extended AABBs can only overlap if the distance of their min corners is smaller than the
+   // largest extent in each direction. Hence, with cells at least as large as the largest extent, only
+   // the directly adjacent cells have to be checked. The cells are enlarged if the bodies are sparse,
+   // so that the number of cells is in the order of the number of bodies.
+   const Vec3   span     = maxCorner - minCorner;
+   const real_t cellSize = std::max( maxExtent, std::cbrt( ( span[0] + maxExtent ) * ( span[1] + maxExtent ) * ( span[2] + maxExtent ) /
+                                                           real_c( numberOfBodies ) ) );
+   WALBERLA_ASSERT_GREATER( cellSize, real_t(0) );
+   const real_t inverseCellSize = real_t(1) / cellSize;
+
+   size_t cells[3];
+   for( uint_t d = 0; d < 3; ++d )
+      cells[d] = static_cast<size_t>( span[d] * inverseCellSize ) + 1;
+   const size_t numberOfCells = cells[0] * cells[1] * cells[2];
+
+   // sort the bodies into the cells (counting sort)
+   bodyCell_.resize( numberOfBodies );
+   cellStart_.assign( numberOfCells + 1, 0 );
+   for( size_t i = 0; i < numberOfBodies; ++i )
+   {
+      size_t cell[3];
+      for( uint_t d = 0; d < 3; ++d )
+         cell[d] = std::min( cells[d] - 1, static_cast<size_t>( ( verletBoxes_[i].minCorner()[d] - minCorner[d] ) * inverseCellSize ) );
+      bodyCell_[i] = cell[0] + cells[0] * ( cell[1] + cells[1] * cell[2] );
+      ++cellStart_[ bodyCell_[i] + 1 ];
+   }
+   for( size_t c = 0; c < numberOfCells; ++c )
+      cellStart_[c + 1] += cellStart_[c];
+
+   cellBodies_.resize( numberOfBodies );
+   for( size_t i = 0; i < numberOfBodies; ++i )
+      cellBodies_[ cellStart_[ bodyCell_[i] ]++ ] = i;
+   for( size_t c = numberOfCells; c > 0; --c )
+      cellStart_[c] = cellStart_[c - 1];
+   cellStart_[0] = 0;
+
+   // check every body against the bodies with a larger index in its own and the adjacent cells
+   for( size_t i = 0; i < numberOfBodies; ++i )
+   {
+      const size_t x = bodyCell_[i] % cells[0];
+      const size_t y = ( bodyCell_[i] / cells[0] ) % cells[1];
+      const size_t z = bodyCell_[i] / ( cells[0] * cells[1] );
+
+      for( size_t nz = ( z > 0 ? z - 1 : z ); nz <= std::min( z + 1, cells[2] - 1 ); ++nz )
+      {
+         for( size_t ny = ( y > 0 ? y - 1 : y ); ny <= std::min( y + 1, cells[1] - 1 ); ++ny )
+         {
+            for( size_t nx = ( x > 0 ? x - 1 : x ); nx <= std::min( x + 1, cells[0] - 1 ); ++nx )
+            {
+               const size_t c = nx + cells[0] * ( ny + cells[1] * nz );
+               for( size_t k = cellStart_[c]; k < cellStart_[c + 1]; ++k )
+               {
+                  const size_t j = cellBodies_[k];
+                  if( j > i && verletBoxes_[i].intersects( verletBoxes_[j] ) )
+                  {
+                     if ( bodies_[i]->getSystemID() > bodies_[j]->getSystemID() )
+                        pairs_.push_back(std::make_pair(bodies_[j], bodies_[i]));
+                     else
+                        pairs_.push_back(std::make_pair(bodies_[i], bodies_[j]));
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+
+}  // namespace ccd
+}  // namespace pe
+}  // namespace walberla
@@ -0,0 +1,85 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file VerletListCCD.h
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "ICCD.h"
+
+#include "core/math/AABB.h"
+
+#include <vector>
+
+namespace walberla{
+namespace pe{
+namespace ccd {
+
+//*************************************************************************************************
+/*!\brief Coarse collision detection based on a Verlet (neighbor) list.
+ *
+ * At a rebuild, the AABBs of all local bodies and shadow copies are extended by half the skin
+ * distance in every direction, and all pairs of bodies whose extended AABBs overlap are stored in
+ * the Verlet list. The pairs are found with a uniform cell list whose cells are at least as large
+ * as the largest extended AABB.
+ *
+ * In every call of generatePossibleContacts(), only the pairs of the Verlet list are checked for
+ * overlapping AABBs. As long as the current AABB of every body lies within its extended AABB of the
+ * last rebuild (i.e., no body moved more than half the skin distance), the list contains all
+ * possible contacts. The list is rebuilt as soon as this is violated or bodies were added to or
+ * removed from the body storages (migration, shadow copies).
+ *
+ * Global bodies are checked against all bodies in every time step.
+ *
+ * The Verlet list pays off for dense, slowly evolving packings, where the list is reused for many
+ * time steps. The cell list assumes bodies of similar size, a few large bodies should be global.
+ */
+class VerletListCCD : public ICCD{
+public:
+   explicit VerletListCCD(BodyStorage& globalStorage, Storage& storage, real_t skin);
+   ~VerletListCCD();
+
+   virtual PossibleContacts& generatePossibleContacts( WcTimingTree* tt = NULL );
+
+   int getObservedBodyCount() const;
+
+   real_t getSkin()                const { return skin_; }
+   uint_t getNumberOfRebuilds()    const { return numberOfRebuilds_; }  //!< Number of rebuilds since construction.
+   size_t getNumberOfVerletPairs() const { return pairs_.size(); }      //!< Number of pairs in the current list.
+private:
+   bool isRebuildRequired() const;
+   void rebuild();
+
+   BodyStorage& globalStorage_;
+   Storage& storage_;
+
+   real_t skin_;                      //!< Skin distance the AABBs are extended by (half of it in each direction).
+   bool   rebuildRequired_;           //!< Set if bodies were added or removed since the last rebuild.
+   uint_t numberOfRebuilds_;
+
+   std::vector<BodyID> bodies_;       //!< All local bodies and shadow copies at the last rebuild.
+   std::vector<AABB>   verletBoxes_;  //!< The extended AABBs of \a bodies_ at the last rebuild.
+   PossibleContacts    pairs_;        //!< The Verlet list: all pairs of \a bodies_ with overlapping extended AABBs.
+
+   std::vector<size_t> bodyCell_;     //!< Cell of each body in \a bodies_ (rebuild only).
+   std::vector<size_t> cellStart_;    //!< Start of each cell in \a cellBodies_ (rebuild only).
+   std::vector<size_t> cellBodies_;   //!< Indices of \a bodies_, sorted by cell (rebuild only).
+};
+
+}  // namespace ccd
+}  // namespace pe
+}  // namespace walberla
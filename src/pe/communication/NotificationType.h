@@ -53,6 +53,7 @@ enum NotificationType {
    rigidBodyVelocityCorrectionNotification,
    rigidBodyNewShadowCopyNotification,
    rigidBodyRemovalInformationNotification,
+   rigidBodyDeltaUpdateNotification,
 };
 //*************************************************************************************************
 
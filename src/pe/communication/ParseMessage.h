@@ -25,6 +25,7 @@
 #include "pe/rigidbody/BodyStorage.h"
 #include "pe/communication/DynamicMarshalling.h"
 #include "pe/communication/RigidBodyCopyNotification.h"
+#include "pe/communication/RigidBodyDeltaUpdateNotification.h"
 #include "pe/communication/RigidBodyDeletionNotification.h"
 #include "pe/communication/RigidBodyForceNotification.h"
 #include "pe/communication/RigidBodyMigrationNotification.h"
@@ -104,6 +105,34 @@ void parseMessage(Owner sender, mpi::RecvBuffer& rb, const domain_decomposition:
 
             break;
          }
+         case rigidBodyDeltaUpdateNotification: {
+            typedef RigidBodyDeltaUpdateNotification N;
+            typename N::Parameters objparam;
+            unmarshal( rb, objparam );
+
+            WALBERLA_LOG_DETAIL( "Received rigid body delta update notification for body " << objparam.sid_ << " from neighboring process with rank " << sender << " (field states " << uint_c( objparam.fieldStates_ ) << ")" );
+
+            auto bodyIt = shadowStorage.find( objparam.sid_ );
+            WALBERLA_ASSERT_UNEQUAL( bodyIt, shadowStorage.end() );
+            BodyID b( bodyIt.getBodyID() );
+
+            WALBERLA_ASSERT( b->MPITrait.getOwner().blockID_ == sender.blockID_, "Update notifications must be sent by owner.\n" << b->MPITrait.getOwner().blockID_ << " != "<< sender.blockID_ );
+            WALBERLA_ASSERT( b->isRemote(), "Update notification must only concern shadow copies." );
+
+            // unchanged parts are still up to date from the previous update
+            if( objparam.hasChanged( N::POSITION ) )
+            {
+               correctBodyPosition(blockStorage.getDomain(), block.getAABB().center(), objparam.gpos_);
+               b->setPosition( objparam.gpos_ );
+            }
+            if( objparam.hasChanged( N::QUATERNION  ) ) b->setOrientation( objparam.q_ );
+            if( objparam.hasChanged( N::LINEAR_VEL  ) ) b->setLinearVel  ( objparam.v_ );
+            if( objparam.hasChanged( N::ANGULAR_VEL ) ) b->setAngularVel ( objparam.w_ );
+
+            WALBERLA_LOG_DETAIL( "Processed rigid body delta update notification.");
+
+            break;
+         }
          case rigidBodyMigrationNotification: {
             RigidBodyMigrationNotification::Parameters objparam;
             unmarshal( rb, objparam );
@@ -123,6 +152,7 @@ void parseMessage(Owner sender, mpi::RecvBuffer& rb, const domain_decomposition:
 
             b->MPITrait.setOwner( receiver );
             b->setRemote( false );
+            b->MPITrait.invalidateSynchronizationState(); // the shadow copies have not been updated by this process yet
 
             WALBERLA_ASSERT_EQUAL(b->MPITrait.sizeShadowOwners(), 0);
             b->MPITrait.clearShadowOwners();
@@ -0,0 +1,156 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file RigidBodyDeltaUpdateNotification.h
+//! \brief Header file for the RigidBodyDeltaUpdateNotification class
+//
+//======================================================================================================================
+
+#pragma once
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <pe/rigidbody/RigidBody.h>
+#include "NotificationType.h"
+#include "Marshalling.h"
+
+#include "core/DataTypes.h"
+
+
+namespace walberla {
+namespace pe {
+namespace communication {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Wrapper class for delta encoded rigid body updates.
+ *
+ * Same content as the RigidBodyUpdateNotification, but only the parts of the state (position,
+ * orientation, linear and angular velocity) that differ from the synchronization state of the body
+ * (the state sent to all shadow copies with the last update, see
+ * MPIRigidBodyTrait::setSynchronizationState) are transmitted. A leading byte stores for each part
+ * whether it is unchanged, zero, or transmitted. The encoding is lossless.
+ */
+class RigidBodyDeltaUpdateNotification {
+public:
+   enum Field      { POSITION = 0, QUATERNION = 1, LINEAR_VEL = 2, ANGULAR_VEL = 3 };
+   enum FieldState { UNCHANGED = 0, ZERO = 1, TRANSMITTED = 2 };
+
+   struct Parameters {
+      id_t    sid_;
+      uint8_t fieldStates_;
+      Vec3    gpos_, v_, w_;
+      Quat    q_;
+
+      FieldState fieldState( const Field field ) const { return static_cast< FieldState >( ( fieldStates_ >> ( 2 * field ) ) & 3 ); }
+      bool       hasChanged( const Field field ) const { return fieldState( field ) != UNCHANGED; }
+   };
+
+   inline explicit RigidBodyDeltaUpdateNotification( const RigidBody& b ) : body_(b) {}
+   const RigidBody& body_;
+
+   static FieldState fieldState( const bool known, const Vec3& value, const Vec3& synchronized )
+   {
+      if( known && isIdentical( value[0], synchronized[0] ) && isIdentical( value[1], synchronized[1] ) && isIdentical( value[2], synchronized[2] ) )
+         return UNCHANGED;
+      if( isIdentical( value[0], real_t(0) ) && isIdentical( value[1], real_t(0) ) && isIdentical( value[2], real_t(0) ) )
+         return ZERO;
+      return TRANSMITTED;
+   }
+
+   static FieldState fieldState( const bool known, const Quat& value, const Quat& synchronized )
+   {
+      if( known && isIdentical( value[0], synchronized[0] ) && isIdentical( value[1], synchronized[1] ) &&
+                   isIdentical( value[2], synchronized[2] ) && isIdentical( value[3], synchronized[3] ) )
+         return UNCHANGED;
+      return TRANSMITTED;
+   }
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Marshalling delta encoded rigid body updates.
+ *
+ * \param buffer The buffer to be filled.
+ * \param obj The object to be marshalled.
+ * \return void
+ */
+template< typename Buffer >
+inline void marshal( Buffer& buffer, const RigidBodyDeltaUpdateNotification& obj ) {
+   typedef RigidBodyDeltaUpdateNotification N;
+
+   const RigidBody& b   = obj.body_;
+   const bool     known = b.MPITrait.hasSynchronizationState();
+
+   const N::FieldState pos = N::fieldState( known, b.getPosition(),   b.MPITrait.getSynchronizedPosition()   );
+   const N::FieldState q   = N::fieldState( known, b.getQuaternion(), b.MPITrait.getSynchronizedQuaternion() );
+   const N::FieldState v   = N::fieldState( known, b.getLinearVel(),  b.MPITrait.getSynchronizedLinearVel()  );
+   const N::FieldState w   = N::fieldState( known, b.getAngularVel(), b.MPITrait.getSynchronizedAngularVel() );
+
+   buffer << b.getSystemID();
+   buffer << uint8_c( pos << ( 2 * N::POSITION ) | q << ( 2 * N::QUATERNION ) | v << ( 2 * N::LINEAR_VEL ) | w << ( 2 * N::ANGULAR_VEL ) );
+
+   if( pos == N::TRANSMITTED ) buffer << b.getPosition();
+   if( q   == N::TRANSMITTED ) buffer << b.getQuaternion();
+   if( v   == N::TRANSMITTED ) buffer << b.getLinearVel();
+   if( w   == N::TRANSMITTED ) buffer << b.getAngularVel();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Unmarshalling delta encoded rigid body updates.
+ *
+ * \param buffer The buffer from where to read.
+ * \param objparam The object to be reconstructed.
+ * \return void
+ *
+ * Parts with state ZERO are set to zero, parts with state UNCHANGED are left uninitialized.
+ */
+template< typename Buffer >
+inline void unmarshal( Buffer& buffer, typename RigidBodyDeltaUpdateNotification::Parameters& objparam ) {
+   typedef RigidBodyDeltaUpdateNotification N;
+
+   buffer >> objparam.sid_;
+   buffer >> objparam.fieldStates_;
+
+   if( objparam.fieldState( N::POSITION    ) == N::TRANSMITTED ) buffer >> objparam.gpos_; else objparam.gpos_ = Vec3( real_t(0) );
+   if( objparam.fieldState( N::QUATERNION  ) == N::TRANSMITTED ) buffer >> objparam.q_;
+   if( objparam.fieldState( N::LINEAR_VEL  ) == N::TRANSMITTED ) buffer >> objparam.v_;    else objparam.v_    = Vec3( real_t(0) );
+   if( objparam.fieldState( N::ANGULAR_VEL ) == N::TRANSMITTED ) buffer >> objparam.w_;    else objparam.w_    = Vec3( real_t(0) );
+}
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief Returns the notification type of a delta encoded rigid body update.
+ * \return The notification type of a delta encoded rigid body update.
+ */
+template<>
+inline NotificationType notificationType< RigidBodyDeltaUpdateNotification >() {
+   return rigidBodyDeltaUpdateNotification;
+}
+//*************************************************************************************************
+
+}  // namespace communication
+}  // namespace pe
+}  // namespace walberla
@@ -34,12 +34,22 @@
 
 #include "domain_decomposition/BlockStorage.h"
 
+#include <vector>
+
 namespace walberla {
 namespace pe {
 namespace cr {
 
 /**
  * \ingroup pe
+ *
+ * If OpenMP is enabled and more than one thread is available, the contacts of a block are resolved and the
+ * locally owned bodies are integrated by all threads. For the contact resolution, cache-sized chunks of contacts are
+ * partitioned into colors such that no two contacts of the same color act on the same (top level super) body. The
+ * colors are processed one after another, the contacts of one color in parallel. Contacts that do not fit into one of
+ * the 64 colors (e.g., contacts with a plane that touches many bodies) are resolved sequentially afterwards. Hence,
+ * the ContactResolver must only modify the two top level super bodies of a contact. setForceContactColoring( true )
+ * enables the coloring also for a single thread (e.g., to test it in builds without OpenMP).
  */
 template< typename Integrator, typename ContactResolver >
 class DEMSolver : public ICR
@@ -64,7 +74,12 @@ public:
    virtual inline real_t            getMaximumPenetration()        const WALBERLA_OVERRIDE { return maxPenetration_; }
    virtual inline size_t            getNumberOfContacts()          const WALBERLA_OVERRIDE { return numberOfContacts_; }
    virtual inline size_t            getNumberOfContactsTreated()   const WALBERLA_OVERRIDE { return numberOfContactsTreated_; }
+   inline bool                      getForceContactColoring()      const { return forceContactColoring_; }
+
+   inline void                      setForceContactColoring( const bool force ) { forceContactColoring_ = force; }
 private:
+   void resolveContacts( const real_t dt );
+
    Integrator                        integrate_;
    ContactResolver                   resolveContact_;
    shared_ptr<BodyStorage>           globalBodyStorage_;
@@ -77,6 +92,10 @@ private:
    real_t                            maxPenetration_;
    size_t                            numberOfContacts_;
    size_t                            numberOfContactsTreated_;
+   bool                              forceContactColoring_;
+
+   std::vector< ContactID >                contacts_; ///< contacts of the current block that are treated
+   std::vector< std::vector< ContactID > > colors_;   ///< conflict-free partition of contacts_ (+ remainder)
 };
 
 class DEM : public DEMSolver<IntegrateImplicitEuler, ResolveContactSpringDashpotHaffWerner>
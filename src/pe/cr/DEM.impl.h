@@ -35,8 +35,11 @@
 #include "pe/contact/ContactFunctions.h"
 #include "pe/synchronization/SyncForces.h"
 
+#include "core/OpenMP.h"
 #include "core/logging/all.h"
 
+#include <algorithm>
+
 namespace walberla {
 namespace pe {
 namespace cr {
@@ -60,6 +63,7 @@ DEMSolver<Integrator,ContactResolver>::DEMSolver(
    , maxPenetration_(0)
    , numberOfContacts_(0)
    , numberOfContactsTreated_(0)
+   , forceContactColoring_(false)
 {
 
 }
@@ -81,17 +85,22 @@ void DEMSolver<Integrator,ContactResolver>::timestep( real_t dt )
       Contacts& cont = fcd->generateContacts( ccd->getPossibleContacts() );
       if (tt_ != NULL) tt_->stop("FCD");
 
+      contacts_.clear();
       for (auto cIt = cont.begin(); cIt != cont.end(); ++cIt){
          const real_t overlap( -cIt->getDistance() );
          if( overlap > maxPenetration_ )
             maxPenetration_ = overlap;
          if (shouldContactBeTreated( &(*cIt), currentBlock.getAABB() ))
          {
-            ++numberOfContactsTreated_;
-            resolveContact_( &(*cIt), dt);
+            contacts_.push_back( &(*cIt) );
          }
       }
 
+      numberOfContactsTreated_ += contacts_.size();
+      if (tt_ != NULL) tt_->start("ContactResolution");
+      resolveContacts( dt );
+      if (tt_ != NULL) tt_->stop("ContactResolution");
+
       numberOfContacts_ += cont.size();
 
       cont.clear();
@@ -116,37 +125,115 @@ void DEMSolver<Integrator,ContactResolver>::timestep( real_t dt )
 
       if (tt_ != NULL) tt_->start("Integration");
 
-      for( auto bodyIt = localStorage.begin(); bodyIt != localStorage.end(); ++bodyIt )
+      const int numberOfBodies = int_c( localStorage.size() );
+#ifdef _OPENMP
+      #pragma omp parallel for schedule(static)
+#endif
+      for( int i = 0; i < numberOfBodies; ++i )
       {
-         WALBERLA_LOG_DETAIL( "Time integration of body with system id " << bodyIt->getSystemID());// << "\n" << *bodyIt );
+         BodyID body = localStorage.at( size_t(i) );
+
+         WALBERLA_LOG_DETAIL( "Time integration of body with system id " << body->getSystemID());// << "\n" << *body );
 
          // Checking the state of the body
-         WALBERLA_ASSERT( bodyIt->checkInvariants(), "Invalid body state detected" );
-         WALBERLA_ASSERT( !bodyIt->hasSuperBody(), "Invalid superordinate body detected" );
+         WALBERLA_ASSERT( body->checkInvariants(), "Invalid body state detected" );
+         WALBERLA_ASSERT( !body->hasSuperBody(), "Invalid superordinate body detected" );
          
          // Moving the body according to the acting forces (don't move a sleeping body)
-         if( bodyIt->isAwake() && !bodyIt->hasInfiniteMass() )
+         if( body->isAwake() && !body->hasInfiniteMass() )
          {
-            integrate_( bodyIt.getBodyID(), dt, *this );
+            integrate_( body, dt, *this );
          }
          
          // Resetting the acting forces
-         bodyIt->resetForceAndTorque();
+         body->resetForceAndTorque();
          
          // Checking the state of the rigid body
-         WALBERLA_ASSERT( bodyIt->checkInvariants(), "Invalid body state detected" );
+         WALBERLA_ASSERT( body->checkInvariants(), "Invalid body state detected" );
 
          // Resetting the acting forces
-         bodyIt->resetForceAndTorque();
+         body->resetForceAndTorque();
       }
 
       if (tt_ != NULL) tt_->stop("Integration");
 
       // Reset forces of shadow copies
-      for( auto& body : shadowStorage ) {
-         body.resetForceAndTorque();
+      const int numberOfShadowBodies = int_c( shadowStorage.size() );
+#ifdef _OPENMP
+      #pragma omp parallel for schedule(static)
+#endif
+      for( int i = 0; i < numberOfShadowBodies; ++i ) {
+         shadowStorage.at( size_t(i) )->resetForceAndTorque();
+      }
+
+   }
+}
+
+template< typename Integrator, typename ContactResolver >
+void DEMSolver<Integrator,ContactResolver>::resolveContacts( const real_t dt )
+{
+   if( ( omp_get_max_threads() == 1 && !forceContactColoring_ ) || contacts_.size() < 2 )
+   {
+      for( auto c = contacts_.begin(); c != contacts_.end(); ++c )
+         resolveContact_( *c, dt );
+      return;
+   }
+
+   // The contacts are processed in chunks that fit into the cache. Within each chunk, a greedy coloring assigns each
+   // contact the lowest color that is not yet used by one of its bodies. colors_.back() holds the contacts that have to
+   // be resolved sequentially.
+   const size_t chunkSize = 4096;
+   const size_t maxColors = 64;
+   colors_.resize( maxColors + 1 );
+
+   for( size_t chunkBegin = 0; chunkBegin < contacts_.size(); chunkBegin += chunkSize )
+   {
+      const auto first = contacts_.begin() + std::ptrdiff_t( chunkBegin );
+      const auto last  = contacts_.begin() + std::ptrdiff_t( std::min( chunkBegin + chunkSize, contacts_.size() ) );
+
+      for( auto color = colors_.begin(); color != colors_.end(); ++color )
+         color->clear();
+
+      for( auto c = first; c != last; ++c )
+      {
+         (*c)->getBody1()->getTopSuperBody()->contactColors_ = uint64_t(0);
+         (*c)->getBody2()->getTopSuperBody()->contactColors_ = uint64_t(0);
+      }
+
+      for( auto c = first; c != last; ++c )
+      {
+         uint64_t & colors1 = (*c)->getBody1()->getTopSuperBody()->contactColors_;
+         uint64_t & colors2 = (*c)->getBody2()->getTopSuperBody()->contactColors_;
+         const uint64_t used = colors1 | colors2;
+
+         size_t color = 0;
+         while( color < maxColors && ( used & ( uint64_t(1) << color ) ) != uint64_t(0) )
+            ++color;
+
+         if( color < maxColors )
+         {
+            colors1 |= uint64_t(1) << color;
+            colors2 |= uint64_t(1) << color;
+         }
+         colors_[color].push_back( *c );
+      }
+
+      for( size_t color = 0; color < maxColors; ++color )
+      {
+         std::vector< ContactID > & contacts = colors_[color];
+         const int numberOfContacts = int_c( contacts.size() );
+         if( numberOfContacts == 0 )
+            break;
+
+#ifdef _OPENMP
+         #pragma omp parallel for schedule(static)
+#endif
+         for( int i = 0; i < numberOfContacts; ++i )
+            resolveContact_( contacts[ size_t(i) ], dt );
       }
 
+      for( auto c = colors_.back().begin(); c != colors_.back().end(); ++c )
+         resolveContact_( *c, dt );
    }
 }
 
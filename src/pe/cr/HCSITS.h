@@ -94,6 +94,10 @@ private:
       std::vector<Mat2>   diag_to_inv_;
       std::vector<real_t> diag_n_inv_;
       std::vector<Vec3>   p_;
+
+      // contact coloring, see colorContacts()
+      std::vector<size_t> colorOrder_;  //!< The contact indices sorted by color.
+      std::vector<size_t> colorStart_;  //!< Start of each color in colorOrder_, the last color is relaxed sequentially.
    };
    std::map<IBlockID::IDType, ContactCache> blockToContactCache_;
 
@@ -108,6 +112,13 @@ public:
       InelasticGeneralizedMaximumDissipationContact
    };
    //**********************************************************************************************
+   //**Definition of iteration schemes ************************************************************
+   enum IterationScheme {
+      GaussSeidel,         //!< Sequential Gauss-Seidel sweep in contact order.
+      ColoredGaussSeidel,  //!< Gauss-Seidel sweep over colors of independent contacts, each color relaxed in parallel.
+      Jacobi               //!< All contacts relaxed in parallel against the velocities of the previous sweep.
+   };
+   //**********************************************************************************************
 public:
    //**Constructor*********************************************************************************
    /*!\name Constructor */
@@ -139,6 +150,8 @@ public:
    inline real_t                    getRelaxationParameter() const { return relaxationParam_; }
    inline real_t                    getErrorReductionParameter() const { return erp_; }
    inline RelaxationModel           getRelaxationModel() const { return relaxationModel_; }
+   inline IterationScheme           getIterationScheme() const { return iterationScheme_; }
+   inline real_t                    getJacobiWeight() const { return jacobiWeight_; }
    //@}
    //**********************************************************************************************
 
@@ -148,6 +161,8 @@ public:
    inline void            setRelaxationParameter( real_t f );
    inline void            setMaxIterations( size_t n );
    inline void            setRelaxationModel( RelaxationModel relaxationModel );
+   inline void            setIterationScheme( IterationScheme iterationScheme );
+   inline void            setJacobiWeight( real_t weight );
    inline void            setErrorReductionParameter( real_t erp );
    inline void            setAbortThreshold( real_t threshold );
    inline void            setSpeedLimiter( bool active, const real_t speedLimitFactor = real_t(0.0) );
@@ -191,6 +206,37 @@ private:
    real_t relaxInelasticGeneralizedMaximumDissipationContacts( real_t dtinv,
                                                                HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
                                                                HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache );
+   real_t relaxInelasticFrictionlessContact( size_t i,
+                                             real_t dtinv,
+                                             HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                             const HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache,
+                                             Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 );
+   real_t relaxApproximateInelasticCoulombContactByDecoupling( size_t i,
+                                                               real_t dtinv,
+                                                               HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                               const HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache,
+                                                               Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 );
+   real_t relaxInelasticCoulombContactByDecoupling( size_t i,
+                                                    real_t dtinv,
+                                                    HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                    const HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache,
+                                                    Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 );
+   real_t relaxInelasticCoulombContactByOrthogonalProjections( size_t i,
+                                                               real_t dtinv,
+                                                               bool approximate,
+                                                               HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                               const HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache,
+                                                               Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 );
+   real_t relaxInelasticGeneralizedMaximumDissipationContact( size_t i,
+                                                              real_t dtinv,
+                                                              HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                              const HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache,
+                                                              Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 );
+   template< typename RelaxContact >
+   real_t relaxContacts( HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                         HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache,
+                         const RelaxContact& relaxContact );
+   void colorContacts( HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache, size_t numBodies ) const;
    //@}
    //**********************************************************************************************
 
@@ -235,6 +281,8 @@ private:
    size_t maxSubIterations_;          //!< Maximum number of iterations of iterative solvers in the one-contact problem.
    real_t abortThreshold_;            //!< If L-infinity iterate difference drops below this threshold the iteration is aborted.
    RelaxationModel relaxationModel_;  //!< The method used to relax unilateral contacts
+   IterationScheme iterationScheme_;  //!< The order in which the contacts are relaxed.
+   real_t jacobiWeight_;              //!< Weight of the impulse updates in the Jacobi iteration scheme.
    real_t relaxationParam_;           //!< Parameter specifying underrelaxation of velocity corrections for boundary bodies.
    real_t maximumPenetration_;
    size_t numContacts_;
@@ -368,6 +416,46 @@ inline void HardContactSemiImplicitTimesteppingSolvers::setRelaxationModel( Rela
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Sets the order in which the iterative solver relaxes the contacts of a block.
+ *
+ * \param iterationScheme The iteration scheme to be used by the iterative solver.
+ * \return void
+ *
+ * GaussSeidel relaxes the contacts sequentially in the order of detection. ColoredGaussSeidel
+ * colors the contacts such that no two contacts of a color share a body with finite mass and
+ * relaxes the contacts of each color in parallel (OpenMP). The result does not depend on the
+ * number of threads, but differs from GaussSeidel due to the different contact order. Jacobi
+ * relaxes all contacts in parallel against the velocities of the previous sweep and applies the
+ * impulse changes weighted by the Jacobi weight afterwards. It typically needs more iterations than the
+ * Gauss-Seidel schemes.
+ */
+inline void HardContactSemiImplicitTimesteppingSolvers::setIterationScheme( IterationScheme iterationScheme )
+{
+   iterationScheme_ = iterationScheme;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the weight of the impulse updates in the Jacobi iteration scheme.
+ *
+ * \param weight The weight of the impulse updates (0 < weight <= 1).
+ * \return void
+ *
+ * Contacts sharing a body are relaxed independently in a Jacobi sweep and would overshoot if their
+ * impulse changes were applied in full. The weight must be smaller for bodies with many contacts.
+ */
+inline void HardContactSemiImplicitTimesteppingSolvers::setJacobiWeight( real_t weight )
+{
+   WALBERLA_ASSERT_GREATER( weight, 0, "Jacobi weight must be positive." );
+   WALBERLA_ASSERT_LESS_EQUAL( weight, 1, "Jacobi weight must not be larger than one." );
+
+   jacobiWeight_ = weight;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Sets the error reduction parameter.
  *
@@ -37,6 +37,7 @@
 #include "core/math/Utility.h"
 
 #include "core/ConcatIterator.h"
+#include "core/OpenMP.h"
 
 
 namespace walberla {
@@ -97,6 +98,8 @@ inline HardContactSemiImplicitTimesteppingSolvers::HardContactSemiImplicitTimest
    , maxSubIterations_ ( 20 )
    , abortThreshold_   ( real_c(1e-7) )
    , relaxationModel_  ( InelasticFrictionlessContact )
+   , iterationScheme_  ( GaussSeidel )
+   , jacobiWeight_     ( real_c(0.5) )
    , relaxationParam_  ( real_c(0.75) )
    , maximumPenetration_ ( real_c(0.0) )
    , numContacts_      ( 0 )
@@ -331,6 +334,13 @@ inline void HardContactSemiImplicitTimesteppingSolvers::timestep( const real_t d
       }
 
       if (tt_ != NULL) tt_->stop("Collision Response Body Caching");
+
+      if( iterationScheme_ == ColoredGaussSeidel )
+      {
+         if (tt_ != NULL) tt_->start("Collision Response Contact Coloring");
+         colorContacts( contactCache, numBodies );
+         if (tt_ != NULL) tt_->stop("Collision Response Contact Coloring");
+      }
    }
 
    if (blockStorage_->size() == 0)
@@ -514,256 +524,505 @@ inline void HardContactSemiImplicitTimesteppingSolvers::timestep( const real_t d
 
 
 //*************************************************************************************************
-/*!\brief Relaxes all contacts once. The contact model is for inelastic unilateral contacts without friction.
+/*!\brief Colors the contacts of a block for the ColoredGaussSeidel iteration scheme.
  *
- * \return The largest variation of contact impulses in the L-infinity norm.
+ * \param contactCache The contacts of the block.
+ * \param numBodies The number of bodies in the body cache of the block.
+ * \return void
  *
- * This function is to be called from resolveContacts(). Separating contacts are preferred over
- * persisting solutions if valid.
+ * Each contact gets the smallest color not yet used by another contact of one of its bodies
+ * (greedy coloring). Bodies with infinite mass are ignored since their velocity corrections do
+ * not change. The colors of a body are stored as a bit mask, hence at most 64 colors are
+ * distinguished. Contacts which do not fit are collected in an additional last color, which is
+ * relaxed sequentially. Within a color the contacts keep their original order.
  */
-inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxInelasticFrictionlessContacts( real_t dtinv,
-                                                                                              HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
-                                                                                              HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache )
+inline void HardContactSemiImplicitTimesteppingSolvers::colorContacts( HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                                       size_t numBodies ) const
 {
-   real_t delta_max( 0 );
-   size_t numContactsMasked( contactCache.p_.size() );
+   const size_t numContactsMasked( contactCache.p_.size() );
+   const size_t maxColors( 64 );
+
+   std::vector<uint64_t> bodyColors( numBodies, uint64_t(0) );  // bit c is set if the body has a contact of color c
+   std::vector<size_t>   contactColor( numContactsMasked );
+   contactCache.colorStart_.assign( maxColors + 2, 0 );
 
-   // Relax contacts
    for( size_t i = 0; i < numContactsMasked; ++i )
    {
-      // Remove velocity corrections of this contact's reaction.
-      bodyCache.dv_[contactCache.body1_[i]->index_] -= contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
-      bodyCache.dw_[contactCache.body1_[i]->index_] -= contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
-      bodyCache.dv_[contactCache.body2_[i]->index_] += contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
-      bodyCache.dw_[contactCache.body2_[i]->index_] += contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
+      const BodyID b1( contactCache.body1_[i] );
+      const BodyID b2( contactCache.body2_[i] );
+      const uint64_t used( ( b1->hasInfiniteMass() ? uint64_t(0) : bodyColors[b1->index_] ) |
+                           ( b2->hasInfiniteMass() ? uint64_t(0) : bodyColors[b2->index_] ) );
+
+      size_t color( 0 );
+      while( color < maxColors && ( used & ( uint64_t(1) << color ) ) != uint64_t(0) )
+         ++color;
 
-      // Calculate the relative contact VELOCITY in the global world frame (if no contact reaction is present at contact i)
-      Vec3 gdot    ( ( bodyCache.v_[contactCache.body1_[i]->index_] + bodyCache.dv_[contactCache.body1_[i]->index_] ) -
-            ( bodyCache.v_[contactCache.body2_[i]->index_] + bodyCache.dv_[contactCache.body2_[i]->index_] ) +
-            ( bodyCache.w_[contactCache.body1_[i]->index_] + bodyCache.dw_[contactCache.body1_[i]->index_] ) % contactCache.r1_[i] -
-            ( bodyCache.w_[contactCache.body2_[i]->index_] + bodyCache.dw_[contactCache.body2_[i]->index_] ) % contactCache.r2_[i] /* + diag_[i] * p */ );
+      if( color < maxColors )
+      {
+         if( !b1->hasInfiniteMass() ) bodyColors[b1->index_] |= uint64_t(1) << color;
+         if( !b2->hasInfiniteMass() ) bodyColors[b2->index_] |= uint64_t(1) << color;
+      }
 
-      // Change from the global world frame to the contact frame
-      Mat3 contactframe( contactCache.n_[i], contactCache.t_[i], contactCache.o_[i] );
-      Vec3 gdot_nto( contactframe.getTranspose() * gdot );
+      contactColor[i] = color;
+      ++contactCache.colorStart_[color + 1];
+   }
 
-      // The constraint in normal direction is actually a positional constraint but instead of g_n we use g_n/dt equivalently and call it gdot_n
-      gdot_nto[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
+   // sort the contacts by color (counting sort)
+   for( size_t color = 0; color <= maxColors; ++color )
+      contactCache.colorStart_[color + 1] += contactCache.colorStart_[color];
 
-      if( gdot_nto[0] >= 0 ) {
-         // Contact is separating if no contact reaction is present at contact i.
+   std::vector<size_t> next( contactCache.colorStart_.begin(), contactCache.colorStart_.end() - 1 );
+   contactCache.colorOrder_.resize( numContactsMasked );
+   for( size_t i = 0; i < numContactsMasked; ++i )
+      contactCache.colorOrder_[ next[contactColor[i]]++ ] = i;
+}
+//*************************************************************************************************
 
-         delta_max = std::max( delta_max, std::max( std::abs( contactCache.p_[i][0] ), std::max( std::abs( contactCache.p_[i][1] ), std::abs( contactCache.p_[i][2] ) ) ) );
-         contactCache.p_[i] = Vec3();
 
-         // No need to apply zero impulse.
+//*************************************************************************************************
+/*!\brief Relaxes all contacts of a block once in the order given by the iteration scheme.
+ *
+ * \param contactCache The contacts of the block.
+ * \param bodyCache The bodies of the block.
+ * \param relaxContact Relaxes contact i when called as relaxContact( i, dv1, dw1, dv2, dw2 ) with
+ *        the velocity corrections of its two bodies.
+ * \return The largest variation of contact impulses in the L-infinity norm.
+ *
+ * In the ColoredGaussSeidel scheme the contacts of a color do not share bodies with finite mass
+ * and are relaxed in parallel. The velocity corrections of bodies with infinite mass do not
+ * change, each contact works on a private copy of them. In the Jacobi scheme all contacts work on
+ * private copies of the velocity corrections and the weighted impulse changes are applied after
+ * the sweep. In all schemes the velocity corrections in the body cache are up to date at the end
+ * of the sweep, as required by synchronizeVelocities().
+ */
+template< typename RelaxContact >
+inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxContacts( HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                                         HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache,
+                                                                         const RelaxContact& relaxContact )
+{
+   const size_t numContactsMasked( contactCache.p_.size() );
+
+   if( iterationScheme_ == GaussSeidel )
+   {
+      real_t delta_max( 0 );
+      for( size_t i = 0; i < numContactsMasked; ++i )
+      {
+         const size_t j1( contactCache.body1_[i]->index_ );
+         const size_t j2( contactCache.body2_[i]->index_ );
+         delta_max = std::max( delta_max, relaxContact( i, bodyCache.dv_[j1], bodyCache.dw_[j1], bodyCache.dv_[j2], bodyCache.dw_[j2] ) );
       }
-      else {
-         // Contact is persisting.
+      return delta_max;
+   }
 
-         // Calculate the impulse necessary for a static contact expressed as components in the contact frame.
-         Vec3 p_wf( contactCache.n_[i] * ( -contactCache.diag_n_inv_[i] * gdot_nto[0] ) );
-         Vec3 dp( contactCache.p_[i] - p_wf );
-         delta_max = std::max( delta_max, std::max( std::abs( dp[0] ), std::max( std::abs( dp[1] ), std::abs( dp[2] ) ) ) );
+   std::vector<real_t> threadDeltaMax( size_t( omp_get_max_threads() ), real_t(0) );
 
-         contactCache.p_[i] = p_wf;
+   if( iterationScheme_ == ColoredGaussSeidel )
+   {
+      WALBERLA_ASSERT_EQUAL( contactCache.colorOrder_.size(), numContactsMasked, "Contacts are not colored." );
+
+      for( size_t color = 0; color + 1 < contactCache.colorStart_.size(); ++color )
+      {
+         const int  begin( int_c( contactCache.colorStart_[color] ) );
+         const int  end  ( int_c( contactCache.colorStart_[color + 1] ) );
+         const bool independent( color + 2 < contactCache.colorStart_.size() );  // the last color holds the uncolored contacts
 
-         // Apply impulse right away.
-         bodyCache.dv_[contactCache.body1_[i]->index_] += contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
-         bodyCache.dw_[contactCache.body1_[i]->index_] += contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
-         bodyCache.dv_[contactCache.body2_[i]->index_] -= contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
-         bodyCache.dw_[contactCache.body2_[i]->index_] -= contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
+         if( begin == end )
+            continue;
+
+#ifdef _OPENMP
+         #pragma omp parallel for schedule(static) if( independent )
+#else
+         WALBERLA_UNUSED( independent );
+#endif
+         for( int k = begin; k < end; ++k )
+         {
+            const size_t i( contactCache.colorOrder_[ size_t(k) ] );
+            const BodyID b1( contactCache.body1_[i] );
+            const BodyID b2( contactCache.body2_[i] );
+
+            Vec3 fixed[4];  // private copies of the velocity corrections of bodies with infinite mass
+            Vec3& dv1 = b1->hasInfiniteMass() ? ( fixed[0] = bodyCache.dv_[b1->index_] ) : bodyCache.dv_[b1->index_];
+            Vec3& dw1 = b1->hasInfiniteMass() ? ( fixed[1] = bodyCache.dw_[b1->index_] ) : bodyCache.dw_[b1->index_];
+            Vec3& dv2 = b2->hasInfiniteMass() ? ( fixed[2] = bodyCache.dv_[b2->index_] ) : bodyCache.dv_[b2->index_];
+            Vec3& dw2 = b2->hasInfiniteMass() ? ( fixed[3] = bodyCache.dw_[b2->index_] ) : bodyCache.dw_[b2->index_];
+
+#ifdef _OPENMP
+            const size_t thread = size_t( omp_get_thread_num() );
+#else
+            const size_t thread = 0;
+#endif
+            threadDeltaMax[thread] = std::max( threadDeltaMax[thread], relaxContact( i, dv1, dw1, dv2, dw2 ) );
+         }
       }
    }
+   else
+   {
+      WALBERLA_ASSERT_EQUAL( iterationScheme_, Jacobi );
+
+      const std::vector<Vec3> p0( contactCache.p_ );
+      const int numContacts( int_c( numContactsMasked ) );
+
+#ifdef _OPENMP
+      #pragma omp parallel for schedule(static)
+#endif
+      for( int k = 0; k < numContacts; ++k )
+      {
+         const size_t i = size_t(k);
+         const size_t j1( contactCache.body1_[i]->index_ );
+         const size_t j2( contactCache.body2_[i]->index_ );
+
+         // relax against the velocity corrections of the previous sweep
+         Vec3 dv1( bodyCache.dv_[j1] ), dw1( bodyCache.dw_[j1] ), dv2( bodyCache.dv_[j2] ), dw2( bodyCache.dw_[j2] );
 
+#ifdef _OPENMP
+         const size_t thread = size_t( omp_get_thread_num() );
+#else
+         const size_t thread = 0;
+#endif
+         threadDeltaMax[thread] = std::max( threadDeltaMax[thread], relaxContact( i, dv1, dw1, dv2, dw2 ) );
+
+         contactCache.p_[i] = p0[i] + jacobiWeight_ * ( contactCache.p_[i] - p0[i] );
+      }
+
+      // Apply the impulse changes.
+      for( size_t i = 0; i < numContactsMasked; ++i )
+      {
+         const BodyID b1( contactCache.body1_[i] );
+         const BodyID b2( contactCache.body2_[i] );
+         const Vec3 dp( contactCache.p_[i] - p0[i] );
+
+         bodyCache.dv_[b1->index_] += b1->getInvMass() * dp;
+         bodyCache.dw_[b1->index_] += b1->getInvInertia() * ( contactCache.r1_[i] % dp );
+         bodyCache.dv_[b2->index_] -= b2->getInvMass() * dp;
+         bodyCache.dw_[b2->index_] -= b2->getInvInertia() * ( contactCache.r2_[i] % dp );
+      }
+   }
+
+   real_t delta_max( 0 );
+   for( auto it = threadDeltaMax.begin(); it != threadDeltaMax.end(); ++it )
+      delta_max = std::max( delta_max, *it );
    return delta_max;
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Relaxes all contacts once. The contact model is for inelastic unilateral contacts with approximate Coulomb friction.
+/*!\brief Relaxes all contacts of a block with relaxInelasticFrictionlessContact().
  *
+ * \param dtinv The inverse of the current time step.
+ * \param contactCache The contacts of the block.
+ * \param bodyCache The bodies of the block.
  * \return The largest variation of contact impulses in the L-infinity norm.
  *
- * This function is to be called from resolveContacts(). Separating contacts are preferred over
- * other solutions if valid. Static solutions are preferred over dynamic solutions. Dynamic
- * solutions are computed by decoupling the normal from the frictional components. That is
- * for a dynamic contact the normal component is relaxed first followed by the frictional
- * components. The determination of the frictional components does not perform any subiterations
- * and guarantees that the friction partially opposes slip.
+ * The order of the contact updates is determined by the iteration scheme, see relaxContacts().
  */
-inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxApproximateInelasticCoulombContactsByDecoupling( real_t dtinv,
-                                                                                                                HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
-                                                                                                                HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache )
+inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxInelasticFrictionlessContacts( real_t dtinv,
+                                                                                              HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                                                              HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache )
 {
-   real_t delta_max( 0 );
-   size_t numContactsMasked( contactCache.p_.size() );
+   return relaxContacts( contactCache, bodyCache, [&]( size_t i, Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 ) {
+      return relaxInelasticFrictionlessContact( i, dtinv, contactCache, bodyCache, dv1, dw1, dv2, dw2 );
+   } );
+}
+//*************************************************************************************************
 
-   // Relax contacts
-   for( size_t i = 0; i < numContactsMasked; ++i ) {
-      // Remove velocity corrections of this contact's reaction.
-      bodyCache.dv_[contactCache.body1_[i]->index_] -= contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
-      bodyCache.dw_[contactCache.body1_[i]->index_] -= contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
-      bodyCache.dv_[contactCache.body2_[i]->index_] += contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
-      bodyCache.dw_[contactCache.body2_[i]->index_] += contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
 
-      // Calculate the relative contact velocity in the global world frame (if no contact reaction is present at contact i)
-      Vec3 gdot    ( ( bodyCache.v_[contactCache.body1_[i]->index_] + bodyCache.dv_[contactCache.body1_[i]->index_] ) - ( bodyCache.v_[contactCache.body2_[i]->index_] + bodyCache.dv_[contactCache.body2_[i]->index_] ) + ( bodyCache.w_[contactCache.body1_[i]->index_] + bodyCache.dw_[contactCache.body1_[i]->index_] ) % contactCache.r1_[i] - ( bodyCache.w_[contactCache.body2_[i]->index_] + bodyCache.dw_[contactCache.body2_[i]->index_] ) % contactCache.r2_[i] /* + diag_[i] * p */ );
+//*************************************************************************************************
+/*!\brief Relaxes contact i once. The contact model is for inelastic unilateral contacts without friction.
+ *
+ * \return The variation of the impulse of contact i in the L-infinity norm.
+ *
+ * The velocity corrections of the two bodies are passed in \a dv1, \a dw1, \a dv2 and \a dw2 and
+ * are updated in place.
+ *
+ * This function is to be called from relaxContacts(). Separating contacts are preferred over
+ * persisting solutions if valid.
+ */
+inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxInelasticFrictionlessContact( size_t i,
+                                                                                             real_t dtinv,
+                                                                                             HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                                                             const HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache,
+                                                                                             Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 )
+{
+   real_t delta_max( 0 );
 
-      // Change from the global world frame to the contact frame
-      Mat3 contactframe( contactCache.n_[i], contactCache.t_[i], contactCache.o_[i] );
-      Vec3 gdot_nto( contactframe.getTranspose() * gdot );
+   // Remove velocity corrections of this contact's reaction.
+   dv1 -= contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
+   dw1 -= contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
+   dv2 += contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
+   dw2 += contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
 
-      //real_t gdot_n  ( trans( contactCache.n_[i] ) * gdot );  // The component of gdot along the contact normal n
-      //Vec3 gdot_t  ( gdot - gdot_n * contactCache.n_[i] );  // The components of gdot tangential to the contact normal n
-      //real_t g_n     ( gdot_n * dt /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] );  // The gap in normal direction
+   // Calculate the relative contact VELOCITY in the global world frame (if no contact reaction is present at contact i)
+   Vec3 gdot    ( ( bodyCache.v_[contactCache.body1_[i]->index_] + dv1 ) -
+         ( bodyCache.v_[contactCache.body2_[i]->index_] + dv2 ) +
+         ( bodyCache.w_[contactCache.body1_[i]->index_] + dw1 ) % contactCache.r1_[i] -
+         ( bodyCache.w_[contactCache.body2_[i]->index_] + dw2 ) % contactCache.r2_[i] /* + diag_[i] * p */ );
 
-      // The constraint in normal direction is actually a positional constraint but instead of g_n we use g_n/dt equivalently and call it gdot_n
-      gdot_nto[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
+   // Change from the global world frame to the contact frame
+   Mat3 contactframe( contactCache.n_[i], contactCache.t_[i], contactCache.o_[i] );
+   Vec3 gdot_nto( contactframe.getTranspose() * gdot );
 
-      if( gdot_nto[0] >= 0 ) {
-         // Contact is separating if no contact reaction is present at contact i.
+   // The constraint in normal direction is actually a positional constraint but instead of g_n we use g_n/dt equivalently and call it gdot_n
+   gdot_nto[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
 
-         delta_max = std::max( delta_max, std::max( std::abs( contactCache.p_[i][0] ), std::max( std::abs( contactCache.p_[i][1] ), std::abs( contactCache.p_[i][2] ) ) ) );
-         contactCache.p_[i] = Vec3();
+   if( gdot_nto[0] >= 0 ) {
+      // Contact is separating if no contact reaction is present at contact i.
 
-         // No need to apply zero impulse.
-      }
-      else {
-         // Contact is persisting (either static or dynamic).
+      delta_max = std::max( delta_max, std::max( std::abs( contactCache.p_[i][0] ), std::max( std::abs( contactCache.p_[i][1] ), std::abs( contactCache.p_[i][2] ) ) ) );
+      contactCache.p_[i] = Vec3();
 
-         // Calculate the impulse necessary for a static contact expressed as components in the contact frame.
-         Vec3 p_cf( -( contactCache.diag_nto_inv_[i] * gdot_nto ) );
+      // No need to apply zero impulse.
+   }
+   else {
+      // Contact is persisting.
 
-         // Can p_cf[0] be negative even though -gdot_nto[0] > 0? Yes! Try:
-         // A = [0.5 -0.1 +0.1; -0.1 0.5 -0.1; +0.1 -0.1 1];
-         // b = [0.01 -1 -1]';
-         // A\b    \approx [-0.19 -2.28 -1.21]'
-         // eig(A) \approx [ 0.40  0.56  1.04]'
+      // Calculate the impulse necessary for a static contact expressed as components in the contact frame.
+      Vec3 p_wf( contactCache.n_[i] * ( -contactCache.diag_n_inv_[i] * gdot_nto[0] ) );
+      Vec3 dp( contactCache.p_[i] - p_wf );
+      delta_max = std::max( delta_max, std::max( std::abs( dp[0] ), std::max( std::abs( dp[1] ), std::abs( dp[2] ) ) ) );
 
-         real_t flimit( contactCache.mu_[i] * p_cf[0] );
-         real_t fsq( p_cf[1] * p_cf[1] + p_cf[2] * p_cf[2] );
-         if( fsq > flimit * flimit || p_cf[0] < 0 ) {
-            // Contact cannot be static so it must be dynamic.
-            // => Complementarity condition on normal reaction now turns into an equation since we know that the normal reaction is definitely not zero.
+      contactCache.p_[i] = p_wf;
 
-            // For simplicity we change to a simpler relaxation scheme here:
-            // 1. Relax normal reaction with the tangential components equal to the previous values
-            // 2. Relax tangential components with the newly relaxed normal reaction
-            // Note: The better approach would be to solve the true 3x3 block problem!
-            // Warning: Simply projecting the frictional components is wrong since then the normal action is no longer 0 and simulations break.
+      // Apply impulse right away.
+      dv1 += contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
+      dw1 += contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
+      dv2 -= contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
+      dw2 -= contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
+   }
 
-            // Add the action of the frictional reactions from the last iteration to the relative contact velocity in normal direction so we can relax it separately.
-            // TODO This can be simplified:
-            //p_cf = trans( contactframe ) * contactCache.p_[i];
-            //p_cf[0] = 0;
-            //p_[i] = contactframe * p_cf;
-            Vec3 p_tmp = ( contactCache.t_[i] * contactCache.p_[i] ) * contactCache.t_[i] + ( contactCache.o_[i] * contactCache.p_[i] ) * contactCache.o_[i];
+   return delta_max;
+}
+//*************************************************************************************************
 
-            //      |<-- This should vanish below since p_cf[0] = 0          -->|
-            //gdot += ( contactCache.body1_[i]->getInvMass() + contactCache.body2_[i]->getInvMass() ) * p_tmp + ( contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % p_tmp] ) ) % contactCache.r1_[i] + ( contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % p_tmp ) ) % contactCache.r2_[i] /* + diag_[i] * p */;
-            //real_t gdot_n = trans( contactCache.n_[i] ) * gdot;
-            //gdot_n += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
 
-            real_t gdot_n = gdot_nto[0] + contactCache.n_[i] * ( ( contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % p_tmp ) ) % contactCache.r1_[i] + ( contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % p_tmp ) ) % contactCache.r2_[i] /* + diag_[i] * p */ );
-            p_cf[0] = -( contactCache.diag_n_inv_[i] * gdot_n );
+//*************************************************************************************************
+/*!\brief Relaxes all contacts of a block with relaxApproximateInelasticCoulombContactByDecoupling().
+ *
+ * \param dtinv The inverse of the current time step.
+ * \param contactCache The contacts of the block.
+ * \param bodyCache The bodies of the block.
+ * \return The largest variation of contact impulses in the L-infinity norm.
+ *
+ * The order of the contact updates is determined by the iteration scheme, see relaxContacts().
+ */
+inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxApproximateInelasticCoulombContactsByDecoupling( real_t dtinv,
+                                                                                                                HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                                                                                HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache )
+{
+   return relaxContacts( contactCache, bodyCache, [&]( size_t i, Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 ) {
+      return relaxApproximateInelasticCoulombContactByDecoupling( i, dtinv, contactCache, bodyCache, dv1, dw1, dv2, dw2 );
+   } );
+}
+//*************************************************************************************************
 
-            // We cannot be sure that gdot_n <= 0 here and thus p_cf[0] >= 0 since we just modified it with the old values of the tangential reactions! => Project
-            p_cf[0] = std::max( real_c( 0 ), p_cf[0] );
 
-            // Now add the action of the normal reaction to the relative contact velocity in the tangential directions so we can relax the frictional components separately.
-            p_tmp = contactCache.n_[i] * p_cf[0];
-            Vec3 gdot2 = gdot + ( contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % p_tmp ) ) % contactCache.r1_[i] + ( contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % p_tmp ) ) % contactCache.r2_[i];
-            Vec2 gdot_to;
-            gdot_to[0] = contactCache.t_[i] * gdot2;
-            gdot_to[1] = contactCache.o_[i] * gdot2;
+//*************************************************************************************************
+/*!\brief Relaxes contact i once. The contact model is for inelastic unilateral contacts with approximate Coulomb friction.
+ *
+ * \return The variation of the impulse of contact i in the L-infinity norm.
+ *
+ * The velocity corrections of the two bodies are passed in \a dv1, \a dw1, \a dv2 and \a dw2 and
+ * are updated in place.
+ *
+ * This function is to be called from relaxContacts(). Separating contacts are preferred over
+ * other solutions if valid. Static solutions are preferred over dynamic solutions. Dynamic
+ * solutions are computed by decoupling the normal from the frictional components. That is
+ * for a dynamic contact the normal component is relaxed first followed by the frictional
+ * components. The determination of the frictional components does not perform any subiterations
+ * and guarantees that the friction partially opposes slip.
+ */
+inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxApproximateInelasticCoulombContactByDecoupling( size_t i,
+                                                                                                               real_t dtinv,
+                                                                                                               HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                                                                               const HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache,
+                                                                                                               Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 )
+{
+   real_t delta_max( 0 );
+
+   // Remove velocity corrections of this contact's reaction.
+   dv1 -= contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
+   dw1 -= contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
+   dv2 += contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
+   dw2 += contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
 
-            Vec2 ret = -( contactCache.diag_to_inv_[i] * gdot_to );
-            p_cf[1] = ret[0];
-            p_cf[2] = ret[1];
+   // Calculate the relative contact velocity in the global world frame (if no contact reaction is present at contact i)
+   Vec3 gdot    ( ( bodyCache.v_[contactCache.body1_[i]->index_] + dv1 ) - ( bodyCache.v_[contactCache.body2_[i]->index_] + dv2 ) + ( bodyCache.w_[contactCache.body1_[i]->index_] + dw1 ) % contactCache.r1_[i] - ( bodyCache.w_[contactCache.body2_[i]->index_] + dw2 ) % contactCache.r2_[i] /* + diag_[i] * p */ );
 
-            flimit = contactCache.mu_[i] * p_cf[0];
-            fsq = p_cf[1] * p_cf[1] + p_cf[2] * p_cf[2];
-            if( fsq > flimit * flimit ) {
-               const real_t f( flimit / std::sqrt( fsq ) );
-               p_cf[1] *= f;
-               p_cf[2] *= f;
-            }
-         }
-         else {
-            // Contact is static.
-         }
-         Vec3 p_wf( contactframe * p_cf );
-         Vec3 dp( contactCache.p_[i] - p_wf );
-         delta_max = std::max( delta_max, std::max( std::abs( dp[0] ), std::max( std::abs( dp[1] ), std::abs( dp[2] ) ) ) );
+   // Change from the global world frame to the contact frame
+   Mat3 contactframe( contactCache.n_[i], contactCache.t_[i], contactCache.o_[i] );
+   Vec3 gdot_nto( contactframe.getTranspose() * gdot );
 
-         contactCache.p_[i] = p_wf;
+   //real_t gdot_n  ( trans( contactCache.n_[i] ) * gdot );  // The component of gdot along the contact normal n
+   //Vec3 gdot_t  ( gdot - gdot_n * contactCache.n_[i] );  // The components of gdot tangential to the contact normal n
+   //real_t g_n     ( gdot_n * dt /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] );  // The gap in normal direction
 
-         // Apply impulse right away
-         bodyCache.dv_[contactCache.body1_[i]->index_] += contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
-         bodyCache.dw_[contactCache.body1_[i]->index_] += contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
-         bodyCache.dv_[contactCache.body2_[i]->index_] -= contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
-         bodyCache.dw_[contactCache.body2_[i]->index_] -= contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
-      }
+   // The constraint in normal direction is actually a positional constraint but instead of g_n we use g_n/dt equivalently and call it gdot_n
+   gdot_nto[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
 
-#if 0
-      Vec3 gdot2   ( ( bodyCache.v_[contactCache.body1_[i]->index_] + bodyCache.dv_[contactCache.body1_[i]->index_] ) -
-            ( bodyCache.v_[contactCache.body2_[i]->index_] + bodyCache.dv_[contactCache.body2_[i]->index_] ) +
-            ( bodyCache.w_[contactCache.body1_[i]->index_] + bodyCache.dw_[contactCache.body1_[i]->index_] ) % contactCache.r1_[i] -
-            ( bodyCache.w_[contactCache.body2_[i]->index_] + bodyCache.dw_contactCache.[contactCache.body2_[i]->index_] ) % contactCache.r2_[i] /* + diag_[i] * p */ );
-      Vec3 gdot_nto2( contactframe.getTranspose() * gdot2 );
-      WALBERLA_LOG_DETAIL( "gdot_n2 = " << gdot_nto2[0] );
-      WALBERLA_LOG_DETAIL( "gdot_t2 = " << gdot_nto2[1] );
-      WALBERLA_LOG_DETAIL( "gdot_o2 = " << gdot_nto2[2] );
-      gdot_nto2[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
-      WALBERLA_LOG_DETAIL( "gdot_n2' = " << gdot_nto2[0] );
-#endif
+   if( gdot_nto[0] >= 0 ) {
+      // Contact is separating if no contact reaction is present at contact i.
 
-      /*
-       * compare DEM time-step with NSCD iteration:
-       * - projections are the same
-       * - velocities are the same if we use an explicit Euler discretization for the velocity time integration
-       *
-      f_cf[0] = -stiffness * contactCache.dist_ - damping_n * gdot_n = -[(stiffness * dt) * contactCache.dist_ * dtinv + damping_n * gdot_n] = -foo * (gdot_n + contactCache.dist_ * dtinv) where foo = stiffness * dt = damping_n;
-      f_cf[1] = -damping_t * gdot_t                     = -damping_t * gdot_t;
-      f_cf[2] = -damping_t * gdot_o                     = -damping_t * gdot_o;
+      delta_max = std::max( delta_max, std::max( std::abs( contactCache.p_[i][0] ), std::max( std::abs( contactCache.p_[i][1] ), std::abs( contactCache.p_[i][2] ) ) ) );
+      contactCache.p_[i] = Vec3();
 
-      or: f_cf = -diag(foo, damping_t, damping_t) * gdot_nto   (since gdot_nto[0] is modified)
-      vs. f_cf = -diaginv * gdot_nto in NSCD iteration
+      // No need to apply zero impulse.
+   }
+   else {
+      // Contact is persisting (either static or dynamic).
 
-      => The NSCD iteration is more or less a DEM time step where we choose the stiffness and damping parameters such that penetration is non-existent after a time step and contacts are truly static (tangential rel. vel. is zero) unless the friction force hits its limit
+      // Calculate the impulse necessary for a static contact expressed as components in the contact frame.
+      Vec3 p_cf( -( contactCache.diag_nto_inv_[i] * gdot_nto ) );
 
-      f_cf[0] = std::max( 0, f_cf[0] );
+      // Can p_cf[0] be negative even though -gdot_nto[0] > 0? Yes! Try:
+      // A = [0.5 -0.1 +0.1; -0.1 0.5 -0.1; +0.1 -0.1 1];
+      // b = [0.01 -1 -1]';
+      // A\b    \approx [-0.19 -2.28 -1.21]'
+      // eig(A) \approx [ 0.40  0.56  1.04]'
 
-      flimit = contactCache.mu_ * f_cf[0];
-      fsq = f_cf[1] * f_cf[1] + f_cf[2] * f_cf[2]
-      if( fsq > flimit * flimit ) {
-         f = flimit / sqrt( fsq );
-         f_cf[1] *= f;
-         f_cf[2] *= f;
+      real_t flimit( contactCache.mu_[i] * p_cf[0] );
+      real_t fsq( p_cf[1] * p_cf[1] + p_cf[2] * p_cf[2] );
+      if( fsq > flimit * flimit || p_cf[0] < 0 ) {
+         // Contact cannot be static so it must be dynamic.
+         // => Complementarity condition on normal reaction now turns into an equation since we know that the normal reaction is definitely not zero.
+
+         // For simplicity we change to a simpler relaxation scheme here:
+         // 1. Relax normal reaction with the tangential components equal to the previous values
+         // 2. Relax tangential components with the newly relaxed normal reaction
+         // Note: The better approach would be to solve the true 3x3 block problem!
+         // Warning: Simply projecting the frictional components is wrong since then the normal action is no longer 0 and simulations break.
+
+         // Add the action of the frictional reactions from the last iteration to the relative contact velocity in normal direction so we can relax it separately.
+         // TODO This can be simplified:
+         //p_cf = trans( contactframe ) * contactCache.p_[i];
+         //p_cf[0] = 0;
+         //p_[i] = contactframe * p_cf;
+         Vec3 p_tmp = ( contactCache.t_[i] * contactCache.p_[i] ) * contactCache.t_[i] + ( contactCache.o_[i] * contactCache.p_[i] ) * contactCache.o_[i];
+
+         //      |<-- This should vanish below since p_cf[0] = 0          -->|
+         //gdot += ( contactCache.body1_[i]->getInvMass() + contactCache.body2_[i]->getInvMass() ) * p_tmp + ( contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % p_tmp] ) ) % contactCache.r1_[i] + ( contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % p_tmp ) ) % contactCache.r2_[i] /* + diag_[i] * p */;
+         //real_t gdot_n = trans( contactCache.n_[i] ) * gdot;
+         //gdot_n += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
+
+         real_t gdot_n = gdot_nto[0] + contactCache.n_[i] * ( ( contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % p_tmp ) ) % contactCache.r1_[i] + ( contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % p_tmp ) ) % contactCache.r2_[i] /* + diag_[i] * p */ );
+         p_cf[0] = -( contactCache.diag_n_inv_[i] * gdot_n );
+
+         // We cannot be sure that gdot_n <= 0 here and thus p_cf[0] >= 0 since we just modified it with the old values of the tangential reactions! => Project
+         p_cf[0] = std::max( real_c( 0 ), p_cf[0] );
+
+         // Now add the action of the normal reaction to the relative contact velocity in the tangential directions so we can relax the frictional components separately.
+         p_tmp = contactCache.n_[i] * p_cf[0];
+         Vec3 gdot2 = gdot + ( contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % p_tmp ) ) % contactCache.r1_[i] + ( contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % p_tmp ) ) % contactCache.r2_[i];
+         Vec2 gdot_to;
+         gdot_to[0] = contactCache.t_[i] * gdot2;
+         gdot_to[1] = contactCache.o_[i] * gdot2;
+
+         Vec2 ret = -( contactCache.diag_to_inv_[i] * gdot_to );
+         p_cf[1] = ret[0];
+         p_cf[2] = ret[1];
+
+         flimit = contactCache.mu_[i] * p_cf[0];
+         fsq = p_cf[1] * p_cf[1] + p_cf[2] * p_cf[2];
+         if( fsq > flimit * flimit ) {
+            const real_t f( flimit / std::sqrt( fsq ) );
+            p_cf[1] *= f;
+            p_cf[2] *= f;
+         }
       }
+      else {
+         // Contact is static.
+      }
+      Vec3 p_wf( contactframe * p_cf );
+      Vec3 dp( contactCache.p_[i] - p_wf );
+      delta_max = std::max( delta_max, std::max( std::abs( dp[0] ), std::max( std::abs( dp[1] ), std::abs( dp[2] ) ) ) );
 
-      f_wf = contactframe * f_cf;
+      contactCache.p_[i] = p_wf;
 
-      b1->addForceAtPos(  f_wf, gpos );
-      b2->addForceAtPos( -f_wf, gpos );
-      */
+      // Apply impulse right away
+      dv1 += contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
+      dw1 += contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
+      dv2 -= contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
+      dw2 -= contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
+   }
 
+#if 0
+   Vec3 gdot2   ( ( bodyCache.v_[contactCache.body1_[i]->index_] + dv1 ) -
+         ( bodyCache.v_[contactCache.body2_[i]->index_] + dv2 ) +
+         ( bodyCache.w_[contactCache.body1_[i]->index_] + dw1 ) % contactCache.r1_[i] -
+         ( bodyCache.w_[contactCache.body2_[i]->index_] + bodyCache.dw_contactCache.[contactCache.body2_[i]->index_] ) % contactCache.r2_[i] /* + diag_[i] * p */ );
+   Vec3 gdot_nto2( contactframe.getTranspose() * gdot2 );
+   WALBERLA_LOG_DETAIL( "gdot_n2 = " << gdot_nto2[0] );
+   WALBERLA_LOG_DETAIL( "gdot_t2 = " << gdot_nto2[1] );
+   WALBERLA_LOG_DETAIL( "gdot_o2 = " << gdot_nto2[2] );
+   gdot_nto2[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
+   WALBERLA_LOG_DETAIL( "gdot_n2' = " << gdot_nto2[0] );
+#endif
+
+   /*
+    * compare DEM time-step with NSCD iteration:
+    * - projections are the same
+    * - velocities are the same if we use an explicit Euler discretization for the velocity time integration
+    *
+   f_cf[0] = -stiffness * contactCache.dist_ - damping_n * gdot_n = -[(stiffness * dt) * contactCache.dist_ * dtinv + damping_n * gdot_n] = -foo * (gdot_n + contactCache.dist_ * dtinv) where foo = stiffness * dt = damping_n;
+   f_cf[1] = -damping_t * gdot_t                     = -damping_t * gdot_t;
+   f_cf[2] = -damping_t * gdot_o                     = -damping_t * gdot_o;
+
+   or: f_cf = -diag(foo, damping_t, damping_t) * gdot_nto   (since gdot_nto[0] is modified)
+   vs. f_cf = -diaginv * gdot_nto in NSCD iteration
+
+   => The NSCD iteration is more or less a DEM time step where we choose the stiffness and damping parameters such that penetration is non-existent after a time step and contacts are truly static (tangential rel. vel. is zero) unless the friction force hits its limit
+
+   f_cf[0] = std::max( 0, f_cf[0] );
+
+   flimit = contactCache.mu_ * f_cf[0];
+   fsq = f_cf[1] * f_cf[1] + f_cf[2] * f_cf[2]
+   if( fsq > flimit * flimit ) {
+      f = flimit / sqrt( fsq );
+      f_cf[1] *= f;
+      f_cf[2] *= f;
    }
 
+   f_wf = contactframe * f_cf;
+
+   b1->addForceAtPos(  f_wf, gpos );
+   b2->addForceAtPos( -f_wf, gpos );
+   */
+
    return delta_max;
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-
-/*!\brief Relaxes all contacts once. The contact model is for inelastic unilateral contacts with Coulomb friction.
+/*!\brief Relaxes all contacts of a block with relaxInelasticCoulombContactByDecoupling().
  *
+ * \param dtinv The inverse of the current time step.
+ * \param contactCache The contacts of the block.
+ * \param bodyCache The bodies of the block.
  * \return The largest variation of contact impulses in the L-infinity norm.
  *
- * This function is to be called from resolveContacts(). Separating contacts are preferred over
+ * The order of the contact updates is determined by the iteration scheme, see relaxContacts().
+ */
+inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxInelasticCoulombContactsByDecoupling( real_t dtinv,
+                                                                                                     HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                                                                     HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache )
+{
+   return relaxContacts( contactCache, bodyCache, [&]( size_t i, Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 ) {
+      return relaxInelasticCoulombContactByDecoupling( i, dtinv, contactCache, bodyCache, dv1, dw1, dv2, dw2 );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+
+/*!\brief Relaxes contact i once. The contact model is for inelastic unilateral contacts with Coulomb friction.
+ *
+ * \return The variation of the impulse of contact i in the L-infinity norm.
+ *
+ * The velocity corrections of the two bodies are passed in \a dv1, \a dw1, \a dv2 and \a dw2 and
+ * are updated in place.
+ *
+ * This function is to be called from relaxContacts(). Separating contacts are preferred over
  * other solutions if valid. Static solutions are preferred over dynamic solutions. Dynamic
  * solutions are computed by decoupling the normal from the frictional components. That is
  * for a dynamic contact the normal component is relaxed first followed by the frictional
@@ -771,252 +1030,276 @@ inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxApproximateInelas
  * friction model depends on the number of subiterations performed. If no subiterations are
  * performed the friction is guaranteed to be at least partially dissipative.
  */
-inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxInelasticCoulombContactsByDecoupling( real_t dtinv,
-                                                                                                     HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
-                                                                                                     HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache )
+inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxInelasticCoulombContactByDecoupling( size_t i,
+                                                                                                    real_t dtinv,
+                                                                                                    HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                                                                    const HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache,
+                                                                                                    Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 )
 {
    real_t delta_max( 0 );
-   size_t numContactsMasked( contactCache.p_.size() );
 
-   // Relax contacts
-   for( size_t i = 0; i < numContactsMasked; ++i ) {
-      // Remove velocity corrections of this contact's reaction.
-      bodyCache.dv_[contactCache.body1_[i]->index_] -= contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
-      bodyCache.dw_[contactCache.body1_[i]->index_] -= contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
-      bodyCache.dv_[contactCache.body2_[i]->index_] += contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
-      bodyCache.dw_[contactCache.body2_[i]->index_] += contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
+   // Remove velocity corrections of this contact's reaction.
+   dv1 -= contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
+   dw1 -= contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
+   dv2 += contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
+   dw2 += contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
 
-      // Calculate the relative contact velocity in the global world frame (if no contact reaction is present at contact i)
-      Vec3 gdot    ( ( bodyCache.v_[contactCache.body1_[i]->index_] + bodyCache.dv_[contactCache.body1_[i]->index_] ) - ( bodyCache.v_[contactCache.body2_[i]->index_] + bodyCache.dv_[contactCache.body2_[i]->index_] ) + ( bodyCache.w_[contactCache.body1_[i]->index_] + bodyCache.dw_[contactCache.body1_[i]->index_] ) % contactCache.r1_[i] - ( bodyCache.w_[contactCache.body2_[i]->index_] + bodyCache.dw_[contactCache.body2_[i]->index_] ) % contactCache.r2_[i] /* + diag_[i] * p */ );
+   // Calculate the relative contact velocity in the global world frame (if no contact reaction is present at contact i)
+   Vec3 gdot    ( ( bodyCache.v_[contactCache.body1_[i]->index_] + dv1 ) - ( bodyCache.v_[contactCache.body2_[i]->index_] + dv2 ) + ( bodyCache.w_[contactCache.body1_[i]->index_] + dw1 ) % contactCache.r1_[i] - ( bodyCache.w_[contactCache.body2_[i]->index_] + dw2 ) % contactCache.r2_[i] /* + diag_[i] * p */ );
 
-      // Change from the global world frame to the contact frame
-      Mat3 contactframe( contactCache.n_[i], contactCache.t_[i], contactCache.o_[i] );
-      Vec3 gdot_nto( contactframe.getTranspose() * gdot );
+   // Change from the global world frame to the contact frame
+   Mat3 contactframe( contactCache.n_[i], contactCache.t_[i], contactCache.o_[i] );
+   Vec3 gdot_nto( contactframe.getTranspose() * gdot );
 
-      //real_t gdot_n  ( trans( contactCache.n_[i] ) * gdot );  // The component of gdot along the contact normal n
-      //Vec3 gdot_t  ( gdot - gdot_n * contactCache.n_[i] );  // The components of gdot tangential to the contact normal n
-      //real_t g_n     ( gdot_n * dt /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] );  // The gap in normal direction
+   //real_t gdot_n  ( trans( contactCache.n_[i] ) * gdot );  // The component of gdot along the contact normal n
+   //Vec3 gdot_t  ( gdot - gdot_n * contactCache.n_[i] );  // The components of gdot tangential to the contact normal n
+   //real_t g_n     ( gdot_n * dt /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] );  // The gap in normal direction
 
-      // The constraint in normal direction is actually a positional constraint but instead of g_n we use g_n/dt equivalently and call it gdot_n
-      gdot_nto[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
+   // The constraint in normal direction is actually a positional constraint but instead of g_n we use g_n/dt equivalently and call it gdot_n
+   gdot_nto[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
 
-      //WALBERLA_LOG_WARNING( "Contact #" << i << " is\nA = \n" << contactCache.diag_nto_[i] << "\nb = \n" << gdot_nto << "\nmu = " << contactCache.mu_[i] );
+   //WALBERLA_LOG_WARNING( "Contact #" << i << " is\nA = \n" << contactCache.diag_nto_[i] << "\nb = \n" << gdot_nto << "\nmu = " << contactCache.mu_[i] );
 
-      if( gdot_nto[0] >= 0 ) {
-         // Contact is separating if no contact reaction is present at contact i.
+   if( gdot_nto[0] >= 0 ) {
+      // Contact is separating if no contact reaction is present at contact i.
 
-         delta_max = std::max( delta_max, std::max( std::abs( contactCache.p_[i][0] ), std::max( std::abs( contactCache.p_[i][1] ), std::abs( contactCache.p_[i][2] ) ) ) );
-         contactCache.p_[i] = Vec3();
-         //WALBERLA_LOG_WARNING( "Contact #" << i << " is separating." );
+      delta_max = std::max( delta_max, std::max( std::abs( contactCache.p_[i][0] ), std::max( std::abs( contactCache.p_[i][1] ), std::abs( contactCache.p_[i][2] ) ) ) );
+      contactCache.p_[i] = Vec3();
+      //WALBERLA_LOG_WARNING( "Contact #" << i << " is separating." );
 
-         // No need to apply zero impulse.
-      }
-      else {
-         // Contact is persisting (either static or dynamic).
-
-         // Calculate the impulse necessary for a static contact expressed as components in the contact frame.
-         Vec3 p_cf( -( contactCache.diag_nto_inv_[i] * gdot_nto ) );
-
-         // Can p_cf[0] be negative even though -gdot_nto[0] > 0? Yes! Try:
-         // A = [0.5 -0.1 +0.1; -0.1 0.5 -0.1; +0.1 -0.1 1];
-         // b = [0.01 -1 -1]';
-         // A\b    \approx [-0.19 -2.28 -1.21]'
-         // eig(A) \approx [ 0.40  0.56  1.04]'
-
-         real_t flimit( contactCache.mu_[i] * p_cf[0] );
-         real_t fsq( p_cf[1] * p_cf[1] + p_cf[2] * p_cf[2] );
-         if( fsq > flimit * flimit || p_cf[0] < 0 ) {
-            // Contact cannot be static so it must be dynamic.
-            // => Complementarity condition on normal reaction now turns into an equation since we know that the normal reaction is definitely not zero.
-
-            for (int j = 0; j < 20; ++j) {
-               // For simplicity we change to a simpler relaxation scheme here:
-               // 1. Relax normal reaction with the tangential components equal to the previous values
-               // 2. Relax tangential components with the newly relaxed normal reaction
-               // Note: The better approach would be to solve the true 3x3 block problem!
-               // Warning: Simply projecting the frictional components is wrong since then the normal action is no longer 0 and simulations break.
-
-               Vec3 gdotCorrected;
-               real_t gdotCorrected_n;
-               Vec2 gdotCorrected_to;
-
-               // Calculate the relative contact velocity in the global world frame (if no normal contact reaction is present at contact i)
-               p_cf[0] = 0;
-               //                       |<- p_cf is orthogonal to the normal and drops out in next line ->|
-               gdotCorrected   = /* ( contactCache.body1_[i]->getInvMass() + contactCache.body2_[i]->getInvMass() ) * p_cf  */ gdot + ( contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % ( contactCache.t_[i] * p_cf[1] + contactCache.o_[i] * p_cf[2] ) ) ) % contactCache.r1_[i] + ( contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % ( contactCache.t_[i] * p_cf[1] + contactCache.o_[i] * p_cf[2] ) ) ) % contactCache.r2_[i];
-               gdotCorrected_n = contactCache.n_[i] * gdotCorrected + contactCache.dist_[i] * dtinv;
-
-               // Relax normal component.
-               p_cf[0] = std::max( real_c( 0 ), -( contactCache.diag_n_inv_[i] * gdotCorrected_n ) );
-
-               // Calculate the relative contact velocity in the global world frame (if no frictional contact reaction is present at contact i)
-               p_cf[1] = p_cf[2] = real_c( 0 );
-               //                       |<- p_cf is orthogonal to the tangential plane and drops out   ->|
-               gdotCorrected   = /* ( contactCache.body1_[i]->getInvMass() + contactCache.body2_[i]->getInvMass() ) * p_cf */ gdot + ( contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % ( contactCache.n_[i] * p_cf[0] ) ) ) % contactCache.r1_[i] + ( contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % ( contactCache.n_[i] * p_cf[0] ) ) ) % contactCache.r2_[i];
-               gdotCorrected_to[0] = contactCache.t_[i] * gdotCorrected;
-               gdotCorrected_to[1] = contactCache.o_[i] * gdotCorrected;
-
-               // Relax frictional components.
-               Vec2 ret = -( contactCache.diag_to_inv_[i] * gdotCorrected_to );
-               p_cf[1] = ret[0];
-               p_cf[2] = ret[1];
-
-               flimit = contactCache.mu_[i] * p_cf[0];
-               fsq = p_cf[1] * p_cf[1] + p_cf[2] * p_cf[2];
-               if( fsq > flimit * flimit ) {
-                  // 3.2.1 Decoupling
-                  // \tilde{x}^0 = p_cf[1..2]
-
-                  // Determine \tilde{A}
-                  Mat2 diag_to( contactCache.diag_nto_[i](1, 1), contactCache.diag_nto_[i](1, 2), contactCache.diag_nto_[i](2, 1), contactCache.diag_nto_[i](2, 2) );
-
-                        const real_t f( flimit / std::sqrt( fsq ) );
-                  //p_cf[1] *= f;
-                  //p_cf[2] *= f;
-
-                  // Determine search interval for Golden Section Search
-                  const real_t phi( real_c(0.5) * ( real_c(1) + std::sqrt( real_c( 5 ) ) ) );
-                  real_t shift( std::atan2( -p_cf[2], p_cf[1] ) );
-                  real_t acos_f( std::acos( f ) );
-
-                  //WALBERLA_LOG_WARNING( acos_f << " " << shift );
-
-                  real_t alpha_left( -acos_f - shift );
-                  //Vec2 x_left( flimit * std::cos( alpha_left ), flimit * std::sin( alpha_left ) );
-                  //real_t f_left( 0.5 * trans( x_left ) * ( diag_to * x_left ) - trans( x_left ) * ( -gdot_to ) );
-
-                  real_t alpha_right( acos_f - shift );
-                  //Vec2 x_right( flimit * std::cos( alpha_right ), flimit * std::sin( alpha_right ) );
-                  //real_t f_right( 0.5 * trans( x_right ) * ( diag_to * x_right ) - trans( x_right ) * ( -gdot_to ) );
-
-                  real_t alpha_mid( ( alpha_right + alpha_left * phi ) / ( 1 + phi ) );
-                  Vec2 x_mid( flimit * std::cos( alpha_mid ), flimit * std::sin( alpha_mid ) );
-                  real_t f_mid( real_c(0.5) * x_mid * ( diag_to * x_mid ) - x_mid * ( -gdotCorrected_to ) );
-
-                  bool leftlarger = false;
-                  for( size_t k = 0; k < maxSubIterations_; ++k ) {
-                     real_t alpha_next( alpha_left + ( alpha_right - alpha_mid ) );
-                     Vec2 x_next( flimit * std::cos( alpha_next ), flimit * std::sin( alpha_next ) );
-                     real_t f_next( real_c(0.5) * x_next * ( diag_to * x_next ) - x_next * ( -gdotCorrected_to ) );
-                     //WALBERLA_LOG_WARNING( "[(" << alpha_left << ", ?); (" << alpha_mid << ", " << f_mid << "); (" << alpha_right << ", ?)] <- (" << alpha_next << ", " << f_next << ")" );
-                     //WALBERLA_LOG_WARNING( "left: " << alpha_mid - alpha_left << "  right: " << alpha_right - alpha_mid << "  ll: " << leftlarger );
-                     //WALBERLA_ASSERT(leftlarger ? (alpha_mid - alpha_left > alpha_right - alpha_mid) : (alpha_mid - alpha_left < alpha_right - alpha_mid), "ll inconsistent!" );
-
-                     if (leftlarger) {
-                        // left interval larger
-                        if( f_next < f_mid ) {
-                           alpha_right = alpha_mid;
-                           alpha_mid   = alpha_next;
-                           x_mid       = x_next;
-                           f_mid       = f_next;
-                           leftlarger = true;
-                        }
-                        else {
-                           alpha_left  = alpha_next;
-                           leftlarger = false;
-                        }
+      // No need to apply zero impulse.
+   }
+   else {
+      // Contact is persisting (either static or dynamic).
+
+      // Calculate the impulse necessary for a static contact expressed as components in the contact frame.
+      Vec3 p_cf( -( contactCache.diag_nto_inv_[i] * gdot_nto ) );
+
+      // Can p_cf[0] be negative even though -gdot_nto[0] > 0? Yes! Try:
+      // A = [0.5 -0.1 +0.1; -0.1 0.5 -0.1; +0.1 -0.1 1];
+      // b = [0.01 -1 -1]';
+      // A\b    \approx [-0.19 -2.28 -1.21]'
+      // eig(A) \approx [ 0.40  0.56  1.04]'
+
+      real_t flimit( contactCache.mu_[i] * p_cf[0] );
+      real_t fsq( p_cf[1] * p_cf[1] + p_cf[2] * p_cf[2] );
+      if( fsq > flimit * flimit || p_cf[0] < 0 ) {
+         // Contact cannot be static so it must be dynamic.
+         // => Complementarity condition on normal reaction now turns into an equation since we know that the normal reaction is definitely not zero.
+
+         for (int j = 0; j < 20; ++j) {
+            // For simplicity we change to a simpler relaxation scheme here:
+            // 1. Relax normal reaction with the tangential components equal to the previous values
+            // 2. Relax tangential components with the newly relaxed normal reaction
+            // Note: The better approach would be to solve the true 3x3 block problem!
+            // Warning: Simply projecting the frictional components is wrong since then the normal action is no longer 0 and simulations break.
+
+            Vec3 gdotCorrected;
+            real_t gdotCorrected_n;
+            Vec2 gdotCorrected_to;
+
+            // Calculate the relative contact velocity in the global world frame (if no normal contact reaction is present at contact i)
+            p_cf[0] = 0;
+            //                       |<- p_cf is orthogonal to the normal and drops out in next line ->|
+            gdotCorrected   = /* ( contactCache.body1_[i]->getInvMass() + contactCache.body2_[i]->getInvMass() ) * p_cf  */ gdot + ( contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % ( contactCache.t_[i] * p_cf[1] + contactCache.o_[i] * p_cf[2] ) ) ) % contactCache.r1_[i] + ( contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % ( contactCache.t_[i] * p_cf[1] + contactCache.o_[i] * p_cf[2] ) ) ) % contactCache.r2_[i];
+            gdotCorrected_n = contactCache.n_[i] * gdotCorrected + contactCache.dist_[i] * dtinv;
+
+            // Relax normal component.
+            p_cf[0] = std::max( real_c( 0 ), -( contactCache.diag_n_inv_[i] * gdotCorrected_n ) );
+
+            // Calculate the relative contact velocity in the global world frame (if no frictional contact reaction is present at contact i)
+            p_cf[1] = p_cf[2] = real_c( 0 );
+            //                       |<- p_cf is orthogonal to the tangential plane and drops out   ->|
+            gdotCorrected   = /* ( contactCache.body1_[i]->getInvMass() + contactCache.body2_[i]->getInvMass() ) * p_cf */ gdot + ( contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % ( contactCache.n_[i] * p_cf[0] ) ) ) % contactCache.r1_[i] + ( contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % ( contactCache.n_[i] * p_cf[0] ) ) ) % contactCache.r2_[i];
+            gdotCorrected_to[0] = contactCache.t_[i] * gdotCorrected;
+            gdotCorrected_to[1] = contactCache.o_[i] * gdotCorrected;
+
+            // Relax frictional components.
+            Vec2 ret = -( contactCache.diag_to_inv_[i] * gdotCorrected_to );
+            p_cf[1] = ret[0];
+            p_cf[2] = ret[1];
+
+            flimit = contactCache.mu_[i] * p_cf[0];
+            fsq = p_cf[1] * p_cf[1] + p_cf[2] * p_cf[2];
+            if( fsq > flimit * flimit ) {
+               // 3.2.1 Decoupling
+               // \tilde{x}^0 = p_cf[1..2]
+
+               // Determine \tilde{A}
+               Mat2 diag_to( contactCache.diag_nto_[i](1, 1), contactCache.diag_nto_[i](1, 2), contactCache.diag_nto_[i](2, 1), contactCache.diag_nto_[i](2, 2) );
+
+                     const real_t f( flimit / std::sqrt( fsq ) );
+               //p_cf[1] *= f;
+               //p_cf[2] *= f;
+
+               // Determine search interval for Golden Section Search
+               const real_t phi( real_c(0.5) * ( real_c(1) + std::sqrt( real_c( 5 ) ) ) );
+               real_t shift( std::atan2( -p_cf[2], p_cf[1] ) );
+               real_t acos_f( std::acos( f ) );
+
+               //WALBERLA_LOG_WARNING( acos_f << " " << shift );
+
+               real_t alpha_left( -acos_f - shift );
+               //Vec2 x_left( flimit * std::cos( alpha_left ), flimit * std::sin( alpha_left ) );
+               //real_t f_left( 0.5 * trans( x_left ) * ( diag_to * x_left ) - trans( x_left ) * ( -gdot_to ) );
+
+               real_t alpha_right( acos_f - shift );
+               //Vec2 x_right( flimit * std::cos( alpha_right ), flimit * std::sin( alpha_right ) );
+               //real_t f_right( 0.5 * trans( x_right ) * ( diag_to * x_right ) - trans( x_right ) * ( -gdot_to ) );
+
+               real_t alpha_mid( ( alpha_right + alpha_left * phi ) / ( 1 + phi ) );
+               Vec2 x_mid( flimit * std::cos( alpha_mid ), flimit * std::sin( alpha_mid ) );
+               real_t f_mid( real_c(0.5) * x_mid * ( diag_to * x_mid ) - x_mid * ( -gdotCorrected_to ) );
+
+               bool leftlarger = false;
+               for( size_t k = 0; k < maxSubIterations_; ++k ) {
+                  real_t alpha_next( alpha_left + ( alpha_right - alpha_mid ) );
+                  Vec2 x_next( flimit * std::cos( alpha_next ), flimit * std::sin( alpha_next ) );
+                  real_t f_next( real_c(0.5) * x_next * ( diag_to * x_next ) - x_next * ( -gdotCorrected_to ) );
+                  //WALBERLA_LOG_WARNING( "[(" << alpha_left << ", ?); (" << alpha_mid << ", " << f_mid << "); (" << alpha_right << ", ?)] <- (" << alpha_next << ", " << f_next << ")" );
+                  //WALBERLA_LOG_WARNING( "left: " << alpha_mid - alpha_left << "  right: " << alpha_right - alpha_mid << "  ll: " << leftlarger );
+                  //WALBERLA_ASSERT(leftlarger ? (alpha_mid - alpha_left > alpha_right - alpha_mid) : (alpha_mid - alpha_left < alpha_right - alpha_mid), "ll inconsistent!" );
+
+                  if (leftlarger) {
+                     // left interval larger
+                     if( f_next < f_mid ) {
+                        alpha_right = alpha_mid;
+                        alpha_mid   = alpha_next;
+                        x_mid       = x_next;
+                        f_mid       = f_next;
+                        leftlarger = true;
                      }
                      else {
-                        // right interval larger
-                        if( f_next < f_mid ) {
-                           alpha_left = alpha_mid;
-                           alpha_mid  = alpha_next;
-                           x_mid      = x_next;
-                           f_mid      = f_next;
-                           leftlarger = false;
-                        }
-                        else {
-                           alpha_right = alpha_next;
-                           leftlarger = true;
-                        }
+                        alpha_left  = alpha_next;
+                        leftlarger = false;
+                     }
+                  }
+                  else {
+                     // right interval larger
+                     if( f_next < f_mid ) {
+                        alpha_left = alpha_mid;
+                        alpha_mid  = alpha_next;
+                        x_mid      = x_next;
+                        f_mid      = f_next;
+                        leftlarger = false;
+                     }
+                     else {
+                        alpha_right = alpha_next;
+                        leftlarger = true;
                      }
                   }
-                  //WALBERLA_LOG_WARNING( "dalpha = " << alpha_right - alpha_left );
-
-                  p_cf[1] = x_mid[0];
-                  p_cf[2] = x_mid[1];
                }
+               //WALBERLA_LOG_WARNING( "dalpha = " << alpha_right - alpha_left );
+
+               p_cf[1] = x_mid[0];
+               p_cf[2] = x_mid[1];
             }
-            //WALBERLA_LOG_WARNING( "Contact #" << i << " is dynamic." );
-         }
-         else {
-            // Contact is static.
-            //WALBERLA_LOG_WARNING( "Contact #" << i << " is static." );
          }
+         //WALBERLA_LOG_WARNING( "Contact #" << i << " is dynamic." );
+      }
+      else {
+         // Contact is static.
+         //WALBERLA_LOG_WARNING( "Contact #" << i << " is static." );
+      }
 
-         //WALBERLA_LOG_WARNING( "Contact reaction in contact frame: " << p_cf << "\n" << contactCache.diag_nto_[i]*p_cf + gdot_nto );
-         Vec3 p_wf( contactframe * p_cf );
-         Vec3 dp( contactCache.p_[i] - p_wf );
-         delta_max = std::max( delta_max, std::max( std::abs( dp[0] ), std::max( std::abs( dp[1] ), std::abs( dp[2] ) ) ) );
+      //WALBERLA_LOG_WARNING( "Contact reaction in contact frame: " << p_cf << "\n" << contactCache.diag_nto_[i]*p_cf + gdot_nto );
+      Vec3 p_wf( contactframe * p_cf );
+      Vec3 dp( contactCache.p_[i] - p_wf );
+      delta_max = std::max( delta_max, std::max( std::abs( dp[0] ), std::max( std::abs( dp[1] ), std::abs( dp[2] ) ) ) );
 
-         contactCache.p_[i] = p_wf;
+      contactCache.p_[i] = p_wf;
 
-         // Apply impulse right away
-         bodyCache.dv_[contactCache.body1_[i]->index_] += contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
-         bodyCache.dw_[contactCache.body1_[i]->index_] += contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
-         bodyCache.dv_[contactCache.body2_[i]->index_] -= contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
-         bodyCache.dw_[contactCache.body2_[i]->index_] -= contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
-      }
+      // Apply impulse right away
+      dv1 += contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
+      dw1 += contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
+      dv2 -= contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
+      dw2 -= contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
+   }
 
 #if 0
-      Vec3 gdot2   ( ( bodyCache.v_[contactCache.body1_[i]->index_] + bodyCache.dv_[contactCache.body1_[i]->index_] ) -
-            ( bodyCache.v_[contactCache.body2_[i]->index_] + bodyCache.dv_[contactCache.body2_[i]->index_] ) +
-            ( bodyCache.w_[contactCache.body1_[i]->index_] + bodyCache.dw_[contactCache.body1_[i]->index_] ) % contactCache.r1_[i] -
-            ( bodyCache.w_[contactCache.body2_[i]->index_] + bodyCache.dw_[contactCache.body2_[i]->index_] ) % contactCache.r2_[i] /* + diag_[i] * p */ );
-      Vec3 gdot_nto2( contactframe.getTranspose() * gdot2 );
-      WALBERLA_LOG_DETAIL( "gdot_n2 = " << gdot_nto2[0] );
-      WALBERLA_LOG_DETAIL( "gdot_t2 = " << gdot_nto2[1] );
-      WALBERLA_LOG_DETAIL( "gdot_o2 = " << gdot_nto2[2] );
-   }
-   gdot_nto2[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
-   WALBERLA_LOG_DETAIL( "gdot_n2' = " << gdot_nto2[0] );
+   Vec3 gdot2   ( ( bodyCache.v_[contactCache.body1_[i]->index_] + dv1 ) -
+         ( bodyCache.v_[contactCache.body2_[i]->index_] + dv2 ) +
+         ( bodyCache.w_[contactCache.body1_[i]->index_] + dw1 ) % contactCache.r1_[i] -
+         ( bodyCache.w_[contactCache.body2_[i]->index_] + dw2 ) % contactCache.r2_[i] /* + diag_[i] * p */ );
+   Vec3 gdot_nto2( contactframe.getTranspose() * gdot2 );
+   WALBERLA_LOG_DETAIL( "gdot_n2 = " << gdot_nto2[0] );
+   WALBERLA_LOG_DETAIL( "gdot_t2 = " << gdot_nto2[1] );
+   WALBERLA_LOG_DETAIL( "gdot_o2 = " << gdot_nto2[2] );
+}
+gdot_nto2[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
+WALBERLA_LOG_DETAIL( "gdot_n2' = " << gdot_nto2[0] );
 }
 #endif
 
 /*
-       * compare DEM time-step with NSCD iteration:
-       * - projections are the same
-       * - velocities are the same if we use an explicit Euler discretization for the velocity time integration
-       *
-      f_cf[0] = -stiffness * contactCache.dist_ - damping_n * gdot_n = -[(stiffness * dt) * contactCache.dist_ * dtinv + damping_n * gdot_n] = -foo * (gdot_n + contactCache.dist_ * dtinv) where foo = stiffness * dt = damping_n;
-      f_cf[1] = -damping_t * gdot_t                     = -damping_t * gdot_t;
-      f_cf[2] = -damping_t * gdot_o                     = -damping_t * gdot_o;
-
-      or: f_cf = -diag(foo, damping_t, damping_t) * gdot_nto   (since gdot_nto[0] is modified)
-      vs. f_cf = -diaginv * gdot_nto in NSCD iteration
-
-      => The NSCD iteration is more or less a DEM time step where we choose the stiffness and damping parameters such that penetration is non-existent after a time step and contacts are truly static (tangential rel. vel. is zero) unless the friction force hits its limit
-
-      f_cf[0] = std::max( 0, f_cf[0] );
-
-      flimit = contactCache.mu_ * f_cf[0];
-      fsq = f_cf[1] * f_cf[1] + f_cf[2] * f_cf[2]
-      if( fsq > flimit * flimit ) {
-         f = flimit / sqrt( fsq );
-         f_cf[1] *= f;
-         f_cf[2] *= f;
-      }
+    * compare DEM time-step with NSCD iteration:
+    * - projections are the same
+    * - velocities are the same if we use an explicit Euler discretization for the velocity time integration
+    *
+   f_cf[0] = -stiffness * contactCache.dist_ - damping_n * gdot_n = -[(stiffness * dt) * contactCache.dist_ * dtinv + damping_n * gdot_n] = -foo * (gdot_n + contactCache.dist_ * dtinv) where foo = stiffness * dt = damping_n;
+   f_cf[1] = -damping_t * gdot_t                     = -damping_t * gdot_t;
+   f_cf[2] = -damping_t * gdot_o                     = -damping_t * gdot_o;
+
+   or: f_cf = -diag(foo, damping_t, damping_t) * gdot_nto   (since gdot_nto[0] is modified)
+   vs. f_cf = -diaginv * gdot_nto in NSCD iteration
+
+   => The NSCD iteration is more or less a DEM time step where we choose the stiffness and damping parameters such that penetration is non-existent after a time step and contacts are truly static (tangential rel. vel. is zero) unless the friction force hits its limit
+
+   f_cf[0] = std::max( 0, f_cf[0] );
+
+   flimit = contactCache.mu_ * f_cf[0];
+   fsq = f_cf[1] * f_cf[1] + f_cf[2] * f_cf[2]
+   if( fsq > flimit * flimit ) {
+      f = flimit / sqrt( fsq );
+      f_cf[1] *= f;
+      f_cf[2] *= f;
+   }
+
+   f_wf = contactframe * f_cf;
 
-      f_wf = contactframe * f_cf;
+   b1->addForceAtPos(  f_wf, gpos );
+   b2->addForceAtPos( -f_wf, gpos );
+   */
 
-      b1->addForceAtPos(  f_wf, gpos );
-      b2->addForceAtPos( -f_wf, gpos );
-      */
+   return delta_max;
 }
+//*************************************************************************************************
+
 
-return delta_max;
+//*************************************************************************************************
+/*!\brief Relaxes all contacts of a block with relaxInelasticCoulombContactByOrthogonalProjections().
+ *
+ * \param dtinv The inverse of the current time step.
+ * \param approximate Use the approximate iteration.
+ * \param contactCache The contacts of the block.
+ * \param bodyCache The bodies of the block.
+ * \return The largest variation of contact impulses in the L-infinity norm.
+ *
+ * The order of the contact updates is determined by the iteration scheme, see relaxContacts().
+ */
+inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxInelasticCoulombContactsByOrthogonalProjections( real_t dtinv,
+                                                                                                                bool approximate,
+                                                                                                                HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                                                                                HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache )
+{
+   return relaxContacts( contactCache, bodyCache, [&]( size_t i, Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 ) {
+      return relaxInelasticCoulombContactByOrthogonalProjections( i, dtinv, approximate, contactCache, bodyCache, dv1, dw1, dv2, dw2 );
+   } );
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-/*!\brief Relaxes all contacts once. The contact model is for inelastic unilateral contacts with Coulomb friction.
+/*!\brief Relaxes contact i once. The contact model is for inelastic unilateral contacts with Coulomb friction.
  *
  * \param dtinv The inverse of the current time step.
  * \param approximate Use the approximate model showing bouncing.
- * \return The largest variation of contact impulses in the L-infinity norm.
+ * \return The variation of the impulse of contact i in the L-infinity norm.
  *
- * This function is to be called from resolveContacts(). The iterative method to solve the contact
+ * The velocity corrections of the two bodies are passed in \a dv1, \a dw1, \a dv2 and \a dw2 and
+ * are updated in place.
+ *
+ * This function is to be called from relaxContacts(). The iterative method to solve the contact
  * problem is e.g. described in the article "A matrix-free cone complementarity approach for
  * solving large-scale, nonsmooth, rigid body dynamics" by A. Tasora and M. Anitescu in Computer
  * Methods in Applied Mechanics and Engineering (Volume 200, Issues 5–8, 15 January 2011,
@@ -1033,376 +1316,396 @@ return delta_max;
  * Modelling (Volume 28, Issue 4, 1998, Pages 225-245). Which iteration is used is controlled with
  * the approximate parameter.
  */
-inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxInelasticCoulombContactsByOrthogonalProjections( real_t dtinv,
-                                                                                                                bool approximate,
-                                                                                                                HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
-                                                                                                                HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache )
+inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxInelasticCoulombContactByOrthogonalProjections( size_t i,
+                                                                                                               real_t dtinv,
+                                                                                                               bool approximate,
+                                                                                                               HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                                                                               const HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache,
+                                                                                                               Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 )
 {
    real_t delta_max( 0 );
-   size_t numContactsMasked( contactCache.p_.size() );
-
-   // Relax contacts
-   for( size_t i = 0; i < numContactsMasked; ++i ) {
-      // Remove velocity corrections of this contact's reaction.
-      bodyCache.dv_[contactCache.body1_[i]->index_] -= contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
-      bodyCache.dw_[contactCache.body1_[i]->index_] -= contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
-      bodyCache.dv_[contactCache.body2_[i]->index_] += contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
-      bodyCache.dw_[contactCache.body2_[i]->index_] += contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
-
-      // Calculate the relative contact velocity in the global world frame (if no contact reaction is present at contact i)
-      Vec3 gdot    ( ( bodyCache.v_[contactCache.body1_[i]->index_] + bodyCache.dv_[contactCache.body1_[i]->index_] ) - ( bodyCache.v_[contactCache.body2_[i]->index_] + bodyCache.dv_[contactCache.body2_[i]->index_] ) + ( bodyCache.w_[contactCache.body1_[i]->index_] + bodyCache.dw_[contactCache.body1_[i]->index_] ) % contactCache.r1_[i] - ( bodyCache.w_[contactCache.body2_[i]->index_] + bodyCache.dw_[contactCache.body2_[i]->index_] ) % contactCache.r2_[i] /* + diag_[i] * p */ );
-
-      // Change from the global world frame to the contact frame
-      Mat3 contactframe( contactCache.n_[i], contactCache.t_[i], contactCache.o_[i] );
-      Vec3 gdot_nto( contactframe.getTranspose() * gdot );
-
-      //real_t gdot_n  ( trans( contactCache.n_[i] ) * gdot );  // The component of gdot along the contact normal n
-      //Vec3 gdot_t  ( gdot - gdot_n * contactCache.n_[i] );  // The components of gdot tangential to the contact normal n
-      //real_t g_n     ( gdot_n * dt /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] );  // The gap in normal direction
-
-      // The constraint in normal direction is actually a positional constraint but instead of g_n we use g_n/dt equivalently and call it gdot_n
-      gdot_nto[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
-
-      const real_t w( 1 ); // w > 0
-      Vec3 p_cf( contactframe.getTranspose() * contactCache.p_[i] );
-      if( approximate ) {
-         // Calculate next iterate (Anitescu/Tasora).
-         p_cf = p_cf - w * ( contactCache.diag_nto_[i] * p_cf + gdot_nto );
-      }
-      else {
-         // Calculate next iterate (De Saxce/Feng).
-         Vec3 tmp( contactCache.diag_nto_[i] * p_cf + gdot_nto );
-         tmp[0] += std::sqrt( math::sq( tmp[1] ) + math::sq( tmp[2] ) ) * contactCache.mu_[i];
-         p_cf = p_cf - w * tmp;
-      }
 
-      // Project.
-      real_t flimit( contactCache.mu_[i] * p_cf[0] );
-      real_t fsq( p_cf[1] * p_cf[1] + p_cf[2] * p_cf[2] );
-      if( p_cf[0] > 0 && fsq < flimit * flimit ) {
-         // Unconstrained minimum is in cone leading to a static contact and no projection
-         // is necessary.
-      }
-      else if( p_cf[0] < 0 && fsq < p_cf[0] / math::sq( contactCache.mu_[i] ) ) {
-         // Unconstrained minimum is in dual cone leading to a separating contact where no contact
-         // reaction is present (the unconstrained minimum is projected to the tip of the cone).
+   // Remove velocity corrections of this contact's reaction.
+   dv1 -= contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
+   dw1 -= contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
+   dv2 += contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
+   dw2 += contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
 
-         p_cf = Vec3();
-      }
-      else {
-         // The contact is dynamic.
-         real_t f( std::sqrt( fsq ) );
-         p_cf[0] = ( f * contactCache.mu_[i] + p_cf[0] ) / ( math::sq( contactCache.mu_[i] ) + 1 );
-         real_t factor( contactCache.mu_[i] * p_cf[0] / f );
-         p_cf[1] *= factor;
-         p_cf[2] *= factor;
-      }
+   // Calculate the relative contact velocity in the global world frame (if no contact reaction is present at contact i)
+   Vec3 gdot    ( ( bodyCache.v_[contactCache.body1_[i]->index_] + dv1 ) - ( bodyCache.v_[contactCache.body2_[i]->index_] + dv2 ) + ( bodyCache.w_[contactCache.body1_[i]->index_] + dw1 ) % contactCache.r1_[i] - ( bodyCache.w_[contactCache.body2_[i]->index_] + dw2 ) % contactCache.r2_[i] /* + diag_[i] * p */ );
 
-      Vec3 p_wf( contactframe * p_cf );
-      Vec3 dp( contactCache.p_[i] - p_wf );
-      delta_max = std::max( delta_max, std::max( std::abs( dp[0] ), std::max( std::abs( dp[1] ), std::abs( dp[2] ) ) ) );
+   // Change from the global world frame to the contact frame
+   Mat3 contactframe( contactCache.n_[i], contactCache.t_[i], contactCache.o_[i] );
+   Vec3 gdot_nto( contactframe.getTranspose() * gdot );
 
-      contactCache.p_[i] = p_wf;
+   //real_t gdot_n  ( trans( contactCache.n_[i] ) * gdot );  // The component of gdot along the contact normal n
+   //Vec3 gdot_t  ( gdot - gdot_n * contactCache.n_[i] );  // The components of gdot tangential to the contact normal n
+   //real_t g_n     ( gdot_n * dt /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] );  // The gap in normal direction
 
-      // Apply impulse right away
-      bodyCache.dv_[contactCache.body1_[i]->index_] += contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
-      bodyCache.dw_[contactCache.body1_[i]->index_] += contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
-      bodyCache.dv_[contactCache.body2_[i]->index_] -= contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
-      bodyCache.dw_[contactCache.body2_[i]->index_] -= contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
+   // The constraint in normal direction is actually a positional constraint but instead of g_n we use g_n/dt equivalently and call it gdot_n
+   gdot_nto[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
+
+   const real_t w( 1 ); // w > 0
+   Vec3 p_cf( contactframe.getTranspose() * contactCache.p_[i] );
+   if( approximate ) {
+      // Calculate next iterate (Anitescu/Tasora).
+      p_cf = p_cf - w * ( contactCache.diag_nto_[i] * p_cf + gdot_nto );
+   }
+   else {
+      // Calculate next iterate (De Saxce/Feng).
+      Vec3 tmp( contactCache.diag_nto_[i] * p_cf + gdot_nto );
+      tmp[0] += std::sqrt( math::sq( tmp[1] ) + math::sq( tmp[2] ) ) * contactCache.mu_[i];
+      p_cf = p_cf - w * tmp;
    }
 
+   // Project.
+   real_t flimit( contactCache.mu_[i] * p_cf[0] );
+   real_t fsq( p_cf[1] * p_cf[1] + p_cf[2] * p_cf[2] );
+   if( p_cf[0] > 0 && fsq < flimit * flimit ) {
+      // Unconstrained minimum is in cone leading to a static contact and no projection
+      // is necessary.
+   }
+   else if( p_cf[0] < 0 && fsq < p_cf[0] / math::sq( contactCache.mu_[i] ) ) {
+      // Unconstrained minimum is in dual cone leading to a separating contact where no contact
+      // reaction is present (the unconstrained minimum is projected to the tip of the cone).
+
+      p_cf = Vec3();
+   }
+   else {
+      // The contact is dynamic.
+      real_t f( std::sqrt( fsq ) );
+      p_cf[0] = ( f * contactCache.mu_[i] + p_cf[0] ) / ( math::sq( contactCache.mu_[i] ) + 1 );
+      real_t factor( contactCache.mu_[i] * p_cf[0] / f );
+      p_cf[1] *= factor;
+      p_cf[2] *= factor;
+   }
+
+   Vec3 p_wf( contactframe * p_cf );
+   Vec3 dp( contactCache.p_[i] - p_wf );
+   delta_max = std::max( delta_max, std::max( std::abs( dp[0] ), std::max( std::abs( dp[1] ), std::abs( dp[2] ) ) ) );
+
+   contactCache.p_[i] = p_wf;
+
+   // Apply impulse right away
+   dv1 += contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
+   dw1 += contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
+   dv2 -= contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
+   dw2 -= contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
+
    return delta_max;
 }
 //*************************************************************************************************
 
 
 //*************************************************************************************************
-
-/*!\brief Relaxes all contacts once. The contact model is for inelastic unilateral contacts with the generalized maximum dissipation principle for friction.
+/*!\brief Relaxes all contacts of a block with relaxInelasticGeneralizedMaximumDissipationContact().
  *
+ * \param dtinv The inverse of the current time step.
+ * \param contactCache The contacts of the block.
+ * \param bodyCache The bodies of the block.
  * \return The largest variation of contact impulses in the L-infinity norm.
  *
- * This function is to be called from resolveContacts(). Dynamic solutions are computed by
- * minimizing the kinetic energy along the intersection of the plane of maximum compression and
- * the friction cone.
+ * The order of the contact updates is determined by the iteration scheme, see relaxContacts().
  */
 inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxInelasticGeneralizedMaximumDissipationContacts( real_t dtinv,
                                                                                                                HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
                                                                                                                HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache )
+{
+   return relaxContacts( contactCache, bodyCache, [&]( size_t i, Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 ) {
+      return relaxInelasticGeneralizedMaximumDissipationContact( i, dtinv, contactCache, bodyCache, dv1, dw1, dv2, dw2 );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+
+/*!\brief Relaxes contact i once. The contact model is for inelastic unilateral contacts with the generalized maximum dissipation principle for friction.
+ *
+ * \return The variation of the impulse of contact i in the L-infinity norm.
+ *
+ * The velocity corrections of the two bodies are passed in \a dv1, \a dw1, \a dv2 and \a dw2 and
+ * are updated in place.
+ *
+ * This function is to be called from relaxContacts(). Dynamic solutions are computed by
+ * minimizing the kinetic energy along the intersection of the plane of maximum compression and
+ * the friction cone.
+ */
+inline real_t HardContactSemiImplicitTimesteppingSolvers::relaxInelasticGeneralizedMaximumDissipationContact( size_t i,
+                                                                                                              real_t dtinv,
+                                                                                                              HardContactSemiImplicitTimesteppingSolvers::ContactCache& contactCache,
+                                                                                                              const HardContactSemiImplicitTimesteppingSolvers::BodyCache& bodyCache,
+                                                                                                              Vec3& dv1, Vec3& dw1, Vec3& dv2, Vec3& dw2 )
 {
    real_t delta_max( 0 );
-   size_t numContactsMasked( contactCache.p_.size() );
 
-   // Relax contacts
-   for( size_t i = 0; i < numContactsMasked; ++i ) {
-      // Remove velocity corrections of this contact's reaction.
-      bodyCache.dv_[contactCache.body1_[i]->index_] -= contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
-      bodyCache.dw_[contactCache.body1_[i]->index_] -= contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
-      bodyCache.dv_[contactCache.body2_[i]->index_] += contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
-      bodyCache.dw_[contactCache.body2_[i]->index_] += contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
+   // Remove velocity corrections of this contact's reaction.
+   dv1 -= contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
+   dw1 -= contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
+   dv2 += contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
+   dw2 += contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
 
-      // Calculate the relative contact velocity in the global world frame (if no contact reaction is present at contact i)
-      Vec3 gdot    ( ( bodyCache.v_[contactCache.body1_[i]->index_] + bodyCache.dv_[contactCache.body1_[i]->index_] ) - ( bodyCache.v_[contactCache.body2_[i]->index_] + bodyCache.dv_[contactCache.body2_[i]->index_] ) + ( bodyCache.w_[contactCache.body1_[i]->index_] + bodyCache.dw_[contactCache.body1_[i]->index_] ) % contactCache.r1_[i] - ( bodyCache.w_[contactCache.body2_[i]->index_] + bodyCache.dw_[contactCache.body2_[i]->index_] ) % contactCache.r2_[i] /* + diag_[i] * p */ );
+   // Calculate the relative contact velocity in the global world frame (if no contact reaction is present at contact i)
+   Vec3 gdot    ( ( bodyCache.v_[contactCache.body1_[i]->index_] + dv1 ) - ( bodyCache.v_[contactCache.body2_[i]->index_] + dv2 ) + ( bodyCache.w_[contactCache.body1_[i]->index_] + dw1 ) % contactCache.r1_[i] - ( bodyCache.w_[contactCache.body2_[i]->index_] + dw2 ) % contactCache.r2_[i] /* + diag_[i] * p */ );
 
-      // Change from the global world frame to the contact frame
-      Mat3 contactframe( contactCache.n_[i], contactCache.t_[i], contactCache.o_[i] );
-      Vec3 gdot_nto( contactframe.getTranspose() * gdot );
+   // Change from the global world frame to the contact frame
+   Mat3 contactframe( contactCache.n_[i], contactCache.t_[i], contactCache.o_[i] );
+   Vec3 gdot_nto( contactframe.getTranspose() * gdot );
 
-      // The constraint in normal direction is actually a positional constraint but instead of g_n we use g_n/dt equivalently and call it gdot_n
-      gdot_nto[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
+   // The constraint in normal direction is actually a positional constraint but instead of g_n we use g_n/dt equivalently and call it gdot_n
+   gdot_nto[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
 
-      //WALBERLA_LOG_WARNING( "Contact #" << i << " is\nA = \n" << contactCache.diag_nto_[i] << "\nb = \n" << gdot_nto << "\nmu = " << contactCache.mu_[i] );
+   //WALBERLA_LOG_WARNING( "Contact #" << i << " is\nA = \n" << contactCache.diag_nto_[i] << "\nb = \n" << gdot_nto << "\nmu = " << contactCache.mu_[i] );
 
-      if( gdot_nto[0] >= 0 ) {
-         // Contact is separating if no contact reaction is necessary without violating the penetration constraint.
+   if( gdot_nto[0] >= 0 ) {
+      // Contact is separating if no contact reaction is necessary without violating the penetration constraint.
 
-         delta_max = std::max( delta_max, std::max( std::abs( contactCache.p_[i][0] ), std::max( std::abs( contactCache.p_[i][1] ), std::abs( contactCache.p_[i][2] ) ) ) );
-         contactCache.p_[i] = Vec3();
+      delta_max = std::max( delta_max, std::max( std::abs( contactCache.p_[i][0] ), std::max( std::abs( contactCache.p_[i][1] ), std::abs( contactCache.p_[i][2] ) ) ) );
+      contactCache.p_[i] = Vec3();
 
-         //WALBERLA_LOG_WARNING( "Contact #" << i << " is separating." );
+      //WALBERLA_LOG_WARNING( "Contact #" << i << " is separating." );
 
-         // No need to apply zero impulse.
-      }
-      else {
-         // Contact is persisting (either static or dynamic).
-
-         // Calculate the impulse necessary for a static contact expressed as components in the contact frame.
-         Vec3 p_cf( -( contactCache.diag_nto_inv_[i] * gdot_nto ) );
-
-         // Can p_cf[0] be negative even though -gdot_nto[0] > 0? Yes! Try:
-         // A = [0.5 -0.1 +0.1; -0.1 0.5 -0.1; +0.1 -0.1 1];
-         // b = [0.01 -1 -1]';
-         // A\b    \approx [-0.19 -2.28 -1.21]'
-         // eig(A) \approx [ 0.40  0.56  1.04]'
-
-         real_t flimit( contactCache.mu_[i] * p_cf[0] );
-         real_t fsq( p_cf[1] * p_cf[1] + p_cf[2] * p_cf[2] );
-         if( fsq > flimit * flimit || p_cf[0] < 0 ) {
-            // Contact cannot be static so it must be dynamic.
-            // => Complementarity condition on normal reaction now turns into an equation since we know that the normal reaction is definitely not zero.
-
-            // \breve{x}^0 = p_cf[1..2]
-
-            // Eliminate normal component from 3x3 system: contactCache.diag_nto_[i]*p_cf + gdot_nto => \breve{A} \breve{x} - \breve{b}
-            const real_t invA_nn( math::inv( contactCache.diag_nto_[i](0, 0) ) );
-                                  const real_t offdiag( contactCache.diag_nto_[i](1, 2) - invA_nn * contactCache.diag_nto_[i](0, 1) * contactCache.diag_nto_[i](0, 2) );
-                                  Mat2 A_breve( contactCache.diag_nto_[i](1, 1) - invA_nn *math::sq( contactCache.diag_nto_[i](0, 1) ), offdiag, offdiag, contactCache.diag_nto_[i](2, 2) - invA_nn *math::sq( contactCache.diag_nto_[i](0, 2) ) );
-                                                                                                     Vec2 b_breve( -gdot_nto[1] + invA_nn * contactCache.diag_nto_[i](0, 1) * gdot_nto[0], -gdot_nto[2] + invA_nn * contactCache.diag_nto_[i](0, 2) * gdot_nto[0] );
-
-                                                const real_t shiftI( std::atan2( -contactCache.diag_nto_[i](0, 2), contactCache.diag_nto_[i](0, 1) ) );
-                                                                     const real_t shiftJ( std::atan2( -p_cf[2], p_cf[1] ) );
-                                  const real_t a3( std::sqrt(math::sq( contactCache.diag_nto_[i](0, 1) ) +math::sq( contactCache.diag_nto_[i](0, 2) ) ) );
-                                                                       const real_t fractionI( -contactCache.diag_nto_[i](0, 0) / ( contactCache.mu_[i] * a3 ) );
-                                                                       const real_t fractionJ( std::min( invA_nn * contactCache.mu_[i] * ( ( -gdot_nto[0] ) / std::sqrt( fsq ) - a3 * std::cos( shiftI - shiftJ ) ), real_c( 1 ) ) );
-
-                                                             // Search interval determination.
-                                                             real_t alpha_left, alpha_right;
-                                                   if( fractionJ < -1 ) {
-                                                      // J is complete
-                                                      const real_t angleI( std::acos( fractionI ) );
-                                                      alpha_left = -angleI - shiftI;
-                                                      alpha_right = +angleI - shiftI;
-                                                      if( alpha_left < 0 ) {
-                                                         alpha_left += 2 * math::M_PI;
-                                                         alpha_right += 2 * math::M_PI;
-                                                      }
+      // No need to apply zero impulse.
+   }
+   else {
+      // Contact is persisting (either static or dynamic).
+
+      // Calculate the impulse necessary for a static contact expressed as components in the contact frame.
+      Vec3 p_cf( -( contactCache.diag_nto_inv_[i] * gdot_nto ) );
+
+      // Can p_cf[0] be negative even though -gdot_nto[0] > 0? Yes! Try:
+      // A = [0.5 -0.1 +0.1; -0.1 0.5 -0.1; +0.1 -0.1 1];
+      // b = [0.01 -1 -1]';
+      // A\b    \approx [-0.19 -2.28 -1.21]'
+      // eig(A) \approx [ 0.40  0.56  1.04]'
+
+      real_t flimit( contactCache.mu_[i] * p_cf[0] );
+      real_t fsq( p_cf[1] * p_cf[1] + p_cf[2] * p_cf[2] );
+      if( fsq > flimit * flimit || p_cf[0] < 0 ) {
+         // Contact cannot be static so it must be dynamic.
+         // => Complementarity condition on normal reaction now turns into an equation since we know that the normal reaction is definitely not zero.
+
+         // \breve{x}^0 = p_cf[1..2]
+
+         // Eliminate normal component from 3x3 system: contactCache.diag_nto_[i]*p_cf + gdot_nto => \breve{A} \breve{x} - \breve{b}
+         const real_t invA_nn( math::inv( contactCache.diag_nto_[i](0, 0) ) );
+                               const real_t offdiag( contactCache.diag_nto_[i](1, 2) - invA_nn * contactCache.diag_nto_[i](0, 1) * contactCache.diag_nto_[i](0, 2) );
+                               Mat2 A_breve( contactCache.diag_nto_[i](1, 1) - invA_nn *math::sq( contactCache.diag_nto_[i](0, 1) ), offdiag, offdiag, contactCache.diag_nto_[i](2, 2) - invA_nn *math::sq( contactCache.diag_nto_[i](0, 2) ) );
+                                                                                                  Vec2 b_breve( -gdot_nto[1] + invA_nn * contactCache.diag_nto_[i](0, 1) * gdot_nto[0], -gdot_nto[2] + invA_nn * contactCache.diag_nto_[i](0, 2) * gdot_nto[0] );
+
+                                             const real_t shiftI( std::atan2( -contactCache.diag_nto_[i](0, 2), contactCache.diag_nto_[i](0, 1) ) );
+                                                                  const real_t shiftJ( std::atan2( -p_cf[2], p_cf[1] ) );
+                               const real_t a3( std::sqrt(math::sq( contactCache.diag_nto_[i](0, 1) ) +math::sq( contactCache.diag_nto_[i](0, 2) ) ) );
+                                                                    const real_t fractionI( -contactCache.diag_nto_[i](0, 0) / ( contactCache.mu_[i] * a3 ) );
+                                                                    const real_t fractionJ( std::min( invA_nn * contactCache.mu_[i] * ( ( -gdot_nto[0] ) / std::sqrt( fsq ) - a3 * std::cos( shiftI - shiftJ ) ), real_c( 1 ) ) );
+
+                                                          // Search interval determination.
+                                                          real_t alpha_left, alpha_right;
+                                                if( fractionJ < -1 ) {
+                                                   // J is complete
+                                                   const real_t angleI( std::acos( fractionI ) );
+                                                   alpha_left = -angleI - shiftI;
+                                                   alpha_right = +angleI - shiftI;
+                                                   if( alpha_left < 0 ) {
+                                                      alpha_left += 2 * math::M_PI;
+                                                      alpha_right += 2 * math::M_PI;
                                                    }
-                                                   else if( contactCache.diag_nto_[i](0, 0) > contactCache.mu_[i] * a3 ) {
-               // I is complete
-               const real_t angleJ( std::acos( fractionJ ) );
-               alpha_left = -angleJ - shiftJ;
-               alpha_right = +angleJ - shiftJ;
-               if( alpha_left < 0 ) {
-                  alpha_left += 2 * math::M_PI;
-                  alpha_right += 2 * math::M_PI;
-               }
+                                                }
+                                                else if( contactCache.diag_nto_[i](0, 0) > contactCache.mu_[i] * a3 ) {
+            // I is complete
+            const real_t angleJ( std::acos( fractionJ ) );
+            alpha_left = -angleJ - shiftJ;
+            alpha_right = +angleJ - shiftJ;
+            if( alpha_left < 0 ) {
+               alpha_left += 2 * math::M_PI;
+               alpha_right += 2 * math::M_PI;
+            }
+         }
+         else {
+            // neither I nor J is complete
+            const real_t angleJ( std::acos( fractionJ ) );
+            real_t alpha1_left( -angleJ - shiftJ );
+            real_t alpha1_right( +angleJ - shiftJ );
+            if( alpha1_left < 0 ) {
+               alpha1_left += 2 * math::M_PI;
+               alpha1_right += 2 * math::M_PI;
+            }
+            const real_t angleI( std::acos( fractionI ) );
+            real_t alpha2_left( -angleI - shiftI );
+            real_t alpha2_right( +angleI - shiftI );
+            if( alpha2_left < 0 ) {
+               alpha2_left += 2 * math::M_PI;
+               alpha2_right += 2 * math::M_PI;
             }
-            else {
-               // neither I nor J is complete
-               const real_t angleJ( std::acos( fractionJ ) );
-               real_t alpha1_left( -angleJ - shiftJ );
-               real_t alpha1_right( +angleJ - shiftJ );
-               if( alpha1_left < 0 ) {
-                  alpha1_left += 2 * math::M_PI;
-                  alpha1_right += 2 * math::M_PI;
-               }
-               const real_t angleI( std::acos( fractionI ) );
-               real_t alpha2_left( -angleI - shiftI );
-               real_t alpha2_right( +angleI - shiftI );
-               if( alpha2_left < 0 ) {
-                  alpha2_left += 2 * math::M_PI;
-                  alpha2_right += 2 * math::M_PI;
-               }
 
-               // Swap intervals if second interval does not start right of the first interval.
-               if( alpha1_left > alpha2_left ) {
-                  std::swap( alpha1_left, alpha2_left );
-                  std::swap( alpha1_right, alpha2_right );
-               }
+            // Swap intervals if second interval does not start right of the first interval.
+            if( alpha1_left > alpha2_left ) {
+               std::swap( alpha1_left, alpha2_left );
+               std::swap( alpha1_right, alpha2_right );
+            }
 
-               if( alpha2_left > alpha1_right ) {
-                  alpha2_right -= 2*math::M_PI;
-                  if( alpha2_right > alpha1_right ) {
-                     // [alpha1_left; alpha1_right] \subset [alpha2_left; alpha2_right]
-                  }
-                  else {
-                     // [alpha2_left; alpha2_right] intersects the left end of [alpha1_left; alpha1_right]
-                     alpha1_right = alpha2_right;
-                  }
+            if( alpha2_left > alpha1_right ) {
+               alpha2_right -= 2*math::M_PI;
+               if( alpha2_right > alpha1_right ) {
+                  // [alpha1_left; alpha1_right] \subset [alpha2_left; alpha2_right]
                }
                else {
-                  alpha1_left = alpha2_left;
-                  if( alpha2_right > alpha1_right ) {
-                     // [alpha2_left; alpha2_right] intersects the right end of [alpha1_left; alpha1_right]
-                  }
-                  else {
-                     // [alpha2_left; alpha2_right] \subset [alpha1_left; alpha1_right]
-                     alpha1_right = alpha2_right;
-                  }
+                  // [alpha2_left; alpha2_right] intersects the left end of [alpha1_left; alpha1_right]
+                  alpha1_right = alpha2_right;
+               }
+            }
+            else {
+               alpha1_left = alpha2_left;
+               if( alpha2_right > alpha1_right ) {
+                  // [alpha2_left; alpha2_right] intersects the right end of [alpha1_left; alpha1_right]
+               }
+               else {
+                  // [alpha2_left; alpha2_right] \subset [alpha1_left; alpha1_right]
+                  alpha1_right = alpha2_right;
                }
-
-               alpha_left = alpha1_left;
-               alpha_right = alpha1_right;
             }
 
-            const real_t phi( real_c(0.5) * ( real_c(1) + std::sqrt( real_c( 5 ) ) ) );
-                                                   real_t alpha_mid( ( alpha_right + alpha_left * phi ) / ( 1 + phi ) );
-                                  Vec2 x_mid;
-                  real_t f_mid;
+            alpha_left = alpha1_left;
+            alpha_right = alpha1_right;
+         }
 
-            {
-               real_t r_ub = contactCache.mu_[i] * ( -gdot_nto[0] ) / ( contactCache.diag_nto_[i](0, 0) + contactCache.mu_[i] * a3 * std::cos( alpha_mid + shiftI ) );
-                     if( r_ub < 0 )
-                     r_ub = math::Limits<real_t>::inf();
-               x_mid = Vec2( r_ub * std::cos( alpha_mid ), r_ub * std::sin( alpha_mid ) );
-               f_mid = real_c(0.5) * x_mid * ( A_breve * x_mid ) - x_mid * b_breve;
-            }
+         const real_t phi( real_c(0.5) * ( real_c(1) + std::sqrt( real_c( 5 ) ) ) );
+                                                real_t alpha_mid( ( alpha_right + alpha_left * phi ) / ( 1 + phi ) );
+                               Vec2 x_mid;
+               real_t f_mid;
 
-            bool leftlarger = false;
-            for( size_t k = 0; k < maxSubIterations_; ++k ) {
-               real_t alpha_next( alpha_left + ( alpha_right - alpha_mid ) );
-               real_t r_ub = contactCache.mu_[i] * ( -gdot_nto[0] ) / ( contactCache.diag_nto_[i](0, 0) + contactCache.mu_[i] * a3 * std::cos( alpha_next + shiftI ) );
-                     if( r_ub < 0 )
-                     r_ub = math::Limits<real_t>::inf();
-               Vec2 x_next( r_ub * std::cos( alpha_next ), r_ub * std::sin( alpha_next ) );
-               real_t f_next( real_c(0.5) * x_next * ( A_breve * x_next ) - x_next * b_breve );
-
-               //WALBERLA_LOG_WARNING( "[(" << alpha_left << ", ?); (" << alpha_mid << ", " << f_mid << "); (" << alpha_right << ", ?)] <- (" << alpha_next << ", " << f_next << ")" );
-               //WALBERLA_LOG_WARNING( "left: " << alpha_mid - alpha_left << "  right: " << alpha_right - alpha_mid << "  ll: " << leftlarger );
-               //WALBERLA_ASSERT(leftlarger ? (alpha_mid - alpha_left > alpha_right - alpha_mid) : (alpha_mid - alpha_left < alpha_right - alpha_mid), "ll inconsistent!" );
-
-               if (leftlarger) {
-                  // left interval larger
-                  if( f_next < f_mid ) {
-                     alpha_right = alpha_mid;
-                     alpha_mid   = alpha_next;
-                     x_mid       = x_next;
-                     f_mid       = f_next;
-                     leftlarger = true;
-                  }
-                  else {
-                     alpha_left  = alpha_next;
-                     leftlarger = false;
-                  }
+         {
+            real_t r_ub = contactCache.mu_[i] * ( -gdot_nto[0] ) / ( contactCache.diag_nto_[i](0, 0) + contactCache.mu_[i] * a3 * std::cos( alpha_mid + shiftI ) );
+                  if( r_ub < 0 )
+                  r_ub = math::Limits<real_t>::inf();
+            x_mid = Vec2( r_ub * std::cos( alpha_mid ), r_ub * std::sin( alpha_mid ) );
+            f_mid = real_c(0.5) * x_mid * ( A_breve * x_mid ) - x_mid * b_breve;
+         }
+
+         bool leftlarger = false;
+         for( size_t k = 0; k < maxSubIterations_; ++k ) {
+            real_t alpha_next( alpha_left + ( alpha_right - alpha_mid ) );
+            real_t r_ub = contactCache.mu_[i] * ( -gdot_nto[0] ) / ( contactCache.diag_nto_[i](0, 0) + contactCache.mu_[i] * a3 * std::cos( alpha_next + shiftI ) );
+                  if( r_ub < 0 )
+                  r_ub = math::Limits<real_t>::inf();
+            Vec2 x_next( r_ub * std::cos( alpha_next ), r_ub * std::sin( alpha_next ) );
+            real_t f_next( real_c(0.5) * x_next * ( A_breve * x_next ) - x_next * b_breve );
+
+            //WALBERLA_LOG_WARNING( "[(" << alpha_left << ", ?); (" << alpha_mid << ", " << f_mid << "); (" << alpha_right << ", ?)] <- (" << alpha_next << ", " << f_next << ")" );
+            //WALBERLA_LOG_WARNING( "left: " << alpha_mid - alpha_left << "  right: " << alpha_right - alpha_mid << "  ll: " << leftlarger );
+            //WALBERLA_ASSERT(leftlarger ? (alpha_mid - alpha_left > alpha_right - alpha_mid) : (alpha_mid - alpha_left < alpha_right - alpha_mid), "ll inconsistent!" );
+
+            if (leftlarger) {
+               // left interval larger
+               if( f_next < f_mid ) {
+                  alpha_right = alpha_mid;
+                  alpha_mid   = alpha_next;
+                  x_mid       = x_next;
+                  f_mid       = f_next;
+                  leftlarger = true;
                }
                else {
-                  // right interval larger
-                  if( f_next < f_mid ) {
-                     alpha_left = alpha_mid;
-                     alpha_mid  = alpha_next;
-                     x_mid      = x_next;
-                     f_mid      = f_next;
-                     leftlarger = false;
-                  }
-                  else {
-                     alpha_right = alpha_next;
-                     leftlarger = true;
-                  }
+                  alpha_left  = alpha_next;
+                  leftlarger = false;
                }
             }
-            //WALBERLA_LOG_DETAIL( "dalpha = " << alpha_right - alpha_left << "\n");
-            {
-               real_t alpha_init( std::atan2( p_cf[2], p_cf[1] ) );
-               real_t r_ub = contactCache.mu_[i] * ( -gdot_nto[0] ) / ( contactCache.diag_nto_[i](0, 0) + contactCache.mu_[i] * a3 * std::cos( alpha_init + shiftI ) );
-                     if( r_ub < 0 )
-                     r_ub = math::Limits<real_t>::inf();
-               Vec2 x_init( r_ub * std::cos( alpha_init ), r_ub * std::sin( alpha_init ) );
-               real_t f_init( real_c(0.5) * x_init * ( A_breve * x_init ) - x_init * b_breve );
-
-               if( f_init < f_mid )
-               {
-                  x_mid = x_init;
-                  WALBERLA_LOG_DETAIL( "Replacing solution by primitive dissipative solution (" << f_init << " < " << f_mid << " at " << alpha_init << " vs. " << alpha_mid << ").\n");
+            else {
+               // right interval larger
+               if( f_next < f_mid ) {
+                  alpha_left = alpha_mid;
+                  alpha_mid  = alpha_next;
+                  x_mid      = x_next;
+                  f_mid      = f_next;
+                  leftlarger = false;
+               }
+               else {
+                  alpha_right = alpha_next;
+                  leftlarger = true;
                }
             }
-
-            p_cf[0] = invA_nn * ( -gdot_nto[0] - contactCache.diag_nto_[i](0, 1) * x_mid[0] - contactCache.diag_nto_[i](0, 2) * x_mid[1] );
-            p_cf[1] = x_mid[0];
-            p_cf[2] = x_mid[1];
-            //WALBERLA_LOG_DETAIL( "Contact #" << i << " is dynamic." );
          }
-         else {
-            // Contact is static.
-            //WALBERLA_LOG_DETAIL( "Contact #" << i << " is static." );
+         //WALBERLA_LOG_DETAIL( "dalpha = " << alpha_right - alpha_left << "\n");
+         {
+            real_t alpha_init( std::atan2( p_cf[2], p_cf[1] ) );
+            real_t r_ub = contactCache.mu_[i] * ( -gdot_nto[0] ) / ( contactCache.diag_nto_[i](0, 0) + contactCache.mu_[i] * a3 * std::cos( alpha_init + shiftI ) );
+                  if( r_ub < 0 )
+                  r_ub = math::Limits<real_t>::inf();
+            Vec2 x_init( r_ub * std::cos( alpha_init ), r_ub * std::sin( alpha_init ) );
+            real_t f_init( real_c(0.5) * x_init * ( A_breve * x_init ) - x_init * b_breve );
+
+            if( f_init < f_mid )
+            {
+               x_mid = x_init;
+               WALBERLA_LOG_DETAIL( "Replacing solution by primitive dissipative solution (" << f_init << " < " << f_mid << " at " << alpha_init << " vs. " << alpha_mid << ").\n");
+            }
          }
-         Vec3 p_wf( contactframe * p_cf );
-         Vec3 dp( contactCache.p_[i] - p_wf );
-         delta_max = std::max( delta_max, std::max( std::abs( dp[0] ), std::max( std::abs( dp[1] ), std::abs( dp[2] ) ) ) );
-         //WALBERLA_LOG_DETAIL( "Contact reaction in contact frame: " << p_cf << "\nContact action in contact frame: " << contactCache.diag_nto_[i]*p_cf + gdot_nto );
-
-         contactCache.p_[i] = p_wf;
-
-         // Apply impulse right away
-         bodyCache.dv_[contactCache.body1_[i]->index_] += contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
-         bodyCache.dw_[contactCache.body1_[i]->index_] += contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
-         bodyCache.dv_[contactCache.body2_[i]->index_] -= contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
-         bodyCache.dw_[contactCache.body2_[i]->index_] -= contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
-      }
 
-#if 0
-      Vec3 gdot2   ( ( bodyCache.v_[contactCache.body1_[i]->index_] + bodyCache.dv_[contactCache.body1_[i]->index_] ) -
-            ( bodyCache.v_[contactCache.body2_[i]->index_] + bodyCache.dv_[contactCache.body2_[i]->index_] ) +
-            ( bodyCache.w_[contactCache.body1_[i]->index_] + bodyCache.dw_[contactCache.body1_[i]->index_] ) % contactCache.r1_[i] -
-            ( bodyCache.w_[contactCache.body2_[i]->index_] + bodyCache.dw_[contactCache.body2_[i]->index_] ) % contactCache.r2_[i] /* + diag_[i] * p */ );
-      Vec3 gdot_nto2( contactframe.getTranspose() * gdot2 );
-      WALBERLA_LOG_DETAIL( "gdot_n2 = " << gdot_nto2[0] );
-      WALBERLA_LOG_DETAIL( "gdot_t2 = " << gdot_nto2[1] );
-      WALBERLA_LOG_DETAIL( "gdot_o2 = " << gdot_nto2[2] );
-
-      gdot_nto2[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
-      WALBERLA_LOG_DETAIL( "gdot_n2' = " << gdot_nto2[0] << "\n");
-#endif
+         p_cf[0] = invA_nn * ( -gdot_nto[0] - contactCache.diag_nto_[i](0, 1) * x_mid[0] - contactCache.diag_nto_[i](0, 2) * x_mid[1] );
+         p_cf[1] = x_mid[0];
+         p_cf[2] = x_mid[1];
+         //WALBERLA_LOG_DETAIL( "Contact #" << i << " is dynamic." );
+      }
+      else {
+         // Contact is static.
+         //WALBERLA_LOG_DETAIL( "Contact #" << i << " is static." );
+      }
+      Vec3 p_wf( contactframe * p_cf );
+      Vec3 dp( contactCache.p_[i] - p_wf );
+      delta_max = std::max( delta_max, std::max( std::abs( dp[0] ), std::max( std::abs( dp[1] ), std::abs( dp[2] ) ) ) );
+      //WALBERLA_LOG_DETAIL( "Contact reaction in contact frame: " << p_cf << "\nContact action in contact frame: " << contactCache.diag_nto_[i]*p_cf + gdot_nto );
 
-      /*
-       * compare DEM time-step with NSCD iteration:
-       * - projections are the same
-       * - velocities are the same if we use an explicit Euler discretization for the velocity time integration
-       *
-      f_cf[0] = -stiffness * contactCache.dist_ - damping_n * gdot_n = -[(stiffness * dt) * contactCache.dist_ * dtinv + damping_n * gdot_n] = -foo * (gdot_n + contactCache.dist_ * dtinv) where foo = stiffness * dt = damping_n;
-      f_cf[1] = -damping_t * gdot_t                     = -damping_t * gdot_t;
-      f_cf[2] = -damping_t * gdot_o                     = -damping_t * gdot_o;
+      contactCache.p_[i] = p_wf;
 
-      or: f_cf = -diag(foo, damping_t, damping_t) * gdot_nto   (since gdot_nto[0] is modified)
-      vs. f_cf = -diaginv * gdot_nto in NSCD iteration
+      // Apply impulse right away
+      dv1 += contactCache.body1_[i]->getInvMass() * contactCache.p_[i];
+      dw1 += contactCache.body1_[i]->getInvInertia() * ( contactCache.r1_[i] % contactCache.p_[i] );
+      dv2 -= contactCache.body2_[i]->getInvMass() * contactCache.p_[i];
+      dw2 -= contactCache.body2_[i]->getInvInertia() * ( contactCache.r2_[i] % contactCache.p_[i] );
+   }
 
-      => The NSCD iteration is more or less a DEM time step where we choose the stiffness and damping parameters such that penetration is non-existent after a time step and contacts are truly static (tangential rel. vel. is zero) unless the friction force hits its limit
+#if 0
+   Vec3 gdot2   ( ( bodyCache.v_[contactCache.body1_[i]->index_] + dv1 ) -
+         ( bodyCache.v_[contactCache.body2_[i]->index_] + dv2 ) +
+         ( bodyCache.w_[contactCache.body1_[i]->index_] + dw1 ) % contactCache.r1_[i] -
+         ( bodyCache.w_[contactCache.body2_[i]->index_] + dw2 ) % contactCache.r2_[i] /* + diag_[i] * p */ );
+   Vec3 gdot_nto2( contactframe.getTranspose() * gdot2 );
+   WALBERLA_LOG_DETAIL( "gdot_n2 = " << gdot_nto2[0] );
+   WALBERLA_LOG_DETAIL( "gdot_t2 = " << gdot_nto2[1] );
+   WALBERLA_LOG_DETAIL( "gdot_o2 = " << gdot_nto2[2] );
 
-      f_cf[0] = std::max( 0, f_cf[0] );
+   gdot_nto2[0] += ( /* + trans( contactCache.n_[i] ) * ( contactCache.body1_[i]->getPosition() + contactCache.r1_[i] ) - ( contactCache.body2_[i]->getPosition() + contactCache.r2_[i] ) */ + contactCache.dist_[i] ) * dtinv;
+   WALBERLA_LOG_DETAIL( "gdot_n2' = " << gdot_nto2[0] << "\n");
+#endif
 
-      flimit = contactCache.mu_ * f_cf[0];
-      fsq = f_cf[1] * f_cf[1] + f_cf[2] * f_cf[2]
-      if( fsq > flimit * flimit ) {
-         f = flimit / sqrt( fsq );
-         f_cf[1] *= f;
-         f_cf[2] *= f;
-      }
+   /*
+    * compare DEM time-step with NSCD iteration:
+    * - projections are the same
+    * - velocities are the same if we use an explicit Euler discretization for the velocity time integration
+    *
+   f_cf[0] = -stiffness * contactCache.dist_ - damping_n * gdot_n = -[(stiffness * dt) * contactCache.dist_ * dtinv + damping_n * gdot_n] = -foo * (gdot_n + contactCache.dist_ * dtinv) where foo = stiffness * dt = damping_n;
+   f_cf[1] = -damping_t * gdot_t                     = -damping_t * gdot_t;
+   f_cf[2] = -damping_t * gdot_o                     = -damping_t * gdot_o;
+
+   or: f_cf = -diag(foo, damping_t, damping_t) * gdot_nto   (since gdot_nto[0] is modified)
+   vs. f_cf = -diaginv * gdot_nto in NSCD iteration
+
+   => The NSCD iteration is more or less a DEM time step where we choose the stiffness and damping parameters such that penetration is non-existent after a time step and contacts are truly static (tangential rel. vel. is zero) unless the friction force hits its limit
+
+   f_cf[0] = std::max( 0, f_cf[0] );
+
+   flimit = contactCache.mu_ * f_cf[0];
+   fsq = f_cf[1] * f_cf[1] + f_cf[2] * f_cf[2]
+   if( fsq > flimit * flimit ) {
+      f = flimit / sqrt( fsq );
+      f_cf[1] *= f;
+      f_cf[2] *= f;
+   }
 
-      f_wf = contactframe * f_cf;
+   f_wf = contactframe * f_cf;
 
-      b1->addForceAtPos(  f_wf, gpos );
-      b2->addForceAtPos( -f_wf, gpos );
-      */
-   }
+   b1->addForceAtPos(  f_wf, gpos );
+   b2->addForceAtPos( -f_wf, gpos );
+   */
 
    return delta_max;
 }
@@ -1877,11 +2180,34 @@ void configure( const Config::BlockHandle& config, pe::cr::HCSITS& cr )
       WALBERLA_ABORT("Unknown HCSITSRelaxationModel: " << HCSITSRelaxationModelStr);
    }
 
+   std::string HCSITSIterationSchemeStr = config.getParameter<std::string>("HCSITSIterationSchemeStr", "GaussSeidel" );
+   WALBERLA_LOG_INFO_ON_ROOT("HCSITSIterationSchemeStr: " << HCSITSIterationSchemeStr);
+
+   cr::HCSITS::IterationScheme HCSITSIterationScheme;
+   if (HCSITSIterationSchemeStr == "GaussSeidel")
+   {
+      HCSITSIterationScheme = cr::HCSITS::GaussSeidel;
+   } else if (HCSITSIterationSchemeStr == "ColoredGaussSeidel")
+   {
+      HCSITSIterationScheme = cr::HCSITS::ColoredGaussSeidel;
+   } else if (HCSITSIterationSchemeStr == "Jacobi")
+   {
+      HCSITSIterationScheme = cr::HCSITS::Jacobi;
+   } else
+   {
+      WALBERLA_ABORT("Unknown HCSITSIterationScheme: " << HCSITSIterationSchemeStr);
+   }
+
+   real_t HCSITSJacobiWeight = config.getParameter<real_t>("HCSITSJacobiWeight", real_t(0.5) );
+   WALBERLA_LOG_INFO_ON_ROOT("HCSITSJacobiWeight: " << HCSITSJacobiWeight);
+
    Vec3 globalLinearAcceleration = config.getParameter<Vec3>("globalLinearAcceleration", Vec3(0, 0, 0));
    WALBERLA_LOG_INFO_ON_ROOT("globalLinearAcceleration: " << globalLinearAcceleration);
 
    cr.setMaxIterations( uint_c(HCSITSmaxIterations) );
    cr.setRelaxationModel( HCSITSRelaxationModel );
+   cr.setIterationScheme( HCSITSIterationScheme );
+   cr.setJacobiWeight( HCSITSJacobiWeight );
    cr.setRelaxationParameter( HCSITSRelaxationParameter );
    cr.setErrorReductionParameter( HCSITSErrorReductionParameter );
    cr.setGlobalLinearAcceleration( globalLinearAcceleration );
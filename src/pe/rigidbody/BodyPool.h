@@ -0,0 +1,176 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file BodyPool.h
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "core/DataTypes.h"
+#include "core/NonCopyable.h"
+#include "core/debug/Debug.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <new>
+#include <vector>
+
+
+namespace walberla {
+namespace pe {
+
+
+
+//**********************************************************************************************************************
+/*! Process-wide pool for the memory of rigid bodies of type BodyT
+*
+* The memory is allocated in chunks of ChunkSize bodies. Freed slots are kept in a LIFO free list and handed out
+* again, hence bodies that are created and destroyed in every time step (migration and shadow copies during the
+* synchronization) reuse the same, recently touched memory and all bodies of a type are packed into a few contiguous
+* chunks instead of being scattered over the heap. This keeps the pointer chasing of the integration and contact
+* loops within a small memory range.
+*
+* Only allocations of exactly sizeof(BodyT) bytes are served from the pool, all others (e.g., derived types that
+* inherit a pooled operator new) are forwarded to the global operator new.
+*
+* The pool is thread-safe. It is never destroyed, so bodies may safely be released during static destruction.
+* Chunks are not returned to the system automatically, i.e., the memory held by the pool is determined by the peak
+* number of bodies. trim() releases all chunks in which no body is allocated (e.g., after most bodies of a simulation
+* have been removed).
+*/
+//**********************************************************************************************************************
+template< typename BodyT, std::size_t ChunkSize = 1024 >
+class BodyPool : private NonCopyable
+{
+public:
+
+   static BodyPool & instance()
+   {
+      static BodyPool * pool = new BodyPool();
+      return *pool;
+   }
+
+   void * allocate( std::size_t bytes )
+   {
+      if( bytes != sizeof(BodyT) )
+         return ::operator new( bytes );
+
+      std::lock_guard< std::mutex > lock( mutex_ );
+      if( freeList_.empty() )
+         addChunk();
+      void * ptr = freeList_.back();
+      freeList_.pop_back();
+      ++inUse_;
+      return ptr;
+   }
+
+   void deallocate( void * ptr, std::size_t bytes )
+   {
+      if( ptr == nullptr )
+         return;
+
+      if( bytes != sizeof(BodyT) )
+      {
+         ::operator delete( ptr );
+         return;
+      }
+
+      std::lock_guard< std::mutex > lock( mutex_ );
+      freeList_.push_back( ptr );
+      --inUse_;
+   }
+
+   /// Returns all chunks in which no body is allocated to the system. Returns the number of released chunks.
+   std::size_t trim()
+   {
+      std::lock_guard< std::mutex > lock( mutex_ );
+
+      std::sort( chunks_.begin(), chunks_.end(), std::less< char * >() );
+
+      std::vector< std::size_t > freeSlots( chunks_.size(), 0 );
+      for( auto ptr = freeList_.begin(); ptr != freeList_.end(); ++ptr )
+         ++freeSlots[ chunkIndex( *ptr ) ];
+
+      std::vector< bool > release( chunks_.size(), false );
+      for( std::size_t i = 0; i < chunks_.size(); ++i )
+         release[i] = ( freeSlots[i] == ChunkSize );
+
+      // keeps the LIFO order of the remaining free slots
+      std::vector< void * > freeList;
+      freeList.reserve( freeList_.size() );
+      for( auto ptr = freeList_.begin(); ptr != freeList_.end(); ++ptr )
+         if( !release[ chunkIndex( *ptr ) ] )
+            freeList.push_back( *ptr );
+      freeList_.swap( freeList );
+
+      std::vector< char * > chunks;
+      for( std::size_t i = 0; i < chunks_.size(); ++i )
+      {
+         if( release[i] )
+            ::operator delete( chunks_[i] );
+         else
+            chunks.push_back( chunks_[i] );
+      }
+
+      const std::size_t released = chunks_.size() - chunks.size();
+      chunks_.swap( chunks );
+      return released;
+   }
+
+   /// number of bodies currently allocated from the pool
+   std::size_t inUse() const { std::lock_guard< std::mutex > lock( mutex_ ); return inUse_; }
+   /// number of bodies the pool can hold without allocating a new chunk
+   std::size_t capacity() const { std::lock_guard< std::mutex > lock( mutex_ ); return chunks_.size() * ChunkSize; }
+
+private:
+
+   static_assert( alignof(BodyT) <= alignof(std::max_align_t), "BodyPool does not support over-aligned types" );
+
+   BodyPool() : inUse_( 0 ) {}
+
+   void addChunk()
+   {
+      char * chunk = static_cast< char * >( ::operator new( ChunkSize * sizeof(BodyT) ) );
+      chunks_.push_back( chunk );
+
+      // reversed order, so that the slots of a fresh chunk are handed out with ascending addresses
+      freeList_.reserve( freeList_.size() + ChunkSize );
+      for( std::size_t i = ChunkSize; i > 0; --i )
+         freeList_.push_back( chunk + ( i - 1 ) * sizeof(BodyT) );
+   }
+
+   /// index of the chunk that contains ptr, chunks_ must be sorted
+   std::size_t chunkIndex( const void * ptr ) const
+   {
+      const char * p = static_cast< const char * >( ptr );
+      auto chunk = std::upper_bound( chunks_.begin(), chunks_.end(), p, std::less< const char * >() );
+      WALBERLA_ASSERT( chunk != chunks_.begin() );
+      return std::size_t( chunk - chunks_.begin() ) - 1;
+   }
+
+   std::vector< char * > chunks_;
+   std::vector< void * > freeList_;
+   std::size_t           inUse_;
+
+   mutable std::mutex mutex_;
+};
+
+
+
+} // namespace pe
+} // namespace walberla
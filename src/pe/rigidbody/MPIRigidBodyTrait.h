@@ -21,6 +21,9 @@
 #pragma once
 
 #include "blockforest/BlockID.h"
+#include "core/math/Quaternion.h"
+#include "core/math/Vector3.h"
+#include "pe/Types.h"
 
 #include "Owner.h"
 
@@ -109,6 +112,19 @@ public:
    //@}
    //**********************************************************************************************
 
+   //** functions to store the last synchronized state ********************************************
+   /*!\name synchronization state functions */
+   //@{
+   inline void                 setSynchronizationState( const Vec3& gpos, const Quat& q, const Vec3& v, const Vec3& w );
+   inline void                 invalidateSynchronizationState();
+   inline bool                 hasSynchronizationState() const;
+   inline const Vec3&          getSynchronizedPosition()   const;
+   inline const Quat&          getSynchronizedQuaternion() const;
+   inline const Vec3&          getSynchronizedLinearVel()  const;
+   inline const Vec3&          getSynchronizedAngularVel() const;
+   //@}
+   //**********************************************************************************************
+
 private:
    //**Member variables****************************************************************************
    /*!\name Member variables */
@@ -116,6 +132,12 @@ private:
    ShadowOwners shadowOwners_;    //!< Vector of all processes the rigid body intersects with.
    BlockStates  blockStates_;
    Owner        owner_;    //!< Rank of the process owning the rigid body.
+
+   bool         syncStateValid_; //!< Whether all shadow copies received the synchronization state below.
+   Vec3         syncPos_;        //!< Global position sent with the last shadow copy update.
+   Quat         syncQ_;          //!< Orientation sent with the last shadow copy update.
+   Vec3         syncV_;          //!< Linear velocity sent with the last shadow copy update.
+   Vec3         syncW_;          //!< Angular velocity sent with the last shadow copy update.
    //@}
    //**********************************************************************************************
 };
@@ -128,7 +150,7 @@ private:
  * \param body The body ID of this rigid body.
  */
 inline MPIRigidBodyTrait::MPIRigidBodyTrait( )
-   : owner_( )
+   : owner_( ), syncStateValid_( false )
 {}
 //*************************************************************************************************
 
@@ -334,5 +356,54 @@ inline size_t MPIRigidBodyTrait::getBlockStateSize() const
    return blockStates_.size();
 }
 
+
+//*************************************************************************************************
+/*!\brief Stores the state that has been sent to all shadow copies of the rigid body.
+ *
+ * The synchronization state is used to send only the changed parts of the state in subsequent
+ * shadow copy updates (see RigidBodyDeltaUpdateNotification).
+ */
+inline void MPIRigidBodyTrait::setSynchronizationState( const Vec3& gpos, const Quat& q, const Vec3& v, const Vec3& w )
+{
+   syncStateValid_ = true;
+   syncPos_        = gpos;
+   syncQ_          = q;
+   syncV_          = v;
+   syncW_          = w;
+}
+
+//*************************************************************************************************
+/*!\brief Marks the synchronization state as unknown (the next update must contain the full state).
+ */
+inline void MPIRigidBodyTrait::invalidateSynchronizationState()
+{
+   syncStateValid_ = false;
+}
+
+inline bool MPIRigidBodyTrait::hasSynchronizationState() const
+{
+   return syncStateValid_;
+}
+
+inline const Vec3& MPIRigidBodyTrait::getSynchronizedPosition() const
+{
+   return syncPos_;
+}
+
+inline const Quat& MPIRigidBodyTrait::getSynchronizedQuaternion() const
+{
+   return syncQ_;
+}
+
+inline const Vec3& MPIRigidBodyTrait::getSynchronizedLinearVel() const
+{
+   return syncV_;
+}
+
+inline const Vec3& MPIRigidBodyTrait::getSynchronizedAngularVel() const
+{
+   return syncW_;
+}
+
 }  // namespace pe
 }  // namespace walberla
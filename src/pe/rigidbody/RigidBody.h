@@ -24,6 +24,7 @@
 #include "pe/Types.h"
 #include "pe/Config.h"
 #include "pe/ccd/HashGridsBodyTrait.h"
+#include "pe/cr/DEMBodyTrait.h"
 #include "pe/cr/HCSITSBodyTrait.h"
 #include "core/math/Matrix3.h"
 #include "core/math/Quaternion.h"
@@ -47,6 +48,7 @@ class Union;
  */
 class RigidBody : public ccd::HashGridsBodyTrait
                 , public cr::HCSITSBodyTrait
+                , public cr::DEMBodyTrait
                 , private NonCopyable
 {
 private:
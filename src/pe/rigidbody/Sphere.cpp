@@ -30,6 +30,7 @@
 #include <stdexcept>
 #include <cmath>
 #include <pe/Materials.h>
+#include <pe/rigidbody/BodyPool.h>
 #include <core/math/Matrix3.h>
 #include <core/debug/Debug.h>
 
@@ -122,6 +123,43 @@ Sphere::~Sphere()
 
 
 
+//=================================================================================================
+//
+//  MEMORY MANAGEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Allocates the memory of a sphere from the process-wide BodyPool.
+ *
+ * \param size The number of bytes to allocate.
+ * \return Pointer to the allocated memory.
+ *
+ * Spheres are allocated in contiguous chunks instead of individually on the heap. Derived classes
+ * (e.g. Squirmer) inherit this operator, their allocations are forwarded to the global operator new.
+ */
+void* Sphere::operator new( std::size_t size )
+{
+   return BodyPool<Sphere>::instance().allocate( size );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the memory of a sphere to the process-wide BodyPool.
+ *
+ * \param ptr Pointer to the memory of the sphere.
+ * \param size The size of the dynamic type of the destroyed object.
+ */
+void Sphere::operator delete( void* ptr, std::size_t size )
+{
+   BodyPool<Sphere>::instance().deallocate( ptr, size );
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  UTILITY FUNCTIONS
@@ -78,6 +78,14 @@ public:
    virtual ~Sphere();
    //@}
    //**********************************************************************************************
+
+   //**Memory management***************************************************************************
+   /*!\name Memory management */
+   //@{
+   static void* operator new   ( std::size_t size );
+   static void  operator delete( void* ptr, std::size_t size );
+   //@}
+   //**********************************************************************************************
    //**********************************************************************************************
 
 public:
@@ -26,6 +26,7 @@
 #include "pe/communication/ParseMessage.h"
 #include "pe/communication/DynamicMarshalling.h"
 #include "pe/communication/RigidBodyCopyNotification.h"
+#include "pe/communication/RigidBodyDeltaUpdateNotification.h"
 #include "pe/communication/RigidBodyDeletionNotification.h"
 #include "pe/communication/RigidBodyForceNotification.h"
 #include "pe/communication/RigidBodyMigrationNotification.h"
@@ -37,6 +38,7 @@
 #include "pe/communication/PackNotification.h"
 
 #include "RemoveAndNotify.h"
+#include "SyncSettings.h"
 
 #include "blockforest/BlockForest.h"
 #include "core/mpi/BufferSystem.h"
@@ -118,7 +120,10 @@ void generateSynchonizationMessages(mpi::BufferSystem& bs, const Block& block, B
 
                WALBERLA_LOG_DETAIL( "Sending update notification for body " << b->getSystemID() << " to process " << (nbProcess) );
 
-               packNotification(me, nbProcess, buffer, RigidBodyUpdateNotification( *b ));
+               if (deltaSynchronization)
+                  packNotification(me, nbProcess, buffer, RigidBodyDeltaUpdateNotification( *b ));
+               else
+                  packNotification(me, nbProcess, buffer, RigidBodyUpdateNotification( *b ));
             }
             else {
                mpi::SendBuffer& buffer( bs.sendBuffer(nbProcess.rank_) );
@@ -148,6 +153,9 @@ void generateSynchonizationMessages(mpi::BufferSystem& bs, const Block& block, B
          }
       }
 
+      // all shadow copies now have this state
+      b->MPITrait.setSynchronizationState( b->getPosition(), b->getQuaternion(), b->getLinearVel(), b->getAngularVel() );
+
       // Update remote processes (no intersections possible; (long-range) interactions only).
       // TODO iterate over all processes attached bodies are owned by (skipping nearest neighbors)
       // depending on registration send update or copy
@@ -303,6 +311,9 @@ void syncNextNeighbors( BlockForest& forest, BlockDataID storageID, WcTimingTree
       }
    }
    WALBERLA_LOG_DETAIL( "Parsing of body synchronization response ended." );
+
+   synchronizationBytesSent     += bs.getBytesSent();
+   synchronizationBytesReceived += bs.getBytesReceived();
    if (tt != NULL) tt->stop("Parsing Body Synchronization");
    if (tt != NULL) tt->stop("Sync");
 }
@@ -0,0 +1,32 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file SyncSettings.cpp
+//! \brief Settings and traffic counters of the rigid body synchronization
+//
+//======================================================================================================================
+
+#include "SyncSettings.h"
+
+namespace walberla {
+namespace pe {
+
+bool deltaSynchronization = false;
+
+uint64_t synchronizationBytesSent     = 0;
+uint64_t synchronizationBytesReceived = 0;
+
+}  // namespace pe
+}  // namespace walberla
@@ -0,0 +1,55 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file SyncSettings.h
+//! \brief Settings and traffic counters of the rigid body synchronization
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "core/DataTypes.h"
+
+namespace walberla {
+namespace pe {
+
+//=================================================================================================
+//
+//  GLOBAL SYNCHRONIZATION SETTINGS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+//! Delta encoded shadow copy updates in syncNextNeighbors and syncShadowOwners.
+/*! If enabled, only the parts of the state of a body (position, orientation, linear and angular
+    velocity) that changed since the last synchronization are sent to its shadow copies (see
+    communication::RigidBodyDeltaUpdateNotification). The encoding is lossless. Disabled by default. */
+extern bool deltaSynchronization;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+//! Number of bytes sent by syncNextNeighbors and syncShadowOwners on this process.
+extern uint64_t synchronizationBytesSent;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+//! Number of bytes received by syncNextNeighbors and syncShadowOwners on this process.
+extern uint64_t synchronizationBytesReceived;
+//*************************************************************************************************
+
+}  // namespace pe
+}  // namespace walberla
@@ -33,6 +33,7 @@
 #include "pe/communication/ParseMessage.h"
 #include "pe/communication/DynamicMarshalling.h"
 #include "pe/communication/RigidBodyCopyNotification.h"
+#include "pe/communication/RigidBodyDeltaUpdateNotification.h"
 #include "pe/communication/RigidBodyDeletionNotification.h"
 #include "pe/communication/RigidBodyForceNotification.h"
 #include "pe/communication/RigidBodyMigrationNotification.h"
@@ -44,6 +45,7 @@
 #include "pe/communication/PackNotification.h"
 
 #include "RemoveAndNotify.h"
+#include "SyncSettings.h"
 
 #include "core/timing/TimingTree.h"
 
@@ -118,8 +120,14 @@ void updateAndMigrate( BlockForest& forest, BlockDataID storageID, const bool sy
             WALBERLA_LOG_DETAIL( "Sending update notification for body " << b->getSystemID() << " to process " << (*it) );
             mpi::SendBuffer& sb = bs.sendBuffer(it->rank_);
             if (sb.isEmpty()) sb << walberla::uint8_c(0);
-            packNotification(me, *it, sb, RigidBodyUpdateNotification( *b ));
+            if (deltaSynchronization)
+               packNotification(me, *it, sb, RigidBodyDeltaUpdateNotification( *b ));
+            else
+               packNotification(me, *it, sb, RigidBodyUpdateNotification( *b ));
          }
+         // all shadow copies now have this state
+         b->MPITrait.setSynchronizationState( b->getPosition(), b->getQuaternion(), b->getLinearVel(), b->getAngularVel() );
+
          if (!blkAABB.contains( b->getPosition() ))
          {
             Owner owner( findContainingProcess( block, b->getPosition() ) );
@@ -202,6 +210,9 @@ void updateAndMigrate( BlockForest& forest, BlockDataID storageID, const bool sy
       }
    }
    WALBERLA_LOG_DETAIL( "Parsing of Update&Migrate ended." );
+
+   synchronizationBytesSent     += bs.getBytesSent();
+   synchronizationBytesReceived += bs.getBytesReceived();
 }
 
 template <typename BodyTypeTuple>
@@ -369,6 +380,9 @@ void checkAndResolveOverlap( BlockForest& forest, BlockDataID storageID, const r
       }
    }
    WALBERLA_LOG_DETAIL( "Parsing of Check&Resolve ended." );
+
+   synchronizationBytesSent     += bs.getBytesSent();
+   synchronizationBytesReceived += bs.getBytesReceived();
 }
 
 template <typename BodyTypeTuple>
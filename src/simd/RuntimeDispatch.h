@@ -0,0 +1,146 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file RuntimeDispatch.h
+//! \ingroup simd
+//! \brief Detection of the instruction sets supported by the executing CPU and macros for multi-versioned kernels
+//
+//======================================================================================================================
+
+#pragma once
+
+#include "waLBerlaDefinitions.h" // for WALBERLA_SIMD_FORCE_SCALAR and WALBERLA_CXX_COMPILER_IS_*
+
+#include <string>
+
+
+//===================================================================================================================
+//
+//  Multi-versioned kernels
+//
+//  The SIMD instruction set used by simd/SIMD.h is fixed at compile time. Kernels that are annotated with one of the
+//  following macros are additionally compiled for the given instruction set, independent of the compiler flags.
+//  The annotated function is 'flattened', i.e., all (inline) functions called by it are inlined and thereby also
+//  compiled for the respective instruction set. Hence, the usual pattern is:
+//
+//    void kernel( ... );                                                  // the actual implementation
+//    WALBERLA_SIMD_TARGET_AVX2   void kernelAVX2  ( ... ) { kernel( ... ); }
+//    WALBERLA_SIMD_TARGET_AVX512 void kernelAVX512( ... ) { kernel( ... ); }
+//
+//  The caller then selects the version at runtime using simd::bestAvailableInstructionSet(). OpenMP parallel regions must
+//  be opened by the caller (outside of the kernel), otherwise the outlined region is not compiled for the target.
+//  All macros are only defined if WALBERLA_SIMD_MULTIVERSIONING is defined.
+//
+//===================================================================================================================
+
+#if ( defined( __x86_64__ ) || defined( __i386__ ) ) && \
+    ( defined( WALBERLA_CXX_COMPILER_IS_GNU ) || defined( WALBERLA_CXX_COMPILER_IS_CLANG ) ) && \
+    !defined( WALBERLA_SIMD_FORCE_SCALAR )
+
+#define WALBERLA_SIMD_MULTIVERSIONING 1
+
+#define WALBERLA_SIMD_TARGET_AVX2   __attribute__(( target( "avx2,fma" ), flatten ))
+#define WALBERLA_SIMD_TARGET_AVX512 __attribute__(( target( "avx512f,avx2,fma" ), flatten ))
+
+#endif
+
+
+
+namespace walberla {
+namespace simd {
+
+
+
+/// Instruction sets for which multi-versioned kernels exist, ordered by capability. DEFAULT refers to the instruction
+/// set the code was compiled for (typically SSE2 on x86-64).
+enum InstructionSet { DEFAULT = 0, AVX2 = 1, AVX512 = 2 };
+
+inline std::string instructionSetToString( const InstructionSet is )
+{
+   switch( is )
+   {
+   case AVX2:
+      return "AVX2";
+   case AVX512:
+      return "AVX-512";
+   default:
+      return "default";
+   }
+}
+
+
+
+struct CpuFeatures
+{
+   bool sse2    = false;
+   bool sse4_2  = false;
+   bool avx     = false;
+   bool avx2    = false;
+   bool fma     = false;
+   bool avx512f = false;
+};
+
+namespace internal {
+
+inline CpuFeatures detectCpuFeatures()
+{
+   CpuFeatures features;
+#ifdef WALBERLA_SIMD_MULTIVERSIONING
+   __builtin_cpu_init();
+   features.sse2    = __builtin_cpu_supports( "sse2" )    != 0;
+   features.sse4_2  = __builtin_cpu_supports( "sse4.2" )  != 0;
+   features.avx     = __builtin_cpu_supports( "avx" )     != 0;
+   features.avx2    = __builtin_cpu_supports( "avx2" )    != 0;
+   features.fma     = __builtin_cpu_supports( "fma" )     != 0;
+   features.avx512f = __builtin_cpu_supports( "avx512f" ) != 0;
+#endif
+   return features;
+}
+
+} // namespace internal
+
+/// Features of the CPU the program is running on (detected once, at the first call)
+inline const CpuFeatures & cpuFeatures()
+{
+   static const CpuFeatures features = internal::detectCpuFeatures();
+   return features;
+}
+
+
+
+/// The most capable instruction set for which multi-versioned kernels exist and that is supported by the executing CPU
+inline InstructionSet bestAvailableInstructionSet()
+{
+#ifdef WALBERLA_SIMD_MULTIVERSIONING
+   const CpuFeatures & features = cpuFeatures();
+   if( features.avx512f && features.avx2 && features.fma )
+      return AVX512;
+   if( features.avx2 && features.fma )
+      return AVX2;
+#endif
+   return DEFAULT;
+}
+
+/// Returns 'requested' if supported by the executing CPU, otherwise the most capable supported instruction set below it
+inline InstructionSet supportedInstructionSet( const InstructionSet requested )
+{
+   const InstructionSet best = bestAvailableInstructionSet();
+   return ( requested < best ) ? requested : best;
+}
+
+
+
+} // namespace simd
+} // namespace walberla
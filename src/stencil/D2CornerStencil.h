@@ -74,6 +74,7 @@ namespace stencil {
          static const uint_t    idx           [NR_OF_DIRECTIONS];
          static const Direction d_per_d       [NR_OF_DIRECTIONS][4/2];
          static const uint_t    d_per_d_length[NR_OF_DIRECTIONS];
+         static const uint_t    d_per_d_mask  [NR_OF_DIRECTIONS];
 
          static const Direction dir_neighbors        [NR_OF_DIRECTIONS][NR_OF_DIRECTIONS];
          static const uint_t    dir_neighbors_length [NR_OF_DIRECTIONS];
@@ -191,6 +192,23 @@ namespace stencil {
       const uint_t D2CornerStencil<Dummy>::d_per_d_length [NR_OF_DIRECTIONS] = { 0,2,2,2,2,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 };
 
 
+      /**
+       * \brief Bit mask of the sub-directions contained in d_per_d
+       *
+       * Bit idx[subDirection] is set for every sub-direction of the given direction that is part of the stencil.
+       * For a lattice model, these are exactly the PDFs that have to be communicated to the neighbor in the
+       * given direction. A mask of zero means that nothing has to be sent in this direction at all.
+       *
+       \code
+       for( uint_t f = 0; f < Stencil::Size; ++f )
+          if( Stencil::d_per_d_mask[dir] & ( uint_t(1) << f ) )
+             // PDF f streams into direction dir
+       \endcode
+       */
+      template<typename Dummy>
+      const uint_t D2CornerStencil<Dummy>::d_per_d_mask [NR_OF_DIRECTIONS] = { 0x0,0x3,0xc,0x5,0xa,0x0,0x0,0x1,0x2,0x4,0x8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0 };
+
+
       /**
        * \brief Views directions as cells in a 3x3x3 grid. Describes neighborhood between cells/directions.
        *
@@ -74,6 +74,7 @@ namespace stencil {
          static const uint_t    idx           [NR_OF_DIRECTIONS];
          static const Direction d_per_d       [NR_OF_DIRECTIONS][9/2];
          static const uint_t    d_per_d_length[NR_OF_DIRECTIONS];
+         static const uint_t    d_per_d_mask  [NR_OF_DIRECTIONS];
 
          static const Direction dir_neighbors        [NR_OF_DIRECTIONS][NR_OF_DIRECTIONS];
          static const uint_t    dir_neighbors_length [NR_OF_DIRECTIONS];
@@ -191,6 +192,23 @@ namespace stencil {
       const uint_t D2Q9<Dummy>::d_per_d_length [NR_OF_DIRECTIONS] = { 1,3,3,3,3,0,0,1,1,1,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0 };
 
 
+      /**
+       * \brief Bit mask of the sub-directions contained in d_per_d
+       *
+       * Bit idx[subDirection] is set for every sub-direction of the given direction that is part of the stencil.
+       * For a lattice model, these are exactly the PDFs that have to be communicated to the neighbor in the
+       * given direction. A mask of zero means that nothing has to be sent in this direction at all.
+       *
+       \code
+       for( uint_t f = 0; f < Stencil::Size; ++f )
+          if( Stencil::d_per_d_mask[dir] & ( uint_t(1) << f ) )
+             // PDF f streams into direction dir
+       \endcode
+       */
+      template<typename Dummy>
+      const uint_t D2Q9<Dummy>::d_per_d_mask [NR_OF_DIRECTIONS] = { 0x1,0x62,0x184,0xa8,0x150,0x0,0x0,0x20,0x40,0x80,0x100,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0 };
+
+
       /**
        * \brief Views directions as cells in a 3x3x3 grid. Describes neighborhood between cells/directions.
        *
@@ -141,6 +141,7 @@ def generate_d_per_d (dirs):
     """ Generate d_per_d array from directions"""
     d_per_d = []
     d_per_d_length = []
+    d_per_d_mask = []
     
     for globalDir1 in directions:
         subdirs = []
@@ -150,8 +151,9 @@ def generate_d_per_d (dirs):
         
         d_per_d.append( "{" + ",".join(subdirs) + "}" )
         d_per_d_length.append( len(subdirs))
+        d_per_d_mask.append( "0x%x" % sum( 1 << dirs.index(d) for d in subdirs ) )
         
-    return (d_per_d,d_per_d_length)
+    return (d_per_d,d_per_d_length,d_per_d_mask)
     
 
 
@@ -260,9 +262,10 @@ for stencil in stencils:
     vals['D'] = stencil['dim']
     vals['Q'] = len(dirs)
     
-    (d_per_d,d_per_d_length) = generate_d_per_d(dirs)
+    (d_per_d,d_per_d_length,d_per_d_mask) = generate_d_per_d(dirs)
     vals['d_per_d'] = ",\n\t\t\t\t\t\t\t\t".join(d_per_d )
     vals['d_per_d_length'] = ",".join(str(i) for i in d_per_d_length)
+    vals['d_per_d_mask'] = ",".join(d_per_d_mask)
     vals['containsCenter'] = "true" if ('C' in dirs) else "false"
     vals['noCenterFirstIndex'] = "1" if ('C' in dirs) else '0'
 
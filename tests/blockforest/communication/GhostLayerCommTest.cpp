@@ -37,6 +37,7 @@
 
 #include "timeloop/SweepTimeloop.h"
 
+#include <cstring>
 #include <iostream>
 
 
@@ -187,6 +188,14 @@ int main(int argc, char **argv)
    auto mpiManager = MPIManager::instance();
    mpiManager->initializeMPI(&argc,&argv);
 
+   bool neighborCollectives = false;
+   bool sharedMemory = false;
+   for( int i = 1; i < argc; ++i )
+   {
+      if( std::strcmp( argv[i], "--neighborCollectives" ) == 0 ) neighborCollectives = true;
+      if( std::strcmp( argv[i], "--sharedMemory" ) == 0 )        sharedMemory = true;
+   }
+
    const uint_t cells [] = { 5,2,7 };
    const uint_t blockCount [] = { uint_c( mpiManager->numProcesses() ), 1, 1 };
    const uint_t nrOfTimeSteps = 30;
@@ -256,6 +265,8 @@ int main(int argc, char **argv)
    // small local fields
    blockforest::communication::UniformBufferedScheme<stencil::D3Q19> scheme(blocks);
    scheme.addPackInfo( make_shared<field::communication::PackInfo< PdfField > >(srcField) );
+   scheme.useNeighborCollectives( neighborCollectives );
+   scheme.useSharedMemory( sharedMemory );
 
    timeLoop.add() << BeforeFunction( scheme )
                   << Sweep ( StreamingSweep<stencil::D3Q19>( srcField, dstField ) );
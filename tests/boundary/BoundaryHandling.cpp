@@ -658,6 +658,19 @@ static int main( int argc, char **argv )
    WALBERLA_CHECK_EQUAL( copyBC.getBeforeCounter(), 3 );
    WALBERLA_CHECK_EQUAL( copyBC.getAfterCounter(), 3 );
 
+   // perform boundary handling - two disjoint sub-intervals (links are taken from the cached link lists)
+
+   boundarySweep( flagField_Ref, workField_Ref, factorField_Ref, near, copy1, copy2, add );
+   handling( CellInterval( cell_idx_c(0), cell_idx_c(0), cell_idx_c(0), cell_idx_c(4), cell_idx_c(4), cell_idx_c(7) ) );
+   handling( CellInterval( cell_idx_c(5), cell_idx_c(0), cell_idx_c(0), cell_idx_c(9), cell_idx_c(4), cell_idx_c(7) ) );
+
+   WALBERLA_CHECK_EQUAL( flagField_Ref, flagField_BH );
+   WALBERLA_CHECK_EQUAL( workField_Ref, workField_BH );
+   WALBERLA_CHECK_EQUAL( factorField_Ref, addBC.getFactorField() );
+
+   WALBERLA_CHECK_EQUAL( copyBC.getBeforeCounter(), 3 );
+   WALBERLA_CHECK_EQUAL( copyBC.getAfterCounter(), 3 );
+
    // forceBoundary - x,y,z
 
    cell = Cell(4,0,5);
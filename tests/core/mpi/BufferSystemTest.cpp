@@ -25,6 +25,7 @@
 #include "core/logging/Logging.h"
 #include "core/mpi/BufferSystem.h"
 #include "core/mpi/Environment.h"
+#include "core/mpi/OpenMPBufferSystem.h"
 
 #include <random>
 
@@ -37,6 +38,7 @@
 
 using namespace walberla;
 using mpi::BufferSystem;
+using mpi::OpenMPBufferSystem;
 using namespace std::literals::chrono_literals;
 
 
@@ -324,6 +326,421 @@ void selfSend()
    }
 }
 
+
+
+/**
+ * Sparse communication where the receivers do not know their senders
+ *    in every step, each process sends to a pseudo-random, step dependent subset of all processes (possibly including
+ *    itself). The message contains the sender rank and the step, its size depends on sender, receiver, and step.
+ */
+bool isSending( int sender, int receiver, uint_t step )
+{
+   return ( uint_c( sender * 7 + receiver * 3 ) + step * 5 ) % 4 == 0;
+}
+
+uint_t messageSize( int sender, int receiver, uint_t step )
+{
+   return ( uint_c( sender + receiver * 11 ) * step ) % 13 + 1;
+}
+
+void unknownSendersCommunication()
+{
+   int rank          = MPIManager::instance()->worldRank();
+   int numProcesses  = MPIManager::instance()->numProcesses();
+
+   BufferSystem bs( MPI_COMM_WORLD, 17 );
+   bs.setReceiverInfoUnknownSenders();
+   WALBERLA_CHECK( bs.areSendersUnknown() );
+
+   const uint_t NUM_STEPS = 8;
+   for ( uint_t step = 1; step <= NUM_STEPS; ++step )
+   {
+      for( int receiver = 0; receiver < numProcesses; ++receiver )
+      {
+         if( !isSending( rank, receiver, step ) )
+            continue;
+
+         bs.sendBuffer( receiver ) << rank << step;
+         for( uint_t i = 0; i < messageSize( rank, receiver, step ); ++i )
+            bs.sendBuffer( receiver ) << i;
+      }
+
+      if( step % 3 == 0 )
+         randomSleep();
+
+      bs.sendAll();
+
+      std::set<int> senders;
+      for( auto it = bs.begin(); it != bs.end(); ++it )
+      {
+         WALBERLA_CHECK( isSending( it.rank(), rank, step ) ); // unexpected sender
+         WALBERLA_CHECK( senders.insert( it.rank() ).second ); // sender received twice
+
+         int sender = -1;
+         uint_t receivedStep = 0;
+         it.buffer() >> sender >> receivedStep;
+         WALBERLA_CHECK_EQUAL( sender, it.rank() );
+         WALBERLA_CHECK_EQUAL( receivedStep, step );
+
+         for( uint_t i = 0; i < messageSize( it.rank(), rank, step ); ++i )
+         {
+            uint_t value = 0;
+            it.buffer() >> value;
+            WALBERLA_CHECK_EQUAL( value, i );
+         }
+         WALBERLA_CHECK( it.buffer().isEmpty() );
+      }
+      WALBERLA_CHECK( ! bs.isCommunciationRunning() );
+
+      for( int sender = 0; sender < numProcesses; ++sender )
+         WALBERLA_CHECK_EQUAL( isSending( sender, rank, step ), senders.find( sender ) != senders.end() );
+   }
+
+   // switching back to known senders
+   bs.setReceiverInfo( BufferSystem::allRanks(), true );
+   WALBERLA_CHECK( ! bs.areSendersUnknown() );
+   for( int receiver = 0; receiver < numProcesses; ++receiver )
+      bs.sendBuffer( receiver ) << rank;
+   bs.sendAll();
+   int numReceived = 0;
+   for( auto it = bs.begin(); it != bs.end(); ++it )
+   {
+      int received = -1;
+      it.buffer() >> received;
+      WALBERLA_CHECK_EQUAL( received, it.rank() );
+      ++numReceived;
+   }
+   WALBERLA_CHECK_EQUAL( numReceived, numProcesses );
+}
+
+
+
+/**
+ * Known size communication using persistent requests
+ *    every process sends to its neighbors (1D, periodic boundary) for several steps, message sizes are constant
+ *    except for one step where they change (-> requests must be recreated)
+ */
+void persistentCommunication()
+{
+   auto mpiManager = MPIManager::instance();
+
+   int numProcesses  = mpiManager->numProcesses();
+   int rank          = mpiManager->worldRank();
+   int leftNeighbor  = (rank-1+numProcesses)  % numProcesses;
+   int rightNeighbor = (rank+1) % numProcesses;
+
+   BufferSystem bs ( MPI_COMM_WORLD, 23 );
+   bs.usePersistentRequests( true );
+   WALBERLA_CHECK( bs.persistentRequestsUsed() );
+
+   std::set<mpi::MPIRank> neighbors;
+   neighbors.insert( leftNeighbor );
+   neighbors.insert( rightNeighbor );
+   bs.setReceiverInfo( neighbors, false );
+
+   const uint_t NUM_STEPS = 6;
+   for ( uint_t step = 1; step <= NUM_STEPS; ++step )
+   {
+      const uint_t msgSize = ( step <= 3 ) ? uint_t(10) : uint_t(20);
+      if( step == 4 )
+         bs.sizeHasChanged();
+
+      // sizes are only communicated in the first step and after the size has changed
+      WALBERLA_CHECK_EQUAL( bs.isSizeCommunicatedInNextStep(), step == 1 || step == 4 );
+
+      for( uint_t i = 0; i < msgSize; ++i )
+      {
+         bs.sendBuffer( leftNeighbor  ) << rank << step << i;
+         bs.sendBuffer( rightNeighbor ) << rank << step << i;
+      }
+      bs.sendAll();
+
+      int numReceived = 0;
+      for( auto it = bs.begin(); it != bs.end(); ++it )
+      {
+         WALBERLA_CHECK( it.rank() == leftNeighbor || it.rank() == rightNeighbor );
+         for( uint_t i = 0; i < msgSize; ++i )
+         {
+            int sender = -1;
+            uint_t receivedStep = 0;
+            uint_t value = 0;
+            it.buffer() >> sender >> receivedStep >> value;
+            WALBERLA_CHECK_EQUAL( sender, it.rank() );
+            WALBERLA_CHECK_EQUAL( receivedStep, step );
+            WALBERLA_CHECK_EQUAL( value, i );
+         }
+         WALBERLA_CHECK( it.buffer().isEmpty() );
+         ++numReceived;
+      }
+      WALBERLA_CHECK_EQUAL( numReceived, int_c( neighbors.size() ) );
+   }
+}
+
+
+
+/**
+ * Communication using neighborhood collectives
+ *    every process sends to its neighbors (1D, periodic boundary), first with constant message sizes
+ *    (except for one step where they change), then with changing message sizes. Finally, the neighborhood is
+ *    changed (the process itself is added -> graph communicator must be recreated)
+ */
+void neighborCollectiveCommunication()
+{
+   auto mpiManager = MPIManager::instance();
+
+   int numProcesses  = mpiManager->numProcesses();
+   int rank          = mpiManager->worldRank();
+   int leftNeighbor  = (rank-1+numProcesses)  % numProcesses;
+   int rightNeighbor = (rank+1) % numProcesses;
+
+   BufferSystem bs ( MPI_COMM_WORLD, 24 );
+   bs.useNeighborCollectives( true );
+   WALBERLA_CHECK( bs.neighborCollectivesUsed() );
+
+   std::set<mpi::MPIRank> neighbors;
+   neighbors.insert( leftNeighbor );
+   neighbors.insert( rightNeighbor );
+   bs.setReceiverInfo( neighbors, false );
+
+   const uint_t NUM_STEPS = 9;
+   for ( uint_t step = 1; step <= NUM_STEPS; ++step )
+   {
+      uint_t msgSize = ( step <= 3 ) ? uint_t(10) : uint_t(20);
+      if( step == 4 )
+         bs.sizeHasChanged();
+      if( step == 6 )
+         bs.setReceiverInfo( neighbors, true );
+      if( step >= 6 )
+         msgSize = step + uint_c( rank );
+      if( step == 8 )
+      {
+         neighbors.insert( rank );
+         bs.setReceiverInfo( neighbors.begin(), neighbors.end(), true );
+      }
+
+      WALBERLA_CHECK_EQUAL( bs.isSizeCommunicatedInNextStep(), step == 1 || step == 4 || step >= 6 );
+
+      for( auto neighbor = neighbors.begin(); neighbor != neighbors.end(); ++neighbor )
+         for( uint_t i = 0; i < msgSize; ++i )
+            bs.sendBuffer( *neighbor ) << rank << step << i;
+      bs.sendAll();
+
+      int numReceived = 0;
+      for( auto it = bs.begin(); it != bs.end(); ++it )
+      {
+         WALBERLA_CHECK( neighbors.find( it.rank() ) != neighbors.end() );
+         const uint_t expectedSize = ( step >= 6 ) ? step + uint_c( it.rank() ) : msgSize;
+         for( uint_t i = 0; i < expectedSize; ++i )
+         {
+            int sender = -1;
+            uint_t receivedStep = 0;
+            uint_t value = 0;
+            it.buffer() >> sender >> receivedStep >> value;
+            WALBERLA_CHECK_EQUAL( sender, it.rank() );
+            WALBERLA_CHECK_EQUAL( receivedStep, step );
+            WALBERLA_CHECK_EQUAL( value, i );
+         }
+         WALBERLA_CHECK( it.buffer().isEmpty() );
+         ++numReceived;
+      }
+      WALBERLA_CHECK_EQUAL( numReceived, int_c( neighbors.size() ) );
+   }
+
+   WALBERLA_CHECK_GREATER( bs.getBytesSent(), 0 );
+   WALBERLA_CHECK_GREATER( bs.getBytesReceived(), 0 );
+}
+
+
+/**
+ * Exchange of messages within a node via shared memory: every process sends to its right neighbor (and in later
+ * steps also to itself) and receives from its left neighbor, the message sizes grow so that the window is reallocated
+ */
+void sharedMemoryCommunication()
+{
+   auto mpiManager = MPIManager::instance();
+
+   int numProcesses  = mpiManager->numProcesses();
+   int rank          = mpiManager->worldRank();
+   int leftNeighbor  = (rank-1+numProcesses)  % numProcesses;
+   int rightNeighbor = (rank+1) % numProcesses;
+
+   BufferSystem bs ( MPI_COMM_WORLD, 25 );
+   bs.useSharedMemory( true );
+   WALBERLA_CHECK( bs.sharedMemoryUsed() );
+
+   std::set<mpi::MPIRank> senders;
+   senders.insert( leftNeighbor );
+   bs.setReceiverInfo( senders, false );
+
+   const uint_t NUM_STEPS = 8;
+   for ( uint_t step = 1; step <= NUM_STEPS; ++step )
+   {
+      uint_t msgSize = ( step <= 3 ) ? uint_t(10) : uint_t(1000);
+      if( step == 4 )
+         bs.sizeHasChanged();
+      if( step >= 6 )
+      {
+         msgSize = step * 1000 + uint_c( rank );
+         senders.insert( rank );
+         bs.setReceiverInfo( senders, true );
+      }
+
+      WALBERLA_CHECK_EQUAL( bs.isSizeCommunicatedInNextStep(), step == 1 || step == 4 || step >= 6 );
+
+      for( uint_t i = 0; i < msgSize; ++i )
+         bs.sendBuffer( rightNeighbor ) << rank << step << i;
+      if( step >= 6 )
+         for( uint_t i = 0; i < msgSize; ++i )
+            bs.sendBuffer( rank ) << rank << step << i;
+      bs.sendAll();
+
+      int numReceived = 0;
+      for( auto it = bs.begin(); it != bs.end(); ++it )
+      {
+         WALBERLA_CHECK( senders.find( it.rank() ) != senders.end() );
+         const uint_t expectedSize = ( step >= 6 ) ? step * 1000 + uint_c( it.rank() ) : msgSize;
+         for( uint_t i = 0; i < expectedSize; ++i )
+         {
+            int sender = -1;
+            uint_t receivedStep = 0;
+            uint_t value = 0;
+            it.buffer() >> sender >> receivedStep >> value;
+            WALBERLA_CHECK_EQUAL( sender, it.rank() );
+            WALBERLA_CHECK_EQUAL( receivedStep, step );
+            WALBERLA_CHECK_EQUAL( value, i );
+         }
+         WALBERLA_CHECK( it.buffer().isEmpty() );
+         ++numReceived;
+      }
+      WALBERLA_CHECK_EQUAL( numReceived, int_c( senders.size() ) );
+   }
+
+   WALBERLA_CHECK_GREATER( bs.getBytesSent(), 0 );
+   WALBERLA_CHECK_GREATER( bs.getBytesReceived(), 0 );
+}
+
+
+/**
+ * OpenMPBufferSystem: packing and unpacking functions for the neighbors (1D, periodic boundary),
+ * with MPI calls from all threads or only from the master thread
+ */
+void openMPCommunication( const bool funneled )
+{
+   auto mpiManager = MPIManager::instance();
+
+   int numProcesses  = mpiManager->numProcesses();
+   int rank          = mpiManager->worldRank();
+   int leftNeighbor  = (rank-1+numProcesses)  % numProcesses;
+   int rightNeighbor = (rank+1) % numProcesses;
+
+   const uint_t MSG_SIZE = 10;
+
+   OpenMPBufferSystem bs( MPI_COMM_WORLD, 31 );
+   bs.enforceFunneledMPI( funneled );
+   WALBERLA_CHECK( !funneled || bs.funneledMPI() );
+
+   uint_t step = 0;
+   std::map< mpi::MPIRank, uint_t > receivedSteps;
+   receivedSteps[ leftNeighbor  ] = 0;
+   receivedSteps[ rightNeighbor ] = 0;
+
+   for( auto neighbor = receivedSteps.begin(); neighbor != receivedSteps.end(); ++neighbor )
+   {
+      bs.addSendingFunction( neighbor->first, [&]( mpi::SendBuffer & buffer ) {
+         for( uint_t i = 0; i < MSG_SIZE; ++i )
+            buffer << rank << step << i;
+      } );
+
+      const mpi::MPIRank sender = neighbor->first;
+      uint_t * receivedStep = &( neighbor->second ); // every receiving function only writes its own entry
+      bs.addReceivingFunction( sender, [=]( mpi::RecvBuffer & buffer ) {
+         for( uint_t i = 0; i < MSG_SIZE; ++i )
+         {
+            int senderRank = -1;
+            uint_t value = 0;
+            buffer >> senderRank >> *receivedStep >> value;
+            WALBERLA_CHECK_EQUAL( senderRank, sender );
+            WALBERLA_CHECK_EQUAL( value, i );
+         }
+         WALBERLA_CHECK( buffer.isEmpty() );
+      } );
+   }
+   bs.setReceiverInfo( false );
+
+   for( step = 1; step <= 3; ++step )
+   {
+      bs.startCommunication();
+      bs.wait();
+
+      for( auto neighbor = receivedSteps.begin(); neighbor != receivedSteps.end(); ++neighbor )
+         WALBERLA_CHECK_EQUAL( neighbor->second, step );
+   }
+}
+
+
+/**
+ * OpenMPBufferSystem with neighborhood collectives: every process exchanges messages with its neighbors
+ * (1D, periodic boundary), then the process itself is added as communication partner (-> the graph communicator
+ * must be recreated when the buffer system is set up again)
+ */
+void openMPNeighborCollectiveCommunication()
+{
+   auto mpiManager = MPIManager::instance();
+
+   int numProcesses  = mpiManager->numProcesses();
+   int rank          = mpiManager->worldRank();
+   int leftNeighbor  = (rank-1+numProcesses)  % numProcesses;
+   int rightNeighbor = (rank+1) % numProcesses;
+
+   const uint_t MSG_SIZE = 10;
+
+   OpenMPBufferSystem bs( MPI_COMM_WORLD, 32 );
+   bs.useNeighborCollectives( true );
+   WALBERLA_CHECK( bs.neighborCollectivesUsed() );
+
+   uint_t step = 0;
+   std::map< mpi::MPIRank, uint_t > receivedSteps;
+
+   auto addPartner = [&]( const mpi::MPIRank partner )
+   {
+      receivedSteps[ partner ] = 0;
+      bs.addSendingFunction( partner, [&]( mpi::SendBuffer & buffer ) {
+         for( uint_t i = 0; i < MSG_SIZE; ++i )
+            buffer << rank << step << i;
+      } );
+      uint_t * receivedStep = &( receivedSteps[ partner ] ); // every receiving function only writes its own entry
+      bs.addReceivingFunction( partner, [=]( mpi::RecvBuffer & buffer ) {
+         for( uint_t i = 0; i < MSG_SIZE; ++i )
+         {
+            int senderRank = -1;
+            uint_t value = 0;
+            buffer >> senderRank >> *receivedStep >> value;
+            WALBERLA_CHECK_EQUAL( senderRank, partner );
+            WALBERLA_CHECK_EQUAL( value, i );
+         }
+         WALBERLA_CHECK( buffer.isEmpty() );
+      } );
+   };
+
+   addPartner( leftNeighbor );
+   addPartner( rightNeighbor );
+   bs.setReceiverInfo( false );
+
+   for( step = 1; step <= 4; ++step )
+   {
+      if( step == 3 )
+         addPartner( rank );
+
+      bs.startCommunication();
+      bs.wait();
+
+      WALBERLA_CHECK_EQUAL( receivedSteps.size(), ( step <= 2 ) ? size_t(2) : size_t(3) );
+      for( auto partner = receivedSteps.begin(); partner != receivedSteps.end(); ++partner )
+         WALBERLA_CHECK_EQUAL( partner->second, step );
+   }
+}
+
+
 void copyTest()
 {
    int rank = MPIManager::instance()->worldRank();
@@ -389,5 +806,24 @@ int main(int argc, char**argv)
    WALBERLA_LOG_INFO_ON_ROOT("Testing Buffer System copy...");
    copyTest();
 
+   WALBERLA_LOG_INFO_ON_ROOT("Testing Communication with unknown senders...");
+   unknownSendersCommunication();
+
+   WALBERLA_LOG_INFO_ON_ROOT("Testing Communication with persistent requests...");
+   persistentCommunication();
+
+   WALBERLA_LOG_INFO_ON_ROOT("Testing Communication with neighborhood collectives...");
+   neighborCollectiveCommunication();
+
+   WALBERLA_LOG_INFO_ON_ROOT("Testing Communication via shared memory...");
+   sharedMemoryCommunication();
+
+   WALBERLA_LOG_INFO_ON_ROOT("Testing OpenMP Buffer System...");
+   openMPCommunication( false );
+   openMPCommunication( true );
+
+   WALBERLA_LOG_INFO_ON_ROOT("Testing OpenMP Buffer System with neighborhood collectives...");
+   openMPNeighborCollectiveCommunication();
+
    return EXIT_SUCCESS;
 }
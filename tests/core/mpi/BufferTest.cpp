@@ -33,6 +33,7 @@
 #include "core/math/Matrix3.h"
 #include "core/math/Vector3.h"
 #include "core/mpi/BufferDataTypeExtensions.h"
+#include "core/mpi/BufferPool.h"
 #include "core/mpi/RecvBuffer.h"
 #include "core/mpi/SendBuffer.h"
 
@@ -342,6 +343,74 @@ void bufferOverwriteTest()
 }
 
 
+void bufferPoolTest()
+{
+   BufferPool & pool = BufferPool::instance();
+   pool.releaseCachedMemory();
+
+   // fill a buffer once, so that the memory of all size classes it passes through is cached
+   {
+      SendBuffer sb;
+      for( int i = 0; i < 10000; ++i )
+         sb << i;
+   }
+   WALBERLA_CHECK_GREATER( pool.bytesCached(), size_t(0) );
+
+   // steady state: a buffer of the same size is filled again from recycled memory only
+   pool.resetStatistics();
+   const size_t bytesInUse = pool.bytesInUse();
+   {
+      SendBuffer sb;
+      for( int i = 0; i < 10000; ++i )
+         sb << i;
+
+      RecvBuffer rb( sb );
+      WALBERLA_CHECK_GREATER_EQUAL( pool.peakBytesInUse(), bytesInUse + rb.size() );
+      for( int i = 0; i < 10000; ++i )
+      {
+         int value;
+         rb >> value;
+         WALBERLA_CHECK_EQUAL( value, i );
+      }
+   }
+   WALBERLA_CHECK_GREATER( pool.numAllocations(), uint64_t(0) );
+   WALBERLA_CHECK_EQUAL( pool.numReuses(), pool.numAllocations() );
+   WALBERLA_CHECK_GREATER( pool.numReallocations(), uint64_t(0) );
+   WALBERLA_CHECK_EQUAL( pool.bytesInUse(), bytesInUse );
+
+   // a reserved buffer never has to copy its content
+   pool.resetStatistics();
+   {
+      SendBuffer sb;
+      sb.reserve( 10000 * sizeof(int) );
+      for( int i = 0; i < 10000; ++i )
+         sb << i;
+   }
+   WALBERLA_CHECK_EQUAL( pool.numReallocations(), uint64_t(0) );
+   WALBERLA_CHECK_EQUAL( pool.bytesCopied(), uint64_t(0) );
+
+   // without pooling, memory is returned to the system immediately
+   pool.enablePooling( false );
+   WALBERLA_CHECK_EQUAL( pool.bytesCached(), size_t(0) );
+   {
+      RecvBuffer rb;
+      rb.resize( 100 );
+      WALBERLA_CHECK_EQUAL( rb.capacity(), size_t(100) );
+   }
+   WALBERLA_CHECK_EQUAL( pool.bytesCached(), size_t(0) );
+   pool.enablePooling( true );
+
+   pool.useHugePages( true );
+   {
+      RecvBuffer rb;
+      rb.resize( size_t(4) << 20 );
+      std::memset( rb.ptr(), 0, rb.size() );
+   }
+   pool.useHugePages( false );
+   WALBERLA_CHECK_EQUAL( pool.bytesInUse(), bytesInUse );
+}
+
+
 int main()
 {
    debug::enterTestMode();
@@ -358,6 +427,8 @@ int main()
 
    bufferOverwriteTest();
 
+   bufferPoolTest();
+
    return 0;
 }
 
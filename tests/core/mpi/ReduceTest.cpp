@@ -131,6 +131,49 @@ void runTestAllReduce()
    }
 }
 
+void runTestAllReduceAsync()
+{
+   using namespace walberla;
+
+   const int rank = walberla::MPIManager::instance()->rank();
+   const int numProcesses = walberla::MPIManager::instance()->numProcesses();
+
+   int sum = 0;
+   for( int i = 0; i < numProcesses; ++i )
+      sum += i;
+
+   double value = double_c( rank );
+   auto scalar = walberla::mpi::allReduceAsync( value, walberla::mpi::SUM );
+   value = -1.0; // the future works on its own copy
+
+   std::vector<int> some_ints( 100 );
+   for( int i = 0; i < 100; ++i )
+      some_ints[ uint_c(i) ] = rank + i;
+   auto vector = walberla::mpi::allReduceAsync( some_ints, walberla::mpi::MAX );
+
+   auto logicalOr  = walberla::mpi::allReduceAsync( ( rank == numProcesses - 1 ) ? 1 : 0, walberla::mpi::LOGICAL_OR );
+   auto logicalAnd = walberla::mpi::allReduceAsync( ( rank == numProcesses - 1 ) ? 1 : 0, walberla::mpi::LOGICAL_AND );
+
+   WALBERLA_CHECK( scalar.valid() );
+   WALBERLA_CHECK_FLOAT_EQUAL( scalar.get(), double_c( sum ) );
+
+   auto moved = std::move( vector );
+   WALBERLA_CHECK( !vector.valid() );
+   moved.wait();
+   WALBERLA_CHECK( moved.ready() );
+   WALBERLA_CHECK_EQUAL( moved.get().size(), 100 );
+   for( int i = 0; i < 100; ++i )
+      WALBERLA_CHECK_EQUAL( moved.get()[ uint_c(i) ], numProcesses - 1 + i );
+
+   WALBERLA_CHECK_EQUAL( logicalOr.get(), 1 );
+   WALBERLA_CHECK_EQUAL( logicalAnd.get(), ( numProcesses == 1 ) ? 1 : 0 );
+
+   {
+      auto empty = mpi::allReduceAsync( std::vector<int>(), walberla::mpi::SUM );
+      WALBERLA_CHECK_EQUAL( empty.get().size(), 0 );
+   }
+}
+
 void runTestAllReduceBool()
 {
    using namespace walberla;
@@ -445,6 +488,7 @@ int main( int argc, char * argv[] )
 
    runTestAllReduce();
    runTestAllReduceBool();
+   runTestAllReduceAsync();
 
    for( int rank = 0; rank < MPIManager::instance()->numProcesses(); ++rank )
    {
@@ -0,0 +1,281 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file FusedBoundaryHandlingTest.cpp
+//! \ingroup lbm
+//! \brief Compares the SplitSweep with fused boundary handling (lbm::FusedBoundaryHandling) with the SplitSweep that
+//!        is executed after a separate boundary handling sweep. The geometry is changed once during the simulation.
+//
+//======================================================================================================================
+
+#include "lbm/boundary/factories/DefaultBoundaryHandling.h"
+#include "lbm/communication/PdfFieldPackInfo.h"
+#include "lbm/field/AddToStorage.h"
+#include "lbm/field/PdfField.h"
+#include "lbm/lattice_model/D3Q19.h"
+#include "lbm/sweeps/FusedBoundaryHandling.h"
+#include "lbm/sweeps/SplitSweep.h"
+
+#include "blockforest/Initialization.h"
+#include "blockforest/communication/UniformBufferedScheme.h"
+
+#include "core/Abort.h"
+#include "core/debug/TestSubsystem.h"
+#include "core/math/Constants.h"
+#include "core/mpi/Environment.h"
+#include "core/mpi/MPIManager.h"
+
+#include "domain_decomposition/SharedSweep.h"
+
+#include "field/AddToStorage.h"
+#include "field/FlagField.h"
+
+#include "timeloop/SweepTimeloop.h"
+
+#include <cmath>
+
+
+namespace walberla {
+
+typedef FlagField< uint16_t > FlagField_T;
+
+const uint_t BlockSize = uint_t(8);
+const uint_t TimeSteps = uint_t(10); // per geometry
+
+const FlagUID Fluid( "Fluid" );
+
+
+
+// deterministic geometry: ~20% NoSlip cells and ~5% velocity bounce back cells in generation 0, generation 1 adds more NoSlip cells
+uint32_t cellHash( const shared_ptr< StructuredBlockForest > & blocks, const IBlock & block, const Cell & local )
+{
+   Cell global( local );
+   blocks->transformBlockLocalToGlobalCell( global, block );
+
+   const cell_idx_t length = cell_idx_c( uint_t(2) * BlockSize );
+   const uint32_t x = uint32_c( ( global.x() + length ) % length );
+   const uint32_t y = uint32_c( ( global.y() + length ) % length );
+   const uint32_t z = uint32_c( ( global.z() + length ) % length );
+
+   uint32_t hash = x * uint32_t(73856093) ^ y * uint32_t(19349663) ^ z * uint32_t(83492791);
+   hash ^= hash >> 13;
+   hash *= uint32_t(0x5bd1e995);
+   hash ^= hash >> 15;
+
+   return hash % uint32_t(100);
+}
+
+
+
+template< typename BHFactory_T >
+void setGeometry( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & boundaryHandlingId, const uint_t generation )
+{
+   typedef typename BHFactory_T::BoundaryHandling BoundaryHandling_T;
+
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      BoundaryHandling_T * handling = block->template getData< BoundaryHandling_T >( boundaryHandlingId );
+
+      CellInterval cells = blocks->getBlockCellBB( *block );
+      blocks->transformGlobalToBlockLocalCellInterval( cells, *block );
+      cells.expand( cell_idx_t(1) );
+
+      for( auto cell = cells.begin(); cell != cells.end(); ++cell )
+      {
+         const uint32_t hash = cellHash( blocks, *block, *cell );
+         if( generation == uint_t(0) )
+         {
+            if( hash < uint32_t(20) )
+               handling->forceBoundary( BHFactory_T::getNoSlip(), cell->x(), cell->y(), cell->z() );
+            else if( hash < uint32_t(25) )
+               handling->forceBoundary( BHFactory_T::getVelocity0(), cell->x(), cell->y(), cell->z() );
+         }
+         else if( hash >= uint32_t(25) && hash < uint32_t(35) )
+         {
+            handling->forceBoundary( BHFactory_T::getNoSlip(), cell->x(), cell->y(), cell->z() );
+         }
+      }
+      if( generation == uint_t(0) )
+         handling->fillWithDomain( uint_t(1) );
+   }
+}
+
+
+
+template< typename LatticeModel_T >
+void initialize( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & pdfFieldId )
+{
+   const real_t length = real_c( uint_t(2) * BlockSize );
+   const real_t k = real_t(2) * math::PI / length;
+
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      auto * pdfField = block->template getData< lbm::PdfField< LatticeModel_T > >( pdfFieldId );
+      for( auto cell = pdfField->beginWithGhostLayerXYZ(); cell != pdfField->end(); ++cell )
+      {
+         Cell global( cell.x(), cell.y(), cell.z() );
+         blocks->transformBlockLocalToGlobalCell( global, *block );
+
+         const real_t x = real_c( global.x() );
+         const real_t y = real_c( global.y() );
+         const real_t z = real_c( global.z() );
+
+         const Vector3< real_t > velocity( real_t(0.05) * std::sin( k * y ), real_t(0.02) * std::cos( k * z ), real_t(0.01) * std::sin( k * x ) );
+         const real_t rho = real_t(1) + real_t(0.01) * std::cos( k * ( x + y ) );
+
+         pdfField->setDensityAndVelocity( cell.x(), cell.y(), cell.z(), velocity, rho );
+      }
+   }
+}
+
+
+
+template< typename LatticeModel_T >
+void test( const shared_ptr< StructuredBlockForest > & blocks, const LatticeModel_T & latticeModel, const field::Layout & layout,
+           const std::string & name )
+{
+   typedef lbm::PdfField< LatticeModel_T >                                   PdfField_T;
+   typedef lbm::DefaultBoundaryHandlingFactory< LatticeModel_T, FlagField_T > BHFactory_T;
+   typedef typename BHFactory_T::BoundaryHandling                            BoundaryHandling_T;
+   typedef typename LatticeModel_T::CommunicationStencil                     CommunicationStencil_T;
+
+   const Vector3< real_t > velocity( real_t(0.05), real_t(0.01), real_t(0) );
+
+   // reference: boundary handling sweep + split sweep
+
+   BlockDataID referenceId = lbm::addPdfFieldToStorage( blocks, "reference pdf field (" + name + ")", latticeModel, layout );
+   BlockDataID referenceFlagId = field::addFlagFieldToStorage< FlagField_T >( blocks, "reference flag field (" + name + ")" );
+   BlockDataID referenceHandlingId = BHFactory_T::addBoundaryHandlingToStorage( blocks, "reference boundary handling (" + name + ")",
+                                                                                referenceFlagId, referenceId, Fluid,
+                                                                                velocity, Vector3< real_t >(), real_t(1), real_t(1) );
+   setGeometry< BHFactory_T >( blocks, referenceHandlingId, uint_t(0) );
+   initialize< LatticeModel_T >( blocks, referenceId );
+
+   blockforest::communication::UniformBufferedScheme< CommunicationStencil_T > referenceCommunication( blocks );
+   referenceCommunication.addPackInfo( make_shared< lbm::PdfFieldPackInfo< LatticeModel_T > >( referenceId ) );
+
+   SweepTimeloop referenceTimeloop( blocks->getBlockStorage(), TimeSteps );
+   referenceTimeloop.add() << BeforeFunction( referenceCommunication, "communication" )
+                           << Sweep( BoundaryHandling_T::getBlockSweep( referenceHandlingId ), "boundary handling" );
+   referenceTimeloop.add() << Sweep( makeSharedSweep( make_shared< lbm::SplitSweep< LatticeModel_T, FlagField_T > >( referenceId, referenceFlagId, Fluid ) ),
+                                     "LB stream & collide (split)" );
+
+   // split sweep with fused boundary handling (no boundary handling sweep)
+
+   BlockDataID fusedId = lbm::addPdfFieldToStorage( blocks, "fused pdf field (" + name + ")", latticeModel, layout );
+   BlockDataID fusedFlagId = field::addFlagFieldToStorage< FlagField_T >( blocks, "fused flag field (" + name + ")" );
+   BlockDataID fusedHandlingId = BHFactory_T::addBoundaryHandlingToStorage( blocks, "fused boundary handling (" + name + ")",
+                                                                            fusedFlagId, fusedId, Fluid,
+                                                                            velocity, Vector3< real_t >(), real_t(1), real_t(1) );
+   setGeometry< BHFactory_T >( blocks, fusedHandlingId, uint_t(0) );
+   initialize< LatticeModel_T >( blocks, fusedId );
+
+   blockforest::communication::UniformBufferedScheme< CommunicationStencil_T > fusedCommunication( blocks );
+   fusedCommunication.addPackInfo( make_shared< lbm::PdfFieldPackInfo< LatticeModel_T > >( fusedId ) );
+
+   auto fusedSweep = make_shared< lbm::SplitSweep< LatticeModel_T, FlagField_T > >( fusedId, fusedFlagId, Fluid );
+   fusedSweep->setFusedBoundaryHandling( lbm::makeFusedBoundaryHandling< BoundaryHandling_T >( fusedHandlingId ) );
+
+   SweepTimeloop fusedTimeloop( blocks->getBlockStorage(), TimeSteps );
+   fusedTimeloop.add() << BeforeFunction( fusedCommunication, "communication" )
+                       << Sweep( makeSharedSweep( fusedSweep ), "LB stream & collide (split, fused boundary handling)" );
+
+   // run, change the geometry, and run again
+
+   for( uint_t generation = uint_t(0); generation < uint_t(2); ++generation )
+   {
+      if( generation > uint_t(0) )
+      {
+         setGeometry< BHFactory_T >( blocks, referenceHandlingId, generation );
+         setGeometry< BHFactory_T >( blocks, fusedHandlingId, generation );
+      }
+
+      referenceTimeloop.setCurrentTimeStepToZero();
+      fusedTimeloop.setCurrentTimeStepToZero();
+
+      referenceTimeloop.run();
+      fusedTimeloop.run();
+
+      for( auto block = blocks->begin(); block != blocks->end(); ++block )
+      {
+         PdfField_T * reference = block->template getData< PdfField_T >( referenceId );
+         PdfField_T * fused     = block->template getData< PdfField_T >( fusedId );
+
+         const FlagField_T * flagField = block->template getData< FlagField_T >( referenceFlagId );
+         const auto fluid = flagField->getFlag( Fluid );
+
+         for( auto cell = reference->beginXYZ(); cell != reference->end(); ++cell )
+         {
+            if( !flagField->isFlagSet( cell.x(), cell.y(), cell.z(), fluid ) )
+               continue;
+
+            for( uint_t f = uint_t(0); f < LatticeModel_T::Stencil::Size; ++f )
+               WALBERLA_CHECK_FLOAT_EQUAL( cell.getF(f), fused->get( cell.cell(), f ),
+                                           name << ", generation " << generation << ", cell " << cell.cell() << ", f = " << f );
+         }
+      }
+   }
+
+   blocks->clearBlockData( fusedHandlingId );
+   blocks->clearBlockData( fusedFlagId );
+   blocks->clearBlockData( fusedId );
+   blocks->clearBlockData( referenceHandlingId );
+   blocks->clearBlockData( referenceFlagId );
+   blocks->clearBlockData( referenceId );
+}
+
+
+
+template< typename LatticeModel_T >
+void test( const shared_ptr< StructuredBlockForest > & blocks, const LatticeModel_T & latticeModel, const std::string & name )
+{
+   test( blocks, latticeModel, field::fzyx, name + ", fzyx" );
+   test( blocks, latticeModel, field::zyxf, name + ", zyxf" );
+}
+
+
+
+int main( int argc, char ** argv )
+{
+   debug::enterTestMode();
+
+   mpi::Environment env( argc, argv );
+
+   const uint_t processes = uint_c( MPIManager::instance()->numProcesses() );
+   if( processes != uint_t(1) && processes != uint_t(2) && processes != uint_t(4) && processes != uint_t(8) )
+      WALBERLA_ABORT( "The number of processes must be 1, 2, 4, or 8!" );
+
+   auto blocks = blockforest::createUniformBlockGrid( uint_t(2), uint_t(2), uint_t(2),
+                                                      BlockSize, BlockSize, BlockSize,
+                                                      real_t(1),
+                                                      ( processes >= uint_t(2) ) ? uint_t(2) : uint_t(1),
+                                                      ( processes >= uint_t(4) ) ? uint_t(2) : uint_t(1),
+                                                      ( processes >= uint_t(8) ) ? uint_t(2) : uint_t(1),
+                                                      true, true, true ); // periodicity
+
+   test( blocks, lbm::D3Q19< lbm::collision_model::SRT, false >( lbm::collision_model::SRT( real_t(1.4) ) ), "D3Q19 SRT incomp" );
+   test( blocks, lbm::D3Q19< lbm::collision_model::SRT, true  >( lbm::collision_model::SRT( real_t(1.4) ) ), "D3Q19 SRT comp" );
+   test( blocks, lbm::D3Q19< lbm::collision_model::TRT, false >( lbm::collision_model::TRT::constructWithMagicNumber( real_t(1.6) ) ), "D3Q19 TRT incomp" );
+   test( blocks, lbm::D3Q19< lbm::collision_model::TRT, true  >( lbm::collision_model::TRT::constructWithMagicNumber( real_t(1.6) ) ), "D3Q19 TRT comp" );
+
+   return EXIT_SUCCESS;
+}
+
+} // namespace walberla
+
+int main( int argc, char* argv[] )
+{
+  return walberla::main( argc, argv );
+}
@@ -0,0 +1,256 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file MixedPrecisionTest.cpp
+//! \ingroup lbm
+//! \brief Compares the SplitPureSweep operating on single precision PDF fields (lbm::MixedPrecision) with the same
+//!        sweep operating on PDF fields stored in 'real_t'
+//
+//======================================================================================================================
+
+#include "lbm/communication/PdfFieldPackInfo.h"
+#include "lbm/field/AddToStorage.h"
+#include "lbm/field/PdfField.h"
+#include "lbm/lattice_model/D3Q15.h"
+#include "lbm/lattice_model/D3Q19.h"
+#include "lbm/lattice_model/D3Q27.h"
+#include "lbm/lattice_model/MixedPrecision.h"
+#include "lbm/sweeps/SplitPureSweep.h"
+
+#include "blockforest/Initialization.h"
+#include "blockforest/communication/UniformBufferedScheme.h"
+
+#include "core/Abort.h"
+#include "core/debug/TestSubsystem.h"
+#include "core/math/Constants.h"
+#include "core/mpi/Environment.h"
+#include "core/mpi/MPIManager.h"
+
+#include "domain_decomposition/SharedSweep.h"
+
+#include "timeloop/SweepTimeloop.h"
+
+#include <cmath>
+#include <limits>
+
+
+namespace walberla {
+
+const uint_t BlockSize = uint_t(6);
+const uint_t TimeSteps = uint_t(20);
+
+
+
+template< typename LatticeModel_T >
+void initialize( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & pdfFieldId )
+{
+   const real_t length = real_c( uint_t(2) * BlockSize );
+   const real_t k = real_t(2) * math::PI / length;
+
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      auto * pdfField = block->template getData< lbm::PdfField< LatticeModel_T > >( pdfFieldId );
+      for( auto cell = pdfField->beginXYZ(); cell != pdfField->end(); ++cell )
+      {
+         Cell global( cell.x(), cell.y(), cell.z() );
+         blocks->transformBlockLocalToGlobalCell( global, *block );
+
+         const real_t x = real_c( global.x() );
+         const real_t y = real_c( global.y() );
+         const real_t z = real_c( global.z() );
+
+         const Vector3< real_t > velocity( real_t(0.05) * std::sin( k * y ), real_t(0.02) * std::cos( k * z ), real_t(0.01) * std::sin( k * x ) );
+         const real_t rho = real_t(1) + real_t(0.01) * std::cos( k * ( x + y ) );
+
+         pdfField->setDensityAndVelocity( cell.x(), cell.y(), cell.z(), velocity, rho );
+      }
+   }
+}
+
+
+
+template< typename LatticeModel_T >
+BlockDataID run( const shared_ptr< StructuredBlockForest > & blocks, const LatticeModel_T & latticeModel, const field::Layout & layout,
+                 const std::string & name )
+{
+   BlockDataID pdfFieldId = lbm::addPdfFieldToStorage( blocks, name, latticeModel, layout );
+   initialize< LatticeModel_T >( blocks, pdfFieldId );
+
+   blockforest::communication::UniformBufferedScheme< typename LatticeModel_T::CommunicationStencil > communication( blocks );
+   communication.addPackInfo( make_shared< lbm::PdfFieldPackInfo< LatticeModel_T > >( pdfFieldId ) );
+
+   SweepTimeloop timeloop( blocks->getBlockStorage(), TimeSteps );
+   timeloop.add() << BeforeFunction( communication, "communication" )
+                  << Sweep( makeSharedSweep( make_shared< lbm::SplitPureSweep< LatticeModel_T > >( pdfFieldId ) ), "LB stream & collide (split pure)" );
+   timeloop.run();
+
+   return pdfFieldId;
+}
+
+
+
+template< typename LatticeModel_T >
+void test( const shared_ptr< StructuredBlockForest > & blocks, const LatticeModel_T & latticeModel, const field::Layout & layout,
+           const std::string & name )
+{
+   typedef lbm::MixedPrecision< LatticeModel_T, float > MixedPrecisionModel_T;
+
+   typedef lbm::PdfField< LatticeModel_T >        PdfField_T;
+   typedef lbm::PdfField< MixedPrecisionModel_T > MixedPrecisionPdfField_T;
+
+   static_assert( (boost::is_same< typename PdfField_T::value_type, real_t >::value), "PDFs must be stored as real_t by default!" );
+   static_assert( (boost::is_same< typename MixedPrecisionPdfField_T::value_type, float >::value), "PDFs must be stored as float!" );
+
+   const std::string layoutName = ( layout == field::fzyx ) ? "fzyx" : "zyxf";
+
+   BlockDataID referenceId = run( blocks, latticeModel, layout, "reference pdf field (" + name + ", " + layoutName + ")" );
+   BlockDataID mixedId     = run( blocks, MixedPrecisionModel_T( latticeModel ), layout, "float pdf field (" + name + ", " + layoutName + ")" );
+
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      PdfField_T               * reference = block->template getData< PdfField_T >( referenceId );
+      MixedPrecisionPdfField_T * mixed     = block->template getData< MixedPrecisionPdfField_T >( mixedId );
+
+      for( auto cell = reference->beginXYZ(); cell != reference->end(); ++cell )
+      {
+         Vector3< real_t > referenceVelocity;
+         Vector3< real_t > mixedVelocity;
+         const real_t referenceRho = reference->getDensityAndVelocity( referenceVelocity, cell.cell() );
+         const real_t mixedRho     = mixed->getDensityAndVelocity( mixedVelocity, cell.cell() );
+
+         WALBERLA_CHECK_FLOAT_EQUAL_EPSILON( referenceRho, mixedRho, real_t(1e-5), name << ", " << layoutName << ", cell " << cell.cell() );
+         for( uint_t i = 0; i < uint_t(3); ++i )
+            WALBERLA_CHECK_FLOAT_EQUAL_EPSILON( referenceVelocity[i], mixedVelocity[i], real_t(1e-5),
+                                                name << ", " << layoutName << ", cell " << cell.cell() << ", velocity component " << i );
+      }
+   }
+
+   blocks->clearBlockData( mixedId );
+   blocks->clearBlockData( referenceId );
+}
+
+
+
+// Performs one time step on a float field and on a real_t field that start from identical PDFs. Since all
+// computations are carried out in real_t, each float PDF must be the correctly rounded real_t result, i.e., the
+// deviation must not exceed half a float ulp. Rounding any intermediate value to float violates this bound.
+template< typename LatticeModel_T >
+void testComputePrecision( const shared_ptr< StructuredBlockForest > & blocks, const LatticeModel_T & latticeModel, const field::Layout & layout,
+                           const std::string & name )
+{
+   typedef lbm::MixedPrecision< LatticeModel_T, float > MixedPrecisionModel_T;
+
+   typedef lbm::PdfField< LatticeModel_T >        PdfField_T;
+   typedef lbm::PdfField< MixedPrecisionModel_T > MixedPrecisionPdfField_T;
+
+   const std::string layoutName = ( layout == field::fzyx ) ? "fzyx" : "zyxf";
+
+   BlockDataID referenceId = lbm::addPdfFieldToStorage( blocks, "reference pdf field (" + name + ", " + layoutName + ", one step)", latticeModel, layout );
+   BlockDataID mixedId     = lbm::addPdfFieldToStorage( blocks, "float pdf field (" + name + ", " + layoutName + ", one step)",
+                                                        MixedPrecisionModel_T( latticeModel ), layout );
+   initialize< MixedPrecisionModel_T >( blocks, mixedId );
+
+   blockforest::communication::UniformBufferedScheme< typename LatticeModel_T::CommunicationStencil > communication( blocks );
+   communication.addPackInfo( make_shared< lbm::PdfFieldPackInfo< MixedPrecisionModel_T > >( mixedId ) );
+   communication();
+
+   lbm::SplitPureSweep< LatticeModel_T >        referenceSweep( referenceId );
+   lbm::SplitPureSweep< MixedPrecisionModel_T > mixedSweep( mixedId );
+
+   const real_t tolerance = real_t(0.5) * real_c( std::numeric_limits< float >::epsilon() );
+
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      PdfField_T               * reference = block->template getData< PdfField_T >( referenceId );
+      MixedPrecisionPdfField_T * mixed     = block->template getData< MixedPrecisionPdfField_T >( mixedId );
+
+      for( auto cell = mixed->beginWithGhostLayerXYZ(); cell != mixed->end(); ++cell )
+         for( uint_t f = 0; f < LatticeModel_T::Stencil::Size; ++f )
+            reference->get( cell.x(), cell.y(), cell.z(), f ) = real_c( mixed->get( cell.x(), cell.y(), cell.z(), f ) );
+
+      referenceSweep( block.get() );
+      mixedSweep( block.get() );
+
+      reference = block->template getData< PdfField_T >( referenceId );
+      mixed     = block->template getData< MixedPrecisionPdfField_T >( mixedId );
+
+      for( auto cell = reference->beginXYZ(); cell != reference->end(); ++cell )
+      {
+         for( uint_t f = 0; f < LatticeModel_T::Stencil::Size; ++f )
+         {
+            const real_t referencePdf = reference->get( cell.x(), cell.y(), cell.z(), f );
+            const real_t mixedPdf     = real_c( mixed->get( cell.x(), cell.y(), cell.z(), f ) );
+            WALBERLA_CHECK_LESS_EQUAL( std::abs( mixedPdf - referencePdf ), tolerance * std::abs( referencePdf ),
+                                       name << ", " << layoutName << ", cell " << cell.cell() << ", direction " << f );
+         }
+      }
+   }
+
+   blocks->clearBlockData( mixedId );
+   blocks->clearBlockData( referenceId );
+}
+
+
+
+template< typename LatticeModel_T >
+void test( const shared_ptr< StructuredBlockForest > & blocks, const LatticeModel_T & latticeModel, const std::string & name )
+{
+   test( blocks, latticeModel, field::fzyx, name );
+   test( blocks, latticeModel, field::zyxf, name );
+
+   // the bound only distinguishes float storage from float computations if real_t is more accurate than float
+   if( std::numeric_limits< real_t >::digits > std::numeric_limits< float >::digits )
+   {
+      testComputePrecision( blocks, latticeModel, field::fzyx, name );
+      testComputePrecision( blocks, latticeModel, field::zyxf, name );
+   }
+}
+
+
+
+int main( int argc, char ** argv )
+{
+   debug::enterTestMode();
+
+   mpi::Environment env( argc, argv );
+
+   const uint_t processes = uint_c( MPIManager::instance()->numProcesses() );
+   if( processes != uint_t(1) && processes != uint_t(2) && processes != uint_t(4) && processes != uint_t(8) )
+      WALBERLA_ABORT( "The number of processes must be 1, 2, 4, or 8!" );
+
+   auto blocks = blockforest::createUniformBlockGrid( uint_t(2), uint_t(2), uint_t(2),
+                                                      BlockSize, BlockSize, BlockSize,
+                                                      real_t(1),
+                                                      ( processes >= uint_t(2) ) ? uint_t(2) : uint_t(1),
+                                                      ( processes >= uint_t(4) ) ? uint_t(2) : uint_t(1),
+                                                      ( processes >= uint_t(8) ) ? uint_t(2) : uint_t(1),
+                                                      true, true, true ); // periodicity
+
+   test( blocks, lbm::D3Q19< lbm::collision_model::SRT, false >( lbm::collision_model::SRT( real_t(1.4) ) ), "D3Q19 SRT incomp" );
+   test( blocks, lbm::D3Q19< lbm::collision_model::SRT, true  >( lbm::collision_model::SRT( real_t(1.4) ) ), "D3Q19 SRT comp" );
+   test( blocks, lbm::D3Q19< lbm::collision_model::TRT, false >( lbm::collision_model::TRT::constructWithMagicNumber( real_t(1.6) ) ), "D3Q19 TRT incomp" );
+   test( blocks, lbm::D3Q19< lbm::collision_model::TRT, true  >( lbm::collision_model::TRT::constructWithMagicNumber( real_t(1.6) ) ), "D3Q19 TRT comp" );
+   test( blocks, lbm::D3Q15< lbm::collision_model::TRT, false >( lbm::collision_model::TRT::constructWithMagicNumber( real_t(1.2) ) ), "D3Q15 TRT incomp" );
+   test( blocks, lbm::D3Q27< lbm::collision_model::SRT, true  >( lbm::collision_model::SRT( real_t(1.8) ) ), "D3Q27 SRT comp" );
+
+   return EXIT_SUCCESS;
+}
+
+} // namespace walberla
+
+int main( int argc, char* argv[] )
+{
+  return walberla::main( argc, argv );
+}
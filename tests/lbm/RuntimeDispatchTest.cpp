@@ -0,0 +1,229 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file RuntimeDispatchTest.cpp
+//! \ingroup lbm
+//
+//======================================================================================================================
+
+#include "lbm/communication/PdfFieldPackInfo.h"
+#include "lbm/field/AddToStorage.h"
+#include "lbm/field/PdfField.h"
+#include "lbm/lattice_model/D3Q19.h"
+#include "lbm/sweeps/SplitSweep.h"
+
+#include "blockforest/Initialization.h"
+#include "blockforest/communication/UniformBufferedScheme.h"
+
+#include "core/Abort.h"
+#include "core/debug/TestSubsystem.h"
+#include "core/logging/Logging.h"
+#include "core/math/Constants.h"
+#include "core/mpi/Environment.h"
+#include "core/mpi/MPIManager.h"
+
+#include "domain_decomposition/SharedSweep.h"
+
+#include "field/AddToStorage.h"
+#include "field/FlagField.h"
+
+#include "simd/RuntimeDispatch.h"
+
+#include "timeloop/SweepTimeloop.h"
+
+#include <cmath>
+#include <limits>
+
+
+namespace walberla {
+
+typedef FlagField< uint8_t > FlagField_T;
+
+const uint_t BlockSize = uint_t(8);
+const uint_t TimeSteps = uint_t(10);
+
+const FlagUID Fluid( "Fluid" );
+
+
+
+template< typename LatticeModel_T >
+BlockDataID createPdfField( const shared_ptr< StructuredBlockForest > & blocks, const LatticeModel_T & latticeModel, const field::Layout & layout,
+                            const std::string & name )
+{
+   BlockDataID pdfFieldId = lbm::addPdfFieldToStorage( blocks, name, latticeModel, layout );
+
+   const real_t length = real_c( uint_t(2) * BlockSize );
+   const real_t k = real_t(2) * math::PI / length;
+
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      auto * pdfField = block->template getData< lbm::PdfField< LatticeModel_T > >( pdfFieldId );
+      for( auto cell = pdfField->beginWithGhostLayerXYZ(); cell != pdfField->end(); ++cell )
+      {
+         Cell global( cell.x(), cell.y(), cell.z() );
+         blocks->transformBlockLocalToGlobalCell( global, *block );
+
+         const real_t x = real_c( global.x() );
+         const real_t y = real_c( global.y() );
+         const real_t z = real_c( global.z() );
+
+         const Vector3< real_t > velocity( real_t(0.05) * std::sin( k * y ), real_t(0.02) * std::cos( k * z ), real_t(0.01) * std::sin( k * x ) );
+         const real_t rho = real_t(1) + real_t(0.01) * std::cos( k * ( x + y ) );
+
+         pdfField->setDensityAndVelocity( cell.x(), cell.y(), cell.z(), velocity, rho );
+      }
+   }
+
+   return pdfFieldId;
+}
+
+
+
+template< typename LatticeModel_T >
+void test( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & flagFieldId, const LatticeModel_T & latticeModel,
+           const field::Layout & layout, const std::string & name )
+{
+   typedef lbm::PdfField< LatticeModel_T >               PdfField_T;
+   typedef lbm::SplitSweep< LatticeModel_T, FlagField_T > Sweep_T;
+   typedef typename LatticeModel_T::CommunicationStencil CommunicationStencil_T;
+
+   // reference: kernel compiled for the default instruction set
+
+   BlockDataID referenceId = createPdfField( blocks, latticeModel, layout, "reference pdf field (" + name + ")" );
+
+   auto referenceSweep = make_shared< Sweep_T >( referenceId, flagFieldId, Fluid );
+   referenceSweep->setInstructionSet( simd::DEFAULT );
+   WALBERLA_CHECK_EQUAL( referenceSweep->getInstructionSet(), simd::DEFAULT );
+
+   blockforest::communication::UniformBufferedScheme< CommunicationStencil_T > referenceCommunication( blocks );
+   referenceCommunication.addPackInfo( make_shared< lbm::PdfFieldPackInfo< LatticeModel_T > >( referenceId ) );
+
+   SweepTimeloop referenceTimeloop( blocks->getBlockStorage(), TimeSteps );
+   referenceTimeloop.add() << BeforeFunction( referenceCommunication, "communication" )
+                           << Sweep( makeSharedSweep( referenceSweep ), "LB stream & collide (default)" );
+   referenceTimeloop.run();
+
+   // all multi-versioned kernels supported by this CPU
+
+   for( int is = int( simd::AVX2 ); is <= int( simd::AVX512 ); ++is )
+   {
+      const simd::InstructionSet instructionSet = static_cast< simd::InstructionSet >( is );
+
+      BlockDataID pdfFieldId = createPdfField( blocks, latticeModel, layout, "pdf field (" + name + ", " + simd::instructionSetToString( instructionSet ) + ")" );
+
+      auto sweep = make_shared< Sweep_T >( pdfFieldId, flagFieldId, Fluid );
+      sweep->setInstructionSet( instructionSet );
+      WALBERLA_CHECK_EQUAL( sweep->getInstructionSet(), simd::supportedInstructionSet( instructionSet ) );
+
+      blockforest::communication::UniformBufferedScheme< CommunicationStencil_T > communication( blocks );
+      communication.addPackInfo( make_shared< lbm::PdfFieldPackInfo< LatticeModel_T > >( pdfFieldId ) );
+
+      SweepTimeloop timeloop( blocks->getBlockStorage(), TimeSteps );
+      timeloop.add() << BeforeFunction( communication, "communication" )
+                     << Sweep( makeSharedSweep( sweep ), "LB stream & collide (" + simd::instructionSetToString( instructionSet ) + ")" );
+      timeloop.run();
+
+      // FMA contraction may change the last bits of the result
+      const real_t tolerance = real_t(100) * std::numeric_limits< real_t >::epsilon();
+      for( auto block = blocks->begin(); block != blocks->end(); ++block )
+      {
+         PdfField_T * reference = block->template getData< PdfField_T >( referenceId );
+         PdfField_T * pdfField  = block->template getData< PdfField_T >( pdfFieldId );
+
+         for( auto cell = reference->beginXYZ(); cell != reference->end(); ++cell )
+            for( uint_t f = uint_t(0); f < LatticeModel_T::Stencil::Size; ++f )
+               WALBERLA_CHECK_LESS( std::fabs( cell.getF(f) - pdfField->get( cell.cell(), f ) ), tolerance,
+                                    name << ", " << simd::instructionSetToString( sweep->getInstructionSet() ) <<
+                                    ", cell " << cell.cell() << ", f = " << f );
+      }
+
+      blocks->clearBlockData( pdfFieldId );
+   }
+
+   blocks->clearBlockData( referenceId );
+}
+
+
+
+template< typename LatticeModel_T >
+void test( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & flagFieldId, const LatticeModel_T & latticeModel,
+           const std::string & name )
+{
+   test( blocks, flagFieldId, latticeModel, field::fzyx, name + ", fzyx" );
+   test( blocks, flagFieldId, latticeModel, field::zyxf, name + ", zyxf" );
+}
+
+
+
+int main( int argc, char ** argv )
+{
+   debug::enterTestMode();
+
+   mpi::Environment env( argc, argv );
+
+   const uint_t processes = uint_c( MPIManager::instance()->numProcesses() );
+   if( processes != uint_t(1) && processes != uint_t(2) && processes != uint_t(4) && processes != uint_t(8) )
+      WALBERLA_ABORT( "The number of processes must be 1, 2, 4, or 8!" );
+
+   const simd::CpuFeatures & features = simd::cpuFeatures();
+   WALBERLA_LOG_INFO_ON_ROOT( "Multi-versioned kernels use: " << simd::instructionSetToString( simd::bestAvailableInstructionSet() ) );
+
+#ifdef WALBERLA_SIMD_MULTIVERSIONING
+   // whatever the compiler was allowed to use must be supported by the executing CPU
+#ifdef __AVX2__
+   WALBERLA_CHECK( features.avx2 );
+   WALBERLA_CHECK_GREATER_EQUAL( simd::bestAvailableInstructionSet(), simd::AVX2 );
+#endif
+#ifdef __AVX512F__
+   WALBERLA_CHECK( features.avx512f );
+   WALBERLA_CHECK_EQUAL( simd::bestAvailableInstructionSet(), simd::AVX512 );
+#endif
+   WALBERLA_CHECK( features.sse2 );
+#else
+   WALBERLA_CHECK_EQUAL( simd::bestAvailableInstructionSet(), simd::DEFAULT );
+#endif
+   WALBERLA_UNUSED( features );
+
+   auto blocks = blockforest::createUniformBlockGrid( uint_t(2), uint_t(2), uint_t(2),
+                                                      BlockSize, BlockSize, BlockSize,
+                                                      real_t(1),
+                                                      ( processes >= uint_t(2) ) ? uint_t(2) : uint_t(1),
+                                                      ( processes >= uint_t(4) ) ? uint_t(2) : uint_t(1),
+                                                      ( processes >= uint_t(8) ) ? uint_t(2) : uint_t(1),
+                                                      true, true, true ); // periodicity
+
+   BlockDataID flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, "flag field" );
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      FlagField_T * flagField = block->getData< FlagField_T >( flagFieldId );
+      const auto fluid = flagField->registerFlag( Fluid );
+      for( auto cell = flagField->beginWithGhostLayer(); cell != flagField->end(); ++cell )
+         *cell = fluid;
+   }
+
+   test( blocks, flagFieldId, lbm::D3Q19< lbm::collision_model::SRT, false >( lbm::collision_model::SRT( real_t(1.4) ) ), "D3Q19 SRT incomp" );
+   test( blocks, flagFieldId, lbm::D3Q19< lbm::collision_model::SRT, true  >( lbm::collision_model::SRT( real_t(1.4) ) ), "D3Q19 SRT comp" );
+   test( blocks, flagFieldId, lbm::D3Q19< lbm::collision_model::TRT, false >( lbm::collision_model::TRT::constructWithMagicNumber( real_t(1.6) ) ), "D3Q19 TRT incomp" );
+   test( blocks, flagFieldId, lbm::D3Q19< lbm::collision_model::TRT, true  >( lbm::collision_model::TRT::constructWithMagicNumber( real_t(1.6) ) ), "D3Q19 TRT comp" );
+
+   return EXIT_SUCCESS;
+}
+
+} // namespace walberla
+
+int main( int argc, char* argv[] )
+{
+  return walberla::main( argc, argv );
+}
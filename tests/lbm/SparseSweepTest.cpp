@@ -0,0 +1,289 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file SparseSweepTest.cpp
+//! \ingroup lbm
+//! \brief Compares the SparseSweep (+ SparsePdfFieldPackInfo) with the cell-wise sweep (+ NoSlip boundary handling)
+//!        in a periodic, porous domain. The geometry is changed once during the simulation.
+//
+//======================================================================================================================
+
+#include "lbm/boundary/factories/DefaultBoundaryHandling.h"
+#include "lbm/communication/PdfFieldPackInfo.h"
+#include "lbm/communication/SparsePdfFieldPackInfo.h"
+#include "lbm/field/AddToStorage.h"
+#include "lbm/field/PdfField.h"
+#include "lbm/lattice_model/D3Q15.h"
+#include "lbm/lattice_model/D3Q19.h"
+#include "lbm/lattice_model/D3Q27.h"
+#include "lbm/sweeps/CellwiseSweep.h"
+#include "lbm/sweeps/SparseSweep.h"
+
+#include "blockforest/Initialization.h"
+#include "blockforest/communication/UniformBufferedScheme.h"
+
+#include "core/Abort.h"
+#include "core/debug/TestSubsystem.h"
+#include "core/math/Constants.h"
+#include "core/mpi/Environment.h"
+#include "core/mpi/MPIManager.h"
+
+#include "domain_decomposition/SharedSweep.h"
+
+#include "field/AddToStorage.h"
+#include "field/FlagField.h"
+
+#include "timeloop/SweepTimeloop.h"
+
+#include <cmath>
+
+
+namespace walberla {
+
+typedef FlagField< uint16_t > FlagField_T;
+
+const uint_t BlockSize = uint_t(8);
+const uint_t TimeSteps = uint_t(10); // per geometry
+
+const FlagUID Fluid( "Fluid" );
+
+
+
+// deterministic porous geometry: approximately 40% of all cells are solid in generation 0, generation 1 adds more solid cells
+bool isSolid( const shared_ptr< StructuredBlockForest > & blocks, const IBlock & block, const Cell & local, const uint_t generation )
+{
+   Cell global( local );
+   blocks->transformBlockLocalToGlobalCell( global, block );
+
+   const cell_idx_t length = cell_idx_c( uint_t(2) * BlockSize );
+   const uint32_t x = uint32_c( ( global.x() + length ) % length );
+   const uint32_t y = uint32_c( ( global.y() + length ) % length );
+   const uint32_t z = uint32_c( ( global.z() + length ) % length );
+
+   uint32_t hash = x * uint32_t(73856093) ^ y * uint32_t(19349663) ^ z * uint32_t(83492791);
+   hash ^= hash >> 13;
+   hash *= uint32_t(0x5bd1e995);
+   hash ^= hash >> 15;
+
+   return ( hash % uint32_t(100) ) < ( ( generation == uint_t(0) ) ? uint32_t(40) : uint32_t(55) );
+}
+
+
+
+template< typename BoundaryHandling_T >
+void setGeometry( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & boundaryHandlingId, const FlagUID & noSlip,
+                  const uint_t generation )
+{
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      BoundaryHandling_T * handling = block->template getData< BoundaryHandling_T >( boundaryHandlingId );
+
+      CellInterval cells = blocks->getBlockCellBB( *block );
+      blocks->transformGlobalToBlockLocalCellInterval( cells, *block );
+      cells.expand( cell_idx_t(1) );
+
+      for( auto cell = cells.begin(); cell != cells.end(); ++cell )
+      {
+         if( isSolid( blocks, *block, *cell, generation ) )
+            handling->forceBoundary( noSlip, cell->x(), cell->y(), cell->z() );
+      }
+      if( generation == uint_t(0) )
+         handling->fillWithDomain( uint_t(1) );
+   }
+}
+
+
+
+template< typename LatticeModel_T >
+void initialize( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & pdfFieldId )
+{
+   const real_t length = real_c( uint_t(2) * BlockSize );
+   const real_t k = real_t(2) * math::PI / length;
+
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      auto * pdfField = block->template getData< lbm::PdfField< LatticeModel_T > >( pdfFieldId );
+      for( auto cell = pdfField->beginWithGhostLayerXYZ(); cell != pdfField->end(); ++cell )
+      {
+         Cell global( cell.x(), cell.y(), cell.z() );
+         blocks->transformBlockLocalToGlobalCell( global, *block );
+
+         const real_t x = real_c( global.x() );
+         const real_t y = real_c( global.y() );
+         const real_t z = real_c( global.z() );
+
+         const Vector3< real_t > velocity( real_t(0.05) * std::sin( k * y ), real_t(0.02) * std::cos( k * z ), real_t(0.01) * std::sin( k * x ) );
+         const real_t rho = real_t(1) + real_t(0.01) * std::cos( k * ( x + y ) );
+
+         pdfField->setDensityAndVelocity( cell.x(), cell.y(), cell.z(), velocity, rho );
+      }
+   }
+}
+
+
+
+template< typename LatticeModel_T >
+void test( const shared_ptr< StructuredBlockForest > & blocks, const LatticeModel_T & latticeModel, const std::string & name )
+{
+   typedef lbm::PdfField< LatticeModel_T >                                   PdfField_T;
+   typedef lbm::DefaultBoundaryHandlingFactory< LatticeModel_T, FlagField_T > BHFactory_T;
+   typedef typename BHFactory_T::BoundaryHandling                            BoundaryHandling_T;
+   typedef typename LatticeModel_T::CommunicationStencil                     CommunicationStencil_T;
+
+   // reference: cell-wise sweep + NoSlip boundary handling
+
+   BlockDataID referenceId = lbm::addPdfFieldToStorage( blocks, "reference pdf field (" + name + ")", latticeModel );
+   BlockDataID referenceFlagId = field::addFlagFieldToStorage< FlagField_T >( blocks, "reference flag field (" + name + ")" );
+   BlockDataID referenceHandlingId = BHFactory_T::addBoundaryHandlingToStorage( blocks, "reference boundary handling (" + name + ")",
+                                                                                referenceFlagId, referenceId, Fluid,
+                                                                                Vector3< real_t >(), Vector3< real_t >(), real_t(1), real_t(1) );
+   setGeometry< BoundaryHandling_T >( blocks, referenceHandlingId, BHFactory_T::getNoSlip(), uint_t(0) );
+   initialize< LatticeModel_T >( blocks, referenceId );
+
+   blockforest::communication::UniformBufferedScheme< CommunicationStencil_T > referenceCommunication( blocks );
+   referenceCommunication.addPackInfo( make_shared< lbm::PdfFieldPackInfo< LatticeModel_T > >( referenceId ) );
+
+   SweepTimeloop referenceTimeloop( blocks->getBlockStorage(), TimeSteps );
+   referenceTimeloop.add() << BeforeFunction( referenceCommunication, "communication" )
+                           << Sweep( BoundaryHandling_T::getBlockSweep( referenceHandlingId ), "boundary handling" );
+   referenceTimeloop.add() << Sweep( makeSharedSweep( lbm::makeCellwiseSweep< LatticeModel_T, FlagField_T >( referenceId, referenceFlagId, Fluid ) ),
+                                     "LB stream & collide (cell-wise)" );
+
+   // sparse sweep with built-in bounce back (no boundary handling sweep) and sparse communication
+
+   BlockDataID sparseId = lbm::addPdfFieldToStorage( blocks, "sparse pdf field (" + name + ")", latticeModel );
+   BlockDataID sparseFlagId = field::addFlagFieldToStorage< FlagField_T >( blocks, "sparse flag field (" + name + ")" );
+   BlockDataID sparseHandlingId = BHFactory_T::addBoundaryHandlingToStorage( blocks, "sparse boundary handling (" + name + ")",
+                                                                             sparseFlagId, sparseId, Fluid,
+                                                                             Vector3< real_t >(), Vector3< real_t >(), real_t(1), real_t(1) );
+   setGeometry< BoundaryHandling_T >( blocks, sparseHandlingId, BHFactory_T::getNoSlip(), uint_t(0) );
+   initialize< LatticeModel_T >( blocks, sparseId );
+
+   blockforest::communication::UniformBufferedScheme< CommunicationStencil_T > sparseCommunication( blocks );
+   sparseCommunication.addPackInfo( make_shared< lbm::SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T > >( sparseId, sparseFlagId, Fluid, false ) );
+
+   auto sparseSweep = lbm::makeSparseSweep< LatticeModel_T, FlagField_T >( sparseId, sparseFlagId, Fluid, BHFactory_T::getNoSlip() );
+
+   SweepTimeloop sparseTimeloop( blocks->getBlockStorage(), TimeSteps );
+   sparseTimeloop.add() << BeforeFunction( sparseCommunication, "communication" )
+                        << Sweep( makeSharedSweep( sparseSweep ), "LB stream & collide (sparse)" );
+
+   // sparse sweep without built-in bounce back: NoSlip is treated by the boundary handling
+
+   BlockDataID sparseBHId = lbm::addPdfFieldToStorage( blocks, "sparse pdf field with boundary handling (" + name + ")", latticeModel );
+   BlockDataID sparseBHFlagId = field::addFlagFieldToStorage< FlagField_T >( blocks, "sparse flag field with boundary handling (" + name + ")" );
+   BlockDataID sparseBHHandlingId = BHFactory_T::addBoundaryHandlingToStorage( blocks, "sparse boundary handling with boundary handling (" + name + ")",
+                                                                               sparseBHFlagId, sparseBHId, Fluid,
+                                                                               Vector3< real_t >(), Vector3< real_t >(), real_t(1), real_t(1) );
+   setGeometry< BoundaryHandling_T >( blocks, sparseBHHandlingId, BHFactory_T::getNoSlip(), uint_t(0) );
+   initialize< LatticeModel_T >( blocks, sparseBHId );
+
+   blockforest::communication::UniformBufferedScheme< CommunicationStencil_T > sparseBHCommunication( blocks );
+   sparseBHCommunication.addPackInfo( make_shared< lbm::SparsePdfFieldPackInfo< LatticeModel_T, FlagField_T > >( sparseBHId, sparseBHFlagId, Fluid, false ) );
+
+   auto sparseBHSweep = lbm::makeSparseSweep< LatticeModel_T, FlagField_T >( sparseBHId, sparseBHFlagId, Fluid );
+
+   SweepTimeloop sparseBHTimeloop( blocks->getBlockStorage(), TimeSteps );
+   sparseBHTimeloop.add() << BeforeFunction( sparseBHCommunication, "communication" )
+                          << Sweep( BoundaryHandling_T::getBlockSweep( sparseBHHandlingId ), "boundary handling" );
+   sparseBHTimeloop.add() << Sweep( makeSharedSweep( sparseBHSweep ), "LB stream & collide (sparse)" );
+
+   // run, change the geometry, and run again
+
+   for( uint_t generation = uint_t(0); generation < uint_t(2); ++generation )
+   {
+      if( generation > uint_t(0) )
+      {
+         setGeometry< BoundaryHandling_T >( blocks, referenceHandlingId, BHFactory_T::getNoSlip(), generation );
+         setGeometry< BoundaryHandling_T >( blocks, sparseHandlingId,    BHFactory_T::getNoSlip(), generation );
+         setGeometry< BoundaryHandling_T >( blocks, sparseBHHandlingId,  BHFactory_T::getNoSlip(), generation );
+
+         sparseSweep->invalidate();
+         sparseBHSweep->invalidate();
+      }
+
+      referenceTimeloop.setCurrentTimeStepToZero();
+      sparseTimeloop.setCurrentTimeStepToZero();
+      sparseBHTimeloop.setCurrentTimeStepToZero();
+
+      referenceTimeloop.run();
+      sparseTimeloop.run();
+      sparseBHTimeloop.run();
+
+      for( auto block = blocks->begin(); block != blocks->end(); ++block )
+      {
+         PdfField_T * reference = block->template getData< PdfField_T >( referenceId );
+         PdfField_T * sparse    = block->template getData< PdfField_T >( sparseId );
+         PdfField_T * sparseBH  = block->template getData< PdfField_T >( sparseBHId );
+
+         const FlagField_T * flagField = block->template getData< FlagField_T >( referenceFlagId );
+         const auto fluid = flagField->getFlag( Fluid );
+
+         uint_t fluidCells( uint_t(0) );
+         for( auto cell = reference->beginXYZ(); cell != reference->end(); ++cell )
+         {
+            if( !flagField->isFlagSet( cell.x(), cell.y(), cell.z(), fluid ) )
+               continue;
+            ++fluidCells;
+
+            for( uint_t f = uint_t(0); f < LatticeModel_T::Stencil::Size; ++f )
+            {
+               WALBERLA_CHECK_FLOAT_EQUAL_EPSILON( cell.getF(f), sparse->get( cell.cell(), f ), real_t(1e-10),
+                                                   name << " (built-in bounce back), generation " << generation << ", cell " << cell.cell() << ", f = " << f );
+               WALBERLA_CHECK_FLOAT_EQUAL_EPSILON( cell.getF(f), sparseBH->get( cell.cell(), f ), real_t(1e-10),
+                                                   name << " (boundary handling), generation " << generation << ", cell " << cell.cell() << ", f = " << f );
+            }
+         }
+
+         WALBERLA_CHECK_EQUAL( sparseSweep->numberOfCells( block.get() ), fluidCells );
+         WALBERLA_CHECK_EQUAL( sparseBHSweep->numberOfCells( block.get() ), fluidCells );
+      }
+   }
+}
+
+
+
+int main( int argc, char ** argv )
+{
+   debug::enterTestMode();
+
+   mpi::Environment env( argc, argv );
+
+   const uint_t processes = uint_c( MPIManager::instance()->numProcesses() );
+   if( processes != uint_t(1) && processes != uint_t(2) && processes != uint_t(4) && processes != uint_t(8) )
+      WALBERLA_ABORT( "The number of processes must be 1, 2, 4, or 8!" );
+
+   auto blocks = blockforest::createUniformBlockGrid( uint_t(2), uint_t(2), uint_t(2),
+                                                      BlockSize, BlockSize, BlockSize,
+                                                      real_t(1),
+                                                      ( processes >= uint_t(2) ) ? uint_t(2) : uint_t(1),
+                                                      ( processes >= uint_t(4) ) ? uint_t(2) : uint_t(1),
+                                                      ( processes >= uint_t(8) ) ? uint_t(2) : uint_t(1),
+                                                      true, true, true ); // periodicity
+
+   test( blocks, lbm::D3Q19< lbm::collision_model::SRT, false >( lbm::collision_model::SRT( real_t(1.4) ) ), "D3Q19 SRT incomp" );
+   test( blocks, lbm::D3Q19< lbm::collision_model::TRT, true >( lbm::collision_model::TRT::constructWithMagicNumber( real_t(1.6) ) ), "D3Q19 TRT comp" );
+   test( blocks, lbm::D3Q15< lbm::collision_model::TRT, false >( lbm::collision_model::TRT::constructWithMagicNumber( real_t(1.2) ) ), "D3Q15 TRT incomp" );
+   test( blocks, lbm::D3Q27< lbm::collision_model::SRT, true >( lbm::collision_model::SRT( real_t(1.8) ) ), "D3Q27 SRT comp" );
+
+   return EXIT_SUCCESS;
+}
+
+} // namespace walberla
+
+int main( int argc, char* argv[] )
+{
+  return walberla::main( argc, argv );
+}
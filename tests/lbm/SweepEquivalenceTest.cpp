@@ -25,6 +25,7 @@
 #include "lbm/field/AddToStorage.h"
 #include "lbm/field/PdfField.h"
 #include "lbm/lattice_model/D2Q9.h"
+#include "lbm/lattice_model/D3Q15.h"
 #include "lbm/lattice_model/D3Q19.h"
 #include "lbm/lattice_model/D3Q27.h"
 #include "lbm/sweeps/CellwiseSweep.h"
@@ -222,6 +223,18 @@ struct AddTest< LatticeModel_T, typename boost::enable_if_c< boost::is_same< typ
    }
 };
 
+template< typename LatticeModel_T  >
+struct AddTest< LatticeModel_T, typename boost::enable_if_c< boost::is_same< typename LatticeModel_T::CollisionModel::tag,
+                                                                             lbm::collision_model::Cumulant_tag >::value >::type >
+{
+   static void add( shared_ptr< StructuredBlockForest > & blocks, SweepTimeloop & timeloop, std::vector< BlockDataID > & fieldIds,
+                    field::Layout layout, const BlockDataID & flagFieldId, const real_t velocity, const char * fieldName )
+   {
+      LatticeModel_T latticeModel = LatticeModel_T( lbm::collision_model::D3Q27Cumulant( GlobalOmega ) );
+      addTest( blocks, timeloop, fieldIds, latticeModel, layout, flagFieldId, velocity, fieldName );
+   }
+};
+
 
 
 template< typename LatticeModel_T, class Enable = void >
@@ -343,7 +356,8 @@ int main( int argc, char ** argv )
                                                       real_c(1.0), true,
                                                       true, true, false ); // periodicty
 
-   BlockDataID flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, "flag field" );
+   // every boundary handling registers its own "near boundary" flag -> one flag field per lattice model/test section
+   BlockDataID flagFieldId;
 
    #ifdef TEST_USES_VTK_OUTPUT
    SweepTimeloop timeloop( blocks->getBlockStorage(), uint_t(101) );
@@ -364,6 +378,7 @@ int main( int argc, char ** argv )
    ///////////////////////////
 
    fieldIds.emplace_back( );
+   flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, std::string("flag field ") + std::to_string( fieldIds.size() ) );
 
    // SRT
 
@@ -491,6 +506,7 @@ int main( int argc, char ** argv )
    /////////////////////////
 
    fieldIds.emplace_back( );
+   flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, std::string("flag field ") + std::to_string( fieldIds.size() ) );
 
    // SRT
 
@@ -554,6 +570,7 @@ int main( int argc, char ** argv )
    ///////////////////////////
 
    fieldIds.emplace_back( );
+   flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, std::string("flag field ") + std::to_string( fieldIds.size() ) );
 
    // SRT
 
@@ -612,11 +629,40 @@ int main( int argc, char ** argv )
       timeloop.add() << Sweep( makeCollideSweep( sweep ), "LB collide (D3Q27 TRT incomp fzyx cell-wise - separate stream+collide)" );
    }
 
+   // SRT & TRT split pure
+
+   AddTest< D3Q27_SRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::zyxf, flagFieldId, velocity, "(D3Q27 SRT incomp zyxf split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q27_SRT_INCOMP >( fieldIds.back().back() ), "LB stream & collide (D3Q27 SRT incomp zyxf split pure)" );
+
+   AddTest< D3Q27_SRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q27 SRT incomp fzyx split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q27_SRT_INCOMP >( fieldIds.back().back() ), "LB stream & collide (D3Q27 SRT incomp fzyx split pure)" );
+
+   AddTest< D3Q27_SRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q27 SRT incomp fzyx split pure - separate stream+collide)" );
+   {
+      auto sweep = make_shared< lbm::SplitPureSweep< D3Q27_SRT_INCOMP > >( fieldIds.back().back() );
+      timeloop.add() << Sweep( makeStreamSweep( sweep ), "LB stream (D3Q27 SRT incomp fzyx split pure - separate stream+collide)" );
+      timeloop.add() << Sweep( makeCollideSweep( sweep ), "LB collide (D3Q27 SRT incomp fzyx split pure - separate stream+collide)" );
+   }
+
+   AddTest< D3Q27_TRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::zyxf, flagFieldId, velocity, "(D3Q27 TRT incomp zyxf split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q27_TRT_INCOMP >( fieldIds.back().back() ), "LB stream & collide (D3Q27 TRT incomp zyxf split pure)" );
+
+   AddTest< D3Q27_TRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q27 TRT incomp fzyx split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q27_TRT_INCOMP >( fieldIds.back().back() ), "LB stream & collide (D3Q27 TRT incomp fzyx split pure)" );
+
+   AddTest< D3Q27_TRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q27 TRT incomp fzyx split pure - separate stream+collide)" );
+   {
+      auto sweep = make_shared< lbm::SplitPureSweep< D3Q27_TRT_INCOMP > >( fieldIds.back().back() );
+      timeloop.add() << Sweep( makeStreamSweep( sweep ), "LB stream (D3Q27 TRT incomp fzyx split pure - separate stream+collide)" );
+      timeloop.add() << Sweep( makeCollideSweep( sweep ), "LB collide (D3Q27 TRT incomp fzyx split pure - separate stream+collide)" );
+   }
+
    /////////////////////////
    // D3Q27, compressible //
    /////////////////////////
 
    fieldIds.emplace_back( );
+   flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, std::string("flag field ") + std::to_string( fieldIds.size() ) );
 
    // SRT
 
@@ -647,11 +693,40 @@ int main( int argc, char ** argv )
    timeloop.add() << Sweep( makeSharedSweep( lbm::makeCellwiseSweep< D3Q27_TRT_COMP, FlagField_T >( fieldIds.back().back(), flagFieldId, Fluid_Flag ) ),
                                                                                                     "LB stream & collide (D3Q27 TRT comp fzyx cell-wise)" );
 
+   // SRT & TRT split pure
+
+   AddTest< D3Q27_SRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::zyxf, flagFieldId, velocity, "(D3Q27 SRT comp zyxf split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q27_SRT_COMP >( fieldIds.back().back() ), "LB stream & collide (D3Q27 SRT comp zyxf split pure)" );
+
+   AddTest< D3Q27_SRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q27 SRT comp fzyx split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q27_SRT_COMP >( fieldIds.back().back() ), "LB stream & collide (D3Q27 SRT comp fzyx split pure)" );
+
+   AddTest< D3Q27_SRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q27 SRT comp fzyx split pure - separate stream+collide)" );
+   {
+      auto sweep = make_shared< lbm::SplitPureSweep< D3Q27_SRT_COMP > >( fieldIds.back().back() );
+      timeloop.add() << Sweep( makeStreamSweep( sweep ), "LB stream (D3Q27 SRT comp fzyx split pure - separate stream+collide)" );
+      timeloop.add() << Sweep( makeCollideSweep( sweep ), "LB collide (D3Q27 SRT comp fzyx split pure - separate stream+collide)" );
+   }
+
+   AddTest< D3Q27_TRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::zyxf, flagFieldId, velocity, "(D3Q27 TRT comp zyxf split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q27_TRT_COMP >( fieldIds.back().back() ), "LB stream & collide (D3Q27 TRT comp zyxf split pure)" );
+
+   AddTest< D3Q27_TRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q27 TRT comp fzyx split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q27_TRT_COMP >( fieldIds.back().back() ), "LB stream & collide (D3Q27 TRT comp fzyx split pure)" );
+
+   AddTest< D3Q27_TRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q27 TRT comp fzyx split pure - separate stream+collide)" );
+   {
+      auto sweep = make_shared< lbm::SplitPureSweep< D3Q27_TRT_COMP > >( fieldIds.back().back() );
+      timeloop.add() << Sweep( makeStreamSweep( sweep ), "LB stream (D3Q27 TRT comp fzyx split pure - separate stream+collide)" );
+      timeloop.add() << Sweep( makeCollideSweep( sweep ), "LB collide (D3Q27 TRT comp fzyx split pure - separate stream+collide)" );
+   }
+
    ////////////////////////////
    // TRT <-> MRT COMPARISON //
    ////////////////////////////
 
    fieldIds.emplace_back( );
+   flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, std::string("flag field ") + std::to_string( fieldIds.size() ) );
 
    // TRT
 
@@ -704,6 +779,7 @@ int main( int argc, char ** argv )
    //////////////////////////
 
    fieldIds.emplace_back( );
+   flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, std::string("flag field ") + std::to_string( fieldIds.size() ) );
 
    // SRT
 
@@ -762,6 +838,122 @@ int main( int argc, char ** argv )
       timeloop.add() << Sweep( makeCollideSweep( sweep ), "LB collide (D2Q9 TRT incomp fzyx cell-wise - separate stream+collide)" );
    }
 
+   ///////////////////////////
+   // D3Q15, incompressible //
+   ///////////////////////////
+
+   fieldIds.emplace_back( );
+   flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, std::string("flag field ") + std::to_string( fieldIds.size() ) );
+
+   // SRT
+
+   typedef lbm::D3Q15< lbm::collision_model::SRT, false > D3Q15_SRT_INCOMP;
+
+   AddTest< D3Q15_SRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q15 SRT incomp fzyx cell-wise)" );
+   timeloop.add() << Sweep( makeSharedSweep( lbm::makeCellwiseSweep< D3Q15_SRT_INCOMP, FlagField_T >( fieldIds.back().back(), flagFieldId, Fluid_Flag ) ),
+                                                                                                      "LB stream & collide (D3Q15 SRT incomp fzyx cell-wise)" );
+
+   AddTest< D3Q15_SRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::zyxf, flagFieldId, velocity, "(D3Q15 SRT incomp zyxf split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q15_SRT_INCOMP >( fieldIds.back().back() ), "LB stream & collide (D3Q15 SRT incomp zyxf split pure)" );
+
+   AddTest< D3Q15_SRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q15 SRT incomp fzyx split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q15_SRT_INCOMP >( fieldIds.back().back() ), "LB stream & collide (D3Q15 SRT incomp fzyx split pure)" );
+
+   AddTest< D3Q15_SRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q15 SRT incomp fzyx split pure - separate stream+collide)" );
+   {
+      auto sweep = make_shared< lbm::SplitPureSweep< D3Q15_SRT_INCOMP > >( fieldIds.back().back() );
+      timeloop.add() << Sweep( makeStreamSweep( sweep ), "LB stream (D3Q15 SRT incomp fzyx split pure - separate stream+collide)" );
+      timeloop.add() << Sweep( makeCollideSweep( sweep ), "LB collide (D3Q15 SRT incomp fzyx split pure - separate stream+collide)" );
+   }
+
+   // TRT
+
+   typedef lbm::D3Q15< lbm::collision_model::TRT, false > D3Q15_TRT_INCOMP;
+
+   AddTest< D3Q15_TRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::zyxf, flagFieldId, velocity, "(D3Q15 TRT incomp zyxf split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q15_TRT_INCOMP >( fieldIds.back().back() ), "LB stream & collide (D3Q15 TRT incomp zyxf split pure)" );
+
+   AddTest< D3Q15_TRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q15 TRT incomp fzyx split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q15_TRT_INCOMP >( fieldIds.back().back() ), "LB stream & collide (D3Q15 TRT incomp fzyx split pure)" );
+
+   AddTest< D3Q15_TRT_INCOMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q15 TRT incomp fzyx split pure - separate stream+collide)" );
+   {
+      auto sweep = make_shared< lbm::SplitPureSweep< D3Q15_TRT_INCOMP > >( fieldIds.back().back() );
+      timeloop.add() << Sweep( makeStreamSweep( sweep ), "LB stream (D3Q15 TRT incomp fzyx split pure - separate stream+collide)" );
+      timeloop.add() << Sweep( makeCollideSweep( sweep ), "LB collide (D3Q15 TRT incomp fzyx split pure - separate stream+collide)" );
+   }
+
+   /////////////////////////
+   // D3Q15, compressible //
+   /////////////////////////
+
+   fieldIds.emplace_back( );
+   flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, std::string("flag field ") + std::to_string( fieldIds.size() ) );
+
+   // SRT
+
+   typedef lbm::D3Q15< lbm::collision_model::SRT, true > D3Q15_SRT_COMP;
+
+   AddTest< D3Q15_SRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q15 SRT comp fzyx cell-wise)" );
+   timeloop.add() << Sweep( makeSharedSweep( lbm::makeCellwiseSweep< D3Q15_SRT_COMP, FlagField_T >( fieldIds.back().back(), flagFieldId, Fluid_Flag ) ),
+                                                                                                    "LB stream & collide (D3Q15 SRT comp fzyx cell-wise)" );
+
+   AddTest< D3Q15_SRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::zyxf, flagFieldId, velocity, "(D3Q15 SRT comp zyxf split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q15_SRT_COMP >( fieldIds.back().back() ), "LB stream & collide (D3Q15 SRT comp zyxf split pure)" );
+
+   AddTest< D3Q15_SRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q15 SRT comp fzyx split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q15_SRT_COMP >( fieldIds.back().back() ), "LB stream & collide (D3Q15 SRT comp fzyx split pure)" );
+
+   AddTest< D3Q15_SRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q15 SRT comp fzyx split pure - separate stream+collide)" );
+   {
+      auto sweep = make_shared< lbm::SplitPureSweep< D3Q15_SRT_COMP > >( fieldIds.back().back() );
+      timeloop.add() << Sweep( makeStreamSweep( sweep ), "LB stream (D3Q15 SRT comp fzyx split pure - separate stream+collide)" );
+      timeloop.add() << Sweep( makeCollideSweep( sweep ), "LB collide (D3Q15 SRT comp fzyx split pure - separate stream+collide)" );
+   }
+
+   // TRT
+
+   typedef lbm::D3Q15< lbm::collision_model::TRT, true > D3Q15_TRT_COMP;
+
+   AddTest< D3Q15_TRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::zyxf, flagFieldId, velocity, "(D3Q15 TRT comp zyxf split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q15_TRT_COMP >( fieldIds.back().back() ), "LB stream & collide (D3Q15 TRT comp zyxf split pure)" );
+
+   AddTest< D3Q15_TRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q15 TRT comp fzyx split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q15_TRT_COMP >( fieldIds.back().back() ), "LB stream & collide (D3Q15 TRT comp fzyx split pure)" );
+
+   AddTest< D3Q15_TRT_COMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q15 TRT comp fzyx split pure - separate stream+collide)" );
+   {
+      auto sweep = make_shared< lbm::SplitPureSweep< D3Q15_TRT_COMP > >( fieldIds.back().back() );
+      timeloop.add() << Sweep( makeStreamSweep( sweep ), "LB stream (D3Q15 TRT comp fzyx split pure - separate stream+collide)" );
+      timeloop.add() << Sweep( makeCollideSweep( sweep ), "LB collide (D3Q15 TRT comp fzyx split pure - separate stream+collide)" );
+   }
+
+   ///////////////////////////////////
+   // D3Q27, cumulant, compressible //
+   ///////////////////////////////////
+
+   fieldIds.emplace_back( );
+   flagFieldId = field::addFlagFieldToStorage< FlagField_T >( blocks, std::string("flag field ") + std::to_string( fieldIds.size() ) );
+
+   typedef lbm::D3Q27< lbm::collision_model::D3Q27Cumulant, true > D3Q27_CUMULANT_COMP;
+
+   AddTest< D3Q27_CUMULANT_COMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q27 CUMULANT comp fzyx cell-wise)" );
+   timeloop.add() << Sweep( makeSharedSweep( lbm::makeCellwiseSweep< D3Q27_CUMULANT_COMP, FlagField_T >( fieldIds.back().back(), flagFieldId, Fluid_Flag ) ),
+                                                                                                         "LB stream & collide (D3Q27 CUMULANT comp fzyx cell-wise)" );
+
+   AddTest< D3Q27_CUMULANT_COMP >::add( blocks, timeloop, fieldIds.back(), field::zyxf, flagFieldId, velocity, "(D3Q27 CUMULANT comp zyxf split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q27_CUMULANT_COMP >( fieldIds.back().back() ), "LB stream & collide (D3Q27 CUMULANT comp zyxf split pure)" );
+
+   AddTest< D3Q27_CUMULANT_COMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q27 CUMULANT comp fzyx split pure)" );
+   timeloop.add() << Sweep( lbm::SplitPureSweep< D3Q27_CUMULANT_COMP >( fieldIds.back().back() ), "LB stream & collide (D3Q27 CUMULANT comp fzyx split pure)" );
+
+   AddTest< D3Q27_CUMULANT_COMP >::add( blocks, timeloop, fieldIds.back(), field::fzyx, flagFieldId, velocity, "(D3Q27 CUMULANT comp fzyx split pure - separate stream+collide)" );
+   {
+      auto sweep = make_shared< lbm::SplitPureSweep< D3Q27_CUMULANT_COMP > >( fieldIds.back().back() );
+      timeloop.add() << Sweep( makeStreamSweep( sweep ), "LB stream (D3Q27 CUMULANT comp fzyx split pure - separate stream+collide)" );
+      timeloop.add() << Sweep( makeCollideSweep( sweep ), "LB collide (D3Q27 CUMULANT comp fzyx split pure - separate stream+collide)" );
+   }
+
    #ifdef TEST_USES_VTK_OUTPUT
    timeloop.addFuncAfterTimeStep( vtk::writeFiles( pdfFieldVTKWriter ), "VTK" );
    #endif
@@ -826,6 +1018,14 @@ int main( int argc, char ** argv )
    check< D3Q27_SRT_INCOMP, D3Q27_TRT_INCOMP >( blocks, fieldIds[2][0], fieldIds[2][6] );
    check< D3Q27_SRT_INCOMP, D3Q27_TRT_INCOMP >( blocks, fieldIds[2][0], fieldIds[2][7] );
 
+   check< D3Q27_SRT_INCOMP, D3Q27_SRT_INCOMP >( blocks, fieldIds[2][0], fieldIds[2][8]  );
+   check< D3Q27_SRT_INCOMP, D3Q27_SRT_INCOMP >( blocks, fieldIds[2][0], fieldIds[2][9]  );
+   check< D3Q27_SRT_INCOMP, D3Q27_SRT_INCOMP >( blocks, fieldIds[2][0], fieldIds[2][10] );
+
+   check< D3Q27_SRT_INCOMP, D3Q27_TRT_INCOMP >( blocks, fieldIds[2][0], fieldIds[2][11] );
+   check< D3Q27_SRT_INCOMP, D3Q27_TRT_INCOMP >( blocks, fieldIds[2][0], fieldIds[2][12] );
+   check< D3Q27_SRT_INCOMP, D3Q27_TRT_INCOMP >( blocks, fieldIds[2][0], fieldIds[2][13] );
+
    /////////////////////////
    // D3Q27, compressible //
    /////////////////////////
@@ -835,6 +1035,14 @@ int main( int argc, char ** argv )
    check< D3Q27_SRT_COMP, D3Q27_TRT_COMP >( blocks, fieldIds[3][0], fieldIds[3][2] );
    check< D3Q27_SRT_COMP, D3Q27_TRT_COMP >( blocks, fieldIds[3][0], fieldIds[3][3] );
 
+   check< D3Q27_SRT_COMP, D3Q27_SRT_COMP >( blocks, fieldIds[3][0], fieldIds[3][4] );
+   check< D3Q27_SRT_COMP, D3Q27_SRT_COMP >( blocks, fieldIds[3][0], fieldIds[3][5] );
+   check< D3Q27_SRT_COMP, D3Q27_SRT_COMP >( blocks, fieldIds[3][0], fieldIds[3][6] );
+
+   check< D3Q27_SRT_COMP, D3Q27_TRT_COMP >( blocks, fieldIds[3][0], fieldIds[3][7] );
+   check< D3Q27_SRT_COMP, D3Q27_TRT_COMP >( blocks, fieldIds[3][0], fieldIds[3][8] );
+   check< D3Q27_SRT_COMP, D3Q27_TRT_COMP >( blocks, fieldIds[3][0], fieldIds[3][9] );
+
    ////////////////////////////
    // TRT <-> MRT COMPARISON //
    ////////////////////////////
@@ -861,6 +1069,38 @@ int main( int argc, char ** argv )
    check< D2Q9_SRT_INCOMP, D2Q9_TRT_INCOMP >( blocks, fieldIds[5][0], fieldIds[5][6] );
    check< D2Q9_SRT_INCOMP, D2Q9_TRT_INCOMP >( blocks, fieldIds[5][0], fieldIds[5][7] );
 
+   ///////////////////////////
+   // D3Q15, incompressible //
+   ///////////////////////////
+
+   check< D3Q15_SRT_INCOMP, D3Q15_SRT_INCOMP >( blocks, fieldIds[6][0], fieldIds[6][1] );
+   check< D3Q15_SRT_INCOMP, D3Q15_SRT_INCOMP >( blocks, fieldIds[6][0], fieldIds[6][2] );
+   check< D3Q15_SRT_INCOMP, D3Q15_SRT_INCOMP >( blocks, fieldIds[6][0], fieldIds[6][3] );
+
+   check< D3Q15_SRT_INCOMP, D3Q15_TRT_INCOMP >( blocks, fieldIds[6][0], fieldIds[6][4] );
+   check< D3Q15_SRT_INCOMP, D3Q15_TRT_INCOMP >( blocks, fieldIds[6][0], fieldIds[6][5] );
+   check< D3Q15_SRT_INCOMP, D3Q15_TRT_INCOMP >( blocks, fieldIds[6][0], fieldIds[6][6] );
+
+   /////////////////////////
+   // D3Q15, compressible //
+   /////////////////////////
+
+   check< D3Q15_SRT_COMP, D3Q15_SRT_COMP >( blocks, fieldIds[7][0], fieldIds[7][1] );
+   check< D3Q15_SRT_COMP, D3Q15_SRT_COMP >( blocks, fieldIds[7][0], fieldIds[7][2] );
+   check< D3Q15_SRT_COMP, D3Q15_SRT_COMP >( blocks, fieldIds[7][0], fieldIds[7][3] );
+
+   check< D3Q15_SRT_COMP, D3Q15_TRT_COMP >( blocks, fieldIds[7][0], fieldIds[7][4] );
+   check< D3Q15_SRT_COMP, D3Q15_TRT_COMP >( blocks, fieldIds[7][0], fieldIds[7][5] );
+   check< D3Q15_SRT_COMP, D3Q15_TRT_COMP >( blocks, fieldIds[7][0], fieldIds[7][6] );
+
+   ///////////////////////////////////
+   // D3Q27, cumulant, compressible //
+   ///////////////////////////////////
+
+   check< D3Q27_CUMULANT_COMP, D3Q27_CUMULANT_COMP >( blocks, fieldIds[8][0], fieldIds[8][1] );
+   check< D3Q27_CUMULANT_COMP, D3Q27_CUMULANT_COMP >( blocks, fieldIds[8][0], fieldIds[8][2] );
+   check< D3Q27_CUMULANT_COMP, D3Q27_CUMULANT_COMP >( blocks, fieldIds[8][0], fieldIds[8][3] );
+
    return EXIT_SUCCESS;
 }
 } // namespace walberla
@@ -0,0 +1,165 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file WavefrontSweepTest.cpp
+//! \ingroup lbm
+//! \brief Compares the WavefrontSweep (+ WavefrontPdfFieldPackInfo) with the cell-wise sweep in a fully periodic domain
+//
+//======================================================================================================================
+
+#include "lbm/communication/PdfFieldPackInfo.h"
+#include "lbm/communication/WavefrontPdfFieldPackInfo.h"
+#include "lbm/field/AddToStorage.h"
+#include "lbm/field/PdfField.h"
+#include "lbm/lattice_model/D3Q15.h"
+#include "lbm/lattice_model/D3Q19.h"
+#include "lbm/lattice_model/D3Q27.h"
+#include "lbm/sweeps/CellwiseSweep.h"
+#include "lbm/sweeps/WavefrontSweep.h"
+
+#include "blockforest/Initialization.h"
+#include "blockforest/communication/UniformBufferedScheme.h"
+
+#include "core/Abort.h"
+#include "core/debug/TestSubsystem.h"
+#include "core/math/Constants.h"
+#include "core/mpi/Environment.h"
+#include "core/mpi/MPIManager.h"
+
+#include "domain_decomposition/SharedSweep.h"
+
+#include "stencil/D3Q27.h"
+
+#include "timeloop/SweepTimeloop.h"
+
+#include <cmath>
+
+
+namespace walberla {
+
+const uint_t BlockSize = uint_t(6);
+const uint_t TimeSteps = uint_t(12); // must be a multiple of the number of time steps performed by one wavefront sweep
+
+
+
+template< typename LatticeModel_T >
+void initialize( const shared_ptr< StructuredBlockForest > & blocks, const BlockDataID & pdfFieldId )
+{
+   const real_t length = real_c( uint_t(2) * BlockSize );
+   const real_t k = real_t(2) * math::PI / length;
+
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      auto * pdfField = block->template getData< lbm::PdfField< LatticeModel_T > >( pdfFieldId );
+      for( auto cell = pdfField->beginXYZ(); cell != pdfField->end(); ++cell )
+      {
+         Cell global( cell.x(), cell.y(), cell.z() );
+         blocks->transformBlockLocalToGlobalCell( global, *block );
+
+         const real_t x = real_c( global.x() );
+         const real_t y = real_c( global.y() );
+         const real_t z = real_c( global.z() );
+
+         const Vector3< real_t > velocity( real_t(0.05) * std::sin( k * y ), real_t(0.02) * std::cos( k * z ), real_t(0.01) * std::sin( k * x ) );
+         const real_t rho = real_t(1) + real_t(0.01) * std::cos( k * ( x + y ) );
+
+         pdfField->setDensityAndVelocity( cell.x(), cell.y(), cell.z(), velocity, rho );
+      }
+   }
+}
+
+
+
+template< typename LatticeModel_T >
+void test( const shared_ptr< StructuredBlockForest > & blocks, const LatticeModel_T & latticeModel, const uint_t steps, const std::string & name )
+{
+   typedef lbm::PdfField< LatticeModel_T > PdfField_T;
+
+   WALBERLA_CHECK_EQUAL( TimeSteps % steps, uint_t(0) );
+
+   // reference: cell-wise sweep, one time step per time loop iteration
+
+   BlockDataID referenceId = lbm::addPdfFieldToStorage( blocks, "reference pdf field (" + name + ")", latticeModel );
+   initialize< LatticeModel_T >( blocks, referenceId );
+
+   blockforest::communication::UniformBufferedScheme< typename LatticeModel_T::CommunicationStencil > referenceCommunication( blocks );
+   referenceCommunication.addPackInfo( make_shared< lbm::PdfFieldPackInfo< LatticeModel_T > >( referenceId ) );
+
+   SweepTimeloop referenceTimeloop( blocks->getBlockStorage(), TimeSteps );
+   referenceTimeloop.add() << BeforeFunction( referenceCommunication, "communication" )
+                           << Sweep( makeSharedSweep( lbm::makeCellwiseSweep< LatticeModel_T >( referenceId ) ), "LB stream & collide (cell-wise)" );
+   referenceTimeloop.run();
+
+   // wavefront sweep: 'steps' time steps per time loop iteration, 'steps' ghost layers
+
+   BlockDataID wavefrontId = lbm::addPdfFieldToStorage( blocks, "wavefront pdf field (" + name + ")", latticeModel, steps );
+   initialize< LatticeModel_T >( blocks, wavefrontId );
+
+   blockforest::communication::UniformBufferedScheme< stencil::D3Q27 > wavefrontCommunication( blocks );
+   wavefrontCommunication.addPackInfo( make_shared< lbm::WavefrontPdfFieldPackInfo< LatticeModel_T > >( wavefrontId, steps ) );
+
+   SweepTimeloop wavefrontTimeloop( blocks->getBlockStorage(), TimeSteps / steps );
+   wavefrontTimeloop.add() << BeforeFunction( wavefrontCommunication, "communication" )
+                           << Sweep( makeSharedSweep( lbm::makeWavefrontSweep< LatticeModel_T >( wavefrontId, steps ) ), "LB stream & collide (wavefront)" );
+   wavefrontTimeloop.run();
+
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      PdfField_T * reference = block->template getData< PdfField_T >( referenceId );
+      PdfField_T * wavefront = block->template getData< PdfField_T >( wavefrontId );
+
+      for( auto cell = reference->beginXYZ(); cell != reference->end(); ++cell )
+         for( uint_t f = 0; f < LatticeModel_T::Stencil::Size; ++f )
+            WALBERLA_CHECK_FLOAT_EQUAL_EPSILON( cell.getF(f), wavefront->get( cell.cell(), f ), real_t(1e-10),
+                                                name << ", " << steps << " time steps per sweep, cell " << cell.cell() << ", f = " << f );
+   }
+}
+
+
+
+int main( int argc, char ** argv )
+{
+   debug::enterTestMode();
+
+   mpi::Environment env( argc, argv );
+
+   const uint_t processes = uint_c( MPIManager::instance()->numProcesses() );
+   if( processes != uint_t(1) && processes != uint_t(2) && processes != uint_t(4) && processes != uint_t(8) )
+      WALBERLA_ABORT( "The number of processes must be 1, 2, 4, or 8!" );
+
+   auto blocks = blockforest::createUniformBlockGrid( uint_t(2), uint_t(2), uint_t(2),
+                                                      BlockSize, BlockSize, BlockSize,
+                                                      real_t(1),
+                                                      ( processes >= uint_t(2) ) ? uint_t(2) : uint_t(1),
+                                                      ( processes >= uint_t(4) ) ? uint_t(2) : uint_t(1),
+                                                      ( processes >= uint_t(8) ) ? uint_t(2) : uint_t(1),
+                                                      true, true, true ); // periodicity
+
+   for( uint_t steps = uint_t(1); steps <= uint_t(4); ++steps )
+      test( blocks, lbm::D3Q19< lbm::collision_model::SRT, false >( lbm::collision_model::SRT( real_t(1.4) ) ), steps, "D3Q19 SRT incomp" );
+
+   test( blocks, lbm::D3Q19< lbm::collision_model::TRT, true >( lbm::collision_model::TRT::constructWithMagicNumber( real_t(1.6) ) ), uint_t(3), "D3Q19 TRT comp" );
+   test( blocks, lbm::D3Q15< lbm::collision_model::TRT, false >( lbm::collision_model::TRT::constructWithMagicNumber( real_t(1.2) ) ), uint_t(2), "D3Q15 TRT incomp" );
+   test( blocks, lbm::D3Q27< lbm::collision_model::SRT, true >( lbm::collision_model::SRT( real_t(1.8) ) ), uint_t(3), "D3Q27 SRT comp" );
+
+   return EXIT_SUCCESS;
+}
+
+} // namespace walberla
+
+int main( int argc, char* argv[] )
+{
+  return walberla::main( argc, argv );
+}
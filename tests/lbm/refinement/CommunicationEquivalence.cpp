@@ -370,8 +370,12 @@ int main( int argc, char ** argv )
    mpi::Environment env( argc, argv );
 
    bool shortrun = false;
+   bool datatypes = false;
    for( int i = 1; i < argc; ++i )
+   {
       if( std::strcmp( argv[i], "--shortrun" ) == 0 ) shortrun = true;
+      if( std::strcmp( argv[i], "--datatypes" ) == 0 ) datatypes = true;
+   }
 
    logging::Logging::printHeaderOnStream();
 
@@ -457,6 +461,7 @@ int main( int argc, char ** argv )
    auto tstep2 = lbm::refinement::makeTimeStep< LatticeModel_T, BoundaryHandling_T >( blocks, mySweep2, pdfFieldId2, boundaryHandlingId2 );
    tstep1->optimizeCommunication( true );
    tstep2->optimizeCommunication( false );
+   tstep1->useEqualLevelDatatypes( datatypes );
 
    timeloop.addFuncBeforeTimeStep( makeSharedFunctor( tstep1 ), "LBM refinement time step (1)" );
    timeloop.addFuncBeforeTimeStep( makeSharedFunctor( tstep2 ), "LBM refinement time step (2)" );
@@ -34,6 +34,7 @@
 
 #include "pde/iterations/CGFixedStencilIteration.h"
 #include "pde/iterations/CGIteration.h"
+#include "pde/iterations/PipelinedCGIteration.h"
 
 #include "stencil/D2Q5.h"
 
@@ -41,6 +42,7 @@
 
 #include "vtk/VTKOutput.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace walberla {
@@ -115,6 +117,23 @@ void clearField( const shared_ptr< StructuredBlockStorage > & blocks, const Bloc
 
 
 
+real_t maxDifference( const shared_ptr< StructuredBlockStorage > & blocks, const BlockDataID & aId, const BlockDataID & bId )
+{
+   real_t result( real_t(0) );
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      PdeField_T * a = block->getData< PdeField_T >( aId );
+      PdeField_T * b = block->getData< PdeField_T >( bId );
+      WALBERLA_FOR_ALL_CELLS_XYZ( a,
+         result = std::max( result, std::fabs( a->get(x,y,z) - b->get(x,y,z) ) );
+      )
+   }
+   mpi::allReduceInplace( result, mpi::MAX );
+   return result;
+}
+
+
+
 int main( int argc, char** argv )
 {
    debug::enterTestMode();
@@ -194,6 +213,35 @@ int main( int argc, char** argv )
    
    timeloop2.run();
 
+   // rerun the test with the pipelined CG and compare with the solution of the classic CG
+
+   BlockDataID uCGId = field::addToStorage< PdeField_T >( blocks, "u (CG)", real_t(0), field::zyxf, uint_t(1) );
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+      block->getData< PdeField_T >( uCGId )->set( *( block->getData< PdeField_T >( uId ) ) );
+
+   clearField<PdeField_T>( blocks, uId);
+   initU( blocks, uId );
+   clearField<PdeField_T>( blocks, rId );
+
+   BlockDataID wId = field::addToStorage< PdeField_T >( blocks, "w (pipelined CG)", real_t(0), field::zyxf, uint_t(1) );
+   BlockDataID pId = field::addToStorage< PdeField_T >( blocks, "p (pipelined CG)", real_t(0), field::zyxf, uint_t(1) );
+   BlockDataID sId = field::addToStorage< PdeField_T >( blocks, "s (pipelined CG)", real_t(0), field::zyxf, uint_t(1) );
+   BlockDataID qId = field::addToStorage< PdeField_T >( blocks, "q (pipelined CG)", real_t(0), field::zyxf, uint_t(1) );
+
+   blockforest::communication::UniformBufferedScheme< Stencil_T > synchronizeW( blocks );
+   synchronizeW.addPackInfo( make_shared< field::communication::PackInfo< PdeField_T > >( wId ) );
+
+   SweepTimeloop timeloop3( blocks, uint_t(1) );
+
+   timeloop3.addFuncBeforeTimeStep( pde::PipelinedCGIteration< Stencil_T >( blocks->getBlockStorage(), uId, rId, wId, pId, sId, zId, qId, fId, stencilId,
+                                                                            shortrun ? uint_t(10) : uint_t(10000), synchronizeW, real_c(1e-6) ), "pipelined CG iteration" );
+
+   timeloop3.run();
+
+   const real_t difference = maxDifference( blocks, uId, uCGId );
+   WALBERLA_LOG_INFO_ON_ROOT( "Maximum difference between the solutions of CG and pipelined CG: " << difference );
+   WALBERLA_CHECK_LESS( difference, shortrun ? real_t(1e-6) : real_t(1e-3) );
+
    if( !shortrun )
    {
       vtk::writeDomainDecomposition( blocks );
@@ -38,13 +38,17 @@
 #include "pde/sweeps/JacobiFixedStencil.h"
 #include "pde/sweeps/Jacobi.h"
 
+#include "simd/RuntimeDispatch.h"
+
 #include "stencil/D2Q5.h"
 
 #include "timeloop/SweepTimeloop.h"
 
 #include "vtk/VTKOutput.h"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace walberla {
 
@@ -120,6 +124,74 @@ void clearField( const shared_ptr< StructuredBlockStorage > & blocks, const Bloc
 
 
 
+// One sweep of every multi-versioned JacobiFixedStencil kernel supported by the CPU must reproduce the sweep compiled
+// for the default instruction set up to rounding (FMA contraction may change the last bits of each update).
+void testInstructionSets( const shared_ptr< StructuredBlockStorage > & blocks, const BlockDataID & fId, const std::vector< real_t > & weights )
+{
+   std::vector< BlockDataID > uIds;
+
+   for( int is = int( simd::DEFAULT ); is <= int( simd::AVX512 ); ++is )
+   {
+      const simd::InstructionSet instructionSet = static_cast< simd::InstructionSet >( is );
+
+      BlockDataID srcId = field::addToStorage< PdeField_T >( blocks, "u (src, " + simd::instructionSetToString( instructionSet ) + ")", real_t(0), field::zyxf, uint_t(1) );
+      BlockDataID dstId = field::addToStorage< PdeField_T >( blocks, "u (dst, " + simd::instructionSetToString( instructionSet ) + ")", real_t(0), field::zyxf, uint_t(1) );
+
+      for( auto block = blocks->begin(); block != blocks->end(); ++block )
+      {
+         PdeField_T * src = block->getData< PdeField_T >( srcId );
+         CellInterval xyz = src->xyzSizeWithGhostLayer();
+         for( auto cell = xyz.begin(); cell != xyz.end(); ++cell )
+         {
+            const Vector3< real_t > p = blocks->getBlockLocalCellCenter( *block, *cell );
+            src->get( *cell ) = std::sin( real_t(2) * math::PI * p[0] ) * std::sinh( real_t(2) * math::PI * p[1] );
+         }
+      }
+
+      pde::JacobiFixedStencil< Stencil_T > sweep( srcId, dstId, fId, weights );
+      sweep.setInstructionSet( instructionSet );
+      WALBERLA_CHECK_EQUAL( sweep.getInstructionSet(), simd::supportedInstructionSet( instructionSet ) );
+
+      for( auto block = blocks->begin(); block != blocks->end(); ++block )
+         sweep( block.get() );
+
+      uIds.push_back( srcId );
+   }
+
+   // the initial u is the analytical solution, which also bounds the magnitude of every term of the update
+   for( auto block = blocks->begin(); block != blocks->end(); ++block )
+   {
+      const PdeField_T * f         = block->getData< PdeField_T >( fId );
+      const PdeField_T * reference = block->getData< PdeField_T >( uIds.front() );
+
+      for( auto id = uIds.begin() + 1; id != uIds.end(); ++id )
+      {
+         const PdeField_T * u = block->getData< PdeField_T >( *id );
+
+         CellInterval xyz = u->xyzSize();
+         for( auto cell = xyz.begin(); cell != xyz.end(); ++cell )
+         {
+            const Vector3< real_t > p = blocks->getBlockLocalCellCenter( *block, *cell );
+            const real_t uMax = std::fabs( std::sinh( real_t(2) * math::PI * ( p[1] + blocks->dy() ) ) );
+
+            real_t terms = std::fabs( f->get( *cell ) );
+            for( auto dir = Stencil_T::beginNoCenter(); dir != Stencil_T::end(); ++dir )
+               terms += std::fabs( weights[ dir.toIdx() ] ) * uMax;
+
+            const real_t tolerance = real_t(16) * std::numeric_limits< real_t >::epsilon() * terms / weights[ Stencil_T::idx[ stencil::C ] ];
+
+            WALBERLA_CHECK_LESS_EQUAL( std::fabs( u->get( *cell ) - reference->get( *cell ) ), tolerance,
+                                       "cell " << *cell << ", " << simd::instructionSetToString( static_cast< simd::InstructionSet >( std::distance( uIds.begin(), id ) ) ) );
+         }
+      }
+   }
+
+   for( auto id = uIds.begin(); id != uIds.end(); ++id )
+      blocks->clearBlockData( *id );
+}
+
+
+
 int main( int argc, char** argv )
 {
    debug::enterTestMode();
@@ -180,6 +252,8 @@ int main( int argc, char** argv )
                                                          real_c(1e-6), uint_t(100) ), "Jacobi iteration" );
 
    timeloop.run();
+
+   testInstructionSets( blocks, fId, weights );
    
    // rerun the test with a stencil field
    
@@ -21,11 +21,14 @@
 #include "pe/Materials.h"
 #include "pe/rigidbody/Sphere.h"
 #include "pe/Types.h"
+#include "pe/rigidbody/BodyPool.h"
 #include "pe/rigidbody/BodyStorage.h"
 #include "core/DataTypes.h"
 
 #include "core/debug/TestSubsystem.h"
 
+#include <cstdlib>
+
 using namespace walberla::pe;
 
 class Body1 : public Sphere {
@@ -89,4 +92,39 @@ int main( int argc, char** argv )
 
     WALBERLA_CHECK_EQUAL(Body1::refCount, 0);
     WALBERLA_CHECK_EQUAL(Body2::refCount, 0);
+
+    // spheres are allocated contiguously from the BodyPool, freed memory is reused
+    {
+        auto & pool = BodyPool<Sphere>::instance();
+        const auto inUse = pool.inUse();
+
+        BodyStorage storage;
+        auto sp1 = std::make_unique<Sphere>(5, 5, Vec3(0,0,0), Vec3(0,0,0), Quat(), 1, iron, false, true, false);
+        auto sp2 = std::make_unique<Sphere>(6, 6, Vec3(0,0,0), Vec3(0,0,0), Quat(), 1, iron, false, true, false);
+        WALBERLA_CHECK_EQUAL(pool.inUse(), inUse + 2);
+        WALBERLA_CHECK_EQUAL(std::abs(reinterpret_cast<char*>(sp2.get()) - reinterpret_cast<char*>(sp1.get())) % std::ptrdiff_t(sizeof(Sphere)), 0);
+
+        auto sp2Addr = sp2.get();
+        storage.add(std::move(sp1));
+        storage.add(std::move(sp2));
+        storage.remove(sp2Addr);
+        WALBERLA_CHECK_EQUAL(pool.inUse(), inUse + 1);
+
+        auto sp3 = std::make_unique<Sphere>(7, 7, Vec3(0,0,0), Vec3(0,0,0), Quat(), 1, iron, false, true, false);
+        WALBERLA_CHECK_EQUAL(sp3.get(), sp2Addr);
+    }
+
+    // chunks without allocated bodies are returned to the system
+    {
+        auto & pool = BodyPool<Sphere>::instance();
+        WALBERLA_CHECK_EQUAL(pool.inUse(), 0);
+        WALBERLA_CHECK_GREATER(pool.capacity(), 0);
+        WALBERLA_CHECK_GREATER(pool.trim(), 0);
+        WALBERLA_CHECK_EQUAL(pool.capacity(), 0);
+
+        auto sp = std::make_unique<Sphere>(8, 8, Vec3(0,0,0), Vec3(0,0,0), Quat(), 1, iron, false, true, false);
+        WALBERLA_CHECK_EQUAL(pool.inUse(), 1);
+        WALBERLA_CHECK_EQUAL(pool.trim(), 0);
+        WALBERLA_CHECK_GREATER(pool.capacity(), 0);
+    }
 }
@@ -0,0 +1,151 @@
+//======================================================================================================================
+//
+//  This file is part of waLBerla. waLBerla is free software: you can
+//  redistribute it and/or modify it under the terms of the GNU General Public
+//  License as published by the Free Software Foundation, either version 3 of
+//  the License, or (at your option) any later version.
+//
+//  waLBerla is distributed in the hope that it will be useful, but WITHOUT
+//  ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+//  FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+//  for more details.
+//
+//  You should have received a copy of the GNU General Public License along
+//  with waLBerla (see COPYING.txt). If not, see <http://www.gnu.org/licenses/>.
+//
+//! \file DEM.cpp
+//
+//======================================================================================================================
+
+#include "pe/basic.h"
+
+#include "blockforest/all.h"
+#include "core/all.h"
+#include "domain_decomposition/all.h"
+
+#include "core/debug/TestSubsystem.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace walberla {
+using namespace walberla::pe;
+
+typedef boost::tuple<Sphere, Plane> BodyTuple ;
+
+struct BodyData
+{
+   BodyData( BodyID body )
+      : uid_( body->getID() ), pos_( body->getPosition() ), v_( body->getLinearVel() ), w_( body->getAngularVel() ),
+        rot_( body->getRotation() ), awake_( body->isAwake() ) {}
+
+   walberla::id_t uid_;
+   Vec3 pos_;
+   Vec3 v_;
+   Vec3 w_;
+   Mat3 rot_;
+   bool awake_;
+};
+
+bool operator<( const BodyData & a, const BodyData & b ) { return a.uid_ < b.uid_; }
+
+shared_ptr< StructuredBlockForest > createForest()
+{
+   return blockforest::createUniformBlockGrid(
+            math::AABB(0,0,0,10,10,10),
+            uint_c( 1), uint_c( 1), uint_c( 1), // number of blocks in x,y,z direction
+            uint_c( 1), uint_c( 1), uint_c( 1), // how many cells per block (x,y,z)
+            true,                               // max blocks per process
+            false, false, false,                // no periodicity
+            false);
+}
+
+std::vector< BodyData > localBodies( const shared_ptr< StructuredBlockForest > & forest, const BlockDataID & storageID )
+{
+   std::vector< BodyData > result;
+   for( auto it = forest->begin(); it != forest->end(); ++it )
+   {
+      Storage * storage = it->getData< Storage >( storageID );
+      BodyStorage & localStorage = (*storage)[0];
+      for( auto body = localStorage.begin(); body != localStorage.end(); ++body )
+      {
+         WALBERLA_CHECK_EQUAL( body->getForce(), Vec3(0) );
+         WALBERLA_CHECK_EQUAL( body->getTorque(), Vec3(0) );
+         result.emplace_back( body.getBodyID() );
+      }
+   }
+   std::sort( result.begin(), result.end() );
+   return result;
+}
+
+/// A layer of 10x10 spheres resting on a plane, every sphere overlaps with its neighbors. All plane contacts share the
+/// plane, hence only 64 of them can be colored and the others are resolved sequentially after the colors.
+std::vector< BodyData > simContactColoring( const bool coloring, const uint_t steps )
+{
+   shared_ptr<BodyStorage> globalStorage = make_shared<BodyStorage>();
+
+   shared_ptr< StructuredBlockForest > forest = createForest();
+
+   auto storageID = forest->addBlockData(createStorageDataHandling<BodyTuple>(), "Storage");
+   auto ccdID     = forest->addBlockData(ccd::createHashGridsDataHandling( globalStorage, storageID ), "CCD");
+   auto fcdID     = forest->addBlockData(fcd::createGenericFCDDataHandling<BodyTuple, fcd::AnalyticCollideFunctor>(), "FCD");
+
+   cr::DEM dem( globalStorage, forest->getBlockStoragePointer(), storageID, ccdID, fcdID );
+   WALBERLA_CHECK( !dem.getForceContactColoring() );
+   dem.setForceContactColoring( coloring );
+   dem.setGlobalLinearAcceleration( Vec3( 0, 0, real_t(-1) ) );
+
+   pe::createPlane( *globalStorage, 0, Vec3(0, 0, 1), Vec3(5, 5, 0) );
+
+   walberla::id_t uid = 0;
+   for( int y = 0; y < 10; ++y )
+      for( int x = 0; x < 10; ++x )
+      {
+         SphereID sp = pe::createSphere( *globalStorage, forest->getBlockStorage(), storageID, ++uid,
+                                         Vec3( real_t(0.5) + real_c(x) * real_t(0.99), real_t(0.5) + real_c(y) * real_t(0.99), real_t(0.49) ), real_t(0.5) );
+         WALBERLA_CHECK_NOT_NULLPTR( sp );
+      }
+
+   dem.timestep( real_t(0.001) );
+   WALBERLA_CHECK_EQUAL( dem.getNumberOfContactsTreated(), 100 + 2 * 10 * 9 );
+
+   for( uint_t i = 1; i < steps; ++i )
+      dem.timestep( real_t(0.001) );
+
+   return localBodies( forest, storageID );
+}
+
+void checkEqual( const std::vector< BodyData > & a, const std::vector< BodyData > & b )
+{
+   WALBERLA_CHECK_EQUAL( a.size(), b.size() );
+   for( size_t i = 0; i < a.size(); ++i )
+   {
+      WALBERLA_CHECK_EQUAL( a[i].uid_, b[i].uid_ );
+      WALBERLA_CHECK_FLOAT_EQUAL( a[i].pos_, b[i].pos_, "uid: " << a[i].uid_ );
+      WALBERLA_CHECK_FLOAT_EQUAL( a[i].v_, b[i].v_, "uid: " << a[i].uid_ );
+      WALBERLA_CHECK_FLOAT_EQUAL( a[i].w_, b[i].w_, "uid: " << a[i].uid_ );
+      WALBERLA_CHECK_FLOAT_EQUAL( a[i].rot_, b[i].rot_, "uid: " << a[i].uid_ );
+      WALBERLA_CHECK_EQUAL( a[i].awake_, b[i].awake_, "uid: " << a[i].uid_ );
+   }
+}
+
+int main( int argc, char** argv )
+{
+   walberla::debug::enterTestMode();
+   walberla::MPIManager::instance()->initializeMPI( &argc, &argv );
+
+   SetBodyTypeIDs<BodyTuple>::execute();
+
+   const uint_t steps = 200;
+
+   WALBERLA_LOG_INFO( "contact coloring" );
+   checkEqual( simContactColoring( true, steps ), simContactColoring( false, steps ) );
+
+   return EXIT_SUCCESS;
+}
+} // namespace walberla
+
+int main( int argc, char* argv[] )
+{
+  return walberla::main( argc, argv );
+}
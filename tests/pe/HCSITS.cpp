@@ -119,6 +119,106 @@ void speedLimiterTest(cr::HCSITS& cr, SphereID sp)
    WALBERLA_CHECK_FLOAT_EQUAL( sp->getLinearVel(), Vec3(0,0,real_t(0.44)) );
 }
 
+// Pyramid of five spheres on a plane: every body has several contacts, hence the iteration schemes relax the contacts
+// in different orders and only agree once the iteration has converged.
+void multiContactTest()
+{
+   typedef cr::HardContactSemiImplicitTimesteppingSolvers HCSITS;
+
+   shared_ptr<BodyStorage> globalBodyStorage = make_shared<BodyStorage>();
+
+   shared_ptr< StructuredBlockForest > forest = blockforest::createUniformBlockGrid(
+            math::AABB(0,0,0,10,10,10),
+            uint_c( 1), uint_c( 1), uint_c( 1), // number of blocks in x,y,z direction
+            uint_c( 1), uint_c( 1), uint_c( 1), // how many cells per block (x,y,z)
+            true,                               // max blocks per process
+            false, false, false,                // no periodicity
+            false);
+
+   auto storageID           = forest->addBlockData(createStorageDataHandling<BodyTuple>(), "Storage");
+   auto hccdID              = forest->addBlockData(ccd::createHashGridsDataHandling( globalBodyStorage, storageID ), "HCCD");
+   auto fcdID               = forest->addBlockData(fcd::createGenericFCDDataHandling<BodyTuple, fcd::AnalyticCollideFunctor>(), "FCD");
+   cr::HCSITS cr(globalBodyStorage, forest->getBlockStoragePointer(), storageID, hccdID, fcdID);
+   cr.setRelaxationParameter    ( real_t(0.7) );
+   cr.setErrorReductionParameter( real_t(0.5) );
+   cr.setGlobalLinearAcceleration( Vec3(0,0,-1) );
+   cr.setRelaxationModel( HCSITS::InelasticFrictionlessContact );
+
+   pe::createPlane( *globalBodyStorage, 0, Vec3(0, 0, 1), Vec3(5, 5, 5) );
+
+   // four spheres on the plane overlapping with their two neighbors, one sphere on top overlapping with all four
+   const real_t d  = real_t(0.995);
+   const real_t zt = real_t(5.99) + std::sqrt( real_t(1.99) * real_t(1.99) - real_t(2) * d * d );
+   std::vector< Vec3 > positions;
+   positions.push_back( Vec3( 5 - d, 5 - d, real_t(5.99) ) );
+   positions.push_back( Vec3( 5 + d, 5 - d, real_t(5.99) ) );
+   positions.push_back( Vec3( 5 - d, 5 + d, real_t(5.99) ) );
+   positions.push_back( Vec3( 5 + d, 5 + d, real_t(5.99) ) );
+   positions.push_back( Vec3( 5, 5, zt ) );
+
+   std::vector< Vec3 > velocities;
+   velocities.push_back( Vec3( real_t( 0.1), real_t( 0.2), real_t(-0.1) ) );
+   velocities.push_back( Vec3( real_t(-0.3), real_t( 0.1), real_t( 0.0) ) );
+   velocities.push_back( Vec3( real_t( 0.2), real_t(-0.1), real_t(-0.2) ) );
+   velocities.push_back( Vec3( real_t(-0.1), real_t(-0.2), real_t( 0.1) ) );
+   velocities.push_back( Vec3( real_t( 0.0), real_t( 0.1), real_t(-0.5) ) );
+
+   std::vector< SphereID > spheres;
+   for( size_t i = 0; i < positions.size(); ++i )
+   {
+      spheres.push_back( pe::createSphere( *globalBodyStorage, forest->getBlockStorage(), storageID, i + 1, positions[i], real_t(1) ) );
+      WALBERLA_CHECK_NOT_NULLPTR( spheres.back() );
+   }
+
+   // one time step from the same initial state, returns the resulting velocities
+   auto solve = [&]( const HCSITS::IterationScheme scheme, const size_t iterations )
+   {
+      for( size_t i = 0; i < spheres.size(); ++i )
+      {
+         spheres[i]->setPosition( positions[i] );
+         spheres[i]->setLinearVel( velocities[i] );
+         spheres[i]->setAngularVel( Vec3(0) );
+      }
+      cr.setIterationScheme( scheme );
+      cr.setMaxIterations( iterations );
+      cr.timestep( real_t(0.1) );
+      WALBERLA_CHECK_EQUAL( cr.getNumberOfContacts(), 12 );
+
+      std::vector< Vec3 > result;
+      for( size_t i = 0; i < spheres.size(); ++i )
+         result.push_back( spheres[i]->getLinearVel() );
+      return result;
+   };
+
+   auto maxDifference = []( const std::vector< Vec3 > & a, const std::vector< Vec3 > & b )
+   {
+      real_t difference( 0 );
+      for( size_t i = 0; i < a.size(); ++i )
+         difference = std::max( difference, ( a[i] - b[i] ).length() );
+      return difference;
+   };
+
+   const real_t tolerance = real_t(1e-8);
+   const std::vector< Vec3 > reference = solve( HCSITS::GaussSeidel, 1000 );
+
+   // the contacts actually changed the velocities of all spheres
+   for( size_t i = 0; i < spheres.size(); ++i )
+      WALBERLA_CHECK_GREATER( ( reference[i] - velocities[i] - Vec3( 0, 0, real_t(-0.1) ) ).length(), real_t(0.01) );
+
+   WALBERLA_LOG_PROGRESS( "Multi Contact Test: ColoredGaussSeidel");
+   WALBERLA_CHECK_LESS( maxDifference( solve( HCSITS::ColoredGaussSeidel, 1000 ), reference ), tolerance );
+
+   WALBERLA_LOG_PROGRESS( "Multi Contact Test: Jacobi");
+   cr.setJacobiWeight( real_t(0.25) );
+   const real_t jacobiError10   = maxDifference( solve( HCSITS::Jacobi, 10 ), reference );
+   const real_t jacobiError100  = maxDifference( solve( HCSITS::Jacobi, 100 ), reference );
+   const real_t jacobiError1000 = maxDifference( solve( HCSITS::Jacobi, 1000 ), reference );
+   WALBERLA_LOG_PROGRESS( "Jacobi error after 10/100/1000 iterations: " << jacobiError10 << " / " << jacobiError100 << " / " << jacobiError1000 );
+   WALBERLA_CHECK_LESS( jacobiError100, jacobiError10 );
+   WALBERLA_CHECK_LESS( jacobiError1000, jacobiError100 );
+   WALBERLA_CHECK_LESS( jacobiError1000, tolerance );
+}
+
 int main( int argc, char** argv )
 {
    walberla::debug::enterTestMode();
@@ -177,6 +277,24 @@ int main( int argc, char** argv )
    cr.setRelaxationModel( cr::HardContactSemiImplicitTimesteppingSolvers::InelasticGeneralizedMaximumDissipationContact );
    normalReactionTest(cr, sp);
 
+   // a single contact is relaxed identically by all iteration schemes
+   WALBERLA_LOG_PROGRESS( "Normal Reaction Test: ColoredGaussSeidel");
+   cr.setIterationScheme( cr::HardContactSemiImplicitTimesteppingSolvers::ColoredGaussSeidel );
+   cr.setRelaxationModel( cr::HardContactSemiImplicitTimesteppingSolvers::InelasticFrictionlessContact );
+   normalReactionTest(cr, sp);
+   cr.setRelaxationModel( cr::HardContactSemiImplicitTimesteppingSolvers::InelasticGeneralizedMaximumDissipationContact );
+   normalReactionTest(cr, sp);
+   WALBERLA_LOG_PROGRESS( "Normal Reaction Test: Jacobi");
+   cr.setIterationScheme( cr::HardContactSemiImplicitTimesteppingSolvers::Jacobi );
+   cr.setJacobiWeight( real_t(1) );
+   cr.setRelaxationModel( cr::HardContactSemiImplicitTimesteppingSolvers::InelasticFrictionlessContact );
+   normalReactionTest(cr, sp);
+   cr.setRelaxationModel( cr::HardContactSemiImplicitTimesteppingSolvers::InelasticGeneralizedMaximumDissipationContact );
+   normalReactionTest(cr, sp);
+   cr.setIterationScheme( cr::HardContactSemiImplicitTimesteppingSolvers::GaussSeidel );
+
+   multiContactTest();
+
    WALBERLA_LOG_PROGRESS("SpeedLimiter Test: InelasticFrictionlessContact");
    cr.setRelaxationModel( cr::HardContactSemiImplicitTimesteppingSolvers::InelasticFrictionlessContact );
    speedLimiterTest(cr, sp);
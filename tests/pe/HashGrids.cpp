@@ -22,6 +22,7 @@
 #include "pe/basic.h"
 #include "pe/cr/PlainIntegrator.h"
 #include "pe/ccd/SimpleCCDDataHandling.h"
+#include "pe/ccd/VerletListCCDDataHandling.h"
 
 #include "blockforest/all.h"
 #include "core/all.h"
@@ -36,6 +37,93 @@ using namespace walberla::pe;
 
 typedef boost::tuple<Sphere, Plane> BodyTuple ;
 
+/// Contacts found by the fine collision detection for the possible contacts of a coarse collision detection.
+size_t countContacts( ccd::ICCD* ccd, fcd::IFCD* fcd )
+{
+   return fcd->generateContacts( ccd->generatePossibleContacts() ).size();
+}
+
+/// Slowly moving bodies on a single block without migration: the Verlet list must be reused across many calls and
+/// only be rebuilt once a body moved more than half the skin distance.
+void verletListReuse()
+{
+   shared_ptr<BodyStorage> globalBodyStorage = make_shared<BodyStorage>();
+
+   shared_ptr< StructuredBlockForest > forest = blockforest::createUniformBlockGrid(
+            math::AABB(0,0,0,10,10,10),
+            uint_c( 1), uint_c( 1), uint_c( 1), // number of blocks in x,y,z direction
+            uint_c( 1), uint_c( 1), uint_c( 1), // how many cells per block (x,y,z)
+            true,                               // max blocks per process
+            false, false, false,                // no periodicity
+            false);
+
+   const real_t skin = real_c(0.4);
+
+   auto storageID = forest->addBlockData(createStorageDataHandling<BodyTuple>(), "Storage");
+   auto sccdID    = forest->addBlockData(ccd::createSimpleCCDDataHandling( globalBodyStorage, storageID ), "SCCD");
+   auto vccdID    = forest->addBlockData(ccd::createVerletListCCDDataHandling( globalBodyStorage, storageID, skin ), "VCCD");
+   auto fcdID     = forest->addBlockData(fcd::createGenericFCDDataHandling<BodyTuple, fcd::AnalyticCollideFunctor>(), "FCD");
+
+   pe::createPlane( *globalBodyStorage, 0, Vec3(0, 0, 1), Vec3(5, 5, 0) );
+
+   // a dense lattice of touching spheres resting on the plane, every sphere moves with a small constant velocity
+   math::seedRandomGenerator(42);
+   const real_t dv = real_c(0.005);
+   std::vector< std::pair< BodyID, Vec3 > > displacements;
+   walberla::id_t uid = 0;
+   for (int z = 0; z < 4; ++z)
+      for (int y = 0; y < 6; ++y)
+         for (int x = 0; x < 6; ++x)
+         {
+            SphereID sp = pe::createSphere( *globalBodyStorage, forest->getBlockStorage(), storageID, ++uid,
+                                            Vec3( real_c(x) + real_c(1), real_c(y) + real_c(1), real_c(z) + real_c(0.5) ), real_c(0.5) );
+            WALBERLA_CHECK_NOT_NULLPTR( sp );
+            displacements.push_back( std::make_pair( sp, Vec3( math::realRandom<real_t>(-dv, dv), math::realRandom<real_t>(-dv, dv), math::realRandom<real_t>(-dv, dv) ) ) );
+         }
+
+   // two spheres far away from the lattice with a gap of half the skin distance between them
+   SphereID sphereA = pe::createSphere( *globalBodyStorage, forest->getBlockStorage(), storageID, ++uid, Vec3( real_c(2), real_c(2), real_c(8) ), real_c(0.5) );
+   SphereID sphereB = pe::createSphere( *globalBodyStorage, forest->getBlockStorage(), storageID, ++uid, Vec3( real_c(3) + skin / real_c(2), real_c(2), real_c(8) ), real_c(0.5) );
+   WALBERLA_CHECK_NOT_NULLPTR( sphereA );
+   WALBERLA_CHECK_NOT_NULLPTR( sphereB );
+
+   IBlock & block = *forest->begin();
+   ccd::ICCD* sccd = block.getData< ccd::ICCD >( sccdID );
+   ccd::VerletListCCD* vccd = block.getData< ccd::VerletListCCD >( vccdID );
+   fcd::IFCD* fcd  = block.getData< fcd::IFCD >( fcdID );
+
+   const uint_t calls = 100;
+   for (uint_t i = 0; i < calls; ++i)
+   {
+      for (auto it = displacements.begin(); it != displacements.end(); ++it)
+         it->first->setPosition( it->first->getPosition() + it->second );
+
+      const size_t contacts = countContacts( sccd, fcd );
+      WALBERLA_CHECK_GREATER( contacts, size_t(0) );
+      WALBERLA_CHECK_EQUAL( contacts, countContacts( vccd, fcd ) );
+   }
+   WALBERLA_LOG_DETAIL_ON_ROOT("Verlet list rebuilds: " << vccd->getNumberOfRebuilds() << " in " << calls << " calls");
+   WALBERLA_CHECK_GREATER( vccd->getNumberOfRebuilds(), 1 );
+   WALBERLA_CHECK_LESS( vccd->getNumberOfRebuilds(), calls / 10 );
+
+   // the lattice is at rest now, sphere B moves towards sphere A
+   const Vec3 positionB = sphereB->getPosition();
+   const uint_t rebuilds = vccd->getNumberOfRebuilds();
+
+   // just under half the skin distance: the list is reused and A and B are still apart
+   sphereB->setPosition( positionB - Vec3( real_c(0.99) * skin / real_c(2), 0, 0 ) );
+   const size_t contacts = countContacts( sccd, fcd );
+   WALBERLA_CHECK_EQUAL( contacts, countContacts( vccd, fcd ) );
+   WALBERLA_CHECK_EQUAL( vccd->getNumberOfRebuilds(), rebuilds );
+
+   // just over half the skin distance: the list is rebuilt and the new contact between A and B is found
+   sphereB->setPosition( positionB - Vec3( real_c(1.01) * skin / real_c(2), 0, 0 ) );
+   const size_t contactsAB = countContacts( sccd, fcd );
+   WALBERLA_CHECK_EQUAL( contactsAB, contacts + 1 );
+   WALBERLA_CHECK_EQUAL( contactsAB, countContacts( vccd, fcd ) );
+   WALBERLA_CHECK_EQUAL( vccd->getNumberOfRebuilds(), rebuilds + 1 );
+}
+
 int main( int argc, char** argv )
 {
     if (argc != 2) WALBERLA_ABORT("Number of particles expected as first argument!");
@@ -65,6 +153,7 @@ int main( int argc, char** argv )
     auto storageID           = forest->addBlockData(createStorageDataHandling<BodyTuple>(), "Storage");
     auto sccdID              = forest->addBlockData(ccd::createSimpleCCDDataHandling( globalBodyStorage, storageID ), "SCCD");
     auto hccdID              = forest->addBlockData(ccd::createHashGridsDataHandling( globalBodyStorage, storageID ), "HCCD");
+    auto vccdID              = forest->addBlockData(ccd::createVerletListCCDDataHandling( globalBodyStorage, storageID, real_c(0.4) ), "VCCD");
     auto fcdID               = forest->addBlockData(fcd::createGenericFCDDataHandling<BodyTuple, fcd::AnalyticCollideFunctor>(), "FCD");
     cr::PlainIntegrator cr(globalBodyStorage, forest->getBlockStoragePointer(), storageID, nullptr);
 
@@ -90,13 +179,17 @@ int main( int argc, char** argv )
 
        ccd::ICCD* sccd = currentBlock.getData< ccd::ICCD >( sccdID );
        ccd::ICCD* hccd = currentBlock.getData< ccd::ICCD >( hccdID );
+       ccd::ICCD* vccd = currentBlock.getData< ccd::ICCD >( vccdID );
        fcd::IFCD* fcd  = currentBlock.getData< fcd::IFCD >( fcdID );
        Contacts cont1 = fcd->generateContacts( sccd->generatePossibleContacts() );
        auto tmp1 = cont1.size();
        Contacts cont2 = fcd->generateContacts( hccd->generatePossibleContacts() );
        auto tmp2 = cont2.size();
-       WALBERLA_LOG_DETAIL_ON_ROOT("tracked particles: " << sccd->getObservedBodyCount() << "/" << hccd->getObservedBodyCount());
+       Contacts cont3 = fcd->generateContacts( vccd->generatePossibleContacts() );
+       auto tmp3 = cont3.size();
+       WALBERLA_LOG_DETAIL_ON_ROOT("tracked particles: " << sccd->getObservedBodyCount() << "/" << hccd->getObservedBodyCount() << "/" << vccd->getObservedBodyCount());
        WALBERLA_CHECK_EQUAL(tmp1, tmp2);
+       WALBERLA_CHECK_EQUAL(tmp1, tmp3);
        WALBERLA_LOG_DETAIL_ON_ROOT("contacts on root: " << cont1.size());
     }
 
@@ -114,6 +207,11 @@ int main( int argc, char** argv )
                      Vec3(15,15,15), 7,
                      iron, true, false, true);
 
+#ifdef _OPENMP
+    // at least two threads, so that the hash grids use more than one thread local buffer
+    omp_set_num_threads( std::max( omp_get_max_threads(), 2 ) );
+#endif
+
     syncShadowOwners<BodyTuple>( forest->getBlockForest(), storageID);
     for (int step=0; step < 100; ++step)
     {
@@ -125,13 +223,28 @@ int main( int argc, char** argv )
 
           ccd::ICCD* sccd = currentBlock.getData< ccd::ICCD >( sccdID );
           ccd::ICCD* hccd = currentBlock.getData< ccd::ICCD >( hccdID );
+          ccd::ICCD* vccd = currentBlock.getData< ccd::ICCD >( vccdID );
           fcd::IFCD* fcd  = currentBlock.getData< fcd::IFCD >( fcdID );
           Contacts cont1 = fcd->generateContacts( sccd->generatePossibleContacts() );
           auto tmp1 = cont1.size();
+#ifdef _OPENMP
+          // called from within an active parallel region the hash grids run on a team of one thread, the buffers of
+          // the other threads must not contribute the (possibly deleted) bodies and contacts of the previous step
+          size_t tmpNested = 0;
+          #pragma omp parallel
+          {
+             #pragma omp single
+             tmpNested = fcd->generateContacts( hccd->generatePossibleContacts() ).size();
+          }
+          WALBERLA_CHECK_EQUAL(tmp1, tmpNested);
+#endif
           Contacts cont2 = fcd->generateContacts( hccd->generatePossibleContacts() );
           auto tmp2 = cont2.size();
-          WALBERLA_LOG_DETAIL_ON_ROOT("tracked particles: " << sccd->getObservedBodyCount() << "/" << hccd->getObservedBodyCount());
+          Contacts cont3 = fcd->generateContacts( vccd->generatePossibleContacts() );
+          auto tmp3 = cont3.size();
+          WALBERLA_LOG_DETAIL_ON_ROOT("tracked particles: " << sccd->getObservedBodyCount() << "/" << hccd->getObservedBodyCount() << "/" << vccd->getObservedBodyCount());
           WALBERLA_CHECK_EQUAL(tmp1, tmp2);
+          WALBERLA_CHECK_EQUAL(tmp1, tmp3);
           WALBERLA_LOG_DETAIL_ON_ROOT("contacts on root: " << cont1.size());
 
           // check for correct ordering of bodies within contacts
@@ -139,12 +252,16 @@ int main( int argc, char** argv )
           {
              WALBERLA_CHECK_LESS(cont1[i].getBody1()->getSystemID(), cont1[i].getBody2()->getSystemID());
              WALBERLA_CHECK_LESS(cont2[i].getBody1()->getSystemID(), cont2[i].getBody2()->getSystemID());
+             WALBERLA_CHECK_LESS(cont3[i].getBody1()->getSystemID(), cont3[i].getBody2()->getSystemID());
           }
        }
     }
 
     forest.reset();
 
+    WALBERLA_LOG_INFO_ON_ROOT("Verlet list reuse for slowly moving bodies");
+    verletListReuse();
+
     return EXIT_SUCCESS;
 }
 } // namespace walberla
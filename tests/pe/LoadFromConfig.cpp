@@ -70,6 +70,8 @@ int main( int argc, char ** argv )
    configure(configBlock, hcsits);
    //! [Config HCSITS]
    WALBERLA_CHECK_EQUAL( hcsits.getRelaxationModel(), cr::HCSITS::RelaxationModel::ApproximateInelasticCoulombContactByDecoupling );
+   WALBERLA_CHECK_EQUAL( hcsits.getIterationScheme(), cr::HCSITS::IterationScheme::ColoredGaussSeidel );
+   WALBERLA_CHECK_FLOAT_EQUAL( hcsits.getJacobiWeight(), real_t(0.123) );
    WALBERLA_CHECK_EQUAL( hcsits.getMaxIterations(), 123 );
    WALBERLA_CHECK_FLOAT_EQUAL( hcsits.getRelaxationParameter(), real_t(0.123) );
    WALBERLA_CHECK_FLOAT_EQUAL( hcsits.getErrorReductionParameter(), real_t(0.123) );
@@ -19,6 +19,7 @@
 //======================================================================================================================
 
 #include "pe/basic.h"
+#include "pe/synchronization/SyncSettings.h"
 #include "pe/rigidbody/UnionFactory.h"
 #include "pe/utility/GetBody.h"
 #include "pe/utility/DestroyBody.h"
@@ -46,6 +47,7 @@ int main( int argc, char** argv )
    for( int i = 1; i < argc; ++i )
    {
       if( std::strcmp( argv[i], "--syncShadowOwners" ) == 0 ) syncShadowOwners = true;
+      if( std::strcmp( argv[i], "--deltaSynchronization" ) == 0 ) pe::deltaSynchronization = true;
    }
    if (syncShadowOwners)
    {
@@ -54,6 +56,10 @@ int main( int argc, char** argv )
    {
       WALBERLA_LOG_DEVEL("running with syncNextNeighbour");
    }
+   if (pe::deltaSynchronization)
+   {
+      WALBERLA_LOG_DEVEL("running with delta synchronization");
+   }
 
    shared_ptr<BodyStorage> globalBodyStorage = make_shared<BodyStorage>();
 
@@ -108,6 +114,42 @@ int main( int argc, char** argv )
    WALBERLA_CHECK_FLOAT_EQUAL( sp->getRadius(), real_t(1.2) );
    destroyBodyBySID( *globalBodyStorage, forest->getBlockStorage(), storageID, sid );
 
+   WALBERLA_LOG_PROGRESS_ON_ROOT( " *** SPHERE AT REST *** ");
+   sp = pe::createSphere(
+            *globalBodyStorage,
+            forest->getBlockStorage(),
+            storageID,
+            999999999,
+            Vec3(real_t(4.9),2,2),
+            real_c(1.2));
+   sid = sp->getSystemID();
+   syncCall();
+   syncCall();
+   auto bytesSent = pe::synchronizationBytesSent;
+   syncCall();
+   auto bytesSentAtRest = pe::synchronizationBytesSent - bytesSent;
+   sp->setLinearVel(1,2,3);
+   bytesSent = pe::synchronizationBytesSent;
+   syncCall();
+   auto bytesSentMoving = pe::synchronizationBytesSent - bytesSent;
+   WALBERLA_CHECK_GREATER( bytesSentAtRest, 0 );
+   if (pe::deltaSynchronization)
+   {
+      WALBERLA_CHECK_LESS( bytesSentAtRest, bytesSentMoving );
+   } else
+   {
+      WALBERLA_CHECK_EQUAL( bytesSentAtRest, bytesSentMoving );
+   }
+   for (auto blockIt = forest->begin(); blockIt != forest->end(); ++blockIt)
+   {
+      for (auto bodyIt = ShadowBodyIterator::begin(*blockIt, storageID); bodyIt != ShadowBodyIterator::end(); ++bodyIt)
+      {
+         WALBERLA_CHECK_FLOAT_EQUAL( bodyIt->getLinearVel(), Vec3(1,2,3) );
+         WALBERLA_CHECK_FLOAT_EQUAL( bodyIt->getAngularVel(), Vec3(0,0,0) );
+      }
+   }
+   destroyBodyBySID( *globalBodyStorage, forest->getBlockStorage(), storageID, sid );
+
    WALBERLA_LOG_PROGRESS_ON_ROOT( " *** SPHERE AT BLOCK EDGE *** ");
    sp = pe::createSphere(
             *globalBodyStorage,
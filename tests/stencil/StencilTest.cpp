@@ -9,6 +9,8 @@
 
 #include "stencil/D3Q27.h"
 #include "stencil/D3Q19.h"
+#include "stencil/D3Q15.h"
+#include "stencil/D2Q9.h"
 #include "stencil/D2Q4.h"
 #include "stencil/D2Q5.h"
 
@@ -50,6 +52,22 @@ void directionTest()
 }
 
 
+template <typename S>
+void directionMask()
+{
+   for( uint_t d = 0; d < NR_OF_DIRECTIONS; ++d )
+   {
+      uint_t mask = 0;
+      for( uint_t i = 0; i < S::d_per_d_length[d]; ++i )
+         mask |= uint_t(1) << S::idx[ S::d_per_d[d][i] ];
+      WALBERLA_CHECK_EQUAL( mask, S::d_per_d_mask[d] );
+
+      // PDFs are sent into a direction if and only if PDFs are received from the inverse direction
+      WALBERLA_CHECK_EQUAL( S::d_per_d_mask[d] == uint_t(0), S::d_per_d_mask[ inverseDir[d] ] == uint_t(0) );
+   }
+}
+
+
 int main()
 {
    debug::enterTestMode();
@@ -61,6 +79,11 @@ int main()
 
 
    directionTest();
+
+   directionMask<D3Q27>();
+   directionMask<D3Q19>();
+   directionMask<D3Q15>();
+   directionMask<D2Q9>();
 }
 
 